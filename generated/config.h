@@ -0,0 +1,1052 @@
+#define CFG_IS_ANDROID 0
+#define USE_IS_ANDROID(...)
+#define SKIP_IS_ANDROID(...) __VA_ARGS__
+#define CFG_IS_FDPIC 0
+#define USE_IS_FDPIC(...)
+#define SKIP_IS_FDPIC(...) __VA_ARGS__
+#define CFG_BASENAME 1
+#define USE_BASENAME(...) __VA_ARGS__
+#define SKIP_BASENAME(...)
+#define CFG_CAL 1
+#define USE_CAL(...) __VA_ARGS__
+#define SKIP_CAL(...)
+#define CFG_CAT 1
+#define USE_CAT(...) __VA_ARGS__
+#define SKIP_CAT(...)
+#define CFG_CHGRP 1
+#define USE_CHGRP(...) __VA_ARGS__
+#define SKIP_CHGRP(...)
+#define CFG_CHOWN 1
+#define USE_CHOWN(...) __VA_ARGS__
+#define SKIP_CHOWN(...)
+#define CFG_CHMOD 1
+#define USE_CHMOD(...) __VA_ARGS__
+#define SKIP_CHMOD(...)
+#define CFG_CKSUM 1
+#define USE_CKSUM(...) __VA_ARGS__
+#define SKIP_CKSUM(...)
+#define CFG_CRC32 1
+#define USE_CRC32(...) __VA_ARGS__
+#define SKIP_CRC32(...)
+#define CFG_CMP 1
+#define USE_CMP(...) __VA_ARGS__
+#define SKIP_CMP(...)
+#define CFG_COMM 1
+#define USE_COMM(...) __VA_ARGS__
+#define SKIP_COMM(...)
+#define CFG_CP 1
+#define USE_CP(...) __VA_ARGS__
+#define SKIP_CP(...)
+#define CFG_MV 1
+#define USE_MV(...) __VA_ARGS__
+#define SKIP_MV(...)
+#define CFG_INSTALL 1
+#define USE_INSTALL(...) __VA_ARGS__
+#define SKIP_INSTALL(...)
+#define CFG_CPIO 1
+#define USE_CPIO(...) __VA_ARGS__
+#define SKIP_CPIO(...)
+#define CFG_CUT 1
+#define USE_CUT(...) __VA_ARGS__
+#define SKIP_CUT(...)
+#define CFG_DATE 1
+#define USE_DATE(...) __VA_ARGS__
+#define SKIP_DATE(...)
+#define CFG_DD 1
+#define USE_DD(...) __VA_ARGS__
+#define SKIP_DD(...)
+#define CFG_DF 1
+#define USE_DF(...) __VA_ARGS__
+#define SKIP_DF(...)
+#define CFG_DIRNAME 1
+#define USE_DIRNAME(...) __VA_ARGS__
+#define SKIP_DIRNAME(...)
+#define CFG_DU 1
+#define USE_DU(...) __VA_ARGS__
+#define SKIP_DU(...)
+#define CFG_ECHO 1
+#define USE_ECHO(...) __VA_ARGS__
+#define SKIP_ECHO(...)
+#define CFG_ENV 1
+#define USE_ENV(...) __VA_ARGS__
+#define SKIP_ENV(...)
+#define CFG_EXPAND 1
+#define USE_EXPAND(...) __VA_ARGS__
+#define SKIP_EXPAND(...)
+#define CFG_FALSE 1
+#define USE_FALSE(...) __VA_ARGS__
+#define SKIP_FALSE(...)
+#define CFG_FILE 1
+#define USE_FILE(...) __VA_ARGS__
+#define SKIP_FILE(...)
+#define CFG_FIND 1
+#define USE_FIND(...) __VA_ARGS__
+#define SKIP_FIND(...)
+#define CFG_FOLD 1
+#define USE_FOLD(...) __VA_ARGS__
+#define SKIP_FOLD(...)
+#define CFG_GETCONF 1
+#define USE_GETCONF(...) __VA_ARGS__
+#define SKIP_GETCONF(...)
+#define CFG_GREP 1
+#define USE_GREP(...) __VA_ARGS__
+#define SKIP_GREP(...)
+#define CFG_EGREP 1
+#define USE_EGREP(...) __VA_ARGS__
+#define SKIP_EGREP(...)
+#define CFG_FGREP 1
+#define USE_FGREP(...) __VA_ARGS__
+#define SKIP_FGREP(...)
+#define CFG_HEAD 1
+#define USE_HEAD(...) __VA_ARGS__
+#define SKIP_HEAD(...)
+#define CFG_ICONV 1
+#define USE_ICONV(...) __VA_ARGS__
+#define SKIP_ICONV(...)
+#define CFG_ID 1
+#define USE_ID(...) __VA_ARGS__
+#define SKIP_ID(...)
+#define CFG_GROUPS 1
+#define USE_GROUPS(...) __VA_ARGS__
+#define SKIP_GROUPS(...)
+#define CFG_LOGNAME 1
+#define USE_LOGNAME(...) __VA_ARGS__
+#define SKIP_LOGNAME(...)
+#define CFG_WHOAMI 1
+#define USE_WHOAMI(...) __VA_ARGS__
+#define SKIP_WHOAMI(...)
+#define CFG_KILL 1
+#define USE_KILL(...) __VA_ARGS__
+#define SKIP_KILL(...)
+#define CFG_KILLALL5 1
+#define USE_KILLALL5(...) __VA_ARGS__
+#define SKIP_KILLALL5(...)
+#define CFG_LINK 1
+#define USE_LINK(...) __VA_ARGS__
+#define SKIP_LINK(...)
+#define CFG_LN 1
+#define USE_LN(...) __VA_ARGS__
+#define SKIP_LN(...)
+#define CFG_LOGGER 1
+#define USE_LOGGER(...) __VA_ARGS__
+#define SKIP_LOGGER(...)
+#define CFG_LS 1
+#define USE_LS(...) __VA_ARGS__
+#define SKIP_LS(...)
+#define CFG_MKDIR 1
+#define USE_MKDIR(...) __VA_ARGS__
+#define SKIP_MKDIR(...)
+#define CFG_MKFIFO 1
+#define USE_MKFIFO(...) __VA_ARGS__
+#define SKIP_MKFIFO(...)
+#define CFG_NICE 1
+#define USE_NICE(...) __VA_ARGS__
+#define SKIP_NICE(...)
+#define CFG_NL 1
+#define USE_NL(...) __VA_ARGS__
+#define SKIP_NL(...)
+#define CFG_NOHUP 1
+#define USE_NOHUP(...) __VA_ARGS__
+#define SKIP_NOHUP(...)
+#define CFG_OD 1
+#define USE_OD(...) __VA_ARGS__
+#define SKIP_OD(...)
+#define CFG_PASTE 1
+#define USE_PASTE(...) __VA_ARGS__
+#define SKIP_PASTE(...)
+#define CFG_PATCH 1
+#define USE_PATCH(...) __VA_ARGS__
+#define SKIP_PATCH(...)
+#define CFG_PRINTF 1
+#define USE_PRINTF(...) __VA_ARGS__
+#define SKIP_PRINTF(...)
+#define CFG_PS 1
+#define USE_PS(...) __VA_ARGS__
+#define SKIP_PS(...)
+#define CFG_TOP 1
+#define USE_TOP(...) __VA_ARGS__
+#define SKIP_TOP(...)
+#define CFG_IOTOP 1
+#define USE_IOTOP(...) __VA_ARGS__
+#define SKIP_IOTOP(...)
+#define CFG_PGREP 1
+#define USE_PGREP(...) __VA_ARGS__
+#define SKIP_PGREP(...)
+#define CFG_PKILL 1
+#define USE_PKILL(...) __VA_ARGS__
+#define SKIP_PKILL(...)
+#define CFG_PWD 1
+#define USE_PWD(...) __VA_ARGS__
+#define SKIP_PWD(...)
+#define CFG_RENICE 1
+#define USE_RENICE(...) __VA_ARGS__
+#define SKIP_RENICE(...)
+#define CFG_RM 1
+#define USE_RM(...) __VA_ARGS__
+#define SKIP_RM(...)
+#define CFG_RMDIR 1
+#define USE_RMDIR(...) __VA_ARGS__
+#define SKIP_RMDIR(...)
+#define CFG_SED 1
+#define USE_SED(...) __VA_ARGS__
+#define SKIP_SED(...)
+#define CFG_SLEEP 1
+#define USE_SLEEP(...) __VA_ARGS__
+#define SKIP_SLEEP(...)
+#define CFG_SORT 1
+#define USE_SORT(...) __VA_ARGS__
+#define SKIP_SORT(...)
+#define CFG_SPLIT 1
+#define USE_SPLIT(...) __VA_ARGS__
+#define SKIP_SPLIT(...)
+#define CFG_STRINGS 1
+#define USE_STRINGS(...) __VA_ARGS__
+#define SKIP_STRINGS(...)
+#define CFG_TAIL 1
+#define USE_TAIL(...) __VA_ARGS__
+#define SKIP_TAIL(...)
+#define CFG_TAR 1
+#define USE_TAR(...) __VA_ARGS__
+#define SKIP_TAR(...)
+#define CFG_TEE 1
+#define USE_TEE(...) __VA_ARGS__
+#define SKIP_TEE(...)
+#define CFG_TEST 1
+#define USE_TEST(...) __VA_ARGS__
+#define SKIP_TEST(...)
+#define CFG_TEST_GLUE 1
+#define USE_TEST_GLUE(...) __VA_ARGS__
+#define SKIP_TEST_GLUE(...)
+#define CFG_TIME 1
+#define USE_TIME(...) __VA_ARGS__
+#define SKIP_TIME(...)
+#define CFG_TOUCH 1
+#define USE_TOUCH(...) __VA_ARGS__
+#define SKIP_TOUCH(...)
+#define CFG_TRUE 1
+#define USE_TRUE(...) __VA_ARGS__
+#define SKIP_TRUE(...)
+#define CFG_TSORT 1
+#define USE_TSORT(...) __VA_ARGS__
+#define SKIP_TSORT(...)
+#define CFG_TTY 1
+#define USE_TTY(...) __VA_ARGS__
+#define SKIP_TTY(...)
+#define CFG_ULIMIT 1
+#define USE_ULIMIT(...) __VA_ARGS__
+#define SKIP_ULIMIT(...)
+#define CFG_ARCH 1
+#define USE_ARCH(...) __VA_ARGS__
+#define SKIP_ARCH(...)
+#define CFG_UNAME 1
+#define USE_UNAME(...) __VA_ARGS__
+#define SKIP_UNAME(...)
+#define CFG_UNIQ 1
+#define USE_UNIQ(...) __VA_ARGS__
+#define SKIP_UNIQ(...)
+#define CFG_UNLINK 1
+#define USE_UNLINK(...) __VA_ARGS__
+#define SKIP_UNLINK(...)
+#define CFG_UUDECODE 1
+#define USE_UUDECODE(...) __VA_ARGS__
+#define SKIP_UUDECODE(...)
+#define CFG_UUENCODE 1
+#define USE_UUENCODE(...) __VA_ARGS__
+#define SKIP_UUENCODE(...)
+#define CFG_WC 1
+#define USE_WC(...) __VA_ARGS__
+#define SKIP_WC(...)
+#define CFG_WHO 1
+#define USE_WHO(...) __VA_ARGS__
+#define SKIP_WHO(...)
+#define CFG_XARGS 1
+#define USE_XARGS(...) __VA_ARGS__
+#define SKIP_XARGS(...)
+#define CFG_ARP 0
+#define USE_ARP(...)
+#define SKIP_ARP(...) __VA_ARGS__
+#define CFG_ARPING 0
+#define USE_ARPING(...)
+#define SKIP_ARPING(...) __VA_ARGS__
+#define CFG_AWK 0
+#define USE_AWK(...)
+#define SKIP_AWK(...) __VA_ARGS__
+#define CFG_BC 0
+#define USE_BC(...)
+#define SKIP_BC(...) __VA_ARGS__
+#define CFG_BOOTCHARTD 0
+#define USE_BOOTCHARTD(...)
+#define SKIP_BOOTCHARTD(...) __VA_ARGS__
+#define CFG_BRCTL 0
+#define USE_BRCTL(...)
+#define SKIP_BRCTL(...) __VA_ARGS__
+#define CFG_CHSH 0
+#define USE_CHSH(...)
+#define SKIP_CHSH(...) __VA_ARGS__
+#define CFG_CROND 0
+#define USE_CROND(...)
+#define SKIP_CROND(...) __VA_ARGS__
+#define CFG_CRONTAB 0
+#define USE_CRONTAB(...)
+#define SKIP_CRONTAB(...) __VA_ARGS__
+#define CFG_CSPLIT 0
+#define USE_CSPLIT(...)
+#define SKIP_CSPLIT(...) __VA_ARGS__
+#define CFG_DHCP 0
+#define USE_DHCP(...)
+#define SKIP_DHCP(...) __VA_ARGS__
+#define CFG_DHCP6 0
+#define USE_DHCP6(...)
+#define SKIP_DHCP6(...) __VA_ARGS__
+#define CFG_DHCPD 0
+#define USE_DHCPD(...)
+#define SKIP_DHCPD(...) __VA_ARGS__
+#define CFG_DEBUG_DHCP 0
+#define USE_DEBUG_DHCP(...)
+#define SKIP_DEBUG_DHCP(...) __VA_ARGS__
+#define CFG_DIFF 0
+#define USE_DIFF(...)
+#define SKIP_DIFF(...) __VA_ARGS__
+#define CFG_DUMPLEASES 0
+#define USE_DUMPLEASES(...)
+#define SKIP_DUMPLEASES(...) __VA_ARGS__
+#define CFG_EXPR 0
+#define USE_EXPR(...)
+#define SKIP_EXPR(...) __VA_ARGS__
+#define CFG_FDISK 0
+#define USE_FDISK(...)
+#define SKIP_FDISK(...) __VA_ARGS__
+#define CFG_FSCK 0
+#define USE_FSCK(...)
+#define SKIP_FSCK(...) __VA_ARGS__
+#define CFG_GETFATTR 0
+#define USE_GETFATTR(...)
+#define SKIP_GETFATTR(...) __VA_ARGS__
+#define CFG_GETTY 0
+#define USE_GETTY(...)
+#define SKIP_GETTY(...) __VA_ARGS__
+#define CFG_GITCOMPAT 0
+#define USE_GITCOMPAT(...)
+#define SKIP_GITCOMPAT(...) __VA_ARGS__
+#define CFG_GITCLONE 0
+#define USE_GITCLONE(...)
+#define SKIP_GITCLONE(...) __VA_ARGS__
+#define CFG_GITINIT 0
+#define USE_GITINIT(...)
+#define SKIP_GITINIT(...) __VA_ARGS__
+#define CFG_GITREMOTE 0
+#define USE_GITREMOTE(...)
+#define SKIP_GITREMOTE(...) __VA_ARGS__
+#define CFG_GITFETCH 0
+#define USE_GITFETCH(...)
+#define SKIP_GITFETCH(...) __VA_ARGS__
+#define CFG_GITCHECKOUT 0
+#define USE_GITCHECKOUT(...)
+#define SKIP_GITCHECKOUT(...) __VA_ARGS__
+#define CFG_GROUPADD 0
+#define USE_GROUPADD(...)
+#define SKIP_GROUPADD(...) __VA_ARGS__
+#define CFG_GROUPDEL 0
+#define USE_GROUPDEL(...)
+#define SKIP_GROUPDEL(...) __VA_ARGS__
+#define CFG_HEXDUMP 0
+#define USE_HEXDUMP(...)
+#define SKIP_HEXDUMP(...) __VA_ARGS__
+#define CFG_INIT 0
+#define USE_INIT(...)
+#define SKIP_INIT(...) __VA_ARGS__
+#define CFG_IP 0
+#define USE_IP(...)
+#define SKIP_IP(...) __VA_ARGS__
+#define CFG_IPCRM 0
+#define USE_IPCRM(...)
+#define SKIP_IPCRM(...) __VA_ARGS__
+#define CFG_IPCS 0
+#define USE_IPCS(...)
+#define SKIP_IPCS(...) __VA_ARGS__
+#define CFG_KLOGD 0
+#define USE_KLOGD(...)
+#define SKIP_KLOGD(...) __VA_ARGS__
+#define CFG_LAST 0
+#define USE_LAST(...)
+#define SKIP_LAST(...) __VA_ARGS__
+#define CFG_LSOF 0
+#define USE_LSOF(...)
+#define SKIP_LSOF(...) __VA_ARGS__
+#define CFG_MAN 0
+#define USE_MAN(...)
+#define SKIP_MAN(...) __VA_ARGS__
+#define CFG_MDEV 0
+#define USE_MDEV(...)
+#define SKIP_MDEV(...) __VA_ARGS__
+#define CFG_MDEV_CONF 0
+#define USE_MDEV_CONF(...)
+#define SKIP_MDEV_CONF(...) __VA_ARGS__
+#define CFG_MODPROBE 0
+#define USE_MODPROBE(...)
+#define SKIP_MODPROBE(...) __VA_ARGS__
+#define CFG_MORE 0
+#define USE_MORE(...)
+#define SKIP_MORE(...) __VA_ARGS__
+#define CFG_ROUTE 0
+#define USE_ROUTE(...)
+#define SKIP_ROUTE(...) __VA_ARGS__
+#define CFG_SH 0
+#define USE_SH(...)
+#define SKIP_SH(...) __VA_ARGS__
+#define CFG_ALIAS 0
+#define USE_ALIAS(...)
+#define SKIP_ALIAS(...) __VA_ARGS__
+#define CFG_BREAK 0
+#define USE_BREAK(...)
+#define SKIP_BREAK(...) __VA_ARGS__
+#define CFG_CD 0
+#define USE_CD(...)
+#define SKIP_CD(...) __VA_ARGS__
+#define CFG_CONTINUE 0
+#define USE_CONTINUE(...)
+#define SKIP_CONTINUE(...) __VA_ARGS__
+#define CFG_DECLARE 0
+#define USE_DECLARE(...)
+#define SKIP_DECLARE(...) __VA_ARGS__
+#define CFG_EXIT 0
+#define USE_EXIT(...)
+#define SKIP_EXIT(...) __VA_ARGS__
+#define CFG_SET 0
+#define USE_SET(...)
+#define SKIP_SET(...) __VA_ARGS__
+#define CFG_UNSET 0
+#define USE_UNSET(...)
+#define SKIP_UNSET(...) __VA_ARGS__
+#define CFG_EVAL 0
+#define USE_EVAL(...)
+#define SKIP_EVAL(...) __VA_ARGS__
+#define CFG_EXEC 0
+#define USE_EXEC(...)
+#define SKIP_EXEC(...) __VA_ARGS__
+#define CFG_EXPORT 0
+#define USE_EXPORT(...)
+#define SKIP_EXPORT(...) __VA_ARGS__
+#define CFG_JOBS 0
+#define USE_JOBS(...)
+#define SKIP_JOBS(...) __VA_ARGS__
+#define CFG_LOCAL 0
+#define USE_LOCAL(...)
+#define SKIP_LOCAL(...) __VA_ARGS__
+#define CFG_RETURN 0
+#define USE_RETURN(...)
+#define SKIP_RETURN(...) __VA_ARGS__
+#define CFG_SHIFT 0
+#define USE_SHIFT(...)
+#define SKIP_SHIFT(...) __VA_ARGS__
+#define CFG_SOURCE 0
+#define USE_SOURCE(...)
+#define SKIP_SOURCE(...) __VA_ARGS__
+#define CFG_TRAP 0
+#define USE_TRAP(...)
+#define SKIP_TRAP(...) __VA_ARGS__
+#define CFG_UNALIAS 0
+#define USE_UNALIAS(...)
+#define SKIP_UNALIAS(...) __VA_ARGS__
+#define CFG_WAIT 0
+#define USE_WAIT(...)
+#define SKIP_WAIT(...) __VA_ARGS__
+#define CFG_STRACE 0
+#define USE_STRACE(...)
+#define SKIP_STRACE(...) __VA_ARGS__
+#define CFG_STTY 0
+#define USE_STTY(...)
+#define SKIP_STTY(...) __VA_ARGS__
+#define CFG_SULOGIN 0
+#define USE_SULOGIN(...)
+#define SKIP_SULOGIN(...) __VA_ARGS__
+#define CFG_SYSLOGD 0
+#define USE_SYSLOGD(...)
+#define SKIP_SYSLOGD(...) __VA_ARGS__
+#define CFG_TCPSVD 0
+#define USE_TCPSVD(...)
+#define SKIP_TCPSVD(...) __VA_ARGS__
+#define CFG_TELNET 0
+#define USE_TELNET(...)
+#define SKIP_TELNET(...) __VA_ARGS__
+#define CFG_TELNETD 0
+#define USE_TELNETD(...)
+#define SKIP_TELNETD(...) __VA_ARGS__
+#define CFG_TFTP 0
+#define USE_TFTP(...)
+#define SKIP_TFTP(...) __VA_ARGS__
+#define CFG_TFTPD 0
+#define USE_TFTPD(...)
+#define SKIP_TFTPD(...) __VA_ARGS__
+#define CFG_TR 0
+#define USE_TR(...)
+#define SKIP_TR(...) __VA_ARGS__
+#define CFG_TRACEROUTE 0
+#define USE_TRACEROUTE(...)
+#define SKIP_TRACEROUTE(...) __VA_ARGS__
+#define CFG_USERADD 0
+#define USE_USERADD(...)
+#define SKIP_USERADD(...) __VA_ARGS__
+#define CFG_USERDEL 0
+#define USE_USERDEL(...)
+#define SKIP_USERDEL(...) __VA_ARGS__
+#define CFG_VI 0
+#define USE_VI(...)
+#define SKIP_VI(...) __VA_ARGS__
+#define CFG_XZCAT 0
+#define USE_XZCAT(...)
+#define SKIP_XZCAT(...) __VA_ARGS__
+#define CFG_ACPI 1
+#define USE_ACPI(...) __VA_ARGS__
+#define SKIP_ACPI(...)
+#define CFG_ASCII 1
+#define USE_ASCII(...) __VA_ARGS__
+#define SKIP_ASCII(...)
+#define CFG_UNICODE 1
+#define USE_UNICODE(...) __VA_ARGS__
+#define SKIP_UNICODE(...)
+#define CFG_BASE64 1
+#define USE_BASE64(...) __VA_ARGS__
+#define SKIP_BASE64(...)
+#define CFG_BASE32 1
+#define USE_BASE32(...) __VA_ARGS__
+#define SKIP_BASE32(...)
+#define CFG_BLKDISCARD 1
+#define USE_BLKDISCARD(...) __VA_ARGS__
+#define SKIP_BLKDISCARD(...)
+#define CFG_BLKID 1
+#define USE_BLKID(...) __VA_ARGS__
+#define SKIP_BLKID(...)
+#define CFG_FSTYPE 1
+#define USE_FSTYPE(...) __VA_ARGS__
+#define SKIP_FSTYPE(...)
+#define CFG_BLOCKDEV 1
+#define USE_BLOCKDEV(...) __VA_ARGS__
+#define SKIP_BLOCKDEV(...)
+#define CFG_BUNZIP2 1
+#define USE_BUNZIP2(...) __VA_ARGS__
+#define SKIP_BUNZIP2(...)
+#define CFG_BZCAT 1
+#define USE_BZCAT(...) __VA_ARGS__
+#define SKIP_BZCAT(...)
+#define CFG_CHCON 0
+#define USE_CHCON(...)
+#define SKIP_CHCON(...) __VA_ARGS__
+#define CFG_CHROOT 1
+#define USE_CHROOT(...) __VA_ARGS__
+#define SKIP_CHROOT(...)
+#define CFG_CHRT 1
+#define USE_CHRT(...) __VA_ARGS__
+#define SKIP_CHRT(...)
+#define CFG_CLEAR 1
+#define USE_CLEAR(...) __VA_ARGS__
+#define SKIP_CLEAR(...)
+#define CFG_COUNT 1
+#define USE_COUNT(...) __VA_ARGS__
+#define SKIP_COUNT(...)
+#define CFG_DEVMEM 1
+#define USE_DEVMEM(...) __VA_ARGS__
+#define SKIP_DEVMEM(...)
+#define CFG_DOS2UNIX 1
+#define USE_DOS2UNIX(...) __VA_ARGS__
+#define SKIP_DOS2UNIX(...)
+#define CFG_UNIX2DOS 1
+#define USE_UNIX2DOS(...) __VA_ARGS__
+#define SKIP_UNIX2DOS(...)
+#define CFG_EJECT 1
+#define USE_EJECT(...) __VA_ARGS__
+#define SKIP_EJECT(...)
+#define CFG_FACTOR 1
+#define USE_FACTOR(...) __VA_ARGS__
+#define SKIP_FACTOR(...)
+#define CFG_FALLOCATE 1
+#define USE_FALLOCATE(...) __VA_ARGS__
+#define SKIP_FALLOCATE(...)
+#define CFG_FLOCK 1
+#define USE_FLOCK(...) __VA_ARGS__
+#define SKIP_FLOCK(...)
+#define CFG_FMT 1
+#define USE_FMT(...) __VA_ARGS__
+#define SKIP_FMT(...)
+#define CFG_FREE 1
+#define USE_FREE(...) __VA_ARGS__
+#define SKIP_FREE(...)
+#define CFG_FREERAMDISK 1
+#define USE_FREERAMDISK(...) __VA_ARGS__
+#define SKIP_FREERAMDISK(...)
+#define CFG_FSFREEZE 1
+#define USE_FSFREEZE(...) __VA_ARGS__
+#define SKIP_FSFREEZE(...)
+#define CFG_FSYNC 1
+#define USE_FSYNC(...) __VA_ARGS__
+#define SKIP_FSYNC(...)
+#define CFG_GETOPT 1
+#define USE_GETOPT(...) __VA_ARGS__
+#define SKIP_GETOPT(...)
+#define CFG_GPIODETECT 1
+#define USE_GPIODETECT(...) __VA_ARGS__
+#define SKIP_GPIODETECT(...)
+#define CFG_GPIOFIND 1
+#define USE_GPIOFIND(...) __VA_ARGS__
+#define SKIP_GPIOFIND(...)
+#define CFG_GPIOINFO 1
+#define USE_GPIOINFO(...) __VA_ARGS__
+#define SKIP_GPIOINFO(...)
+#define CFG_GPIOGET 1
+#define USE_GPIOGET(...) __VA_ARGS__
+#define SKIP_GPIOGET(...)
+#define CFG_GPIOSET 1
+#define USE_GPIOSET(...) __VA_ARGS__
+#define SKIP_GPIOSET(...)
+#define CFG_HD 1
+#define USE_HD(...) __VA_ARGS__
+#define SKIP_HD(...)
+#define CFG_HELP 1
+#define USE_HELP(...) __VA_ARGS__
+#define SKIP_HELP(...)
+#define CFG_HEXEDIT 1
+#define USE_HEXEDIT(...) __VA_ARGS__
+#define SKIP_HEXEDIT(...)
+#define CFG_HWCLOCK 1
+#define USE_HWCLOCK(...) __VA_ARGS__
+#define SKIP_HWCLOCK(...)
+#define CFG_I2CDETECT 1
+#define USE_I2CDETECT(...) __VA_ARGS__
+#define SKIP_I2CDETECT(...)
+#define CFG_I2CDUMP 1
+#define USE_I2CDUMP(...) __VA_ARGS__
+#define SKIP_I2CDUMP(...)
+#define CFG_I2CGET 1
+#define USE_I2CGET(...) __VA_ARGS__
+#define SKIP_I2CGET(...)
+#define CFG_I2CSET 1
+#define USE_I2CSET(...) __VA_ARGS__
+#define SKIP_I2CSET(...)
+#define CFG_I2CTRANSFER 1
+#define USE_I2CTRANSFER(...) __VA_ARGS__
+#define SKIP_I2CTRANSFER(...)
+#define CFG_INOTIFYD 1
+#define USE_INOTIFYD(...) __VA_ARGS__
+#define SKIP_INOTIFYD(...)
+#define CFG_INSMOD 1
+#define USE_INSMOD(...) __VA_ARGS__
+#define SKIP_INSMOD(...)
+#define CFG_IONICE 1
+#define USE_IONICE(...) __VA_ARGS__
+#define SKIP_IONICE(...)
+#define CFG_IORENICE 1
+#define USE_IORENICE(...) __VA_ARGS__
+#define SKIP_IORENICE(...)
+#define CFG_LINUX32 1
+#define USE_LINUX32(...) __VA_ARGS__
+#define SKIP_LINUX32(...)
+#define CFG_LOGIN 1
+#define USE_LOGIN(...) __VA_ARGS__
+#define SKIP_LOGIN(...)
+#define CFG_LOSETUP 1
+#define USE_LOSETUP(...) __VA_ARGS__
+#define SKIP_LOSETUP(...)
+#define CFG_LSATTR 1
+#define USE_LSATTR(...) __VA_ARGS__
+#define SKIP_LSATTR(...)
+#define CFG_CHATTR 1
+#define USE_CHATTR(...) __VA_ARGS__
+#define SKIP_CHATTR(...)
+#define CFG_LSMOD 1
+#define USE_LSMOD(...) __VA_ARGS__
+#define SKIP_LSMOD(...)
+#define CFG_LSPCI 1
+#define USE_LSPCI(...) __VA_ARGS__
+#define SKIP_LSPCI(...)
+#define CFG_LSUSB 1
+#define USE_LSUSB(...) __VA_ARGS__
+#define SKIP_LSUSB(...)
+#define CFG_MAKEDEVS 1
+#define USE_MAKEDEVS(...) __VA_ARGS__
+#define SKIP_MAKEDEVS(...)
+#define CFG_MCOOKIE 1
+#define USE_MCOOKIE(...) __VA_ARGS__
+#define SKIP_MCOOKIE(...)
+#define CFG_MEMEATER 1
+#define USE_MEMEATER(...) __VA_ARGS__
+#define SKIP_MEMEATER(...)
+#define CFG_MIX 1
+#define USE_MIX(...) __VA_ARGS__
+#define SKIP_MIX(...)
+#define CFG_MKPASSWD 1
+#define USE_MKPASSWD(...) __VA_ARGS__
+#define SKIP_MKPASSWD(...)
+#define CFG_MKSWAP 1
+#define USE_MKSWAP(...) __VA_ARGS__
+#define SKIP_MKSWAP(...)
+#define CFG_MODINFO 1
+#define USE_MODINFO(...) __VA_ARGS__
+#define SKIP_MODINFO(...)
+#define CFG_MOUNTPOINT 1
+#define USE_MOUNTPOINT(...) __VA_ARGS__
+#define SKIP_MOUNTPOINT(...)
+#define CFG_NBD_CLIENT 1
+#define USE_NBD_CLIENT(...) __VA_ARGS__
+#define SKIP_NBD_CLIENT(...)
+#define CFG_NBD_SERVER 1
+#define USE_NBD_SERVER(...) __VA_ARGS__
+#define SKIP_NBD_SERVER(...)
+#define CFG_NOLOGIN 1
+#define USE_NOLOGIN(...) __VA_ARGS__
+#define SKIP_NOLOGIN(...)
+#define CFG_UNSHARE 1
+#define USE_UNSHARE(...) __VA_ARGS__
+#define SKIP_UNSHARE(...)
+#define CFG_NSENTER 1
+#define USE_NSENTER(...) __VA_ARGS__
+#define SKIP_NSENTER(...)
+#define CFG_ONEIT 1
+#define USE_ONEIT(...) __VA_ARGS__
+#define SKIP_ONEIT(...)
+#define CFG_OPENVT 1
+#define USE_OPENVT(...) __VA_ARGS__
+#define SKIP_OPENVT(...)
+#define CFG_CHVT 1
+#define USE_CHVT(...) __VA_ARGS__
+#define SKIP_CHVT(...)
+#define CFG_DEALLOCVT 1
+#define USE_DEALLOCVT(...) __VA_ARGS__
+#define SKIP_DEALLOCVT(...)
+#define CFG_PARTPROBE 1
+#define USE_PARTPROBE(...) __VA_ARGS__
+#define SKIP_PARTPROBE(...)
+#define CFG_PIVOT_ROOT 1
+#define USE_PIVOT_ROOT(...) __VA_ARGS__
+#define SKIP_PIVOT_ROOT(...)
+#define CFG_PMAP 1
+#define USE_PMAP(...) __VA_ARGS__
+#define SKIP_PMAP(...)
+#define CFG_PRINTENV 1
+#define USE_PRINTENV(...) __VA_ARGS__
+#define SKIP_PRINTENV(...)
+#define CFG_PWDX 1
+#define USE_PWDX(...) __VA_ARGS__
+#define SKIP_PWDX(...)
+#define CFG_PWGEN 1
+#define USE_PWGEN(...) __VA_ARGS__
+#define SKIP_PWGEN(...)
+#define CFG_READAHEAD 1
+#define USE_READAHEAD(...) __VA_ARGS__
+#define SKIP_READAHEAD(...)
+#define CFG_READELF 1
+#define USE_READELF(...) __VA_ARGS__
+#define SKIP_READELF(...)
+#define CFG_READLINK 1
+#define USE_READLINK(...) __VA_ARGS__
+#define SKIP_READLINK(...)
+#define CFG_REALPATH 1
+#define USE_REALPATH(...) __VA_ARGS__
+#define SKIP_REALPATH(...)
+#define CFG_REBOOT 1
+#define USE_REBOOT(...) __VA_ARGS__
+#define SKIP_REBOOT(...)
+#define CFG_RESET 1
+#define USE_RESET(...) __VA_ARGS__
+#define SKIP_RESET(...)
+#define CFG_REV 1
+#define USE_REV(...) __VA_ARGS__
+#define SKIP_REV(...)
+#define CFG_RMMOD 1
+#define USE_RMMOD(...) __VA_ARGS__
+#define SKIP_RMMOD(...)
+#define CFG_RTCWAKE 1
+#define USE_RTCWAKE(...) __VA_ARGS__
+#define SKIP_RTCWAKE(...)
+#define CFG_SETFATTR 1
+#define USE_SETFATTR(...) __VA_ARGS__
+#define SKIP_SETFATTR(...)
+#define CFG_SETSID 1
+#define USE_SETSID(...) __VA_ARGS__
+#define SKIP_SETSID(...)
+#define CFG_SHA3SUM 1
+#define USE_SHA3SUM(...) __VA_ARGS__
+#define SKIP_SHA3SUM(...)
+#define CFG_SHRED 1
+#define USE_SHRED(...) __VA_ARGS__
+#define SKIP_SHRED(...)
+#define CFG_SHUF 1
+#define USE_SHUF(...) __VA_ARGS__
+#define SKIP_SHUF(...)
+#define CFG_STAT 1
+#define USE_STAT(...) __VA_ARGS__
+#define SKIP_STAT(...)
+#define CFG_SWAPOFF 1
+#define USE_SWAPOFF(...) __VA_ARGS__
+#define SKIP_SWAPOFF(...)
+#define CFG_SWAPON 1
+#define USE_SWAPON(...) __VA_ARGS__
+#define SKIP_SWAPON(...)
+#define CFG_SWITCH_ROOT 1
+#define USE_SWITCH_ROOT(...) __VA_ARGS__
+#define SKIP_SWITCH_ROOT(...)
+#define CFG_SYSCTL 1
+#define USE_SYSCTL(...) __VA_ARGS__
+#define SKIP_SYSCTL(...)
+#define CFG_TAC 1
+#define USE_TAC(...) __VA_ARGS__
+#define SKIP_TAC(...)
+#define CFG_NPROC 1
+#define USE_NPROC(...) __VA_ARGS__
+#define SKIP_NPROC(...)
+#define CFG_TASKSET 1
+#define USE_TASKSET(...) __VA_ARGS__
+#define SKIP_TASKSET(...)
+#define CFG_TIMEOUT 1
+#define USE_TIMEOUT(...) __VA_ARGS__
+#define SKIP_TIMEOUT(...)
+#define CFG_TRUNCATE 1
+#define USE_TRUNCATE(...) __VA_ARGS__
+#define SKIP_TRUNCATE(...)
+#define CFG_TS 1
+#define USE_TS(...) __VA_ARGS__
+#define SKIP_TS(...)
+#define CFG_UCLAMPSET 1
+#define USE_UCLAMPSET(...) __VA_ARGS__
+#define SKIP_UCLAMPSET(...)
+#define CFG_UPTIME 1
+#define USE_UPTIME(...) __VA_ARGS__
+#define SKIP_UPTIME(...)
+#define CFG_USLEEP 1
+#define USE_USLEEP(...) __VA_ARGS__
+#define SKIP_USLEEP(...)
+#define CFG_UUIDGEN 1
+#define USE_UUIDGEN(...) __VA_ARGS__
+#define SKIP_UUIDGEN(...)
+#define CFG_VCONFIG 1
+#define USE_VCONFIG(...) __VA_ARGS__
+#define SKIP_VCONFIG(...)
+#define CFG_VMSTAT 1
+#define USE_VMSTAT(...) __VA_ARGS__
+#define SKIP_VMSTAT(...)
+#define CFG_W 1
+#define USE_W(...) __VA_ARGS__
+#define SKIP_W(...)
+#define CFG_WATCH 1
+#define USE_WATCH(...) __VA_ARGS__
+#define SKIP_WATCH(...)
+#define CFG_WATCHDOG 1
+#define USE_WATCHDOG(...) __VA_ARGS__
+#define SKIP_WATCHDOG(...)
+#define CFG_WHICH 1
+#define USE_WHICH(...) __VA_ARGS__
+#define SKIP_WHICH(...)
+#define CFG_XXD 1
+#define USE_XXD(...) __VA_ARGS__
+#define SKIP_XXD(...)
+#define CFG_YES 1
+#define USE_YES(...) __VA_ARGS__
+#define SKIP_YES(...)
+#define CFG_FTPGET 1
+#define USE_FTPGET(...) __VA_ARGS__
+#define SKIP_FTPGET(...)
+#define CFG_FTPPUT 1
+#define USE_FTPPUT(...) __VA_ARGS__
+#define SKIP_FTPPUT(...)
+#define CFG_HOST 1
+#define USE_HOST(...) __VA_ARGS__
+#define SKIP_HOST(...)
+#define CFG_HTTPD 1
+#define USE_HTTPD(...) __VA_ARGS__
+#define SKIP_HTTPD(...)
+#define CFG_IFCONFIG 1
+#define USE_IFCONFIG(...) __VA_ARGS__
+#define SKIP_IFCONFIG(...)
+#define CFG_MICROCOM 1
+#define USE_MICROCOM(...) __VA_ARGS__
+#define SKIP_MICROCOM(...)
+#define CFG_NETCAT 1
+#define USE_NETCAT(...) __VA_ARGS__
+#define SKIP_NETCAT(...)
+#define CFG_NETSTAT 1
+#define USE_NETSTAT(...) __VA_ARGS__
+#define SKIP_NETSTAT(...)
+#define CFG_PING 1
+#define USE_PING(...) __VA_ARGS__
+#define SKIP_PING(...)
+#define CFG_RFKILL 1
+#define USE_RFKILL(...) __VA_ARGS__
+#define SKIP_RFKILL(...)
+#define CFG_SNTP 1
+#define USE_SNTP(...) __VA_ARGS__
+#define SKIP_SNTP(...)
+#define CFG_TUNCTL 1
+#define USE_TUNCTL(...) __VA_ARGS__
+#define SKIP_TUNCTL(...)
+#define CFG_WGET 1
+#define USE_WGET(...) __VA_ARGS__
+#define SKIP_WGET(...)
+#define CFG_WGET_LIBTLS 0
+#define USE_WGET_LIBTLS(...)
+#define SKIP_WGET_LIBTLS(...) __VA_ARGS__
+#define CFG_DMESG 1
+#define USE_DMESG(...) __VA_ARGS__
+#define SKIP_DMESG(...)
+#define CFG_GZIP 1
+#define USE_GZIP(...) __VA_ARGS__
+#define SKIP_GZIP(...)
+#define CFG_GUNZIP 1
+#define USE_GUNZIP(...) __VA_ARGS__
+#define SKIP_GUNZIP(...)
+#define CFG_ZCAT 1
+#define USE_ZCAT(...) __VA_ARGS__
+#define SKIP_ZCAT(...)
+#define CFG_HOSTNAME 1
+#define USE_HOSTNAME(...) __VA_ARGS__
+#define SKIP_HOSTNAME(...)
+#define CFG_DNSDOMAINNAME 1
+#define USE_DNSDOMAINNAME(...) __VA_ARGS__
+#define SKIP_DNSDOMAINNAME(...)
+#define CFG_KILLALL 1
+#define USE_KILLALL(...) __VA_ARGS__
+#define SKIP_KILLALL(...)
+#define CFG_MD5SUM 1
+#define USE_MD5SUM(...) __VA_ARGS__
+#define SKIP_MD5SUM(...)
+#define CFG_SHA1SUM 1
+#define USE_SHA1SUM(...) __VA_ARGS__
+#define SKIP_SHA1SUM(...)
+#define CFG_SHA224SUM 1
+#define USE_SHA224SUM(...) __VA_ARGS__
+#define SKIP_SHA224SUM(...)
+#define CFG_SHA256SUM 1
+#define USE_SHA256SUM(...) __VA_ARGS__
+#define SKIP_SHA256SUM(...)
+#define CFG_SHA384SUM 1
+#define USE_SHA384SUM(...) __VA_ARGS__
+#define SKIP_SHA384SUM(...)
+#define CFG_SHA512SUM 1
+#define USE_SHA512SUM(...) __VA_ARGS__
+#define SKIP_SHA512SUM(...)
+#define CFG_MKNOD 1
+#define USE_MKNOD(...) __VA_ARGS__
+#define SKIP_MKNOD(...)
+#define CFG_MKTEMP 1
+#define USE_MKTEMP(...) __VA_ARGS__
+#define SKIP_MKTEMP(...)
+#define CFG_MOUNT 1
+#define USE_MOUNT(...) __VA_ARGS__
+#define SKIP_MOUNT(...)
+#define CFG_PASSWD 0
+#define USE_PASSWD(...)
+#define SKIP_PASSWD(...) __VA_ARGS__
+#define CFG_PASSWD_SAD 0
+#define USE_PASSWD_SAD(...)
+#define SKIP_PASSWD_SAD(...) __VA_ARGS__
+#define CFG_PIDOF 1
+#define USE_PIDOF(...) __VA_ARGS__
+#define SKIP_PIDOF(...)
+#define CFG_SEQ 1
+#define USE_SEQ(...) __VA_ARGS__
+#define SKIP_SEQ(...)
+#define CFG_SU 1
+#define USE_SU(...) __VA_ARGS__
+#define SKIP_SU(...)
+#define CFG_SYNC 1
+#define USE_SYNC(...) __VA_ARGS__
+#define SKIP_SYNC(...)
+#define CFG_UMOUNT 1
+#define USE_UMOUNT(...) __VA_ARGS__
+#define SKIP_UMOUNT(...)
+#define CFG_DEMO_MANY_OPTIONS 0
+#define USE_DEMO_MANY_OPTIONS(...)
+#define SKIP_DEMO_MANY_OPTIONS(...) __VA_ARGS__
+#define CFG_DEMO_NUMBER 0
+#define USE_DEMO_NUMBER(...)
+#define SKIP_DEMO_NUMBER(...) __VA_ARGS__
+#define CFG_DEMO_SCANKEY 0
+#define USE_DEMO_SCANKEY(...)
+#define SKIP_DEMO_SCANKEY(...) __VA_ARGS__
+#define CFG_DEMO_UTF8TOWC 0
+#define USE_DEMO_UTF8TOWC(...)
+#define SKIP_DEMO_UTF8TOWC(...) __VA_ARGS__
+#define CFG_HELLO 0
+#define USE_HELLO(...)
+#define SKIP_HELLO(...) __VA_ARGS__
+#define CFG_HOSTID 0
+#define USE_HOSTID(...)
+#define SKIP_HOSTID(...) __VA_ARGS__
+#define CFG_LOGPATH 0
+#define USE_LOGPATH(...)
+#define SKIP_LOGPATH(...) __VA_ARGS__
+#define CFG_SKELETON 0
+#define USE_SKELETON(...)
+#define SKIP_SKELETON(...) __VA_ARGS__
+#define CFG_SKELETON_ALIAS 0
+#define USE_SKELETON_ALIAS(...)
+#define SKIP_SKELETON_ALIAS(...) __VA_ARGS__
+#define CFG_GETENFORCE 0
+#define USE_GETENFORCE(...)
+#define SKIP_GETENFORCE(...) __VA_ARGS__
+#define CFG_LOAD_POLICY 0
+#define USE_LOAD_POLICY(...)
+#define SKIP_LOAD_POLICY(...) __VA_ARGS__
+#define CFG_LOG 0
+#define USE_LOG(...)
+#define SKIP_LOG(...) __VA_ARGS__
+#define CFG_RESTORECON 0
+#define USE_RESTORECON(...)
+#define SKIP_RESTORECON(...) __VA_ARGS__
+#define CFG_RUNCON 0
+#define USE_RUNCON(...)
+#define SKIP_RUNCON(...) __VA_ARGS__
+#define CFG_SENDEVENT 0
+#define USE_SENDEVENT(...)
+#define SKIP_SENDEVENT(...) __VA_ARGS__
+#define CFG_SETENFORCE 0
+#define USE_SETENFORCE(...)
+#define SKIP_SETENFORCE(...) __VA_ARGS__
+#define CFG_TOYBOX 1
+#define USE_TOYBOX(...) __VA_ARGS__
+#define SKIP_TOYBOX(...)
+#define CFG_TOYBOX_SUID 1
+#define USE_TOYBOX_SUID(...) __VA_ARGS__
+#define SKIP_TOYBOX_SUID(...)
+#define CFG_TOYBOX_LSM_NONE 1
+#define USE_TOYBOX_LSM_NONE(...) __VA_ARGS__
+#define SKIP_TOYBOX_LSM_NONE(...)
+#define CFG_TOYBOX_SELINUX 0
+#define USE_TOYBOX_SELINUX(...)
+#define SKIP_TOYBOX_SELINUX(...) __VA_ARGS__
+#define CFG_TOYBOX_SMACK 0
+#define USE_TOYBOX_SMACK(...)
+#define SKIP_TOYBOX_SMACK(...) __VA_ARGS__
+#define CFG_TOYBOX_LIBCRYPTO 0
+#define USE_TOYBOX_LIBCRYPTO(...)
+#define SKIP_TOYBOX_LIBCRYPTO(...) __VA_ARGS__
+#define CFG_TOYBOX_LIBZ 0
+#define USE_TOYBOX_LIBZ(...)
+#define SKIP_TOYBOX_LIBZ(...) __VA_ARGS__
+#define CFG_TOYBOX_FLOAT 1
+#define USE_TOYBOX_FLOAT(...) __VA_ARGS__
+#define SKIP_TOYBOX_FLOAT(...)
+#define CFG_TOYBOX_HELP 1
+#define USE_TOYBOX_HELP(...) __VA_ARGS__
+#define SKIP_TOYBOX_HELP(...)
+#define CFG_TOYBOX_HELP_DASHDASH 1
+#define USE_TOYBOX_HELP_DASHDASH(...) __VA_ARGS__
+#define SKIP_TOYBOX_HELP_DASHDASH(...)
+#define CFG_TOYBOX_ZHELP 1
+#define USE_TOYBOX_ZHELP(...) __VA_ARGS__
+#define SKIP_TOYBOX_ZHELP(...)
+#define CFG_TOYBOX_FREE 0
+#define USE_TOYBOX_FREE(...)
+#define SKIP_TOYBOX_FREE(...) __VA_ARGS__
+#define CFG_TOYBOX_NORECURSE 0
+#define USE_TOYBOX_NORECURSE(...)
+#define SKIP_TOYBOX_NORECURSE(...) __VA_ARGS__
+#define CFG_TOYBOX_DEBUG 0
+#define USE_TOYBOX_DEBUG(...)
+#define SKIP_TOYBOX_DEBUG(...) __VA_ARGS__
+#define CFG_TOYBOX_UID_SYS 100
+#define CFG_TOYBOX_UID_USR 500
+#define CFG_TOYBOX_FORCE_NOMMU 0
+#define USE_TOYBOX_FORCE_NOMMU(...)
+#define SKIP_TOYBOX_FORCE_NOMMU(...) __VA_ARGS__
+#define CFG_TOYBOX_FORK 1
+#define USE_TOYBOX_FORK(...) __VA_ARGS__
+#define SKIP_TOYBOX_FORK(...)
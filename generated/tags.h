@@ -0,0 +1,150 @@
+#define CP_mode                          0
+#define _CP_mode                         (1<<0)
+#define CP_ownership                     1
+#define _CP_ownership                    (1<<1)
+#define CP_timestamps                    2
+#define _CP_timestamps                   (1<<2)
+#define CP_context                       3
+#define _CP_context                      (1<<3)
+#define CP_xattr                         4
+#define _CP_xattr                        (1<<4)
+#define DD_conv_fsync                    0
+#define _DD_conv_fsync                   (1<<0)
+#define DD_conv_noerror                  1
+#define _DD_conv_noerror                 (1<<1)
+#define DD_conv_notrunc                  2
+#define _DD_conv_notrunc                 (1<<2)
+#define DD_conv_sync                     3
+#define _DD_conv_sync                    (1<<3)
+#define DD_conv_nocreat                  4
+#define _DD_conv_nocreat                 (1<<4)
+#define DD_conv_sparse                   5
+#define _DD_conv_sparse                  (1<<5)
+#define DD_iflag_count_bytes             0
+#define _DD_iflag_count_bytes            (1<<0)
+#define DD_iflag_direct                  1
+#define _DD_iflag_direct                 (1<<1)
+#define DD_iflag_skip_bytes              2
+#define _DD_iflag_skip_bytes             (1<<2)
+#define DD_oflag_append                  0
+#define _DD_oflag_append                 (1<<0)
+#define DD_oflag_direct                  1
+#define _DD_oflag_direct                 (1<<1)
+#define DD_oflag_seek_bytes              2
+#define _DD_oflag_seek_bytes             (1<<2)
+#define PS_PID                           0
+#define _PS_PID                          (1<<0)
+#define PS_PPID                          1
+#define _PS_PPID                         (1<<1)
+#define PS_PRI                           2
+#define _PS_PRI                          (1<<2)
+#define PS_NI                            3
+#define _PS_NI                           (1<<3)
+#define PS_ADDR                          4
+#define _PS_ADDR                         (1<<4)
+#define PS_SZ                            5
+#define _PS_SZ                           (1<<5)
+#define PS_RSS                           6
+#define _PS_RSS                          (1<<6)
+#define PS_PGID                          7
+#define _PS_PGID                         (1<<7)
+#define PS_VSZ                           8
+#define _PS_VSZ                          (1<<8)
+#define PS_MAJFL                         9
+#define _PS_MAJFL                        (1<<9)
+#define PS_MINFL                         10
+#define _PS_MINFL                        (1<<10)
+#define PS_PR                            11
+#define _PS_PR                           (1<<11)
+#define PS_PSR                           12
+#define _PS_PSR                          (1<<12)
+#define PS_RTPRIO                        13
+#define _PS_RTPRIO                       (1<<13)
+#define PS_SCH                           14
+#define _PS_SCH                          (1<<14)
+#define PS_CPU                           15
+#define _PS_CPU                          (1<<15)
+#define PS_TID                           16
+#define _PS_TID                          (1<<16)
+#define PS_TCNT                          17
+#define _PS_TCNT                         (1<<17)
+#define PS_BIT                           18
+#define _PS_BIT                          (1<<18)
+#define PS_TTY                           19
+#define _PS_TTY                          (1<<19)
+#define PS_WCHAN                         20
+#define _PS_WCHAN                        (1<<20)
+#define PS_LABEL                         21
+#define _PS_LABEL                        (1<<21)
+#define PS_COMM                          22
+#define _PS_COMM                         (1<<22)
+#define PS_NAME                          23
+#define _PS_NAME                         (1<<23)
+#define PS_COMMAND                       24
+#define _PS_COMMAND                      (1<<24)
+#define PS_CMDLINE                       25
+#define _PS_CMDLINE                      (1<<25)
+#define PS_ARGS                          26
+#define _PS_ARGS                         (1<<26)
+#define PS_CMD                           27
+#define _PS_CMD                          (1<<27)
+#define PS_UID                           28
+#define _PS_UID                          (1<<28)
+#define PS_USER                          29
+#define _PS_USER                         (1<<29)
+#define PS_RUID                          30
+#define _PS_RUID                         (1<<30)
+#define PS_RUSER                         31
+#define _PS_RUSER                        (1LL<<31)
+#define PS_GID                           32
+#define _PS_GID                          (1LL<<32)
+#define PS_GROUP                         33
+#define _PS_GROUP                        (1LL<<33)
+#define PS_RGID                          34
+#define _PS_RGID                         (1LL<<34)
+#define PS_RGROUP                        35
+#define _PS_RGROUP                       (1LL<<35)
+#define PS_TIME                          36
+#define _PS_TIME                         (1LL<<36)
+#define PS_ELAPSED                       37
+#define _PS_ELAPSED                      (1LL<<37)
+#define PS_TIME_                         38
+#define _PS_TIME_                        (1LL<<38)
+#define PS_C                             39
+#define _PS_C                            (1LL<<39)
+#define PS__VSZ                          40
+#define _PS__VSZ                         (1LL<<40)
+#define PS__MEM                          41
+#define _PS__MEM                         (1LL<<41)
+#define PS__CPU                          42
+#define _PS__CPU                         (1LL<<42)
+#define PS_VIRT                          43
+#define _PS_VIRT                         (1LL<<43)
+#define PS_RES                           44
+#define _PS_RES                          (1LL<<44)
+#define PS_SHR                           45
+#define _PS_SHR                          (1LL<<45)
+#define PS_READ                          46
+#define _PS_READ                         (1LL<<46)
+#define PS_WRITE                         47
+#define _PS_WRITE                        (1LL<<47)
+#define PS_IO                            48
+#define _PS_IO                           (1LL<<48)
+#define PS_DREAD                         49
+#define _PS_DREAD                        (1LL<<49)
+#define PS_DWRITE                        50
+#define _PS_DWRITE                       (1LL<<50)
+#define PS_SWAP                          51
+#define _PS_SWAP                         (1LL<<51)
+#define PS_DIO                           52
+#define _PS_DIO                          (1LL<<52)
+#define PS_STIME                         53
+#define _PS_STIME                        (1LL<<53)
+#define PS_F                             54
+#define _PS_F                            (1LL<<54)
+#define PS_S                             55
+#define _PS_S                            (1LL<<55)
+#define PS_STAT                          56
+#define _PS_STAT                         (1LL<<56)
+#define PS_PCY                           57
+#define _PS_PCY                          (1LL<<57)
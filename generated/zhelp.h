@@ -0,0 +1,2214 @@
+#define ZHELP_LEN 88095
+static char zhelp_data[] = {
+ 0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xed,0xbd,0x5b,0x63,0x1b,0xc7
+,0xb1,0x2e,0x9a,0x57,0xcc,0xaf,0x68,0x33,0xe1,0x16,0xb0,0x8d,0x01,0x48,0x4a,0x56
+,0x1c,0x2e,0x33,0x59,0x14,0x2f,0x12,0x97,0x79,0x0b,0x01,0x5a,0xb2,0x69,0xc6,0x7b
+,0x08,0x0c,0x80,0x31,0x81,0x19,0x08,0x33,0xe0,0x45,0x51,0xf6,0x5f,0xcf,0xae,0xaf
+,0xaa,0xfa,0x32,0x20,0xed,0x78,0xad,0x73,0xd6,0x39,0xe7,0xe1,0x28,0x8e,0x44,0xce
+,0x74,0xf7,0xf4,0xb5,0xba,0xae,0x5f,0x2d,0xcb,0x64,0x9c,0x6e,0x9b,0xaa,0x78,0xbc
+,0x29,0x1e,0xcc,0x55,0x1c,0x4f,0x8b,0x7c,0x6c,0x3e,0x9b,0x38,0x9e,0xa4,0xd3,0x39
+,0xff,0x70,0x97,0x2e,0xca,0xac,0xc8,0xe9,0xe7,0xab,0xbd,0xb3,0x93,0x93,0xdd,0xd3
+,0xfd,0x6b,0x73,0xb5,0x7b,0xf1,0xf6,0xf2,0xe4,0xe0,0xb4,0xdf,0xeb,0x74,0x3a,0xd7
+,0xd7,0x51,0xf4,0x3e,0xab,0x26,0x26,0x2f,0x4c,0xb2,0x18,0x2f,0x67,0x69,0x5e,0x95
+,0x6d,0xb3,0x26,0x8d,0xae,0x99,0x72,0x52,0xdc,0x97,0x26,0xb9,0x4b,0xb2,0x69,0x72
+,0x33,0x4d,0x8d,0xb6,0x62,0xf2,0x64,0x96,0x96,0x1d,0xb3,0x3b,0x1c,0x1a,0xf9,0x6e
+,0x54,0x15,0x26,0xcb,0x07,0xd3,0xe5,0x30,0x35,0xe5,0x72,0x3c,0x4e,0xcb,0x2a,0x1d
+,0xd2,0x93,0xb2,0x4a,0xa6,0x53,0x33,0x4f,0xe8,0x13,0xa3,0x62,0x61,0xd2,0x64,0x30
+,0x31,0x83,0x62,0x36,0x4b,0xf2,0x61,0xdb,0x94,0x69,0x1a,0x4d,0xaa,0x6a,0x5e,0x6e
+,0x77,0xbb,0x53,0x7a,0x32,0x4d,0x1f,0x3b,0x79,0x5a,0x75,0xe5,0xeb,0xdd,0x51,0xf2
+,0xb1,0x33,0xa9,0x66,0xd3,0xdf,0xdb,0x66,0xd0,0xc2,0x30,0xad,0xa8,0x33,0x65,0x27
+,0x8a,0x0e,0xb3,0x45,0x59,0xb9,0x5e,0x9b,0xac,0xe4,0x5e,0x99,0x62,0x64,0x12,0xd7
+,0x4f,0xea,0xd5,0x62,0x99,0xb7,0xa9,0xe6,0x74,0x5a,0xdc,0x53,0x8f,0x6e,0x1e,0x4d
+,0x92,0x3f,0x1a,0x37,0x07,0xe8,0x77,0x35,0x49,0x2a,0xdb,0xa9,0x8e,0x39,0x29,0xa8
+,0x55,0x9d,0x54,0x7d,0x48,0x33,0x30,0x2d,0x0b,0xb3,0xcc,0x87,0x34,0x9f,0x15,0x3d
+,0xd8,0x8e,0x22,0x99,0xe5,0x46,0xa3,0x47,0x33,0x64,0xcb,0x19,0x9e,0xf8,0x66,0x91
+,0x4f,0x1f,0x5b,0x91,0x9b,0x7d,0x29,0xa2,0x2d,0xda,0x15,0xd1,0x42,0x51,0x7f,0x92
+,0x9a,0x51,0x36,0x4d,0xb9,0xeb,0x6b,0xf1,0x9a,0x99,0xa5,0x49,0x5e,0x9a,0xb2,0x1a
+,0x66,0x79,0x97,0xfe,0x2e,0x96,0x55,0xdb,0xa0,0xe9,0xb5,0x98,0x5e,0x96,0x55,0x31
+,0x2f,0xfd,0x90,0xe7,0x09,0x35,0x96,0x8f,0x69,0x2e,0x4e,0xe9,0xc1,0x22,0x1b,0x24
+,0x53,0xbf,0x8a,0x26,0x19,0x0c,0xd2,0x39,0x4d,0x90,0x41,0x19,0x5a,0xbb,0x69,0x5a
+,0x55,0xe9,0x82,0x56,0x67,0x34,0xca,0x1e,0x30,0x97,0xd1,0x6d,0x36,0x2d,0xda,0xf4
+,0xc5,0x71,0xd2,0x36,0xe3,0x0c,0x7f,0x53,0x01,0xfa,0x7b,0x4e,0x73,0x2c,0x5f,0x4d
+,0x1f,0x92,0x9b,0xc7,0x2a,0xa5,0x2d,0x31,0x9f,0x2e,0xa9,0xc9,0xdc,0x24,0xc3,0x61
+,0x56,0xd1,0x08,0x92,0x69,0xb4,0x36,0x5c,0x33,0xbc,0xec,0x43,0xfa,0x72,0x95,0xd2
+,0xd2,0x0c,0xb2,0x19,0x75,0x61,0x73,0x63,0x63,0xe3,0x45,0xc9,0x8b,0x9f,0x26,0x43
+,0x2c,0xc8,0xe6,0xc6,0xd6,0x2b,0xea,0xe5,0xfe,0x72,0x91,0xa0,0x6e,0x69,0x06,0xd4
+,0xd2,0x8d,0xaf,0x31,0x5a,0x24,0x03,0x79,0x81,0x8f,0x6a,0xc7,0x67,0x59,0xbe,0xa4
+,0x56,0x9b,0x6b,0xb3,0xb5,0x56,0xdb,0x4c,0x8a,0xe5,0x82,0x7e,0x9e,0xd0,0xcf,0x11
+,0xb6,0x41,0xf2,0x48,0xbf,0x0d,0xd7,0x5a,0x3a,0x9e,0xb4,0x34,0x4d,0x5a,0xa2,0x8d
+,0xce,0xe6,0xcc,0xec,0x98,0xd7,0x65,0xab,0xf3,0xbb,0x7f,0x56,0x8b,0x65,0x4a,0x7f
+,0xd3,0x56,0xfc,0xdd,0x52,0xce,0x4a,0x32,0x98,0x67,0x74,0x52,0x92,0x9b,0x41,0xf5
+,0x1d,0xed,0x7c,0x5e,0x18,0x5a,0xd0,0x8a,0x86,0x46,0xbd,0x9c,0xd3,0x0e,0xa1,0xf9
+,0xa1,0x0f,0x0d,0x52,0xe9,0x49,0x35,0x49,0x17,0xe8,0xdf,0x30,0xbd,0xcb,0xe8,0x19
+,0x0d,0x21,0x4e,0x64,0x39,0xa5,0x6c,0x32,0x4c,0xe6,0x34,0x65,0x65,0x14,0xdf,0xc8
+,0xe3,0x9b,0x04,0x73,0x9c,0xa5,0xf4,0x64,0x60,0xb7,0x46,0x31,0xa5,0xf9,0xd7,0x26
+,0xf8,0x6b,0x69,0x14,0x57,0xba,0x29,0xd2,0xd9,0x9c,0x66,0xbc,0x5a,0x2e,0x50,0xe3
+,0x3b,0x79,0x98,0xd2,0x1e,0x79,0xac,0x26,0x54,0xc9,0x75,0x7b,0x31,0x98,0x44,0xd1
+,0xf9,0x22,0xa3,0x35,0x9f,0xd1,0x09,0xca,0x72,0x9a,0x96,0x49,0xb2,0x18,0xde,0x27
+,0x8b,0xb4,0xc5,0xdb,0x9e,0x0e,0x13,0x76,0x50,0x52,0xd2,0x2e,0xc5,0x0f,0xf1,0xac
+,0xe3,0x6a,0x97,0x83,0x2c,0xa3,0xc9,0xcf,0xca,0xf9,0x94,0x66,0x8d,0x7f,0x35,0x03
+,0xaa,0x4e,0x73,0x8e,0xf1,0xa6,0x95,0x2b,0x7a,0x93,0x94,0xe9,0xcb,0x2d,0x9a,0xa1
+,0x61,0x46,0x84,0x22,0xbe,0xa7,0x73,0x74,0x7c,0x79,0x72,0xda,0xa3,0x5f,0x0e,0x8f
+,0x8e,0x0f,0x40,0x30,0xa2,0xe8,0x20,0x1f,0x14,0x74,0xca,0xf9,0x2c,0xf2,0x4f,0x59
+,0xae,0x15,0x31,0x3f,0xc3,0xc6,0x3e,0x3f,0x8d,0xe2,0xac,0x71,0x34,0xce,0x8b,0x45
+,0x4a,0xb4,0x25,0x8f,0x93,0xe9,0x7c,0x92,0xdc,0xa4,0x55,0x36,0xf0,0x9f,0xa6,0x21
+,0xdf,0x37,0xde,0x2f,0x92,0xb9,0xa1,0x5d,0x3e,0x5f,0xd2,0x56,0xad,0xec,0x07,0x4d
+,0x73,0x98,0x8e,0x92,0xe5,0xb4,0x32,0x7f,0x7c,0x8d,0x2f,0x6d,0xf0,0xd9,0x27,0x22
+,0x75,0x4f,0xc5,0x5b,0x61,0x77,0x5f,0xbf,0xfa,0x2f,0x76,0xf7,0xf5,0xab,0xff,0x37
+,0xba,0xcb,0x8b,0x43,0x3b,0x10,0xfd,0x2d,0x4d,0xef,0xf2,0xf0,0xf0,0xe8,0xc3,0xb5
+,0x39,0xdd,0x3d,0x41,0x6f,0x89,0x4e,0xe3,0x27,0x73,0xa5,0xcf,0xa3,0xe8,0x22,0xa5
+,0xbd,0x91,0x73,0x97,0x86,0xd9,0x22,0x1d,0x54,0xc5,0xe2,0x91,0xf6,0xde,0x02,0x87
+,0x45,0x28,0x1d,0x48,0x2b,0x37,0xba,0x48,0x67,0xc5,0x1d,0x76,0x9a,0x1c,0x08,0xd9
+,0xab,0x8d,0xdd,0x69,0x8d,0x24,0x60,0x78,0x20,0xdd,0x91,0xfb,0x78,0xe3,0x02,0xf5
+,0x52,0x4b,0x16,0x9a,0xd9,0x6c,0x3e,0xa5,0xfd,0x6b,0xe2,0xc4,0xf7,0x7b,0x7a,0x3b
+,0xcc,0xca,0x01,0xed,0x37,0x74,0xfa,0xd3,0x08,0x7d,0x2f,0xcc,0xd9,0xe1,0x61,0xef
+,0xa0,0x8f,0x9f,0xa7,0xe6,0xf8,0xe0,0xf4,0x6d,0xff,0xdd,0xb5,0xd9,0x3f,0xf8,0xee
+,0x68,0xef,0x80,0xf7,0x1a,0x17,0xb7,0x9b,0x9e,0x3b,0x4e,0x27,0x74,0x8e,0xe3,0x44
+,0x14,0x7e,0xfa,0x48,0xaf,0x88,0x1e,0xf1,0xc1,0x48,0xaa,0xa4,0xd5,0x31,0x87,0x8b
+,0x94,0x0a,0xce,0x13,0x2a,0x0e,0xe2,0x40,0xdd,0x58,0x50,0xb7,0xa2,0xd1,0x34,0x29
+,0x27,0x44,0x90,0x16,0x34,0xa1,0x54,0x95,0xde,0xe2,0x5c,0x4e,0xb3,0x11,0x55,0xa6
+,0x41,0x13,0x39,0xbf,0x4f,0x93,0x05,0xd1,0xb6,0xbb,0x94,0x8f,0x19,0xde,0x0e,0x88
+,0xd8,0x27,0xae,0xed,0x4e,0xd4,0xec,0x15,0x33,0xa1,0xb2,0xe5,0x23,0x91,0xa4,0x59
+,0x77,0xb8,0xc8,0xe8,0x8c,0x81,0x6a,0xdf,0x64,0x79,0x40,0x91,0x86,0xb8,0x0b,0xe8
+,0x1e,0x49,0x96,0x55,0x31,0xa3,0xe7,0x44,0x4f,0xa7,0x8f,0x1d,0xa2,0xd2,0x71,0xd1
+,0xe8,0x55,0xc9,0x82,0x97,0x5c,0xc6,0x6d,0x9a,0x71,0x5c,0x8c,0x46,0x74,0x78,0xda
+,0xc6,0xae,0xfd,0x06,0x11,0xfd,0x69,0x43,0xe6,0x02,0x84,0xd1,0x4e,0x1a,0x15,0x25
+,0x02,0x3f,0xae,0x26,0xbe,0x28,0x35,0x4c,0x85,0xcb,0xc6,0x19,0xf5,0xe3,0x7e,0x91
+,0x81,0x78,0x4a,0x61,0xba,0xa2,0xd0,0x69,0xd4,0xa1,0x59,0x23,0xba,0x40,0xc5,0x3e
+,0x35,0x7e,0x48,0x17,0x45,0x4c,0x03,0x98,0x1a,0x22,0x16,0x44,0x93,0x70,0x65,0xe5
+,0x61,0xfb,0x9f,0xa8,0x00,0xed,0x4a,0x2a,0x3c,0x6a,0xd0,0xe4,0xf3,0x5d,0x3d,0x98
+,0xa4,0x83,0x5b,0xde,0x88,0xb3,0x62,0x99,0xe3,0x3a,0xf6,0x53,0x80,0x3a,0xf4,0x66
+,0x40,0xcd,0x47,0x3a,0x20,0xcc,0x9c,0xf6,0x7d,0xb6,0xa4,0x2b,0x90,0xc8,0x73,0x32
+,0xcd,0xc6,0x39,0xd5,0xe3,0x3b,0x32,0xad,0xaf,0x26,0xdd,0x2a,0x9f,0xd2,0x8e,0xd9
+,0x97,0x01,0x45,0xf7,0xc4,0x44,0x50,0x07,0x4c,0x5c,0x74,0x69,0x3f,0x68,0xcf,0x4a
+,0xae,0x46,0x3b,0x8f,0xb6,0xae,0xd6,0xee,0x98,0xe6,0xf7,0xc5,0xd2,0x4c,0x12,0xda
+,0x72,0x37,0x69,0x9a,0x1b,0x22,0x61,0xf4,0x89,0x4e,0xb8,0xd9,0xb2,0x21,0x6f,0xb0
+,0xfe,0xf7,0xe7,0x07,0x72,0x4c,0xfa,0xbb,0x6f,0xf1,0xc3,0xe5,0x31,0xef,0x30,0x3a
+,0x28,0x96,0x18,0x56,0x8f,0x73,0xa2,0x7c,0xc4,0x9a,0xa4,0x53,0xee,0xff,0xe5,0xe5
+,0xd1,0x3e,0x8e,0x45,0x30,0x50,0x3a,0x27,0x09,0x35,0x5a,0xd0,0x54,0x68,0xff,0xa9
+,0xef,0x74,0xe9,0x8c,0x53,0x9c,0x90,0x4b,0x21,0xb9,0x52,0x8f,0x6e,0x64,0xba,0x97
+,0x17,0xb6,0x1c,0x86,0x24,0xbc,0x01,0x5e,0xd3,0xd4,0x1e,0x4b,0xe1,0xe3,0xdd,0x37
+,0x07,0xc7,0xbf,0x52,0x9a,0xdf,0x53,0x71,0x19,0x41,0xe3,0x4c,0x88,0x05,0xef,0xdf
+,0xca,0x34,0x47,0xcb,0xe9,0xb4,0x6d,0xee,0x92,0xe9,0x92,0x7a,0x9e,0x3e,0xe0,0x2c
+,0x63,0x27,0x60,0x8c,0x8d,0x33,0xb4,0x09,0x96,0x8b,0xa8,0x7c,0x05,0x32,0x3f,0x36
+,0x55,0x32,0x2e,0x3d,0x75,0xc1,0xb6,0xf1,0x13,0x45,0x63,0xa2,0x8f,0x13,0x03,0x76
+,0x76,0xde,0x3f,0x3a,0x3b,0x05,0x01,0x79,0x73,0x7c,0xb6,0xf7,0xad,0x9d,0xa3,0x3d
+,0xf0,0x4c,0x59,0x31,0xa8,0xa6,0xcd,0xb2,0x85,0x89,0x60,0xee,0x6b,0x9a,0x31,0x6b
+,0x16,0x4e,0x09,0xb8,0x19,0xda,0xc9,0x8b,0x82,0xd8,0x99,0xb4,0x22,0x4a,0x82,0x5b
+,0x9b,0xfa,0xa2,0x8f,0xef,0x83,0xc7,0xbc,0x59,0xe9,0xf9,0x58,0x8a,0xbf,0x5d,0x29
+,0x4e,0x8f,0xcb,0x52,0x1e,0x07,0xdb,0x44,0x5e,0xdc,0x94,0x9f,0xf8,0x85,0x7c,0x59
+,0x9f,0x97,0xfc,0xdc,0xbc,0xf9,0xbe,0x7f,0xd0,0xe3,0xaf,0xd4,0xde,0xa2,0xb9,0x4f
+,0xd2,0x9c,0xdd,0x7c,0xf4,0x02,0x14,0xfc,0xab,0xcd,0xad,0x18,0x9c,0x89,0xa5,0x2d
+,0x5a,0x98,0xde,0x3e,0x57,0xda,0x11,0xa0,0x61,0x3a,0x27,0x2a,0x4a,0x57,0xf0,0xb0
+,0xe5,0x6b,0xbc,0x7e,0xf5,0x5c,0x1d,0xe6,0x7b,0x74,0xa4,0x89,0x1f,0x69,0x32,0xc1
+,0x70,0x9f,0xef,0x01,0x26,0x2b,0x31,0xbd,0x83,0xbd,0xfe,0xd9,0x45,0xcf,0xcd,0x19
+,0xd7,0xa0,0xb7,0x23,0xe2,0xa0,0x26,0x37,0xcb,0x51,0xd9,0x38,0xc4,0x4f,0x86,0x7e
+,0x1c,0xf1,0xad,0x12,0x2f,0x52,0x94,0x9b,0x57,0x44,0x8b,0x79,0x32,0x89,0xaf,0xab
+,0x98,0xc9,0xa2,0xe5,0xa7,0x93,0xec,0x56,0x7c,0x99,0x7f,0xca,0xe6,0xb8,0x9e,0x07
+,0xa3,0xea,0xf6,0x0e,0x47,0xe2,0x67,0x73,0x5a,0xbb,0xec,0x70,0x99,0x11,0xe5,0x4c
+,0xcb,0xd2,0xae,0x33,0x1f,0x05,0xda,0x76,0xf4,0x4f,0xe7,0xe6,0x13,0x9d,0x39,0x2a
+,0x40,0x0f,0xf0,0x7b,0xcb,0x13,0x61,0x70,0x18,0x44,0x13,0xf9,0x31,0x6d,0x96,0x0e
+,0x5d,0x3c,0xd4,0x8f,0xd1,0xa2,0x98,0x09,0x2b,0x6a,0xb2,0x11,0xae,0x33,0x69,0x4c
+,0x5a,0xc6,0xf1,0x19,0x34,0x0e,0x41,0x44,0xec,0x85,0x48,0x74,0x42,0x58,0x56,0x90
+,0x21,0x79,0x33,0x74,0x1d,0x62,0xae,0x97,0x9a,0x41,0x67,0x89,0xd2,0xa6,0x65,0xfe
+,0xa2,0x22,0xda,0xc0,0x73,0x49,0x3d,0x6b,0xd3,0x5c,0x11,0x7f,0xc2,0xe7,0x33,0x1b
+,0x13,0x59,0x06,0x81,0xfc,0xb9,0x11,0x0c,0xe8,0x54,0xf6,0x46,0x09,0x22,0x5c,0xe0
+,0x26,0x70,0xc7,0x22,0x5f,0xce,0x6e,0x88,0x28,0xd2,0xc1,0xdf,0x3b,0xbf,0x2c,0xa9
+,0xde,0x6d,0xe3,0xdb,0x34,0x9d,0x53,0xcb,0x7c,0xf2,0x64,0x06,0xe2,0x01,0x93,0x88
+,0xb8,0xc2,0xdd,0x42,0xe7,0x0c,0x94,0xbe,0x05,0x4e,0xac,0x4f,0x0c,0x22,0x15,0xad
+,0xd2,0x31,0xed,0x6d,0xda,0xc4,0x77,0x8d,0xef,0xd2,0xc5,0x4d,0x51,0xfa,0x79,0xff
+,0x44,0x3b,0xe6,0x3f,0x31,0xd9,0x6e,0x1a,0x3a,0xe6,0xb2,0x4c,0x7f,0x75,0x02,0xff
+,0x6b,0x03,0xb4,0x1d,0x03,0xbf,0x7f,0x15,0x4f,0xa8,0x53,0x57,0x57,0xfb,0xbb,0xdf
+,0x5f,0x9b,0x93,0xb3,0x53,0x5c,0xc3,0xdf,0x1f,0xec,0x5e,0x5c,0x5b,0x1a,0x99,0xa0
+,0x18,0xcd,0x73,0xb2,0xe8,0xa8,0xac,0x57,0x10,0xfb,0x68,0x79,0x02,0x62,0xec,0x51
+,0x0a,0x12,0xce,0x94,0xee,0x89,0xbc,0x9a,0x30,0x2b,0x0c,0xba,0x5d,0xce,0x89,0x3b
+,0x1f,0x65,0x34,0xac,0xc7,0x14,0x95,0xb9,0x6e,0x75,0x5f,0x13,0x14,0xb5,0xb2,0xfd
+,0x82,0xde,0x36,0xd4,0x0a,0xcf,0x75,0x58,0x6f,0x82,0xfb,0x3d,0xa8,0x39,0xc9,0xc6
+,0x13,0xba,0x5e,0x26,0x54,0x1b,0xbc,0x3c,0xc8,0x27,0xcd,0xd2,0x6a,0xdd,0x28,0x9e
+,0x34,0xf6,0x0b,0xec,0x14,0x57,0x9e,0xa6,0x97,0x2a,0xf8,0x29,0xc0,0xca,0x10,0x97
+,0x74,0x57,0x5b,0x9a,0xbd,0x62,0x4e,0xd4,0x79,0x40,0xb3,0x48,0x67,0x9d,0xae,0x78
+,0xda,0xeb,0x4f,0xd6,0xc6,0x1c,0x3d,0x59,0x92,0x36,0xf1,0x04,0x54,0xd1,0xef,0xfb
+,0x0e,0x49,0x99,0x81,0x70,0x06,0xde,0xc0,0x94,0x8f,0xc4,0x8e,0x3d,0xce,0x78,0xac
+,0x5a,0x28,0x8a,0xd3,0xc6,0x49,0xb2,0xb8,0x15,0x0a,0x9b,0xa7,0xf7,0x53,0xb0,0xe8
+,0x7c,0x25,0xfc,0xc1,0x33,0xfb,0xc9,0x4d,0x09,0x06,0xfd,0x6f,0x47,0x51,0xbc,0x6c
+,0x70,0x0f,0xb1,0x12,0x4c,0x43,0x12,0xac,0x13,0x73,0x34,0xcd,0x92,0x04,0xd5,0x16
+,0x76,0xa1,0x65,0xd8,0xe9,0x6b,0x3c,0xcd,0x38,0xa7,0x9e,0x19,0x45,0x4b,0x29,0xdd
+,0xb2,0x73,0x10,0xa0,0x8f,0xcb,0x34,0x87,0xcc,0xc2,0x5f,0x3c,0x89,0x45,0xba,0x6b
+,0x60,0xca,0x56,0xd9,0x7d,0x3a,0x08,0x7f,0xde,0xdc,0xfa,0x63,0x4b,0xc4,0xbb,0xbf
+,0x71,0x49,0x53,0x30,0x4f,0xb1,0xfa,0x9d,0xd2,0xcd,0x31,0xdd,0x6a,0xd5,0x82,0xa6
+,0xf9,0x02,0x24,0xe7,0xcb,0x9d,0xdd,0x64,0xb0,0x3f,0xcc,0x7e,0x2e,0x7b,0x55,0x7f
+,0x89,0x27,0x73,0x73,0x7e,0x71,0xf6,0x1f,0x47,0xd0,0x2d,0xc4,0x77,0xe6,0xbb,0x83
+,0x8b,0x1e,0xdd,0x46,0xf5,0xe5,0x20,0x76,0x65,0x2c,0xd4,0xc5,0xa0,0xad,0xec,0x86
+,0x24,0xbb,0x52,0xee,0xe6,0x63,0x12,0xf3,0x1e,0xe4,0x95,0x5c,0xd9,0x98,0xce,0x0b
+,0x22,0x85,0xc4,0xfd,0x94,0x74,0x09,0xcc,0x99,0x90,0x56,0x2a,0x27,0x93,0x5c,0x49
+,0x8c,0xe1,0xcf,0x44,0x72,0xf5,0x50,0x60,0xa6,0x56,0x0a,0xa8,0x8c,0xdd,0x1d,0xa7
+,0x79,0x2a,0x02,0xa7,0x2d,0x1b,0x9d,0xb1,0xb8,0x45,0xd4,0x7a,0x3b,0x32,0xe6,0x45
+,0xfc,0xc2,0x28,0xf7,0xeb,0x3b,0x85,0xe7,0x5f,0xbe,0x60,0xcd,0x46,0xfd,0xe1,0xce
+,0x0b,0x83,0xef,0x04,0x0f,0xa3,0x5d,0xf7,0x33,0x9a,0xdb,0x35,0xe6,0x94,0x0e,0x07
+,0xaf,0xe2,0x73,0x7f,0x12,0x2a,0x32,0x9f,0x83,0xe2,0xf1,0x65,0x69,0xcc,0x1e,0x57
+,0xd8,0x3b,0x7b,0x6f,0x9e,0xff,0x33,0xa0,0x22,0x9e,0x78,0x52,0x85,0x7d,0x63,0x7a
+,0x8f,0xf9,0x60,0xb2,0x28,0xf2,0x82,0x44,0x56,0x92,0x08,0xcc,0x72,0x4e,0xec,0x22
+,0x4d,0x25,0xff,0x19,0x72,0x83,0xc3,0xe5,0x6c,0x4e,0x85,0x0f,0xe8,0xbf,0x7c,0xb0
+,0x78,0x9c,0x83,0x30,0x3d,0xf3,0x87,0x3a,0x79,0xf0,0x50,0xe1,0x30,0x52,0xe1,0x43
+,0xfa,0x14,0x49,0x27,0x31,0xc9,0xec,0x69,0x5e,0xd2,0xdd,0x43,0x73,0xd2,0x1c,0xd0
+,0x93,0x51,0x31,0xa5,0xab,0x92,0xce,0x0a,0xfd,0x97,0x0f,0xd3,0x07,0xf0,0xa7,0x4e
+,0x10,0x09,0xfe,0x64,0xf4,0x7e,0x36,0x5b,0xf2,0x7d,0x45,0xc5,0x7f,0x36,0xe6,0x3f
+,0x48,0x8e,0xce,0x21,0x3b,0x13,0x3b,0x4b,0x4f,0x4e,0xd1,0x00,0x1f,0x0b,0xe6,0x6f
+,0x41,0x11,0x73,0xc8,0x5d,0xc6,0x9c,0xd3,0x7f,0xba,0xa4,0x93,0x8c,0x96,0x87,0xae
+,0x22,0xcc,0x4e,0xaf,0x3e,0x58,0xde,0x20,0xe1,0x68,0xe9,0xef,0x1e,0x73,0xc8,0x72
+,0x8b,0xa1,0xa5,0x3e,0xfd,0x57,0xcc,0x41,0xbf,0x30,0x35,0xae,0x31,0xd7,0xc9,0x8a
+,0xe7,0x07,0xfa,0xa3,0x78,0x96,0x2e,0xe8,0x92,0x19,0x53,0xa5,0x25,0x2d,0x0b,0x94
+,0x43,0xac,0xde,0xd1,0x86,0xbe,0xa3,0xff,0x52,0xdc,0x06,0xfe,0x08,0x8c,0x17,0xf3
+,0xee,0x80,0x8e,0x71,0x8e,0x73,0xf0,0xee,0xf8,0x1c,0x9b,0x7d,0x74,0x47,0xb4,0xf7
+,0xed,0xc5,0xd9,0xe5,0xb9,0xd1,0xbd,0xee,0xb6,0xfa,0x78,0x51,0x2c,0xb9,0x27,0x38
+,0xe2,0x4c,0x14,0x17,0x2a,0x82,0x60,0x7b,0x8f,0x1a,0xbd,0xe5,0x5c,0x88,0xfe,0x0c
+,0xea,0xa6,0x74,0xb1,0x40,0x19,0xfa,0x9d,0xbe,0x56,0x82,0xe8,0x69,0x33,0xe5,0xe3
+,0x8c,0xe6,0xec,0xb6,0xa6,0x4c,0xb9,0x07,0x93,0x49,0xdb,0x1d,0x82,0x20,0x33,0xc1
+,0x45,0x70,0x5e,0x70,0x91,0x11,0x89,0x5b,0xde,0xd8,0x55,0x82,0x2c,0xe7,0x85,0xba
+,0x09,0x51,0x96,0x77,0x0d,0xa6,0xc8,0xf1,0x05,0x0e,0x36,0x3e,0x42,0x92,0x0d,0x31
+,0x39,0x68,0x5a,0x3f,0x67,0xf5,0x65,0x4e,0xaf,0xc5,0xeb,0x66,0xfb,0x02,0x46,0xf8
+,0x37,0xb7,0x80,0x6b,0xc5,0x57,0x3c,0x5f,0xad,0xe8,0x8a,0x93,0xe8,0x95,0x17,0x95
+,0xad,0xe5,0x86,0x6d,0x6f,0xc0,0xd6,0x33,0xd7,0xf2,0x60,0x32,0x2b,0x86,0x42,0x95
+,0x4e,0xce,0xf6,0x0f,0x9e,0x2c,0x01,0x84,0xcd,0x4c,0xf8,0x8e,0x19,0x6b,0x00,0x46
+,0xe1,0x35,0x7d,0x55,0x5e,0xe3,0x32,0xb8,0x49,0x85,0x47,0xa3,0x6d,0xdb,0x16,0xe6
+,0x56,0x7e,0xa4,0x51,0x77,0x89,0x86,0xd2,0x86,0x1f,0xc8,0xa6,0xb6,0x42,0x10,0xcd
+,0xf2,0x02,0xba,0xb7,0x65,0x99,0x2e,0xda,0x21,0xd5,0xe1,0x15,0x6f,0x1b,0x47,0x4e
+,0x9b,0xac,0xc7,0xc1,0xf2,0xa7,0xd3,0x32,0x25,0x96,0x0a,0x72,0x0f,0xa4,0x4c,0xd6
+,0x25,0x12,0xab,0xd8,0x1d,0x4c,0x21,0xba,0xf2,0x55,0xbb,0xcc,0xe8,0xee,0x19,0xf3
+,0xdf,0x98,0xef,0x92,0x64,0xcf,0xdb,0x47,0x73,0x93,0x55,0xa5,0xb0,0x59,0x72,0x95
+,0xcb,0xa4,0x95,0x2c,0xe4,0xf1,0xa5,0xc8,0xf4,0x5a,0x76,0x4f,0xe9,0x37,0x01,0x1d
+,0xde,0x60,0xba,0xa2,0x88,0x67,0x47,0x35,0x6e,0x24,0x0d,0xd0,0x99,0xa4,0x4e,0x36
+,0x79,0x6d,0x89,0x65,0x25,0x66,0x93,0xf9,0x61,0xa8,0xa6,0xf2,0x4f,0x09,0x5f,0xff
+,0x57,0xcb,0x71,0x91,0x5c,0x5f,0x7d,0x19,0xef,0x5c,0x5f,0x2d,0xee,0x1f,0xca,0xea
+,0x03,0x3d,0x80,0xc2,0x4c,0x8b,0x40,0x8f,0x90,0xcc,0xb1,0xa7,0x98,0x7d,0x2b,0x48
+,0x6e,0x5d,0x6c,0x9b,0x43,0xa7,0xe0,0xa5,0x06,0xc7,0x20,0x10,0xcd,0xa5,0xd9,0x91
+,0x99,0x8a,0xc6,0xf4,0x93,0x9d,0x22,0xfa,0x91,0xe7,0x88,0x06,0x4b,0x3f,0x62,0x8b
+,0x30,0x7b,0xd0,0x16,0x26,0x29,0x0f,0x59,0x0f,0xcb,0x01,0xe1,0xe6,0x6d,0xb5,0x23
+,0x9a,0x36,0xd3,0xfc,0x92,0x6e,0x2f,0x99,0xbb,0x66,0xdc,0xe2,0x19,0xe7,0x5b,0xbb
+,0xb9,0x43,0xbf,0x2c,0xa8,0x41,0x2c,0x28,0x2d,0x26,0xfd,0xc4,0x0b,0xda,0x36,0x0f
+,0xf4,0xa3,0xac,0x24,0x09,0x7d,0x25,0xba,0xf4,0x25,0xfe,0xd6,0x59,0x97,0x9f,0xc7
+,0xf8,0xf9,0xcb,0x0a,0x3f,0xf2,0xe4,0x93,0xa0,0x5a,0xd0,0x9b,0x8c,0x75,0x42,0xb4
+,0x22,0x44,0xd9,0xe9,0x57,0xcb,0xb7,0xa2,0x1f,0x5f,0xd2,0xae,0x44,0x13,0x5d,0xd4
+,0xdd,0xb6,0x1f,0xc0,0xbd,0x8c,0x25,0xc5,0xa8,0xbb,0x42,0x05,0xee,0x27,0x85,0x21
+,0xc2,0x51,0xba,0xdd,0x42,0x9d,0xe0,0x6f,0x80,0x7d,0x41,0x6b,0x42,0x77,0x94,0x13
+,0x79,0xa4,0x6d,0x32,0xe4,0xd5,0x05,0xb1,0x81,0x4c,0xcd,0xfc,0x58,0x56,0x7a,0xc2
+,0x1b,0x7d,0xa0,0x6e,0xca,0xd5,0x1d,0x1e,0x73,0x08,0xb6,0x23,0x56,0x6f,0xbb,0x05
+,0x48,0xa6,0x98,0x8c,0x47,0x92,0xb7,0x4b,0xaa,0x00,0x55,0x1f,0xdd,0x81,0x0b,0x13
+,0xee,0x08,0xfa,0x5b,0x36,0x05,0xcb,0xa4,0x44,0x62,0xb1,0xd3,0xff,0x48,0x7f,0x1a
+,0xcb,0xb1,0x59,0x2e,0x97,0xe3,0xf1,0xb8,0x28,0x8a,0x46,0x45,0x84,0xf5,0xcb,0x88
+,0x76,0xa4,0xd9,0xc4,0xf2,0x7d,0xf9,0xd0,0x36,0xfc,0xcb,0x37,0xdf,0x7c,0xcd,0x13
+,0x4a,0x8b,0x49,0x3f,0x6f,0x6e,0x60,0x99,0xbf,0x2c,0x1b,0x65,0x49,0x72,0xe3,0x83
+,0xfc,0xd7,0xb8,0x29,0xaa,0xaa,0x98,0x45,0xd1,0xc1,0x43,0x42,0x84,0x08,0xb7,0xa5
+,0x9c,0xdd,0xe5,0x97,0xf7,0x42,0xd7,0x63,0x6c,0x02,0x3a,0xf7,0x34,0x62,0x61,0x73
+,0xd7,0xf0,0x98,0xb5,0xcb,0xa2,0x1d,0x81,0x9a,0x99,0xfa,0x2e,0xd5,0xfe,0xf8,0xea
+,0x95,0xad,0x86,0x59,0xe6,0x81,0x60,0x98,0x5d,0x2e,0xdb,0xd5,0x85,0x68,0x9b,0xda
+,0x01,0xf4,0x62,0xea,0xef,0xfe,0xc9,0xd4,0xdc,0x93,0x91,0x45,0x41,0x94,0xe7,0xf4
+,0xe0,0xfd,0xc5,0xd9,0x59,0xdf,0x19,0x4a,0xd8,0x4e,0xa2,0x16,0x92,0x8b,0x65,0xee
+,0x48,0xa1,0x32,0xaa,0x09,0xb8,0x3c,0xc3,0x35,0xdd,0xb2,0x74,0x94,0xa3,0x74,0xf6
+,0x8d,0x05,0xd5,0xeb,0xde,0x40,0x91,0x3f,0xe9,0x04,0x9f,0x03,0xc7,0x7a,0x31,0x2b
+,0x46,0x8b,0x9b,0xec,0xda,0xfc,0x1d,0xec,0xd3,0x11,0x7d,0xee,0xfc,0xe2,0xe8,0xec
+,0xe2,0xa8,0x4f,0x5c,0xfc,0x67,0xff,0x8b,0x35,0x64,0xa0,0x23,0xff,0x88,0x22,0x12
+,0x42,0xbb,0xd8,0x7a,0x09,0x98,0x20,0x62,0xf8,0xca,0x17,0x18,0xd6,0x34,0x66,0x9e
+,0xa3,0x1c,0x4c,0xd2,0xe1,0x92,0xb5,0x60,0xf3,0x62,0x9a,0x0d,0x1e,0x99,0x94,0x10
+,0x89,0x28,0x70,0x93,0x81,0x8e,0x30,0x2b,0xd5,0x25,0x66,0x91,0x76,0xc6,0x98,0xa8
+,0x44,0x6e,0xe6,0xd9,0x90,0x6e,0x07,0x7f,0xb7,0x50,0x8f,0x73,0x34,0xa0,0x9f,0x6d
+,0x81,0xa8,0x80,0xeb,0xe9,0xed,0xbd,0x3b,0xd8,0xff,0xe9,0xe2,0xa0,0x77,0xd0,0xff
+,0xe9,0xec,0xf4,0xa7,0xc3,0xb3,0x8b,0x6f,0xa3,0x78,0x26,0x7c,0xed,0x8c,0x06,0x38
+,0x4b,0x1e,0xec,0x97,0xb0,0x13,0x9d,0xc1,0x88,0x48,0x06,0xd5,0xd6,0xee,0x38,0x71
+,0x26,0x5e,0xb4,0xb6,0x23,0xba,0x66,0xe3,0xc2,0x68,0xcb,0x67,0xfd,0x77,0x07,0x17
+,0xb8,0xa2,0xe3,0x91,0x7d,0x74,0x78,0x74,0x78,0xc6,0x4f,0x16,0xf6,0xc9,0xc5,0x05
+,0xea,0xdc,0xd8,0x5f,0xdf,0xec,0xf6,0xf7,0xde,0x71,0x89,0xcc,0x3e,0x3a,0xda,0x3f
+,0x3e,0xf0,0x13,0x7d,0x47,0xab,0x7a,0x79,0xe2,0xee,0x03,0xda,0x43,0x77,0xd9,0xa2
+,0x5a,0xd2,0x56,0xaf,0x70,0x35,0x80,0x39,0x51,0xc1,0x8a,0x8a,0xd1,0x79,0xef,0xe3
+,0x90,0xb1,0x5e,0xe7,0xbe,0x58,0xf0,0x9d,0x4b,0x05,0x1f,0x2a,0xbe,0x3d,0xa0,0x05
+,0xfc,0x6e,0xa5,0xb6,0xd0,0x41,0x1c,0x6a,0xe1,0x61,0xbf,0x7b,0xbb,0xeb,0x2b,0xb0
+,0x6e,0x68,0xb4,0x20,0xc9,0x41,0xe4,0xfc,0x16,0x94,0x62,0xe0,0xe7,0x4b,0xa2,0x62
+,0xb4,0x89,0xb0,0x58,0x74,0xfc,0xaa,0x7b,0x28,0xc1,0xee,0xb2,0x84,0x4e,0x40,0x15
+,0x1f,0x6e,0xb6,0xe5,0xdf,0x2d,0xda,0xbd,0xd5,0x40,0xe4,0xc7,0x41,0xb5,0x98,0xc6
+,0xf2,0x96,0xc5,0x17,0xae,0x1c,0xb1,0x8c,0xf2,0x61,0x93,0x1f,0x25,0x4f,0x06,0x26
+,0xd7,0x08,0x57,0x7a,0xcd,0x3d,0x39,0xfc,0x23,0x13,0xca,0xc3,0xaf,0x5b,0xa8,0x80
+,0xcb,0xfa,0x26,0x19,0xdc,0xfa,0x5d,0x79,0x5b,0x2e,0x67,0xb4,0x2d,0xdf,0x1d,0x9d
+,0x1f,0xd7,0x59,0x77,0x47,0xd4,0x71,0xe2,0xda,0x56,0xd2,0x1f,0x2c,0x06,0x2f,0xb7
+,0x44,0xc3,0x88,0x8a,0xaa,0xce,0x12,0x2d,0x27,0x7f,0xda,0x9a,0xe2,0x84,0xdc,0xfd
+,0x16,0x49,0x8b,0x98,0xd0,0xdf,0x26,0x6a,0xbd,0x6b,0xbc,0x4b,0x1f,0x12,0x6b,0x3a
+,0x72,0x7d,0xb0,0xbb,0x8b,0x65,0x3c,0x7d,0x4b,0xfb,0xf7,0xa8,0xd1,0xbb,0xcd,0xe6
+,0xb4,0x05,0xcb,0x8a,0xb8,0x5b,0x15,0x0d,0xc0,0x89,0x9c,0x2f,0xd2,0xf0,0xc1,0x71
+,0xe3,0x38,0xab,0xaa,0x29,0xd4,0x95,0xc3,0x8c,0x08,0x4a,0xad,0xb9,0x9b,0x6c,0xac
+,0xcf,0xa9,0xc5,0x53,0xba,0x7c,0x99,0x59,0xb1,0xf6,0x4e,0x1d,0x36,0x6d,0x97,0xbd
+,0x8b,0x3d,0xc8,0xc2,0x83,0xe5,0x54,0xc4,0x0e,0xcc,0xbc,0xcc,0x58,0xeb,0x77,0x7b
+,0xfe,0xb6,0x1f,0xd0,0x65,0x97,0xfb,0xb9,0x9f,0xcd,0xa1,0x44,0x2f,0xc1,0x51,0xe6
+,0x50,0xc1,0x5e,0x33,0x2b,0xb3,0x29,0xab,0xb0,0x65,0xae,0x7a,0xdf,0x1e,0x9d,0x6f
+,0xca,0x3f,0x5b,0xd7,0xd7,0x2c,0xdd,0xce,0xe6,0x76,0xeb,0x91,0x8c,0xcb,0x4c,0xbc
+,0x53,0x7b,0x9a,0xe6,0x5d,0xe9,0x75,0x0e,0xbc,0x9d,0x41,0x03,0xf9,0xbc,0xe3,0xb6
+,0x9c,0x8b,0xf5,0x8e,0x24,0x90,0x92,0x26,0x66,0x8e,0xd3,0xce,0xaa,0x2e,0xc8,0xa0
+,0x25,0x94,0xdc,0x98,0xe3,0xa9,0x1c,0x6d,0x5c,0xcd,0xc3,0x0c,0xdb,0xd7,0x15,0x8b
+,0xa4,0x8f,0x0d,0xdb,0x87,0xa4,0x12,0x16,0x96,0x9e,0xd9,0x02,0x65,0xa3,0x87,0x95
+,0x74,0x56,0x37,0xd0,0x43,0x1a,0xdb,0xe6,0xd6,0x4b,0x3b,0x32,0x1e,0x58,0x24,0x4a
+,0x26,0x79,0x82,0x3d,0xc3,0x4f,0xe9,0xe2,0x9e,0x64,0xb4,0xdd,0xca,0x49,0xb1,0x9c
+,0x0e,0x99,0x65,0x01,0x77,0x91,0x2a,0x67,0x44,0x74,0x6f,0xb8,0x1c,0xa4,0xaa,0x4f
+,0xc0,0x69,0x8b,0x06,0xc5,0x74,0x39,0xcb,0x59,0x20,0x96,0xb9,0xde,0x66,0x7e,0x55
+,0x8f,0x32,0x4d,0x03,0x7f,0xe1,0xdf,0x9e,0x79,0xb8,0xf5,0x6f,0xc6,0x72,0xb7,0x65
+,0x04,0x95,0x5f,0x51,0x4d,0x94,0x49,0xff,0xad,0x9b,0x71,0xd3,0x73,0xf2,0x58,0x0d
+,0x7b,0x3c,0xb8,0x4b,0xc2,0x71,0xe2,0xa3,0xcb,0x3c,0x23,0xaa,0x8b,0x9d,0xc4,0x7d
+,0x89,0xe2,0xad,0xff,0x42,0xb5,0xad,0x28,0x7e,0xf9,0x9b,0xaa,0x0d,0x97,0xc4,0x99
+,0xb1,0x92,0xd3,0x8d,0xde,0xcf,0xaf,0x5f,0x94,0x65,0x8e,0x8b,0x68,0x7a,0xcd,0xcb
+,0x7d,0x0c,0xdf,0x01,0x6d,0xaf,0x59,0x15,0xe0,0x07,0xd4,0xf0,0x3b,0x59,0xce,0xf4
+,0x7e,0x15,0xce,0xb8,0x5a,0x24,0x79,0x49,0x3b,0x02,0xa6,0x08,0x5c,0xb2,0xd3,0x64
+,0x5e,0xc2,0x46,0x40,0x57,0x50,0x4b,0x15,0x2f,0xb2,0xfb,0x9c,0xaa,0xa5,0x6d,0x49
+,0x1f,0x5b,0xa7,0x20,0x8b,0xa4,0x58,0xc7,0x31,0x8f,0x43,0xad,0xc7,0x34,0xa7,0x52
+,0x9e,0x98,0x59,0x7f,0x32,0x70,0x30,0x92,0xfd,0xe1,0xe1,0xe8,0x5d,0x76,0x3c,0xcd
+,0xcf,0xe7,0x17,0x8b,0xb2,0xbf,0x0c,0x14,0x9f,0x71,0x8c,0xc9,0x48,0x17,0x77,0xe9
+,0xce,0xac,0xa8,0x06,0x0f,0x6c,0x56,0x8b,0x17,0xe9,0x08,0xd2,0xc3,0xd5,0xce,0xfb
+,0x77,0x74,0x98,0xf8,0x51,0x09,0x53,0x79,0x2a,0x0f,0xe8,0xf7,0xca,0xf4,0xe9,0x76
+,0x87,0xf5,0xaa,0x77,0x76,0x79,0xb1,0xc7,0xb6,0xb7,0xab,0xfd,0x83,0x5e,0xdf,0xaa
+,0x8e,0xe4,0x24,0x31,0x75,0x92,0x12,0xe8,0x1d,0x0a,0x88,0xda,0x88,0xa5,0x39,0xb6
+,0xc1,0xe0,0x68,0x49,0x89,0x36,0xbf,0x67,0xdb,0x49,0x04,0xb6,0x2a,0xe0,0x0b,0xc4
+,0x6c,0xac,0xf6,0xd9,0x78,0x38,0x5f,0x44,0xf1,0x7e,0x63,0x8f,0xa6,0xb4,0x02,0xf1
+,0x48,0x86,0x6c,0xaa,0xca,0x16,0xa5,0x78,0x18,0x48,0x3b,0x4d,0x1a,0x5b,0x02,0x49
+,0x03,0x4a,0xca,0xa1,0xf2,0xfb,0x38,0x08,0x34,0xf5,0x50,0xf6,0x04,0x52,0xd5,0x61
+,0x63,0x5f,0x18,0x48,0xb0,0x7e,0xe9,0x03,0xd1,0x57,0x34,0xc8,0xad,0x8c,0xd8,0x47
+,0xa2,0x89,0x39,0x81,0x9e,0x23,0x1e,0xa6,0x78,0xc9,0xc4,0x49,0x6c,0x45,0x52,0x31
+,0x78,0xac,0x43,0xbf,0x4f,0x95,0x37,0xb5,0xfc,0x17,0xe8,0xee,0xe1,0x8a,0x74,0xa6
+,0xe2,0x54,0x91,0xd7,0x04,0x45,0x36,0xa5,0xe6,0xf0,0x24,0x18,0x40,0x8f,0x00,0x25
+,0x21,0xd1,0x0a,0x18,0x94,0x46,0x98,0xb6,0x42,0x4d,0x5e,0xe8,0x63,0xad,0xb3,0xd0
+,0x86,0xf2,0xe4,0x9f,0x6a,0x1f,0x54,0x0d,0x0a,0xda,0x7c,0xf8,0x9c,0x34,0x39,0x6d
+,0xbc,0x83,0xf9,0x0b,0xbf,0x85,0xf2,0x31,0x2e,0x16,0xa2,0x52,0x0d,0x12,0xf5,0x07
+,0xd3,0xe2,0x06,0xf7,0x7b,0x53,0x19,0x6a,0x67,0x6d,0xc3,0xf7,0x5a,0xb8,0x05,0xf6
+,0x9f,0x95,0x3b,0xc1,0x2a,0x9d,0xeb,0xce,0xe2,0x9d,0x4d,0x84,0x71,0x36,0xa7,0xc3
+,0xc0,0x0c,0x6a,0x39,0xc9,0xe6,0x42,0x8d,0x66,0x6c,0x39,0xfe,0x17,0xc2,0xb7,0xdb
+,0x16,0xa6,0xbe,0x2d,0xe8,0xfb,0x8b,0x46,0x2f,0x20,0x2a,0xf1,0x05,0xd3,0x4e,0xe9
+,0xc3,0xd3,0x11,0xf5,0x1b,0xdc,0x52,0x32,0xbd,0x27,0x26,0x82,0x8e,0x61,0xca,0x27
+,0x3c,0x29,0xf5,0x66,0x06,0x0b,0xb6,0xe5,0x35,0xac,0x50,0x3b,0xf2,0x6c,0x52,0x8f
+,0x64,0xb3,0xb3,0x52,0xa4,0x99,0x17,0x76,0xf0,0xcb,0xc6,0x25,0xab,0x53,0x4c,0xf3
+,0x16,0xca,0x72,0xe2,0x67,0xa1,0x08,0x9f,0xc9,0x41,0x0e,0xe5,0xc7,0x5d,0x67,0x3f
+,0xa6,0xb6,0xfc,0x91,0x73,0xdc,0x8f,0x6c,0x32,0x71,0x2f,0x61,0x4b,0xd3,0x88,0xb9
+,0x3b,0xf9,0xc3,0xbc,0x50,0x1c,0x08,0xe3,0x50,0x47,0x88,0xa1,0x9d,0x08,0x4b,0x29
+,0x06,0x4a,0x12,0x12,0x94,0x21,0x80,0x40,0xb5,0x22,0x02,0x43,0xfd,0xe4,0x27,0xde
+,0x32,0xfd,0x28,0xc3,0xe2,0x15,0xbd,0xf5,0x2b,0x44,0x6f,0x59,0x32,0x18,0x60,0x76
+,0xe8,0x63,0x6d,0x7c,0x9f,0x24,0xc9,0x81,0xfe,0x66,0xdd,0x4b,0x40,0x40,0x51,0xa9
+,0x23,0xfd,0xe4,0x4b,0x94,0x18,0xb7,0xd8,0xb0,0xd1,0x95,0xd8,0x65,0xfb,0xc8,0x8e
+,0xe3,0x81,0x55,0xa0,0x31,0xed,0x58,0xba,0x6d,0x61,0xa5,0xad,0x29,0x07,0xad,0x86
+,0x8f,0xb6,0x27,0x8b,0x32,0x56,0x85,0x9e,0xdc,0xc0,0x86,0x1d,0x39,0x92,0x44,0xb7
+,0x1a,0x4d,0x5a,0xe9,0x2f,0x6d,0x8c,0x39,0x2e,0xf2,0x58,0x76,0x25,0xcc,0x23,0x81
+,0xe9,0x92,0x0e,0x60,0x6b,0xdb,0x80,0x66,0xd1,0x05,0x14,0xe9,0xba,0x3b,0x8d,0x48
+,0x9b,0xcd,0xd4,0xa6,0xc9,0xc2,0x0d,0xda,0x69,0x63,0x2f,0x38,0x3b,0xac,0xfd,0xa4
+,0x08,0xc8,0x39,0x64,0xa1,0x0e,0xdb,0xf9,0x98,0x12,0xd2,0x6e,0xb9,0xa5,0x7e,0x4c
+,0x0a,0x9c,0x33,0xa2,0xd5,0xbc,0xb3,0xee,0x49,0x24,0xb7,0xd4,0x8c,0x25,0x46,0x1a
+,0x02,0xf1,0x55,0xf8,0x4c,0x5b,0x0d,0xc0,0xfa,0xe9,0x88,0x75,0x18,0xce,0xa1,0x4b
+,0x6c,0x76,0x34,0x66,0x98,0xa1,0xb1,0xe5,0xa5,0xaf,0xf2,0x69,0x1e,0x9a,0xd8,0x17
+,0xec,0x6b,0xee,0x4d,0x2b,0x20,0xf3,0x19,0xed,0xab,0xbf,0x17,0x9f,0xab,0xcf,0xd9
+,0xe7,0x39,0xf7,0xe5,0x1f,0x70,0xea,0x38,0x16,0xad,0x3e,0x3b,0x52,0x61,0x27,0xe2
+,0xe7,0x43,0xbe,0xc5,0xf0,0xd3,0x85,0xb9,0xba,0xec,0x1d,0x5c,0x5c,0x5f,0x6d,0xb3
+,0x06,0x8e,0x0b,0xe6,0x85,0xdb,0x9d,0x31,0xef,0x98,0x3a,0x3d,0xe7,0xe3,0x89,0x2d
+,0xa0,0x52,0x75,0x62,0xd6,0x68,0xd7,0x0f,0xd6,0xac,0x71,0x96,0x3b,0xa2,0xa6,0x30
+,0x71,0x0e,0x51,0x22,0x1d,0x9e,0x67,0xe8,0x28,0xd2,0x94,0xb6,0x40,0xa4,0x9d,0x69
+,0x80,0x49,0xb7,0x06,0x34,0xb6,0x6e,0x05,0x47,0x37,0x74,0xe4,0x02,0x61,0x3c,0x78
+,0xa8,0x40,0x17,0xe5,0x6a,0xb1,0x95,0xb8,0x5f,0x81,0x06,0xdc,0x34,0xb9,0xda,0x8e
+,0xbe,0x6f,0x05,0x14,0xd0,0x53,0xa8,0xc2,0x76,0xce,0xb6,0xa2,0x95,0x40,0x94,0x1d
+,0x33,0xd8,0xd6,0x2b,0x38,0x68,0x4a,0x26,0x98,0x69,0x03,0xdd,0x30,0xac,0x81,0x1c
+,0xa6,0xf6,0xf4,0xf1,0xc5,0xcd,0x3d,0xe1,0x66,0xd8,0x89,0xc1,0x6a,0x7b,0x85,0x46
+,0x5f,0x18,0xcc,0x3a,0x51,0x3c,0x35,0xd6,0xb1,0xc4,0xce,0x76,0x07,0x3c,0xb7,0x8b
+,0xe1,0xec,0x6a,0xca,0x92,0x4a,0xa7,0x88,0xf5,0x6a,0x9b,0xda,0xd0,0x5c,0xff,0x6a
+,0xbd,0x16,0xe2,0x94,0xf3,0x89,0x71,0x57,0x84,0xde,0x4b,0x13,0x12,0x97,0x52,0x99
+,0x44,0xe8,0x6f,0x03,0x3a,0xf5,0xcc,0xf2,0xf3,0xa9,0x94,0xab,0x13,0x62,0xb3,0x27
+,0x22,0xc3,0xe5,0x42,0xee,0x1f,0x6e,0xc8,0x6d,0x44,0x96,0x6a,0xae,0x58,0x66,0x61
+,0xe1,0xe7,0xec,0x59,0x69,0x67,0x14,0x8a,0x44,0x7e,0x17,0x2f,0xc1,0x4e,0xed,0x33
+,0x1b,0x7f,0x33,0xd8,0x1b,0x1d,0x9a,0xe3,0xa3,0x1e,0xfb,0xc7,0x0c,0xcf,0x68,0xee
+,0x8e,0x8f,0x4e,0x6a,0x72,0x95,0x68,0xf4,0x4a,0xba,0x7f,0x07,0x20,0xe3,0x30,0xf9
+,0x96,0x9e,0x85,0xe3,0xed,0xc1,0xdf,0xe0,0x0d,0xc5,0xac,0x51,0x02,0x0b,0xdb,0x50
+,0x99,0x34,0xda,0x9e,0x07,0x78,0x2d,0x0d,0xe0,0xde,0xc6,0xd7,0xc0,0xa8,0xf2,0x55
+,0x6c,0x9c,0x5e,0x8f,0x38,0xb4,0x4c,0xcc,0x3b,0x2c,0xea,0x96,0x50,0xfc,0x2d,0xc5
+,0xc8,0xc3,0x1f,0xd9,0x6c,0x89,0x3b,0x5d,0x39,0xf1,0x75,0x88,0xb5,0x83,0x9e,0x11
+,0x9a,0x01,0x92,0x70,0x4a,0x5e,0x27,0x5e,0xe2,0x0f,0x31,0xfb,0x27,0xb2,0x63,0x42
+,0xc1,0xc6,0x5b,0xed,0xb1,0x98,0x56,0x3f,0x44,0x2a,0xcf,0xd1,0x60,0x5a,0x1d,0xf3
+,0xe6,0xd1,0xa9,0xef,0x7c,0x37,0xb5,0x69,0xdc,0x1d,0x65,0xb1,0xe0,0x1b,0xcc,0xb9
+,0xec,0xa0,0xb7,0x44,0xdc,0x4d,0xbc,0x0f,0xb7,0x4c,0x5a,0xca,0x3b,0x68,0x5a,0xe1
+,0x54,0x81,0xd3,0x78,0xd3,0xe8,0x71,0x2b,0x2a,0xae,0x34,0xb9,0x47,0x24,0x8d,0xd0
+,0x25,0xc0,0xf7,0x05,0x7d,0xb4,0x8b,0x2e,0x0d,0xa1,0x37,0x93,0x19,0x5b,0xf0,0x9e
+,0x5a,0x56,0xa3,0xaf,0xd9,0xa2,0xd5,0x62,0xaf,0x3c,0x69,0xe4,0xb2,0x7f,0x18,0x7f
+,0x5d,0x73,0xee,0xda,0xb3,0xaf,0x88,0xed,0x66,0x47,0x31,0x15,0x2c,0x40,0x07,0x8e
+,0xd8,0x92,0x3c,0x4c,0xa7,0xd9,0x2c,0xab,0x98,0xa1,0xf0,0x7a,0xc9,0xfe,0xee,0x1b
+,0xb9,0xbe,0x47,0xa2,0xf1,0x61,0x15,0x3d,0x68,0x1e,0x3b,0x33,0xf1,0x9b,0xc3,0x16
+,0x38,0x3e,0xdd,0x88,0x34,0xea,0xae,0x8e,0xd7,0xcf,0x0b,0x6b,0xef,0xd8,0xeb,0x83
+,0xda,0x39,0xd4,0x5d,0x60,0x89,0xb9,0xfb,0x2e,0x5b,0x0e,0xa4,0x93,0xa3,0x2c,0x9d
+,0x0e,0x31,0x0b,0x24,0x1e,0xd1,0x9d,0xeb,0xd7,0xee,0xe6,0xd1,0x3a,0x7c,0xf2,0xa6
+,0xf3,0x43,0x04,0xa3,0x58,0xaf,0x5c,0xab,0x24,0xa5,0x17,0xe9,0x38,0x7d,0x88,0xe2
+,0x33,0xeb,0xb6,0xa2,0x45,0x8a,0x60,0xc8,0xa2,0xa0,0xf5,0x63,0x6b,0xab,0x9d,0x9d
+,0x7b,0xa9,0x33,0xc1,0xce,0x4d,0x2c,0x78,0xff,0xc2,0x48,0x9c,0x71,0x91,0x39,0x90
+,0xab,0x98,0x0d,0x89,0x47,0xe6,0xe2,0x00,0xce,0x7b,0xf1,0xc2,0x51,0xf9,0xa1,0xd9
+,0xdf,0xed,0xe3,0xa7,0x2f,0xf7,0x8f,0x7a,0xe7,0xc7,0xbb,0xdf,0x43,0xf7,0x74,0xb2
+,0xcb,0xe7,0x6a,0xdf,0x40,0x1d,0xe5,0x7e,0x87,0x37,0x1a,0xeb,0x9b,0xba,0x63,0xb5
+,0x07,0x5a,0x5d,0x3d,0xbe,0xd1,0xc5,0x7d,0xdf,0x31,0xd6,0xd9,0x19,0x1e,0x4f,0xe2
+,0xdc,0xbc,0x5a,0x50,0x08,0x3f,0x8b,0xbf,0xf8,0x74,0x8d,0x0f,0xd3,0x62,0x62,0xa8
+,0xa5,0x4b,0x9c,0x2e,0x26,0xa9,0xa4,0x37,0x08,0x2f,0xf3,0x97,0xd2,0x23,0x9e,0x09
+,0x7c,0x06,0x13,0x52,0xd7,0xb2,0x9d,0x9c,0xec,0xef,0x4f,0x26,0xb3,0xd9,0xd5,0xd5
+,0xde,0xde,0xf5,0xf7,0xdf,0x5f,0x5f,0x75,0xca,0xf2,0x1a,0xba,0x0a,0x8c,0xbf,0x71
+,0xd4,0x3b,0x33,0x5f,0xbf,0xde,0xd8,0x94,0x23,0x47,0x4f,0x68,0x1b,0xf2,0xd1,0x19
+,0xee,0xf0,0x40,0x26,0x3b,0xf0,0x85,0x2d,0xbb,0xb3,0x1d,0xf1,0x90,0x2d,0xbb,0xe5
+,0x0e,0xb1,0x2d,0x45,0x3e,0x2c,0xbb,0xf9,0x0e,0xf6,0xeb,0x82,0xaf,0xa4,0x90,0xf3
+,0x91,0x2e,0x17,0xa3,0x27,0xf7,0x53,0x38,0x72,0xb8,0x21,0x61,0xc8,0xce,0x9e,0x6a
+,0xf9,0x10,0xbe,0xde,0x21,0x00,0xd1,0xcb,0x0e,0xd3,0x66,0x6a,0xfe,0xb2,0xbf,0xf7
+,0x4b,0x73,0xf3,0x89,0xb6,0x08,0xad,0x04,0x89,0xaa,0x72,0xc2,0xd5,0x0f,0x83,0xa7
+,0xa8,0x24,0xde,0xf0,0xd9,0xf1,0x33,0xad,0x3e,0x3f,0xeb,0x1d,0x7d,0x88,0xfe,0xfd
+,0xf2,0xf4,0xe8,0x43,0xff,0xe8,0xe4,0xe0,0xaa,0x73,0x78,0xb1,0xbb,0xd7,0x67,0x73
+,0xb2,0x18,0xfd,0x64,0x9c,0xd8,0xe1,0xb4,0xff,0x66,0xd9,0x30,0x67,0x97,0x80,0xcd
+,0x3f,0xfd,0x71,0x23,0xde,0xd8,0xa4,0xff,0xa2,0xef,0xe9,0x4f,0x7c,0x72,0x12,0xef
+,0xef,0x9b,0xab,0xc9,0x64,0x9b,0x3e,0xb2,0x4d,0x8d,0xa3,0xba,0x9d,0xd7,0xc8,0x3f
+,0x5e,0xb5,0x89,0x6e,0xbd,0x8a,0xd9,0xcf,0x98,0x67,0x8b,0xfd,0x0c,0x88,0xfb,0x85
+,0x13,0x55,0x38,0x00,0xab,0x38,0x0f,0x7d,0xca,0xad,0x03,0x33,0x89,0xcd,0xda,0x45
+,0x6b,0x42,0x22,0x26,0x83,0x66,0x2a,0x12,0x5f,0x41,0x62,0x6f,0x07,0x13,0x16,0x02
+,0x37,0xbe,0xde,0xd8,0xe8,0xfc,0x4a,0xe3,0x70,0x53,0x02,0x93,0x81,0xc6,0xfb,0x3f
+,0xec,0xac,0x65,0xe2,0x6b,0x5d,0xea,0xca,0x48,0x1d,0xee,0x26,0x4f,0xb6,0x3d,0xc9
+,0x53,0x55,0xa9,0x05,0xda,0x01,0x57,0xa8,0x63,0xce,0x70,0x11,0xdc,0x67,0xb4,0x78
+,0x7f,0xe8,0xff,0x80,0xb6,0x4a,0x56,0x79,0x50,0x3f,0xec,0x9e,0xb5,0x86,0x97,0xd2
+,0x8a,0xec,0x96,0x35,0x2a,0x2b,0xbe,0x30,0x97,0x25,0xcb,0xf0,0xd5,0x62,0x84,0x66
+,0x9b,0x2f,0x5b,0xd0,0x8a,0x54,0xc9,0x03,0x2d,0xea,0xfa,0x3a,0x9d,0x75,0x48,0x7d
+,0x53,0xb3,0x5e,0x9b,0xd4,0xf5,0xdc,0x79,0x44,0xd4,0x9f,0x57,0x70,0x89,0x88,0xd6
+,0x7b,0x6e,0x55,0x9b,0x1b,0x1b,0xf1,0xeb,0x8d,0x96,0x7d,0x7f,0xe2,0x5c,0xc0,0xe9
+,0xf9,0x57,0x7f,0x72,0xcf,0x67,0xea,0x26,0xd2,0xa4,0x15,0xdf,0xdc,0x6a,0x45,0xeb
+,0xef,0xd4,0x3b,0x7c,0x23,0xde,0x7a,0xd9,0x0a,0xbf,0x70,0x64,0x5f,0x70,0x41,0xff
+,0x7c,0x6e,0x76,0x4f,0xba,0xe7,0x27,0xd1,0x3a,0xbb,0xdb,0xd1,0x19,0x7e,0x64,0x6b
+,0x12,0x7d,0xe6,0x4f,0xf2,0x99,0xf5,0xef,0xe5,0xd1,0xea,0x9f,0xf5,0x3d,0x33,0xa0
+,0x5d,0xbe,0x5c,0x3c,0x46,0xeb,0x89,0xd6,0xbd,0x4f,0xd3,0x5b,0xb8,0xb0,0xb0,0xb6
+,0x08,0x65,0x76,0x9f,0x3c,0x92,0xba,0x4b,0xf6,0x74,0xc1,0xf5,0x40,0xaf,0x4d,0x73
+,0x33,0xfe,0x63,0xdb,0x6c,0xee,0xcc,0x20,0x8a,0xaf,0xdf,0x68,0x63,0x32,0x32,0x5f
+,0x6f,0xfd,0xcd,0x93,0x47,0xf2,0xfc,0x07,0x77,0xd2,0xf8,0x55,0xb4,0xfe,0xb3,0x6d
+,0xdd,0x8e,0x65,0x33,0x7e,0xf9,0xfa,0x75,0xcb,0xac,0x0f,0xed,0x0b,0x3f,0x6b,0x2f
+,0x37,0xe9,0x79,0xba,0xf2,0xdc,0xf0,0xf3,0x68,0xfd,0x94,0x1a,0xcc,0x89,0xa1,0x1a
+,0x98,0xa6,0x6e,0x21,0x8d,0x55,0x58,0xbf,0x34,0xef,0xd1,0x73,0xff,0x8d,0xf8,0xab
+,0x97,0x7a,0xcd,0xf6,0xe8,0x0e,0x4e,0x1e,0x31,0x77,0xeb,0xef,0x7f,0xb9,0xd4,0x49
+,0xc1,0xa5,0xa2,0xf5,0xef,0x56,0xca,0x6c,0xae,0x96,0x69,0xcb,0x24,0x7d,0x63,0x5e
+,0xa1,0x97,0x25,0x0b,0xe9,0x73,0xbd,0xcf,0xd9,0x18,0x86,0x7a,0xe8,0xd3,0xa1,0x59
+,0x5b,0xff,0x3e,0x5e,0x9f,0xc5,0xeb,0x74,0x42,0xe8,0xeb,0x17,0xf4,0xfb,0xbb,0xed
+,0xf5,0x93,0x35,0x37,0x53,0x7d,0x7d,0xb2,0xbd,0xde,0xf3,0x0f,0x3f,0x19,0x3f,0x7f
+,0x4d,0x3e,0x8d,0xd4,0xab,0x7d,0x2a,0x39,0xeb,0xae,0x0f,0xbb,0xeb,0x8f,0xdc,0xd6
+,0x82,0x7e,0x3f,0x92,0x9a,0xb4,0x67,0xe8,0xd1,0xfa,0x84,0x9e,0xdc,0xac,0xad,0xec
+,0x89,0xed,0x4f,0xf5,0xb6,0xb6,0xb9,0xb1,0x07,0x43,0x64,0x33,0x99,0xa6,0x72,0x3f
+,0x98,0xf5,0x0f,0xf6,0x77,0xeb,0x20,0xb2,0x3e,0x08,0x4b,0x74,0xe5,0xf1,0x7a,0x69
+,0xc0,0x7f,0x3c,0x98,0x74,0x5e,0x10,0xa9,0xc0,0x43,0x77,0x53,0x0e,0xcd,0x55,0x36
+,0xfa,0x5c,0x8c,0x76,0xf4,0x72,0xcc,0x6e,0xca,0xcf,0x05,0xfd,0x9f,0xfe,0x63,0x9e
+,0xee,0x73,0x49,0x53,0xf6,0x19,0x5a,0xdd,0x1d,0x68,0xb9,0x70,0x3f,0x7d,0x96,0xe8
+,0x86,0xcf,0xd9,0x68,0x9a,0x8c,0xa9,0x2a,0xfd,0xbd,0x73,0x78,0xbc,0xfb,0xf6,0xaa
+,0x8d,0xbf,0xd5,0xbc,0x05,0x51,0xa0,0x6b,0x6f,0x33,0x75,0x41,0x83,0x0f,0x05,0xfc
+,0x34,0x98,0x9a,0x28,0xb5,0x29,0x94,0xa4,0xb4,0xad,0xb3,0xab,0xa5,0x81,0x60,0xc4
+,0x6f,0xd3,0x47,0xb0,0x22,0x3b,0x62,0x45,0x94,0xbb,0x87,0xd9,0x4d,0x8d,0xa3,0xc8
+,0x16,0x8e,0x19,0xe4,0x22,0x25,0x4c,0x40,0x99,0x8c,0xc5,0x18,0xa7,0x09,0x56,0x29
+,0x26,0x38,0xc5,0x85,0x2d,0xf3,0xde,0x5a,0x02,0x5d,0x39,0xf6,0x78,0xa6,0x22,0x37
+,0xe5,0xce,0xa9,0x31,0x6f,0x9c,0xe7,0xa8,0x73,0xdf,0x34,0xcd,0xaf,0xf8,0xdc,0xf3
+,0xf4,0xa0,0x4c,0x0f,0x66,0xcc,0x64,0x54,0xa5,0x62,0x33,0x06,0x31,0x73,0x5e,0x77
+,0x4d,0x76,0xca,0x36,0x26,0x93,0xe6,0x84,0xe5,0xf3,0xee,0xa8,0xa6,0x49,0xcf,0x6d
+,0xbf,0x0a,0x29,0xa3,0x4c,0xd2,0x6a,0xa1,0xc8,0xc8,0x22,0xd0,0xf7,0xc0,0x02,0x9d
+,0xea,0x04,0xda,0xef,0x28,0x85,0xc3,0x6a,0x05,0x65,0x8a,0xa0,0x2d,0x2e,0xa4,0x1c
+,0x3e,0x15,0x91,0x39,0x95,0xb0,0x18,0x61,0x58,0xf2,0x82,0xe3,0x52,0x68,0xa7,0x54
+,0x61,0x00,0x0c,0x54,0xe2,0x12,0x67,0x24,0xe1,0x49,0xad,0x0e,0x47,0x18,0x95,0xe1
+,0x82,0x54,0x24,0xf9,0xc3,0x29,0xb0,0x2e,0x26,0x18,0x2b,0x80,0xcd,0x0b,0x68,0x26
+,0x32,0x38,0x09,0xb0,0xa5,0xa0,0xe4,0x65,0xc2,0xbe,0x89,0x74,0x1e,0x7f,0x92,0xa9
+,0xb5,0x73,0x9a,0x95,0x7e,0xba,0x8d,0x8a,0x8b,0x46,0x47,0x35,0xa0,0x01,0xb0,0x82
+,0x04,0xf3,0xa1,0xf5,0xec,0xdc,0x04,0xf5,0xa2,0xc2,0x7e,0x20,0x11,0x07,0x29,0xfe
+,0xa3,0xce,0x52,0x56,0x34,0xd6,0x3f,0xbf,0xf4,0x01,0x9a,0x4c,0xf7,0x01,0x99,0xd8
+,0xf0,0x03,0x72,0x0c,0x76,0xf2,0xe2,0x61,0x94,0x2e,0xda,0xec,0x63,0x10,0xfe,0x11
+,0xf5,0x20,0x7b,0x5e,0xaf,0xa8,0xb7,0x73,0xe8,0xf3,0x68,0xa6,0x16,0x30,0x1a,0x8c
+,0x8a,0x08,0xc7,0x04,0x1d,0x25,0x7a,0x44,0xbc,0xfe,0xc0,0x4a,0x97,0xfc,0x0b,0xce
+,0xb9,0xae,0xa2,0x41,0x09,0xf1,0xea,0x31,0x7b,0x05,0xc4,0x2d,0x2c,0x20,0xef,0x3b
+,0xb6,0x43,0xab,0xcb,0x86,0xc1,0xf5,0x39,0xe0,0x2e,0xc0,0xc5,0x9f,0x28,0xdc,0x50
+,0xef,0x01,0x94,0x12,0x3f,0xa7,0x91,0x2d,0x22,0x5e,0xc3,0xde,0xd5,0x96,0x6e,0xe8
+,0x5b,0xe8,0x48,0x69,0x92,0xd0,0x90,0xe8,0x75,0xe0,0x14,0x45,0x74,0x93,0x04,0xfb
+,0x4a,0xd4,0x2d,0x43,0xd7,0xa5,0xf4,0x61,0x30,0xe5,0x16,0x0f,0x93,0x6c,0xca,0xb6
+,0x21,0xf5,0x4c,0xc7,0xec,0xb2,0x98,0x5d,0xf2,0xc0,0x58,0x77,0x16,0x94,0xd2,0xf3
+,0xc7,0xea,0x3b,0x1f,0x93,0x34,0x4c,0x61,0xb2,0x1f,0xdc,0x91,0xd0,0x7b,0x7a,0x79
+,0xc2,0xde,0xb0,0xfc,0x00,0x93,0xb0,0xcc,0x97,0x30,0x09,0xac,0x1a,0x25,0x4b,0x27
+,0x8b,0x26,0x96,0xd1,0x18,0x98,0xee,0x30,0xbd,0xeb,0x56,0xd5,0x23,0x35,0xc2,0xea
+,0x22,0x6a,0xa4,0xe3,0xbf,0x71,0x37,0x4b,0x61,0x3a,0x1a,0xa9,0x3c,0xb0,0xbb,0xbf
+,0x7f,0x61,0xae,0xde,0x1f,0xed,0xf7,0xdf,0x99,0x2b,0xe2,0x46,0x77,0xad,0x81,0xde
+,0x59,0xff,0xcd,0x7c,0xf2,0x58,0x4a,0x20,0xdc,0x70,0x08,0x03,0x03,0x6c,0x39,0x52
+,0x81,0xf6,0xc3,0x66,0xdb,0x6c,0xb5,0xcd,0x2b,0xfe,0xd0,0xd7,0x96,0x44,0x58,0xb2
+,0xf4,0x8a,0x4e,0xcb,0xf9,0x22,0x45,0x14,0x0c,0x7f,0x87,0x89,0xdc,0x86,0xb8,0x59
+,0x4c,0xbc,0xc5,0xd1,0xd9,0x40,0x65,0x7f,0x71,0xd8,0x15,0x22,0x7b,0xc0,0xd6,0xe9
+,0x37,0xd9,0xc5,0x4b,0x74,0x43,0x0d,0xd8,0x91,0x98,0x74,0xb2,0xe7,0x61,0x0a,0x65
+,0xb9,0xfb,0x22,0x8f,0x9d,0x46,0xd8,0x12,0xdd,0x05,0x16,0x5a,0x85,0x44,0x2a,0x9d
+,0x3b,0x77,0x11,0xe9,0xc9,0xd9,0x4f,0xbd,0xef,0x4f,0xf7,0x4c,0x13,0xdd,0xe1,0x6d
+,0x6f,0x35,0x99,0x5a,0x9b,0x36,0xe9,0x5c,0x6b,0xe3,0x47,0x57,0xdb,0x4d,0xe6,0x08
+,0xc6,0x94,0x77,0x93,0xec,0xf6,0x5c,0x4d,0x20,0x12,0x5f,0xe1,0x55,0x12,0x88,0x45
+,0x5c,0xe3,0x5d,0x35,0x5a,0xa4,0xe9,0x9a,0x53,0xea,0xab,0x9c,0x04,0xa3,0x50,0x17
+,0x0b,0xdb,0xf5,0xf1,0xa0,0x5c,0xda,0x09,0x83,0x91,0xd3,0x8a,0xa8,0xe4,0xe0,0x0d
+,0x04,0x62,0xaa,0xf4,0x46,0x02,0xbb,0xd6,0x56,0x6e,0x20,0xc6,0x55,0xa3,0x54,0x22
+,0x5f,0x3f,0x0c,0xb8,0x43,0x59,0xd1,0x47,0xb0,0xb9,0xa4,0x0b,0x07,0x08,0x56,0x1d
+,0x8c,0x16,0x19,0x9d,0x80,0x92,0x1d,0xdb,0xde,0xd5,0x6c,0x55,0xa6,0x79,0xbb,0x83
+,0x58,0xc4,0x16,0x1c,0xea,0x56,0x5f,0x7d,0xbb,0x83,0xa0,0xc4,0x16,0x74,0x72,0xdc
+,0x3e,0x7b,0x23,0xd6,0xfc,0xec,0x84,0x12,0xc3,0x99,0xbc,0x07,0x4e,0x19,0xb4,0xb6
+,0x64,0xab,0x39,0x96,0x13,0x95,0xed,0x06,0x0a,0x54,0xa3,0x5e,0xff,0x7a,0xce,0xe6
+,0x05,0x4c,0x69,0xef,0xb2,0x77,0xf7,0xd2,0xac,0x9d,0xa7,0xc3,0x84,0x08,0xc1,0x60
+,0x4d,0x09,0x2b,0xdf,0x4d,0xe2,0xfd,0x2b,0x5f,0x82,0x33,0xba,0x84,0x8c,0x58,0xcf
+,0x5f,0xb6,0x55,0x06,0xd3,0xe1,0x98,0x1f,0xc4,0xbd,0x44,0x91,0x6d,0x11,0x06,0x96
+,0xbb,0x0c,0xbd,0xa7,0x73,0xc5,0x3e,0xd2,0x54,0x6d,0x0a,0x1d,0x37,0xad,0xd6,0x68
+,0x39,0x75,0x07,0x5d,0x58,0xf9,0x61,0x36,0xa8,0xac,0xd0,0xcf,0xf2,0x56,0x3b,0xe2
+,0x55,0x4e,0xf5,0x6e,0x91,0x81,0xd2,0x18,0x6d,0xff,0x6a,0xb3,0x12,0x0e,0xd6,0x4f
+,0x82,0x3f,0xb2,0xd9,0x82,0x39,0xd5,0xf3,0xdd,0xfe,0x3b,0x76,0xc6,0xe3,0xc9,0x7d
+,0x36,0x76,0x0d,0x91,0x6b,0xbe,0xde,0x2c,0x2d,0xc7,0xb4,0x2d,0xf7,0x06,0x2c,0xff
+,0x7f,0x8e,0xab,0xcf,0x71,0xdf,0x5a,0xc4,0xbf,0x3b,0x38,0xd6,0x78,0xb9,0xa3,0x1f
+,0x58,0x2b,0x70,0xff,0x39,0x7e,0xef,0x74,0x68,0xec,0xff,0x95,0x57,0x8b,0x62,0xca
+,0x9d,0xbb,0x4d,0x17,0x79,0x3a,0x35,0x62,0xb1,0x66,0xd7,0x0b,0xec,0xa2,0xbd,0x86
+,0xd8,0xdf,0x83,0xc7,0x6e,0xad,0xac,0xd7,0x33,0xb4,0x43,0x4f,0x4b,0x09,0xd5,0xf6
+,0x65,0x72,0x16,0x8f,0xf5,0x2b,0xd3,0x62,0x0c,0x37,0x52,0xe9,0x23,0xd8,0xd8,0xaf
+,0xd9,0xaa,0x73,0x91,0xdc,0x3b,0x63,0x2a,0x1f,0xde,0x6f,0x38,0x40,0xcd,0xd0,0x3d
+,0x42,0x15,0xcb,0x3f,0x53,0xa1,0x1e,0x0b,0xd1,0xb4,0xb0,0xd4,0x44,0x93,0x78,0x94
+,0x30,0xb0,0x8b,0xe9,0xc2,0xed,0xac,0x1c,0xb3,0x16,0x85,0x6f,0x25,0x1a,0xd8,0x14
+,0x34,0x1d,0x33,0x40,0xcd,0xe4,0x8f,0xd6,0xd8,0xde,0x5f,0xdd,0xd9,0xde,0x18,0x02
+,0x25,0x6c,0xe8,0x27,0x18,0xbe,0xb9,0x97,0x08,0x89,0xfb,0x44,0x0c,0x71,0x23,0xeb
+,0xa2,0x6a,0x7b,0x9d,0xdc,0x26,0x06,0x21,0x62,0x53,0xf1,0x46,0x7f,0xdf,0x78,0x4f
+,0x25,0xc5,0x59,0x5c,0x79,0x40,0xde,0x9c,0xce,0x61,0x1c,0xde,0x50,0xd6,0x7f,0xd5
+,0xad,0x69,0x5e,0x0e,0x8b,0x59,0x92,0xe5,0x2c,0xa0,0xe8,0x4e,0xe0,0x07,0xb2,0x8b
+,0x95,0x48,0xdc,0xa4,0x08,0x20,0xe7,0x1d,0xd7,0xb4,0x41,0xac,0x93,0xa2,0xac,0x24
+,0x8e,0x75,0xe8,0xed,0x04,0xc3,0xa2,0xdc,0x62,0xde,0xb8,0xe6,0xe8,0x2f,0x6c,0xab
+,0x95,0x30,0x75,0x8f,0x33,0xdb,0x4a,0xe5,0xcd,0xda,0x8f,0x8b,0x1f,0x73,0x16,0x9d
+,0xb9,0xe6,0x1a,0xfd,0xf2,0x9c,0x3b,0xca,0xaa,0x37,0x4a,0xfb,0xd7,0xcc,0xfe,0xae
+,0x3f,0x4b,0x56,0x50,0x9d,0x06,0xf6,0xe8,0xe4,0x66,0xf0,0xee,0xdb,0xdb,0xe3,0xe9
+,0xac,0x7c,0xa8,0x91,0x56,0x3d,0x05,0x44,0x2c,0xb9,0x6e,0xdb,0x46,0x3a,0x12,0x7f
+,0xb5,0x9c,0xa9,0x0a,0x41,0x6c,0x9e,0xf9,0x30,0xb4,0x36,0xe0,0x00,0x09,0x43,0xbb
+,0x0d,0x05,0x28,0xb1,0x44,0x6c,0x13,0x76,0x57,0x97,0x3b,0x57,0x53,0xd5,0x92,0x83
+,0x09,0x6d,0xb3,0xb4,0x24,0x5f,0x00,0xbd,0x7e,0x96,0xfe,0xa5,0x9d,0x71,0x87,0xc4
+,0xcf,0x6f,0xcd,0xd6,0xab,0x97,0x27,0x66,0xeb,0x2d,0x47,0xcd,0xb8,0x03,0xed,0xd8
+,0x50,0xef,0x7f,0xfb,0x6d,0x63,0x85,0x5e,0x99,0xe6,0xbc,0x28,0xb3,0x87,0x16,0x1c
+,0xc1,0x4e,0xd2,0xb1,0x04,0x8a,0x47,0xd1,0x7b,0x76,0x4f,0x2e,0xf8,0xd6,0xd8,0x06
+,0xf9,0x86,0x8e,0x43,0x8d,0x11,0xe8,0xd7,0xcf,0xb0,0x84,0x06,0x43,0xe4,0x53,0xb7
+,0x9c,0xb1,0xcb,0x0c,0xac,0xad,0xb8,0x66,0x22,0x4c,0xab,0x84,0xc3,0x0d,0x89,0xe7
+,0xa5,0xf3,0x63,0x4e,0x9f,0x33,0x40,0xc3,0xf2,0x3c,0x1b,0x8a,0xd1,0xf9,0xe7,0x06
+,0x0b,0x11,0xa7,0x35,0x63,0xcd,0xbf,0x36,0x21,0xdb,0x68,0x49,0x84,0x53,0xb3,0xc1
+,0x81,0xba,0xca,0xca,0xd2,0x52,0xbe,0x2f,0xbe,0x10,0xcc,0xdb,0x13,0xcd,0xe2,0x0b
+,0xce,0xda,0x58,0xa3,0xf8,0x41,0xcf,0x17,0x11,0x0d,0x74,0x1d,0x9b,0xda,0x93,0x6b
+,0xbb,0x4d,0xd2,0xc1,0xa4,0xa0,0xad,0x71,0x90,0xe6,0xd7,0xce,0xa9,0x90,0xa6,0x89
+,0xb9,0x95,0x5a,0x7b,0xa1,0xc7,0x84,0x57,0xb2,0x5a,0x1f,0x31,0x14,0x5d,0x01,0x32
+,0xb0,0xbb,0x1e,0x04,0xee,0x40,0x7d,0x84,0x9f,0xc4,0x84,0xa8,0x52,0x66,0xfa,0x18
+,0x2e,0x66,0x4a,0xa5,0x8b,0x81,0xf5,0x23,0x71,0x52,0xdc,0x93,0xda,0xdb,0x51,0xe3
+,0xc7,0x1f,0x49,0xb4,0xa2,0x5b,0xaf,0x44,0x24,0x6e,0xa3,0xf1,0xe3,0xc6,0xe9,0xe9
+,0xa9,0x39,0x63,0x8f,0x51,0xa2,0x77,0x2f,0x69,0xba,0xc7,0x59,0xd5,0x6a,0xfc,0xf8
+,0xf0,0xee,0x9d,0x79,0x97,0x3e,0xe0,0xe1,0x96,0x3e,0xa4,0xca,0x08,0x7a,0x98,0xe2
+,0x80,0x36,0x6f,0x88,0xde,0x74,0x39,0x9c,0x97,0x0a,0xdf,0x68,0x9b,0x18,0x21,0xb5
+,0x39,0x50,0xc9,0x8c,0x0d,0x90,0x30,0x51,0xff,0x98,0xa3,0xf2,0xc8,0xc0,0xa7,0x98
+,0x8e,0x5e,0x9a,0x0e,0xa9,0x54,0x6e,0xcc,0xa9,0x0c,0x98,0x7e,0x01,0x63,0x9d,0x2c
+,0x16,0x19,0x4d,0x31,0xed,0x6a,0x44,0x49,0x53,0x05,0x62,0x5b,0xdf,0xd1,0xc2,0x93
+,0x24,0x8e,0xee,0x55,0xc9,0x4d,0xe3,0xc7,0x3b,0x76,0xe5,0xe7,0x58,0x5e,0x56,0x37
+,0x89,0x63,0x00,0x71,0xf9,0xd9,0x54,0xe9,0x16,0x1a,0xfc,0xdd,0x3f,0xc7,0x8b,0xd4
+,0xb9,0x84,0xa6,0x1c,0x8c,0x40,0x17,0x4e,0x85,0x2b,0x48,0x82,0x9a,0x11,0x49,0xce
+,0x8f,0xe5,0x57,0x89,0x27,0x0f,0xd8,0xb8,0xc1,0x70,0x01,0x17,0x57,0x10,0xec,0xbd
+,0xde,0x91,0x0d,0xac,0x84,0x11,0x7e,0x5a,0x10,0xa1,0xa7,0x0f,0xb2,0x09,0xff,0x8c
+,0x18,0xbb,0xee,0xc0,0x3d,0x82,0xaf,0xcd,0x78,0x3c,0x4d,0x5d,0x48,0x57,0x9a,0xdf
+,0xd1,0x87,0x37,0x38,0x9e,0x3d,0x75,0x5a,0xf0,0x25,0xc7,0x85,0xd3,0x4f,0xf8,0x67
+,0xe7,0xbb,0xdd,0xe3,0x4b,0xa6,0x2b,0xce,0x59,0x55,0x89,0x8c,0x2a,0x07,0xa9,0x8d
+,0x6c,0x51,0xe4,0xbc,0xa5,0x98,0x5b,0x54,0xbe,0x2b,0xcb,0xef,0x0a,0x6b,0x08,0xa7
+,0xc7,0x2c,0xf1,0x85,0x65,0xef,0x12,0x9a,0xce,0x1b,0x0d,0x51,0x48,0x1b,0x07,0xea
+,0xd0,0xbc,0xaa,0x32,0xa6,0xed,0x7a,0x77,0xb5,0x71,0xcd,0xfe,0x6e,0xea,0x2b,0x8b
+,0xa6,0xc0,0x49,0xc9,0xed,0xe9,0x4c,0x76,0x41,0xe3,0x91,0x8e,0xc1,0x86,0x9b,0x73
+,0x9c,0xbb,0x53,0x55,0xd6,0x0a,0x6e,0xf0,0xcd,0x98,0x2f,0x59,0x35,0xea,0xbe,0x6a
+,0x09,0x7c,0x96,0xeb,0x0d,0xe4,0x66,0xec,0x61,0x8e,0xc1,0x89,0x53,0xcf,0x1b,0xb5
+,0xb9,0x05,0xe1,0xff,0xf2,0x9a,0x83,0xaf,0x70,0xbe,0xb0,0xe3,0x18,0x1b,0xa3,0x58
+,0x0c,0xd5,0x8e,0x85,0x77,0x00,0xd6,0xc0,0xb0,0xab,0x86,0x36,0x42,0xd3,0xc9,0x22
+,0xca,0x23,0x5e,0x0b,0xf0,0x46,0x28,0xbe,0x88,0x85,0x45,0xdd,0x47,0x7f,0x81,0x3d
+,0xfa,0x9a,0x91,0x2a,0x7e,0x59,0xd4,0x26,0x6e,0x96,0xe8,0x31,0x6b,0x54,0xad,0x71
+,0x6e,0x91,0xb2,0x01,0x53,0xee,0x54,0xed,0x57,0x04,0x32,0x2b,0x36,0xa2,0x26,0x3d
+,0x81,0x35,0x40,0x49,0x3c,0x37,0xc0,0x9e,0x19,0x2d,0x91,0x11,0x84,0x9c,0x38,0x84
+,0x0e,0xee,0xfa,0x4d,0xfa,0x58,0x90,0x84,0xc8,0xa1,0xc9,0x1c,0xfd,0x89,0xa6,0x1d
+,0x79,0x71,0x97,0xd9,0x28,0xe1,0x70,0xdd,0xab,0x78,0x42,0x37,0x17,0x09,0x63,0x6f
+,0x0e,0x2e,0x98,0x7f,0x3b,0x94,0xe7,0x1c,0x1f,0x49,0x3d,0x94,0x90,0xbc,0xfa,0x65
+,0xb2,0x2d,0x92,0x33,0xf5,0x5d,0x5c,0x52,0xa4,0x29,0x76,0xc8,0x7b,0xf8,0x5b,0x0e
+,0x2a,0x19,0x3a,0x6c,0xd6,0x57,0x6f,0xe4,0x84,0xc6,0x10,0x53,0x20,0x9e,0x0a,0xa3
+,0x83,0x65,0x24,0xb9,0x24,0x9d,0x4e,0x9d,0x38,0xa3,0x4c,0x03,0x0c,0xf9,0xb6,0xa6
+,0x37,0x46,0x25,0x62,0x5e,0x34,0xec,0xa0,0x2d,0xae,0xa7,0xa0,0xf1,0xa7,0x2e,0x7c
+,0xd2,0xb2,0xb3,0x52,0xce,0xc7,0xf5,0xab,0x7a,0x1e,0x1e,0xd0,0xdc,0x40,0xd3,0xc7
+,0xf4,0x07,0x3d,0x85,0x33,0x8c,0x47,0x64,0x80,0x78,0xdd,0xa9,0x13,0x0e,0x96,0xd6
+,0xae,0xe2,0x9b,0xc9,0x71,0xb9,0xb2,0x09,0x93,0x19,0x36,0x2f,0x06,0x21,0x8e,0xd7
+,0xc1,0x6d,0x4f,0x34,0x77,0x91,0xdd,0xa4,0xaa,0x24,0x53,0xd7,0x10,0x66,0xf1,0x4b
+,0x31,0x7b,0xbe,0xa1,0xab,0x6c,0xc4,0x64,0xd1,0x22,0xc5,0xb4,0x7c,0x5c,0xe4,0xaf
+,0x44,0xcc,0x3c,0xe3,0x34,0xa0,0xec,0x24,0x5f,0xe0,0x5d,0x58,0x06,0x6d,0xd4,0xb3
+,0xf5,0x48,0xf1,0x23,0xe1,0x33,0xf5,0xee,0xd8,0x33,0x37,0xfb,0x47,0x17,0x42,0x74
+,0xbe,0x51,0xcd,0xd0,0x9f,0x99,0xe6,0xc0,0x92,0x5f,0xbb,0x73,0x47,0xd6,0x92,0xe9
+,0xac,0xf6,0x9d,0x48,0x61,0x02,0x68,0xa7,0x48,0xf9,0xb5,0xce,0x5a,0x5b,0xcd,0x9d
+,0x09,0xe2,0xe1,0xe3,0xb9,0x82,0x9b,0xc0,0x2f,0x9a,0x87,0xfd,0x0e,0xb4,0xff,0x97
+,0x83,0x90,0x9c,0xea,0x26,0x3e,0x76,0x05,0xeb,0x57,0xfb,0xcf,0xaa,0x55,0x5c,0x61
+,0x08,0xa8,0x21,0x18,0x69,0x4f,0x89,0xc1,0x43,0xa0,0x80,0xf9,0x72,0x2d,0x40,0xf9
+,0x51,0x6e,0x21,0x3a,0xe1,0x9e,0x09,0x27,0x40,0x77,0x60,0x2c,0xca,0x77,0x92,0x69
+,0xfa,0x07,0x17,0xa7,0xd0,0xc9,0x58,0xe7,0x50,0x3e,0x75,0xf7,0xd9,0x74,0x28,0x70
+,0x07,0xf0,0x45,0xf7,0x8a,0x7a,0x75,0x73,0x42,0x18,0x9d,0xe1,0x26,0xa2,0x98,0x81
+,0x90,0x82,0x86,0xf8,0xf7,0x67,0x5b,0x8a,0x33,0x29,0xfb,0xa4,0x21,0x3c,0x26,0x6a
+,0x0a,0x1f,0x28,0x73,0xc9,0x64,0x14,0x7f,0x02,0x26,0x9a,0x5f,0xf9,0x37,0x31,0xc2
+,0xe7,0xd4,0x15,0x82,0x7f,0x38,0xda,0x67,0xe2,0x71,0x9b,0x17,0xf7,0x74,0x38,0x25
+,0x44,0x45,0x82,0xd8,0x56,0x1a,0x5a,0x79,0x45,0x0d,0xc9,0x13,0xfa,0x23,0x3f,0xd4
+,0x5b,0x82,0x8b,0x97,0xa1,0xdd,0xd2,0xbd,0xe6,0xf0,0x92,0xba,0xcb,0x57,0x0c,0x63
+,0xa5,0xe9,0xee,0x90,0xe4,0xd2,0xc2,0x6a,0x2f,0xf3,0xfa,0x24,0x0d,0xfd,0xd6,0xc7
+,0x36,0x05,0xbb,0x65,0x4e,0xaf,0x06,0x6a,0xa1,0x7b,0xc2,0x79,0x0e,0x76,0xf8,0x24
+,0x53,0x53,0x0f,0x80,0x40,0x50,0xa5,0x6c,0xae,0x61,0xdd,0x01,0xa1,0xa0,0xe3,0xcf
+,0xdb,0xe5,0xd4,0x6d,0x18,0xc7,0xe8,0x89,0x07,0x6c,0xf0,0x27,0x4e,0x67,0xf3,0x4a
+,0xa3,0x05,0xe5,0xc7,0x1a,0x4f,0x4e,0xfd,0x92,0xe0,0xce,0xd3,0xab,0xa5,0xf6,0x4b
+,0x14,0x30,0x29,0x36,0x99,0x48,0xcd,0xc9,0xb8,0xd0,0xb6,0x00,0x3e,0xe4,0xdc,0xc2
+,0xd4,0x63,0x6f,0x49,0x3b,0x60,0xb0,0xd2,0xc4,0x40,0xfd,0xf8,0x9e,0xb4,0x60,0x62
+,0xa6,0x38,0xb5,0x26,0x84,0x06,0xc5,0xb3,0x95,0x36,0x54,0xb9,0xfb,0x5c,0x37,0x82
+,0x00,0x36,0xe9,0x6c,0xf3,0xc3,0x4f,0x67,0xdf,0xb6,0x78,0x71,0xbe,0xdc,0xdd,0x3b
+,0xa6,0x5b,0x9b,0xee,0x1e,0x13,0xcc,0x0f,0x2b,0x42,0x5c,0x60,0x44,0x6d,0x7e,0x9c
+,0xf4,0x60,0x47,0xde,0xbc,0x58,0x69,0xcc,0x3a,0xd2,0xd9,0x1d,0xbe,0xea,0x4e,0x17
+,0x34,0x26,0x8c,0xbd,0x77,0xbf,0x83,0x3b,0x9c,0xba,0x88,0xd2,0x64,0xd3,0x1e,0xa0
+,0x53,0xc1,0xf4,0x54,0xb4,0xff,0x7e,0xdd,0xac,0x05,0xc0,0x37,0x35,0x4b,0x1e,0xa4
+,0xb5,0x53,0xe7,0x8e,0x7e,0x2a,0x0e,0xb5,0x43,0xde,0x99,0x70,0x6d,0xe4,0x03,0xa0
+,0xf5,0xe4,0x77,0x99,0x45,0x16,0xb8,0x5d,0x7b,0x31,0xed,0xd2,0xa0,0x29,0x62,0x67
+,0x9e,0x6d,0xeb,0xc3,0xf7,0xae,0xad,0x0f,0x3b,0xc9,0x60,0x26,0x36,0x9d,0x3f,0xf3
+,0xb3,0x17,0xa5,0xf9,0xde,0x3f,0x6b,0x7e,0xbf,0x43,0x54,0x4f,0x58,0x28,0xc7,0x8b
+,0xab,0xb3,0x74,0x0c,0x1a,0x6f,0xae,0x6e,0x06,0xc3,0xd1,0x74,0x0e,0x63,0x34,0xff
+,0x4e,0xc5,0x9a,0xbc,0xcd,0xdb,0xec,0xba,0x01,0xe7,0x69,0xfa,0x4b,0x7c,0x3c,0x5d
+,0xb8,0xe4,0x3c,0x03,0xf0,0x49,0x49,0xa5,0x52,0xa2,0xf4,0xd1,0xa9,0xb2,0x0f,0xa7
+,0x44,0x41,0x1f,0xd5,0x7c,0x0c,0x9b,0x00,0x8b,0x09,0xb1,0x69,0x4e,0x85,0xd3,0x4f
+,0xf2,0x16,0x18,0xbf,0x2f,0x4d,0x73,0xcc,0xbb,0x4e,0xd4,0x0d,0xad,0x8e,0xb9,0xe4
+,0x5d,0x03,0x0d,0x5e,0x7c,0x45,0x5d,0xbf,0xe6,0xae,0xc3,0x45,0x67,0x48,0xf7,0x09
+,0x42,0x56,0xbc,0xeb,0x9f,0x99,0x98,0x26,0xfb,0x1f,0xd0,0x8f,0x33,0xd3,0x54,0x17
+,0x04,0x71,0xf5,0x63,0x13,0x04,0x9b,0x72,0x61,0x78,0xd8,0x63,0x78,0x9d,0xd4,0x12
+,0x75,0xa6,0x70,0xdb,0xd1,0x17,0x44,0xec,0x13,0xfa,0x7f,0xd1,0x36,0x4d,0xd3,0x12
+,0x45,0xb9,0x40,0x9c,0xa1,0x89,0xb6,0x52,0x16,0x62,0xea,0x34,0xec,0x19,0x61,0xd6
+,0x03,0x35,0x44,0xe8,0x2d,0x61,0xce,0xfd,0x65,0x21,0x74,0xd3,0xd9,0x97,0xa5,0xc4
+,0x86,0xdd,0x19,0x4f,0x0b,0x12,0x57,0x19,0x09,0xe1,0xa7,0xeb,0x61,0x25,0xac,0xcb
+,0x38,0x8a,0xcb,0x25,0x40,0x92,0xe4,0x4f,0x58,0x50,0xfd,0xe3,0x5e,0x94,0xb2,0x4b
+,0x8b,0x5b,0xb1,0x55,0x90,0x64,0xaf,0x9b,0x57,0x1b,0x77,0x9b,0xb3,0xb8,0xf5,0x0d
+,0x3d,0x29,0xc8,0x6d,0x68,0xf8,0x9f,0x72,0xc6,0xb5,0xab,0xb3,0xcb,0x75,0x65,0x54
+,0x23,0xa3,0x46,0x7a,0x19,0x95,0x98,0xe2,0x6b,0xe6,0xf9,0x28,0xfe,0xb8,0xcc,0x70
+,0xc6,0x0e,0x1e,0x32,0xc0,0x5c,0xcc,0xd2,0x61,0xc6,0x4e,0x01,0xbc,0x18,0x72,0xc7
+,0x95,0x4b,0x62,0x2a,0xb3,0x0a,0x8c,0xfd,0xda,0xdf,0xff,0xb1,0x26,0x03,0x97,0x25
+,0x92,0xc0,0xd8,0x8e,0x39,0xb0,0xf3,0xb1,0xf6,0x6f,0x6b,0x8a,0xa0,0x17,0x84,0x00
+,0x81,0xa7,0x5d,0xa3,0x5b,0xb3,0x99,0xe3,0x3c,0x3b,0xd9,0x55,0xd4,0x64,0x68,0x92
+,0x23,0x8c,0xe0,0xe0,0x04,0x69,0xc9,0xde,0xb7,0xf2,0x19,0xda,0x41,0x19,0xbc,0xff
+,0x95,0x2b,0x80,0x76,0x54,0xed,0x55,0x8b,0x59,0x5b,0x02,0x7a,0xf1,0x0f,0x1d,0xb4
+,0xb6,0x84,0x5c,0x8b,0xc7,0x6e,0x55,0x2c,0x3d,0x6c,0x60,0xe9,0xda,0x2b,0x44,0xa7
+,0x79,0x2b,0x10,0x78,0x2b,0x93,0x14,0x22,0x25,0xd0,0x64,0xff,0xa8,0xa2,0x2d,0x53
+,0xf3,0x6d,0xd8,0xdb,0x9f,0x5c,0x2a,0x50,0x95,0x44,0xeb,0x24,0x73,0x3a,0x9c,0xae
+,0xd0,0xc8,0x3b,0x36,0x1c,0x6d,0x02,0x7b,0xc6,0x38,0x0b,0x02,0xea,0xd7,0xdf,0x1a
+,0x10,0x4b,0xa0,0xef,0xe1,0x45,0xb4,0x9e,0x19,0x07,0x6b,0x27,0xa4,0x54,0xcb,0x4d
+,0xcd,0xd3,0x30,0x69,0x75,0x67,0xd0,0x00,0x4c,0xf6,0x26,0x5f,0x3f,0x31,0x66,0x5a
+,0xda,0x75,0x05,0x45,0xe8,0xb2,0x0b,0xf5,0xfa,0x5c,0xb9,0x85,0x15,0x7b,0x98,0x59
+,0x3f,0x5f,0x79,0x81,0x23,0x59,0x1a,0xe2,0xd6,0x22,0x18,0x93,0xeb,0xf6,0x50,0x6b
+,0x12,0xff,0x77,0x7c,0x4c,0x28,0x14,0x43,0xc6,0x65,0x0f,0xf8,0x39,0x5a,0x5f,0x0a
+,0x8f,0xf0,0x64,0xf4,0x97,0x7e,0x90,0xcb,0xda,0xe8,0x7f,0x30,0x4f,0x68,0xbc,0x63
+,0x21,0xd9,0x2a,0x4a,0x52,0xf4,0xc3,0x32,0xbf,0x36,0xa3,0x21,0xd8,0xaa,0x1c,0xe2
+,0x7a,0x32,0xbc,0xcb,0x4a,0x28,0xad,0xc4,0xd1,0x14,0x93,0xdf,0x11,0xc9,0x19,0xde
+,0xd1,0x43,0x7e,0x02,0xa9,0xe1,0xe0,0x41,0xbd,0x0f,0xf9,0x49,0xc8,0xd9,0xb2,0x77
+,0x28,0x97,0x82,0x34,0x9f,0xc7,0xbc,0x82,0xb4,0x0d,0xc0,0xa5,0x67,0x75,0x90,0xac
+,0x7b,0xab,0xb7,0x64,0x15,0x2a,0x15,0x73,0xdd,0x9b,0x55,0x8c,0x19,0xc7,0xc6,0xa1
+,0x1a,0xb7,0x7e,0x91,0xea,0xec,0x3b,0xbb,0x37,0x2c,0xdb,0x80,0x72,0x13,0x9c,0x0e
+,0xe1,0xe0,0x99,0xe0,0x58,0x5c,0x2f,0x75,0x3b,0x0d,0x63,0x1a,0x22,0xdc,0x24,0x79
+,0x25,0xee,0x57,0xac,0xfe,0x95,0x00,0x73,0x15,0x3a,0x15,0x85,0x84,0xc6,0xad,0x5d
+,0x68,0x9c,0x24,0x0f,0xd9,0x8c,0xee,0xe2,0x60,0xe7,0xd2,0xc5,0x2a,0xdf,0xf1,0xf8
+,0x72,0x5f,0x79,0x81,0xa4,0x98,0x82,0x45,0xbf,0x29,0xaf,0x7f,0x61,0x1c,0x6f,0x88
+,0xc8,0xdf,0x1a,0x46,0x05,0x15,0x2f,0xbc,0x1b,0x18,0x31,0x4b,0x68,0x43,0xbc,0xe6
+,0x43,0x65,0x8c,0x3d,0x66,0x86,0x9e,0x68,0xfb,0x97,0xd5,0x28,0xfe,0xfa,0xa9,0x43
+,0x64,0x29,0x38,0x78,0x34,0x1b,0x81,0xa7,0x23,0xbb,0xe6,0x92,0xac,0x5a,0x66,0x08
+,0xfc,0x8c,0xef,0x1b,0xf2,0x7d,0x2a,0x24,0xf6,0x37,0x1b,0xa7,0xe5,0xc6,0xf2,0x75
+,0x20,0x5c,0x21,0x9a,0x8b,0xc6,0x72,0x3b,0x1b,0x57,0xd7,0x1e,0xab,0xb0,0x9a,0xa8
+,0x42,0xb0,0x2d,0x25,0x40,0x0c,0xd8,0xb4,0x98,0xb0,0xb1,0x88,0xad,0x08,0xd6,0xde
+,0x37,0x23,0xf2,0xb9,0x90,0x98,0xd7,0xf2,0x9e,0x3a,0x27,0xe2,0x2d,0x06,0x47,0x8d
+,0x5a,0x77,0x46,0x61,0x8f,0x42,0xef,0x4d,0xe1,0x23,0x7f,0xc5,0x42,0x14,0x76,0x71
+,0x91,0xcc,0x58,0x89,0x7b,0x75,0xb1,0x7b,0xa2,0x92,0x13,0x42,0x24,0xb9,0x6b,0x53
+,0xdf,0x05,0x15,0x4c,0x87,0xa2,0x70,0xb0,0xa1,0xec,0x5a,0xd9,0xb5,0x57,0xa2,0x45
+,0x3a,0x9c,0x7f,0x8f,0x47,0x00,0x6b,0x5d,0xfe,0xc3,0x9c,0x9c,0x5d,0x9e,0xf6,0xcf
+,0xcf,0x8e,0x4e,0xfb,0xd2,0xe8,0x27,0x86,0x8e,0x58,0xe6,0x5a,0x30,0x09,0xf8,0x5a
+,0x41,0x91,0x90,0x42,0x72,0x1e,0xa4,0x90,0x6f,0x9d,0x99,0x89,0xa7,0x70,0x69,0xbf
+,0x1d,0x1e,0xcd,0x37,0x05,0x03,0xf4,0x55,0x3c,0xac,0xc7,0x85,0xb2,0x35,0x9a,0x67
+,0x83,0xad,0x91,0x7c,0xc6,0xf0,0xba,0x09,0x66,0xc0,0x6e,0x74,0x35,0x54,0xb2,0x2b
+,0x09,0x6f,0xfa,0x62,0x01,0x0a,0xa0,0x58,0x70,0xe2,0x69,0x09,0x3b,0xbe,0x57,0x64
+,0xc3,0xca,0x4e,0x6c,0x04,0x3e,0x29,0x91,0x1c,0x2e,0xbe,0x11,0x4e,0x48,0xbe,0x53
+,0xd5,0x1c,0xa4,0xf4,0x2a,0x1e,0xdc,0x8d,0xcb,0xe9,0xf1,0xec,0x64,0xc8,0xf0,0x33
+,0xe7,0xe6,0xfc,0xec,0xa2,0xaf,0xa0,0x34,0xbb,0xbd,0xde,0xfb,0xb3,0x8b,0x7d,0x51
+,0xa0,0x71,0xac,0x80,0x79,0x77,0xd6,0xeb,0x9b,0xab,0xe3,0xb3,0xbd,0x5d,0x12,0x6c
+,0x2f,0x0e,0x4e,0xce,0xfa,0xd0,0x2f,0x24,0x53,0xe6,0x2a,0xa9,0x4d,0xc3,0xce,0xe3
+,0x8b,0x9a,0xef,0x32,0xbe,0x23,0x45,0xa5,0x47,0x08,0xd6,0x85,0xe3,0x3c,0x08,0x53
+,0xc2,0xb6,0x01,0x12,0xb0,0x22,0xeb,0x37,0x10,0x46,0x58,0x9a,0x32,0x61,0x92,0x20
+,0x61,0x5d,0x89,0xe1,0xef,0xb2,0xb8,0xd7,0x31,0x7b,0x1e,0x09,0x02,0xac,0x0f,0x74
+,0x42,0x12,0xf3,0xcb,0x78,0x0f,0xce,0x67,0x80,0xa1,0xc0,0xc0,0x31,0x6a,0xf3,0x88
+,0x4c,0x82,0x7a,0x0c,0xc3,0x0c,0x0f,0xea,0xda,0xd6,0xe6,0x1a,0x0c,0x8e,0xfc,0x4e
+,0x07,0x5e,0x7b,0x2f,0x13,0xf6,0xef,0x6b,0xce,0x7d,0x93,0xe6,0xa3,0x56,0xc0,0x0d
+,0x65,0xad,0x16,0xfc,0xf3,0x9e,0x45,0x97,0x82,0x15,0x40,0x1c,0xb9,0xc0,0x37,0xf9
+,0x61,0xff,0x5c,0xa7,0x6a,0x5b,0x30,0x34,0x1d,0x80,0x01,0x3c,0x60,0x95,0x93,0xf1
+,0x78,0x05,0xf1,0x98,0xf1,0xd3,0x78,0xfa,0x02,0x32,0x3e,0x6d,0x1c,0x67,0x81,0x31
+,0xe0,0x51,0xa2,0x70,0x11,0xb0,0x66,0x05,0x6c,0x5d,0x76,0x36,0x31,0x14,0x8a,0x4f
+,0x86,0x3d,0x2b,0xdf,0x16,0x05,0xa2,0xcc,0x2a,0x75,0x51,0xd7,0x33,0x3e,0x69,0xcc
+,0x6e,0x45,0x84,0x68,0xf4,0xe0,0x41,0xc2,0x56,0xf0,0x7f,0xca,0x04,0xd8,0xfd,0x43
+,0x3f,0xd2,0xce,0x1a,0x11,0x2f,0x6a,0xae,0x60,0xab,0x44,0xd4,0x7d,0x3c,0x75,0x00
+,0x9c,0xfc,0x88,0xe3,0xed,0x9d,0x13,0x2c,0x95,0xce,0xc6,0x0a,0x60,0xab,0x2e,0x4c
+,0x1d,0xf3,0x1d,0xff,0x2b,0xfd,0xc0,0x25,0x8c,0x52,0xf0,0x8a,0x5c,0xa4,0xc4,0x89
+,0x21,0x3a,0x56,0xac,0x9c,0x2b,0x66,0xec,0x30,0xb4,0x78,0xad,0xbb,0xa6,0xd8,0x60
+,0x7c,0x89,0x4b,0x98,0xae,0x9b,0x1a,0x6f,0x69,0x17,0x1f,0x20,0x99,0x93,0x26,0x33
+,0xc9,0xea,0xeb,0xcd,0x70,0xb5,0xad,0x60,0x5c,0xb4,0xff,0x60,0x89,0x12,0x6c,0xa6
+,0x69,0x61,0x04,0x1d,0xb0,0x27,0xc6,0x54,0xd5,0x23,0xbb,0x67,0x62,0x8f,0xb0,0x91
+,0x0e,0x65,0x5d,0xd9,0xc2,0x4b,0x4d,0x6b,0x53,0x8c,0x73,0xe2,0x22,0x86,0xb6,0xa5
+,0x00,0x3c,0xd6,0x43,0x8b,0x62,0xc5,0x41,0xf0,0x10,0x02,0x00,0x58,0xb1,0x0a,0xb7
+,0x01,0x40,0x8b,0xf5,0x47,0x40,0x98,0xaa,0xe1,0xdb,0x55,0xea,0x18,0xd1,0xa6,0x95
+,0x66,0x13,0x73,0xb0,0xcc,0x59,0x93,0x60,0x1d,0x8f,0x3a,0x91,0xfd,0x5e,0x68,0xf4
+,0xd8,0x56,0x07,0xa6,0x3c,0x80,0x30,0x23,0xca,0xb3,0xbd,0x2d,0xc6,0x49,0x3d,0x7b
+,0x41,0xc7,0x9a,0x1c,0x4f,0x1c,0xb9,0x00,0xbc,0xaa,0x62,0x9a,0x84,0x40,0xfb,0xc4
+,0xc4,0x0f,0x37,0xd3,0x64,0xc2,0x2e,0xda,0x0c,0x63,0xbd,0x83,0x5f,0x5b,0xb2,0x5e
+,0x82,0x0a,0xc4,0xd7,0xa7,0xf6,0x48,0x3c,0x14,0x71,0xa2,0x79,0x66,0x9c,0x1a,0x38
+,0x76,0x11,0xb4,0xb6,0xc7,0x4d,0xa7,0x0c,0xb5,0xfa,0x77,0xaf,0xff,0x6d,0x81,0x6b
+,0x51,0x7e,0x5c,0xf5,0xe0,0x08,0x28,0x59,0x81,0x00,0x2a,0xb0,0x5f,0x16,0x95,0x6f
+,0x31,0xbc,0x95,0x85,0xf5,0xaf,0xe1,0x5f,0xb7,0x60,0x5d,0xe0,0x90,0x1b,0xba,0x87
+,0x95,0xfd,0x81,0x87,0x0a,0x4c,0x98,0x60,0x20,0x17,0xb9,0xee,0x0d,0xb9,0x2d,0x3e
+,0x2e,0x8b,0xca,0xfb,0x06,0xf9,0x0b,0x91,0x77,0xa2,0x00,0xd8,0xb8,0x41,0xb3,0x88
+,0xa9,0xd8,0x1d,0x00,0xba,0xfa,0x83,0xdd,0x65,0xf1,0x94,0xa7,0x67,0xbb,0x4d,0x9d
+,0xa0,0x05,0x48,0x6e,0x06,0x6e,0xff,0x28,0x1a,0x79,0x7c,0xc3,0x18,0xca,0x34,0x45
+,0x31,0x95,0x01,0x7c,0x83,0x3c,0x7f,0x11,0xdf,0xbc,0x90,0x67,0xe6,0x05,0x7e,0x30
+,0x2f,0xb4,0xe2,0x0b,0xf3,0x82,0x2b,0xbc,0x70,0x1b,0x7a,0x9e,0x51,0xef,0x2b,0x22
+,0x10,0x6a,0x45,0xc5,0x09,0xc2,0x43,0xda,0x85,0xd9,0xbc,0x7c,0x21,0x47,0x42,0x41
+,0x40,0xc5,0xeb,0x3a,0x80,0xcb,0x13,0x0e,0x27,0x6c,0x8b,0x15,0x9b,0x98,0x75,0x6d
+,0x8e,0x1d,0x53,0x10,0x12,0xe4,0x76,0xbd,0xd6,0xb6,0x3c,0x63,0xc0,0xed,0x31,0xe5
+,0x0e,0x1b,0x93,0x2b,0x68,0x7a,0x6d,0xf6,0xde,0x1d,0x9d,0x9b,0xe3,0xa3,0x53,0x01
+,0x20,0x7a,0x6b,0x5d,0x29,0x84,0x4c,0x58,0xbb,0x80,0x6f,0x89,0x2d,0x97,0xa8,0x23
+,0x08,0x0f,0xae,0x5f,0x2c,0x38,0x89,0x41,0x9b,0x8d,0x9a,0x72,0xdc,0xe9,0xa9,0xda
+,0x07,0x44,0x9d,0xbd,0xcb,0x71,0xb5,0x34,0xf5,0xf7,0x61,0x5f,0xf8,0xe2,0xbc,0xe2
+,0x46,0xbd,0xc9,0x39,0x9c,0xa8,0xa7,0x73,0x51,0x3e,0xe9,0xbe,0xb3,0x2d,0x79,0x6b
+,0x52,0xad,0xbf,0x16,0x05,0x49,0x86,0x62,0xa9,0xe0,0xff,0x3d,0x63,0xa0,0x23,0x23
+,0x16,0xf4,0x83,0xc3,0x77,0x93,0x23,0x04,0x7c,0x17,0x1f,0x17,0xe5,0xdd,0xfd,0xc3
+,0x0f,0x9f,0x40,0xbb,0x76,0xdf,0xec,0xc1,0x2e,0x81,0x1f,0x67,0xe6,0x64,0xf7,0x83
+,0x58,0xc8,0x2e,0x0e,0xde,0x1e,0x7c,0xb8,0xe6,0xf8,0xed,0xf8,0xa4,0x67,0xf5,0x4e
+,0xfa,0x60,0x84,0xd7,0x6c,0x43,0xe3,0xdf,0xed,0x4f,0x3a,0x37,0x32,0x30,0x27,0x6e
+,0x2f,0xd2,0xf1,0x72,0xca,0xd6,0x2b,0xa7,0x7a,0xb0,0x80,0x2e,0x71,0xda,0x5e,0x39
+,0x6d,0x08,0xc8,0x7c,0x5a,0x01,0xa3,0xe4,0xf6,0x7c,0x9c,0x89,0xc6,0xbf,0x41,0x66
+,0x8e,0xd7,0xbc,0xfe,0x5e,0xbc,0x00,0x15,0x45,0xc0,0x12,0xc1,0x0d,0x1c,0x3f,0x15
+,0xc5,0xdb,0x42,0x12,0x73,0x6d,0x90,0x76,0xe3,0x12,0x6c,0xc2,0x56,0xcd,0xa0,0x27
+,0x5e,0x84,0x6c,0xad,0x83,0xb2,0x7b,0x9c,0x3e,0x34,0xa1,0x13,0xf5,0xbd,0xb0,0x8a
+,0x44,0xc1,0xd6,0x90,0xd8,0x5c,0x09,0xf1,0x91,0x25,0x91,0xb6,0x9b,0x9b,0x4e,0xd0
+,0x00,0xe9,0x93,0x40,0x44,0xd6,0xd3,0xd3,0xe5,0xbe,0x40,0xcb,0x4f,0xa2,0x9b,0x45
+,0x92,0x8c,0x2f,0xfc,0x4b,0x6f,0x43,0xf6,0x2a,0x78,0x12,0x65,0x9d,0x26,0x9d,0x21
+,0x38,0x63,0x85,0xcc,0x68,0x51,0xdd,0x9e,0xba,0x70,0xba,0x77,0xf0,0x4f,0xc4,0x3b
+,0xc4,0xc1,0x18,0xc5,0xe2,0x06,0x3e,0xf3,0xc2,0xea,0x61,0xe5,0x9b,0xb6,0x1c,0x00
+,0xb1,0x77,0x9c,0x26,0xbd,0xc6,0x45,0xc2,0xab,0x20,0x92,0xb1,0x81,0xe5,0xa5,0x51
+,0xec,0x52,0x09,0xac,0x39,0x6d,0x20,0x5d,0x77,0xd1,0x57,0x70,0x8b,0x6f,0x9e,0xbc
+,0x54,0x0d,0x0d,0x37,0x11,0xc5,0xc0,0xe9,0x73,0xaf,0xac,0x22,0xb3,0xb9,0xfb,0xe5
+,0x1b,0x0c,0xe3,0xc0,0xf8,0x98,0x60,0x9e,0x59,0x8d,0x88,0x40,0x74,0xa8,0x11,0x1d
+,0x5c,0xd3,0xaa,0xfd,0xb8,0x3d,0xd6,0x79,0x11,0xdb,0xe1,0xd4,0xc2,0xdc,0x1a,0xf4
+,0xe8,0x32,0x58,0xb8,0xa4,0x19,0xd1,0xf5,0x87,0x68,0x7c,0x5e,0xd9,0x69,0x74,0xd9
+,0xe8,0x0c,0x88,0x27,0x90,0xe0,0x57,0xc4,0x77,0xd0,0xdd,0xf2,0xb9,0x93,0xf7,0x35
+,0xd5,0xed,0xbd,0x01,0x0c,0x15,0x7c,0x09,0x0b,0x20,0x46,0x3b,0x40,0xb8,0x03,0xfa
+,0xdc,0x83,0x7d,0xf7,0x34,0x46,0xc3,0xc4,0x9f,0x8c,0x8a,0xc1,0xa7,0x97,0xc7,0xd6
+,0x93,0x13,0x5e,0x7a,0x91,0x0d,0x10,0xc1,0xe5,0x52,0x6e,0xbb,0x2b,0x64,0xdb,0x29
+,0x93,0x78,0x3f,0x45,0xb0,0xcf,0x78,0x6e,0xee,0x5e,0x8f,0x85,0xf6,0x30,0xfe,0xc1
+,0x04,0xde,0x94,0x2b,0x5f,0x88,0x07,0xea,0x70,0xcc,0x31,0x0a,0xf6,0x98,0xca,0x2a
+,0xe0,0xea,0x59,0x6d,0x36,0xb1,0xeb,0x55,0xa8,0x29,0xc0,0xd5,0xe1,0xc0,0x01,0x1d
+,0xcf,0x47,0x63,0x88,0x35,0x03,0x8c,0x98,0x9c,0x1e,0xcb,0x60,0xb2,0xaa,0x04,0xa8
+,0x25,0x6c,0x68,0xd3,0xdb,0xb8,0x1c,0xd3,0xcd,0xa7,0x1d,0x14,0x95,0x6a,0x30,0x4e
+,0x67,0x04,0xa2,0x73,0xca,0xb1,0xa1,0xf8,0x94,0x47,0x86,0xd8,0x14,0x8c,0x5d,0xb6
+,0x64,0x31,0xd4,0xb6,0xaf,0x10,0x4c,0xef,0x8d,0x11,0x1d,0x94,0x37,0x40,0xea,0x20
+,0x68,0x76,0x26,0xd9,0xf0,0xd9,0x4a,0x08,0x7a,0xac,0x5d,0x55,0xb6,0x96,0x27,0xa5
+,0xc4,0x1e,0x96,0xe6,0x0a,0xaa,0x1c,0xe7,0x26,0xc7,0x64,0x5b,0x5e,0x24,0x62,0x08
+,0x62,0x07,0x56,0x7f,0x21,0x30,0xba,0x30,0x83,0x0b,0xdf,0x56,0xbf,0x84,0x73,0xab
+,0xe0,0x28,0x35,0xea,0xd6,0x0e,0x40,0x7e,0xd3,0x72,0x15,0xfc,0x83,0xb8,0xb8,0x1c
+,0x61,0x4f,0x30,0x17,0xb4,0x83,0xd8,0x25,0x35,0xad,0x2c,0x14,0xb8,0x5e,0xe3,0x40
+,0x15,0x03,0x98,0x39,0xbd,0x3c,0xbd,0x8f,0x34,0xe8,0x57,0x95,0x7d,0xa8,0xdd,0x19
+,0x7f,0x0a,0x10,0xee,0x07,0x56,0xb0,0x77,0xdf,0x33,0x4d,0x08,0x29,0x49,0x69,0x00
+,0xda,0xdb,0x72,0x40,0xc4,0xdb,0x8a,0x30,0xb6,0x70,0xb8,0xc6,0x15,0xb0,0x7e,0x9f
+,0x03,0x0a,0x0e,0x94,0x03,0x50,0x7e,0x72,0xef,0x9e,0x01,0x0a,0x76,0xf3,0x26,0xb3
+,0xb6,0xf9,0xa7,0xc1,0x70,0x75,0xe2,0xf6,0x7e,0x7d,0xda,0xfe,0xfb,0x27,0xed,0x37
+,0xcd,0x98,0x4d,0x82,0xa0,0x7d,0xb5,0xf3,0x27,0xfb,0xe1,0xe9,0x0c,0x7a,0x10,0x8d
+,0xa2,0xe6,0x42,0xfe,0x7f,0x69,0x32,0xa3,0xf8,0xf7,0x8d,0x00,0xeb,0x54,0xf4,0x65
+,0x66,0x33,0xfe,0x13,0x5d,0x4e,0xdb,0xa3,0xa4,0x44,0x12,0x8f,0xb6,0x79,0xbd,0xad
+,0xcd,0xb5,0xcd,0x9f,0xb6,0x6f,0xe8,0x51,0xeb,0x77,0xff,0x5c,0xa4,0x37,0x45,0xe1
+,0xc4,0xba,0xc9,0xb0,0xb6,0x71,0xad,0x1a,0x69,0x91,0x38,0x97,0x88,0xcd,0xd7,0x7c
+,0xe0,0xba,0x12,0xb5,0x0c,0x70,0xdc,0x2f,0x27,0xe9,0x83,0x3b,0x05,0x8c,0xee,0x4d
+,0x67,0x20,0xb7,0xbc,0xc6,0xc7,0x67,0x80,0x85,0x15,0xf0,0xc2,0x47,0x6a,0x3f,0xc1
+,0x16,0xfe,0x55,0xc0,0xab,0x48,0x01,0xaf,0x7e,0x23,0xc4,0x50,0x1e,0xf8,0x2f,0xc8
+,0x37,0x99,0xc5,0x02,0x24,0xc8,0xe0,0x89,0x6b,0x83,0x7b,0xf5,0xb1,0x71,0x0a,0x94
+,0x05,0x75,0xfd,0xc4,0xb0,0x38,0xc8,0xf9,0x8e,0xc4,0x1a,0xbe,0x76,0x6a,0xcf,0xfd
+,0xe8,0xa7,0xcc,0x83,0x4d,0x96,0xde,0xb7,0xe8,0xda,0x0a,0x43,0x4e,0x01,0x2f,0x2a
+,0x04,0xe8,0x71,0x04,0xf5,0x7d,0xd2,0x78,0xd7,0x3f,0x39,0xd6,0xbd,0xa0,0xcc,0x15
+,0x37,0xc8,0xca,0x1c,0x68,0x52,0x19,0x57,0x86,0x21,0x7e,0x6a,0x69,0x75,0x3a,0x8c
+,0xac,0xe7,0x92,0x0d,0xdd,0xaf,0x26,0x22,0x52,0x9f,0x0e,0xeb,0x2f,0xe3,0x85,0x61
+,0xd7,0x80,0xef,0x38,0x5d,0xb4,0x19,0xb8,0xd9,0xc5,0xb5,0x7a,0x8d,0x84,0x3e,0x27
+,0x12,0xe2,0x40,0x05,0x8a,0x45,0xf7,0x2e,0x83,0x05,0xaf,0x63,0x78,0x44,0x13,0x1f
+,0x8d,0x8e,0x3d,0x5d,0xa5,0xb9,0x8b,0xac,0x08,0xcc,0x27,0x58,0x85,0x85,0xb8,0x17
+,0x0a,0xec,0xbf,0xbd,0xfb,0x6e,0x10,0xd2,0xcc,0x6e,0x18,0x68,0x9c,0xee,0x8a,0x6f
+,0xd3,0xc7,0x72,0x3b,0xda,0xa5,0xdb,0xe3,0xde,0xbb,0x28,0xb0,0xe6,0x62,0x9a,0x8e
+,0xaa,0xee,0x02,0xce,0xd9,0xdd,0xe5,0xbc,0xcb,0x31,0xea,0x37,0x82,0xcc,0x85,0x35
+,0xed,0x8a,0x72,0x34,0x3a,0x1f,0x5f,0xce,0xbb,0xe7,0xe3,0xfd,0x3c,0xa8,0xb9,0x52
+,0x7c,0x4e,0x03,0x8e,0xde,0x15,0xb3,0xb4,0x7b,0x60,0x23,0x65,0x4c,0xcf,0x05,0xbf
+,0xdb,0x78,0xfc,0x66,0x19,0x3e,0xf2,0x51,0x04,0x00,0x93,0x6b,0x45,0x1b,0xf1,0x9f
+,0x48,0x52,0x02,0x5f,0xc8,0x7f,0x14,0x20,0xcf,0x86,0xf0,0x4e,0x92,0xe9,0x48,0xa0
+,0xed,0x69,0x2e,0x82,0xc8,0x07,0xe1,0xf7,0xa3,0xbf,0xfd,0x07,0x0b,0xdc,0x76,0x74
+,0xff,0xb1,0x9c,0xcd,0x4d,0xf3,0xcb,0x6e,0x2c,0x48,0x2e,0xa9,0xfa,0x71,0xda,0xe4
+,0x18,0x85,0x8b,0x39,0xb5,0xbe,0x4b,0x36,0x4a,0xa2,0x15,0xfd,0xed,0x10,0x2d,0x75
+,0x6d,0x4b,0x87,0x19,0xc7,0xf1,0xb3,0xf3,0x75,0xf3,0x6f,0x6f,0xbb,0xf9,0xb6,0x81
+,0x8d,0xa9,0x6d,0xfe,0xb6,0xdf,0x9d,0x6f,0x33,0x1e,0x40,0x06,0x28,0x60,0x61,0xa3
+,0xa2,0x65,0x9d,0x53,0xb9,0xcc,0x87,0x45,0xf4,0x50,0x7f,0xd6,0x67,0xe7,0x3a,0x73
+,0x73,0x8f,0xf9,0x65,0xb4,0x4c,0x5e,0xb7,0xe8,0x63,0xf7,0x6f,0x7b,0xdd,0xbf,0xfd
+,0xb5,0x7b,0x50,0xb2,0xa9,0xee,0xaf,0xcb,0xcc,0x53,0x10,0x58,0x8f,0xaf,0xe2,0xbb
+,0x30,0x46,0x42,0x93,0xb2,0x1c,0x5c,0x7c,0x77,0x00,0x5c,0xf5,0xe3,0xa2,0xb8,0x05
+,0x4e,0xe6,0x3e,0x89,0xe5,0xd0,0x8e,0xc0,0x5f,0x03,0x63,0x47,0x31,0xe7,0x23,0xa6
+,0x8e,0xce,0x82,0x83,0xb7,0x30,0x47,0xe7,0x77,0xaf,0xba,0xf4,0xd7,0x6b,0x3b,0x7a
+,0xa8,0x4a,0x00,0x70,0x00,0xde,0x79,0x4a,0x0d,0x02,0x18,0x55,0xf0,0xa6,0xf8,0x33
+,0xa1,0x7f,0x21,0xbe,0x23,0x0a,0x2f,0x86,0xe6,0xb7,0xc7,0x51,0x3f,0xed,0xa2,0x06
+,0x2e,0xf8,0x77,0xfe,0x99,0x78,0x18,0xa5,0x0b,0x0b,0xb3,0x7b,0xfa,0xbd,0xd9,0x35
+,0xbb,0xf4,0xc7,0xec,0xf1,0x40,0x4e,0x3e,0x18,0x6a,0xf0,0xbc,0x7f,0x61,0x7a,0x67
+,0xbb,0xa6,0x77,0xf1,0x9d,0xe9,0x7f,0xe8,0x3f,0x07,0xb0,0xeb,0x9c,0xb0,0xaf,0xe2
+,0x9b,0x61,0x39,0xf2,0xf0,0x2b,0xaa,0x44,0xa2,0xbb,0x06,0xaf,0xaf,0x3d,0x2e,0x65
+,0x18,0x4b,0x6f,0x6b,0x5b,0xe8,0x06,0xff,0x04,0xdb,0xea,0x05,0x87,0x3e,0xe2,0xc9
+,0x0b,0x0e,0x32,0x72,0xbb,0x64,0x49,0x3c,0x6f,0xe5,0x23,0xf0,0xa9,0xa7,0xe1,0x4c
+,0x82,0x37,0x43,0x25,0xbe,0x96,0xb8,0x04,0xf2,0x69,0x3c,0xc6,0x1f,0x97,0xc9,0x54
+,0xb4,0xec,0x52,0x0c,0x65,0xbe,0x94,0x8a,0x6d,0x73,0xf8,0xd7,0xfd,0xd3,0x96,0xa0
+,0x1f,0xd4,0x3b,0x11,0x62,0xe7,0xd9,0x71,0x39,0x1f,0x29,0x89,0xc3,0xe2,0xed,0xe0
+,0x3e,0x2d,0x2d,0x3a,0x65,0x1b,0x72,0x97,0xe1,0xb6,0x20,0x36,0xad,0xd7,0x67,0x70
+,0xf4,0x3b,0x51,0x3d,0x5f,0x1d,0x9d,0x6f,0x5f,0xb3,0x8a,0x96,0x9d,0xa7,0xe8,0x26
+,0x11,0xff,0x29,0x76,0x98,0x02,0x74,0x52,0xf8,0x65,0xaf,0xfb,0x4e,0x58,0xc3,0x84
+,0x88,0x8e,0xfb,0xf4,0x86,0x0f,0x3a,0x31,0x0d,0xef,0x38,0x31,0x5a,0xc9,0x67,0x9f
+,0xaa,0xe5,0x82,0x17,0x11,0x41,0x09,0x1a,0x60,0xcb,0x98,0xa6,0x46,0x6a,0xa6,0xd5
+,0xb0,0x45,0x93,0xc8,0x16,0x7f,0xea,0x49,0x09,0x5a,0x2f,0xc0,0x3e,0x34,0x60,0xbe
+,0x8a,0x14,0xaf,0xfe,0x40,0x5c,0x7d,0xa9,0xe3,0xf8,0xee,0xe5,0xc5,0x71,0xdb,0x7b
+,0xf3,0xd3,0x06,0xe5,0x74,0x23,0x9c,0x01,0x8c,0x35,0xf9,0x1d,0x9f,0x2a,0x49,0x2d
+,0xa9,0x43,0x54,0xfd,0x57,0x75,0x7e,0x0e,0x2e,0x28,0x80,0x6a,0xf2,0x85,0xc4,0x8e
+,0xc7,0xea,0x28,0x46,0x5d,0x74,0x3c,0xc2,0x26,0xd0,0x69,0x58,0xef,0x99,0x02,0x58
+,0xcd,0xcf,0xe2,0x73,0x7b,0xf3,0x7e,0xa0,0xe6,0xc5,0x45,0x79,0x5f,0x4d,0x59,0xd7
+,0xa9,0x51,0x62,0xf5,0xed,0x68,0xd3,0x64,0x09,0x8a,0x81,0x4b,0x58,0x83,0xfb,0xd6
+,0xb6,0x11,0x2f,0x96,0x23,0x71,0xe2,0x5d,0x54,0x83,0x0d,0x36,0xac,0x70,0x6c,0x46
+,0x00,0x42,0xcc,0x96,0x91,0x55,0x47,0x58,0x57,0x85,0x01,0xd6,0xaa,0x41,0xcb,0x42
+,0x92,0xf9,0xef,0x81,0xd1,0x2e,0x25,0xcc,0x57,0xdc,0x41,0xa0,0xff,0xd2,0x5f,0x04
+,0xff,0x0b,0x5b,0xad,0xde,0x47,0x63,0x4b,0xc2,0xab,0x52,0x80,0x34,0xbc,0x1a,0x9a
+,0xdf,0xf1,0x52,0xaf,0x54,0xa2,0xf2,0x13,0xda,0x45,0x54,0x8c,0xd9,0xab,0x23,0xbe
+,0x79,0x6d,0x98,0x4a,0xc1,0xb8,0xca,0x31,0x20,0x1b,0xb8,0xf4,0x8b,0xd2,0x47,0x2c
+,0x97,0x80,0xd6,0x55,0x17,0xea,0x92,0x51,0x1d,0xf0,0x69,0xfa,0xda,0x27,0x36,0xb4
+,0x3e,0x37,0x1e,0x2d,0xb4,0xe4,0x21,0xdf,0xcb,0xb1,0xaa,0x17,0x93,0x48,0x8a,0xa0
+,0xcb,0xda,0x66,0x31,0x19,0xb8,0xd3,0x93,0x6d,0x0d,0x44,0xb1,0x07,0x8e,0xe3,0xe3
+,0xe2,0xf1,0xda,0xbc,0xb9,0xec,0x81,0xd7,0xba,0xe8,0xf5,0xcd,0xf1,0x2e,0xc0,0xf8
+,0x9e,0x94,0x24,0x02,0x44,0x85,0x9e,0x79,0x3e,0x85,0x98,0xc2,0x3f,0xd2,0xc3,0x7a
+,0xbe,0x36,0x4e,0x81,0x65,0x83,0x01,0x4d,0x73,0xe3,0x61,0x63,0x23,0xde,0x78,0xf8
+,0xe3,0xa8,0x66,0x26,0xa6,0xa7,0x2f,0xf1,0xf4,0x8f,0x8c,0x92,0x8a,0x2e,0xc4,0xe8
+,0x82,0x90,0x0d,0xa1,0x33,0xb9,0x22,0x3c,0x30,0xbb,0xfa,0x44,0x3f,0x7f,0x83,0x99
+,0x01,0xdb,0x75,0xbe,0x28,0x6e,0xf4,0xb2,0xed,0x9d,0xbc,0xa1,0xeb,0x8a,0x6e,0x17
+,0x9a,0x11,0xf1,0xf7,0x0f,0x8c,0x1f,0x8b,0xa7,0x25,0x99,0xc3,0x78,0xf3,0x08,0x24
+,0x8e,0x47,0xb1,0x8b,0xb1,0xd5,0xc1,0x72,0x50,0x82,0xa3,0x47,0x43,0x78,0x14,0x46
+,0x2f,0xcc,0x06,0x84,0xa9,0x58,0x32,0x90,0xe8,0x48,0x27,0x12,0xea,0x3a,0xa4,0xdc
+,0xa3,0x87,0x98,0x92,0x45,0x3a,0xc6,0xc1,0x5a,0x28,0xfe,0xbc,0x64,0x67,0xb1,0x50
+,0x68,0x05,0xba,0xff,0x68,0xa7,0xed,0xbf,0xf4,0x75,0x51,0x85,0x86,0x1f,0x37,0x57
+,0x08,0xa3,0xd4,0xe8,0x4c,0x28,0xec,0xc3,0x6e,0xfc,0x37,0xf5,0xa2,0x7c,0xda,0x0b
+,0x8e,0xe5,0xb4,0x6a,0x4d,0x46,0xbe,0xb6,0xc1,0x17,0xab,0x5d,0x12,0x58,0x6c,0xd8
+,0x84,0x99,0x34,0x81,0x03,0x02,0x8c,0x38,0x7e,0xde,0x7c,0x1d,0x03,0xed,0x1a,0xca
+,0x93,0xb6,0xc9,0xf8,0xd1,0xd1,0xd6,0x9e,0x18,0x4e,0xff,0x9b,0x86,0xe2,0x02,0x91
+,0xfd,0x78,0xf6,0x0f,0x7a,0x7b,0x3e,0xee,0x95,0x35,0x99,0x27,0x30,0x86,0x60,0x14
+,0xb6,0x38,0xdd,0x18,0x5c,0x8c,0x86,0xf1,0x62,0xf1,0x42,0x79,0xb2,0x84,0xed,0x10
+,0x2f,0xee,0xe5,0x77,0x45,0x45,0x0f,0xac,0x2a,0x11,0xc7,0x94,0x3f,0x15,0x25,0x6c
+,0xcd,0xa7,0x35,0xcc,0x8b,0x7f,0x7f,0x21,0x68,0x7a,0xe6,0x8f,0x3c,0x35,0x2e,0xf4
+,0x15,0x80,0xc1,0xd0,0x4a,0xa9,0x29,0x43,0x15,0x6d,0x0e,0x27,0x50,0xc4,0x59,0x57
+,0x5b,0x99,0x21,0x8b,0x4e,0x3f,0x03,0x0f,0x3e,0x14,0xde,0x08,0x48,0x50,0x28,0xeb
+,0xf8,0x3e,0xfb,0x09,0x62,0x67,0x30,0x14,0x1e,0xa6,0x35,0xeb,0x84,0x5d,0xab,0x0d
+,0x26,0xc2,0x74,0xd9,0x11,0xc1,0x07,0xfe,0x1e,0xb7,0xac,0x23,0xed,0x99,0x84,0xa6
+,0xa2,0xad,0xdf,0xb2,0x8e,0xee,0x1e,0x22,0x06,0x9b,0xb1,0xaf,0xd5,0x5e,0x03,0x2b
+,0x6e,0x15,0xc4,0x37,0x01,0xbd,0x85,0xb8,0x60,0xd8,0x7a,0xfe,0xd3,0x4b,0x0f,0xed
+,0xb9,0xdc,0x66,0x17,0x67,0x27,0xca,0x86,0x9e,0x5d,0x3f,0x17,0xf4,0xe6,0xed,0x70
+,0x29,0x92,0x1c,0xb2,0x63,0xff,0xc8,0x67,0x99,0x20,0x51,0x7f,0x06,0x3f,0xb0,0x9c
+,0xf8,0xf6,0x6c,0x28,0x39,0x5d,0x30,0x44,0x5b,0x9d,0x89,0xb4,0xbb,0x7d,0x19,0x10
+,0xab,0x25,0xb0,0x91,0xf2,0xbe,0x82,0x13,0xe9,0xca,0x7b,0xd7,0x4b,0xf0,0x3d,0x6f
+,0xc7,0xf9,0x62,0xf9,0xc5,0x0f,0xd7,0x82,0xc4,0x17,0xe2,0x9a,0xd5,0x21,0x1a,0xcd
+,0xd1,0x3e,0xfa,0xf3,0xd6,0x9b,0x40,0xed,0xe3,0x12,0xa6,0x61,0x7e,0xaa,0xce,0xbb
+,0xc4,0x5d,0x8c,0x46,0xa9,0x18,0x07,0x6c,0x21,0x88,0xc0,0xd2,0xac,0x68,0xfb,0xc2
+,0xa8,0x10,0x75,0x4a,0xa2,0x96,0x10,0x4a,0x83,0x9d,0xc0,0xfe,0x21,0x82,0x0d,0xf6
+,0x76,0xbc,0xf4,0x97,0x2c,0x80,0xd2,0xe1,0xb1,0x1c,0xd4,0xf6,0x9f,0xc2,0x47,0x96
+,0xbf,0xd8,0x11,0x75,0x9b,0x8e,0xbe,0x88,0x7f,0x08,0xca,0xfc,0x92,0xdf,0x53,0x36
+,0x12,0x5b,0x31,0xae,0x35,0x58,0x5d,0x8f,0x4e,0xfb,0x07,0x17,0x87,0xbb,0x7b,0x24
+,0x42,0x08,0x96,0x91,0x06,0xad,0xbb,0x28,0xdf,0x85,0x33,0x2e,0xd3,0xbe,0x4d,0x2b
+,0xf0,0x49,0x62,0x6e,0x1f,0x89,0x07,0xcb,0x33,0x09,0x7a,0xad,0x00,0x2a,0x10,0xab
+,0xbe,0x34,0x03,0x17,0xaf,0xa6,0xc5,0x75,0x6f,0xa3,0x5a,0x1c,0x7a,0xbb,0x96,0x08
+,0x8a,0x9d,0x83,0xaa,0x32,0x9d,0x8e,0x1c,0x50,0xb9,0x9c,0x97,0xb0,0x27,0x7a,0x9b
+,0xfa,0xcf,0xd9,0xb2,0xd0,0x6f,0xb8,0xcd,0xaf,0x9d,0x2a,0x58,0x2b,0xdd,0x53,0x3b
+,0x26,0xc4,0xee,0xb6,0x93,0x77,0xd9,0xe0,0xe0,0xfb,0xc5,0x89,0x25,0x18,0xdd,0x4e
+,0x66,0x88,0x0f,0x85,0x26,0x7d,0x64,0x17,0x95,0xdc,0xb8,0x59,0xdc,0x8e,0x22,0x90
+,0xf4,0xab,0xee,0xc9,0x6e,0xef,0x5b,0x87,0xe0,0x14,0x33,0x34,0x12,0xa4,0x2c,0x47
+,0x53,0x9a,0x9b,0x9d,0xad,0xce,0xcb,0xce,0xab,0xee,0x57,0x2d,0xc5,0xfd,0xa4,0x6e
+,0x61,0xe8,0xfe,0xbb,0x54,0xf4,0xf3,0x90,0xf8,0x23,0x69,0x90,0xa1,0xb7,0x63,0xd4
+,0xef,0x8a,0xa2,0xca,0xd4,0x04,0xb6,0xe6,0x26,0xfd,0xd9,0xde,0xfe,0x9a,0xfe,0x74
+,0x37,0xb7,0xe8,0xa8,0x2c,0xe7,0x9f,0x59,0x30,0x0f,0x35,0xb3,0xfe,0x2b,0x2c,0xc0
+,0x3d,0xf3,0xcd,0x68,0x77,0x78,0x87,0x44,0x96,0x7e,0xac,0xcd,0x3a,0x30,0x0a,0x6d
+,0xb7,0xa5,0x78,0x8f,0x40,0x69,0x37,0x48,0x01,0x94,0x62,0x4b,0x04,0x1f,0xf2,0x5d
+,0x74,0x43,0x8e,0x68,0xf7,0x30,0xa6,0x2a,0xdf,0x79,0x2b,0xd3,0x62,0xdf,0xc1,0x7d
+,0x65,0xeb,0xab,0xaf,0x3a,0xf6,0xff,0x1b,0x35,0x96,0x76,0xeb,0x55,0x54,0x3d,0x7c
+,0x5c,0xa6,0xcb,0x74,0x9a,0x32,0xd0,0x37,0x37,0x12,0x5c,0x0d,0x1c,0x14,0xcd,0x80
+,0x85,0xf0,0x3d,0x76,0xa6,0x92,0x1a,0x7a,0x49,0x34,0xab,0x96,0x5a,0xd7,0x2f,0x8f
+,0x46,0x50,0x52,0xc1,0x71,0x21,0x4a,0x79,0x69,0xa0,0x69,0xfd,0xde,0xfa,0xb8,0xc1
+,0x6c,0xc6,0x16,0x78,0x24,0xb7,0xa2,0x9b,0x45,0x91,0x0c,0x07,0xf0,0xc1,0xd6,0x11
+,0xc5,0x9c,0x83,0xc9,0x3f,0xb6,0x03,0xe7,0x4c,0x38,0x85,0xe4,0xc3,0xe1,0xa2,0xb1
+,0x39,0x3f,0x3f,0xe7,0x65,0xa7,0x7f,0xcf,0x0e,0x8c,0x5c,0x26,0x59,0x8d,0x78,0xac
+,0x11,0x7d,0x11,0x75,0x84,0xf7,0xf5,0xb9,0x5f,0x8b,0x26,0xf7,0x22,0x43,0xaf,0x4c
+,0xa2,0xe3,0x70,0x9b,0xb3,0x64,0xd0,0xf2,0xbb,0x82,0x9d,0xaa,0x76,0x0c,0xdb,0xdc
+,0x3f,0x67,0x74,0x8e,0xf3,0xec,0x86,0xbe,0xdb,0xa2,0x1b,0x8c,0xe5,0xc6,0xd3,0x83
+,0xf7,0x1a,0x8b,0x81,0x35,0x13,0x83,0x81,0xdf,0x0c,0x87,0x53,0x24,0x78,0x7c,0xd4
+,0xd4,0x30,0x6c,0x02,0xe0,0xed,0xee,0x8a,0xb0,0xed,0x50,0xe1,0x9b,0x71,0x46,0xc5
+,0x0c,0xe1,0x7c,0x10,0x62,0xec,0x8e,0x64,0x31,0x77,0xf3,0x2c,0xea,0x28,0x0c,0x77
+,0x57,0x7b,0x78,0x91,0x96,0x16,0x41,0x8e,0x38,0xce,0xaa,0x18,0x20,0x50,0x1e,0x26
+,0x98,0x39,0x71,0xd9,0xa7,0x86,0x27,0x81,0x66,0x90,0x2e,0x83,0x8c,0xd5,0x21,0xb6
+,0x0d,0x9b,0x5e,0xd4,0x2e,0x14,0x53,0x03,0x84,0x1f,0xbf,0xa8,0xc4,0x0c,0x4c,0xb3
+,0x89,0x06,0xdc,0xc4,0xd8,0xc5,0x60,0x37,0x5f,0x5e,0x9e,0x58,0x2d,0x1f,0x7e,0x34
+,0x6c,0x43,0xf4,0x05,0xd8,0xb5,0x35,0xd3,0xb0,0x39,0xc9,0xca,0xaa,0x29,0x56,0x22
+,0x3a,0x02,0x5c,0x0e,0x1d,0xb2,0x9d,0xe3,0xd0,0x22,0x57,0x59,0x3b,0xe6,0xe8,0x2e
+,0x11,0xa0,0x6c,0xf4,0x38,0x44,0x36,0xb2,0xb7,0x2c,0xac,0x5d,0x6d,0x0b,0x8d,0x60
+,0x4e,0xe9,0x3d,0xbc,0x50,0x42,0x17,0x3a,0x23,0xf0,0x92,0xce,0x4a,0x84,0xb2,0xa6
+,0x18,0xc0,0x9c,0x29,0x49,0x15,0xd0,0x84,0x40,0x3a,0x72,0x8b,0x49,0xc9,0xb0,0xc6
+,0xfc,0xf3,0xc1,0x77,0x48,0x1e,0x2e,0x12,0x21,0x04,0x7b,0x15,0x3c,0x8f,0x46,0xf2
+,0x9a,0x66,0x06,0x3a,0x5d,0xfe,0x80,0x62,0x5d,0xd6,0xe2,0x7b,0x19,0x96,0x47,0xe3
+,0x54,0xa8,0x30,0x9c,0x2a,0x92,0x20,0x9a,0x44,0x72,0x7f,0xb9,0xa8,0x0e,0x49,0xd6
+,0x35,0x4b,0xab,0x84,0xfd,0xe8,0x34,0x75,0x12,0x71,0xa6,0x86,0x03,0x49,0x87,0xa6
+,0x09,0xfe,0x0c,0x52,0x08,0xe0,0x8b,0x16,0x86,0xd1,0x43,0x6c,0xd2,0xaf,0x7d,0xa3
+,0xe9,0x65,0xe4,0xf7,0x13,0xa3,0x9e,0x3a,0xc1,0x9f,0x0d,0xdf,0xd0,0x32,0x0f,0x9b
+,0x82,0x37,0x70,0x6e,0x93,0xc7,0x52,0xb3,0x86,0x95,0xff,0x23,0x58,0x01,0x00,0x89
+,0x8c,0xb7,0xf7,0x98,0x3d,0xc9,0xf4,0xb1,0xab,0xc3,0xc9,0x57,0xb2,0xd5,0xe8,0x00
+,0x67,0xf6,0xcb,0x19,0x53,0xcc,0x47,0xfb,0x6b,0xc1,0x70,0x39,0xb9,0x8f,0x84,0xf1
+,0xa8,0x3c,0xae,0xeb,0xba,0x7a,0x0f,0xba,0x64,0x13,0x86,0x09,0x52,0xf5,0x30,0xdd
+,0x47,0x98,0xfd,0xb2,0xed,0x37,0x00,0xf4,0x0f,0x30,0x64,0x30,0xe7,0x19,0x42,0x1c
+,0x60,0x71,0xbc,0x0f,0x21,0x91,0x02,0x78,0x41,0x13,0xd7,0x7f,0x89,0x65,0x74,0x59
+,0x54,0x59,0xc5,0x97,0x30,0x6a,0x15,0x16,0x61,0x39,0x15,0xcf,0x0f,0x57,0x92,0x9d
+,0xff,0x02,0xaf,0x20,0xda,0xbf,0xec,0x0f,0x11,0x36,0xcc,0xf9,0xea,0xaf,0xe2,0xe1
+,0xfe,0xbc,0xbc,0x93,0x7c,0xc9,0xe2,0x80,0x78,0x15,0x8f,0x8d,0xc3,0x2b,0x9e,0xb1
+,0xc4,0x51,0x07,0xa4,0xbf,0x72,0x88,0xf4,0xd7,0xcf,0x41,0xd2,0x2b,0x52,0x47,0x00
+,0x3f,0x2d,0x5e,0x94,0xbb,0x03,0x18,0x24,0x48,0x16,0x60,0xd7,0x37,0x13,0xcf,0x9f
+,0x87,0x98,0xaf,0x05,0xe9,0x09,0xa0,0xef,0xb8,0xc1,0x32,0x04,0x5b,0x27,0x24,0xf8
+,0x0b,0xfb,0x94,0xfb,0xc8,0x29,0x5e,0x90,0xbf,0x25,0x88,0xe4,0xa2,0x77,0x2c,0x43
+,0xc5,0xc5,0xb3,0xf5,0x30,0xca,0x5f,0x40,0x4f,0x87,0x26,0x83,0x53,0xd2,0xae,0x41
+,0xc7,0x3b,0xa7,0x3e,0xae,0x39,0x90,0x72,0x67,0x40,0x79,0x1e,0xaa,0xfc,0x89,0xfa
+,0x87,0xba,0x02,0x8d,0x0c,0x4d,0x1c,0x66,0x6f,0x60,0xf6,0x48,0x58,0xef,0xd5,0xe1
+,0x42,0x7c,0x68,0xf4,0x67,0x49,0xb1,0xe3,0xf3,0x10,0x62,0x61,0x8f,0xba,0x67,0xb5
+,0x8c,0x39,0x9a,0x26,0x47,0x93,0x6a,0x8b,0x8e,0xca,0x5b,0xec,0x3c,0xac,0x3a,0xc8
+,0x31,0x73,0x39,0xf1,0xbc,0xe5,0xf9,0x30,0x97,0x8e,0xc7,0xc5,0x3e,0xa3,0xfd,0xc1
+,0x94,0x76,0x4a,0x37,0xcc,0xc0,0x33,0x68,0x70,0x4f,0xe9,0xbe,0xd8,0x8c,0x5f,0x6e
+,0x9b,0xcd,0x26,0xb8,0x52,0x56,0x06,0xb5,0xcd,0x56,0x13,0x26,0xad,0x98,0xd8,0x4e
+,0xe2,0x97,0xc2,0x88,0x9b,0x97,0x4d,0xb8,0x56,0xc7,0xd9,0x90,0xcd,0xc9,0x79,0x43
+,0xc0,0x46,0x76,0xcc,0x46,0xfc,0xc7,0x6d,0xd3,0xdc,0x60,0x55,0x56,0x36,0x9e,0xc0
+,0xa0,0x66,0xbf,0xe5,0x33,0x4d,0xef,0x98,0xaf,0x58,0xad,0xb6,0xcb,0xdc,0xac,0xef
+,0xdf,0x79,0x9d,0x15,0x2e,0xe7,0xc9,0x7d,0x6e,0x81,0x3c,0x88,0x1e,0x4e,0x87,0xac
+,0x45,0x12,0x2f,0x0c,0x38,0xd5,0x2f,0x45,0x83,0xc8,0xec,0x04,0x0d,0xcd,0x7e,0x88
+,0x58,0x37,0x21,0xa6,0xce,0xd0,0x57,0xb8,0xa9,0xa4,0x7e,0x49,0x0a,0x46,0x30,0x33
+,0xb4,0x48,0x5b,0x30,0x5c,0xbf,0xf2,0xa7,0x84,0x9a,0xe6,0x55,0xe4,0xf4,0x47,0x76
+,0x05,0x5d,0x1a,0xa4,0x3a,0x83,0x2c,0x0b,0x17,0x7e,0x99,0x19,0x78,0x3b,0x1a,0xb7
+,0x60,0x32,0xbd,0x22,0x4e,0x46,0x6b,0x8b,0x6a,0xcd,0x4a,0xc0,0x3c,0xcb,0x6d,0xb3
+,0x76,0x93,0xca,0x23,0xcc,0xb5,0xb1,0x73,0xbd,0x86,0xb9,0x95,0xe7,0x92,0xff,0x07
+,0xd4,0x06,0xcf,0xe0,0x5b,0x18,0xad,0x01,0x2f,0x8c,0x23,0x61,0x04,0xe7,0x01,0xd2
+,0xee,0x94,0x01,0x35,0x5d,0x9a,0x26,0x95,0x5f,0x69,0x45,0xea,0x0b,0xe2,0xd7,0xe1
+,0x55,0x40,0x77,0x0a,0x60,0x1d,0x5c,0xc5,0xbb,0xc9,0xb7,0x67,0x37,0x1f,0xd5,0x2f
+,0x93,0x23,0xae,0x05,0xf1,0xb6,0x77,0xb0,0x77,0x76,0xba,0xdf,0x53,0x2f,0xe6,0xa3
+,0xfd,0xb6,0xf7,0x60,0x6e,0x43,0x9d,0x92,0xe4,0xb7,0x81,0x16,0x95,0x78,0x02,0x9a
+,0x16,0x6c,0xae,0x5d,0x66,0xce,0xe9,0x97,0x1a,0xd0,0x46,0x79,0xcb,0x6c,0x3b,0xdd
+,0x6b,0x8c,0xb1,0x41,0x64,0x0c,0xb3,0xc8,0x0e,0x27,0x74,0xae,0x81,0x66,0x49,0x9d
+,0x62,0xf4,0x24,0xf5,0x87,0x63,0xe8,0x31,0xe0,0x7d,0x7c,0x9b,0x4d,0x0b,0x45,0x99
+,0xb9,0x6d,0x1c,0xd2,0x2a,0x32,0xf8,0x11,0xf0,0x8b,0x89,0xe2,0x1e,0x1c,0xef,0x07
+,0x69,0xef,0xe3,0xab,0xfd,0xeb,0xa3,0xb3,0x76,0x7c,0x00,0xd4,0xd6,0x76,0x7c,0xce
+,0xf9,0xb2,0x67,0x2e,0xa4,0xc1,0xf3,0x8f,0x15,0xb1,0xa0,0xa5,0x85,0x07,0x61,0x9c
+,0x61,0x97,0xf3,0xda,0x0f,0x69,0x58,0xe8,0x09,0x52,0x37,0xc8,0xfb,0x27,0xdf,0xc3
+,0xac,0x9c,0x5f,0xb4,0x79,0x4a,0xe8,0xd3,0x17,0x07,0xbb,0xfb,0xf8,0xf7,0x3d,0x2d
+,0xc6,0x41,0xbb,0xf7,0x7e,0xf7,0xbc,0x2d,0x1d,0x02,0x11,0x10,0x15,0x2a,0x7a,0xcd
+,0x28,0x2b,0xe9,0xd4,0x39,0x08,0x36,0x37,0xe2,0x0f,0x7e,0x85,0x5e,0xb7,0x38,0xd8
+,0x9a,0x3d,0x53,0x24,0x83,0x13,0x1d,0xfc,0xaa,0x7a,0x6c,0xa9,0x87,0x33,0xed,0x44
+,0x5d,0x99,0x1a,0x26,0x87,0x19,0x3c,0x0e,0x02,0xb7,0x66,0xf3,0x92,0xcf,0x28,0x47
+,0x60,0xc9,0x05,0x24,0x4b,0x6b,0xd8,0x07,0x88,0x2f,0x0c,0x4e,0xc4,0xa5,0xbe,0x87
+,0x25,0x6f,0xff,0xd2,0x49,0x9f,0xf2,0x08,0xe3,0x62,0x65,0xe2,0x5f,0xc5,0x55,0x05
+,0x56,0x0f,0xb6,0xd4,0x8a,0x01,0x18,0x79,0x56,0x88,0x4b,0xa1,0xdd,0x7a,0x7c,0x70
+,0xd8,0xef,0x5e,0x1c,0xbd,0x7d,0xd7,0x67,0x7b,0x86,0x26,0x55,0xe4,0x3d,0x7d,0x79
+,0xde,0xdd,0x3f,0x7b,0x7f,0xca,0xb7,0xac,0xba,0x97,0x4b,0x9c,0x46,0x55,0x08,0x57
+,0x16,0x49,0x36,0xcd,0xb6,0xb9,0x10,0x55,0x8f,0xd8,0xa2,0xa4,0xf2,0x5f,0x19,0xdf
+,0x9b,0xc6,0xe0,0x36,0xed,0x6d,0xc6,0x17,0x1a,0xfd,0xbf,0x77,0xf4,0xf6,0x14,0xee
+,0xf3,0x9f,0x0d,0x23,0x32,0xe1,0x17,0xfc,0x6c,0x1f,0xd3,0x70,0xd4,0x7f,0x10,0x57
+,0x55,0x36,0x66,0x1c,0x82,0xc2,0xae,0x2e,0x1c,0xd4,0xc4,0x03,0x90,0xf5,0xa7,0xfa
+,0x1e,0xd7,0x2b,0xbc,0xd3,0xbc,0xf3,0x66,0xb3,0x6c,0x39,0xff,0x6d,0xfd,0x86,0x9b
+,0x61,0xfa,0x9d,0x64,0xc1,0x93,0x56,0xd8,0x35,0xb9,0x6e,0xa7,0x38,0x29,0x19,0x9b
+,0xec,0xb5,0x3f,0x9f,0x5d,0x1f,0xaf,0x71,0xfb,0xef,0x1d,0xf4,0x7a,0x3f,0x81,0x1d
+,0xf7,0x5d,0x4c,0x6c,0x27,0xbc,0x67,0x0f,0xb7,0xae,0x7a,0x99,0x60,0x5b,0x3a,0x8f
+,0x0a,0xf1,0x7e,0x64,0x65,0x04,0xc6,0x92,0x35,0x76,0x35,0x8f,0x45,0x4d,0xc9,0xa3
+,0x92,0x11,0x7a,0xc7,0xb1,0x79,0x53,0x55,0x62,0x38,0x73,0x36,0xf4,0xd2,0x4e,0x7f
+,0x2c,0x9d,0xe0,0x45,0x0f,0x31,0x9b,0xa0,0x49,0x23,0xe6,0x1a,0xa4,0x99,0x21,0xc2
+,0x57,0xdd,0x84,0xeb,0x53,0x14,0x10,0x74,0x9d,0x24,0xdc,0x9d,0x17,0x29,0x50,0xb7
+,0x2c,0x9b,0xad,0xa3,0x65,0x35,0x98,0x78,0x98,0xb0,0x09,0x8d,0x39,0x54,0x68,0xf3
+,0x19,0xe8,0x09,0x08,0xf1,0x53,0x09,0xa8,0xe7,0xe2,0xe9,0x30,0x98,0x07,0x0e,0x0c
+,0xa5,0xcf,0xac,0xcc,0xff,0x57,0xb5,0xed,0xf1,0xfc,0x12,0x80,0x11,0xc2,0x55,0xfc
+,0xcc,0xf4,0x3f,0x99,0x6e,0x62,0x0c,0x4b,0x78,0x40,0x59,0x83,0x62,0x29,0xbe,0x21
+,0xbf,0x79,0xf7,0xf0,0x97,0x44,0x05,0x76,0x0e,0xfd,0xce,0x6f,0xdc,0x4d,0x1c,0x97
+,0xc7,0x8c,0x3d,0x49,0x6e,0xc7,0x47,0xa7,0xdf,0xd2,0x61,0x13,0x3e,0x2a,0x8c,0x40
+,0x4e,0xea,0xe0,0xff,0x53,0x24,0x80,0x43,0xee,0x80,0x1a,0x20,0x0b,0x03,0x57,0x2c
+,0x05,0xc7,0x6a,0x26,0xf6,0x37,0x3e,0x7e,0xc8,0xa8,0xc1,0xd1,0x07,0xac,0xb2,0x5a
+,0xd2,0x65,0x6b,0xa8,0x2e,0xb4,0xa8,0xec,0x02,0x98,0x89,0xbf,0xed,0xeb,0x57,0xfc
+,0x48,0x4c,0x38,0xfe,0xf6,0x98,0x22,0x03,0xed,0x28,0x5f,0x94,0x7d,0xb5,0x51,0xc3
+,0xae,0x68,0xae,0xa0,0x2c,0x64,0xa6,0xb1,0x7f,0xe6,0x3a,0x9c,0xc8,0x60,0x2c,0xb5
+,0x42,0x11,0x9e,0xa4,0xfe,0x19,0x1c,0x8c,0xd2,0x6e,0x75,0x5f,0x74,0xd9,0x83,0xd0
+,0x7b,0x5c,0xb0,0xf2,0x89,0x19,0xc9,0xb5,0xd9,0xdd,0x1a,0x76,0xdc,0xda,0x60,0xbe
+,0x16,0xaa,0x46,0xd9,0xc6,0xab,0xe9,0x55,0xac,0x67,0xb3,0x04,0x25,0x83,0x39,0xc7
+,0x2e,0xeb,0x9f,0xb9,0xbc,0x93,0x0a,0x2b,0x09,0xd0,0x34,0x8d,0x78,0x4c,0xa0,0xcd
+,0x5c,0xcd,0x5e,0x03,0x25,0x9d,0xf6,0xd9,0x39,0x10,0xd8,0x10,0x49,0xd6,0x52,0xc6
+,0x7f,0xe6,0x14,0x44,0xa5,0xcb,0x79,0x81,0xd7,0x37,0x48,0x2b,0xc8,0xdf,0x66,0x3e
+,0x52,0x99,0x5d,0x4d,0x97,0xcb,0x01,0x90,0x70,0x89,0x3f,0xfb,0xed,0x19,0x73,0x9e
+,0xb0,0x99,0x80,0x77,0x63,0x0d,0x7c,0x69,0x99,0xf4,0xb7,0x6a,0xe0,0x3d,0xdc,0xdd
+,0x3b,0x3a,0xa6,0x9b,0xbf,0x73,0xed,0xf3,0x36,0x5e,0x9d,0x10,0x75,0xd9,0x7d,0x7b
+,0x60,0x45,0x88,0xb1,0xd3,0x81,0x37,0xad,0x3f,0x0f,0x53,0x15,0x01,0x7d,0x93,0x90
+,0xc7,0x5d,0x84,0x00,0x89,0x3b,0x95,0x2d,0xec,0xf2,0x60,0x61,0x54,0x30,0x44,0xd2
+,0x57,0x6b,0x31,0x79,0x36,0x40,0x13,0x51,0x39,0x08,0x31,0x04,0x48,0x8d,0xad,0x2c
+,0xe1,0x20,0x7c,0xc3,0x28,0x7c,0x8d,0xe3,0x51,0x98,0x7c,0xb9,0x00,0x09,0x37,0x80
+,0xd0,0x22,0xba,0x86,0xb6,0x3b,0x10,0xa3,0x06,0xe9,0x5a,0x30,0x09,0x19,0xf6,0xdc
+,0x1c,0x43,0x9f,0xb0,0x45,0x5c,0xac,0xad,0xb8,0xa5,0xd4,0x15,0xc0,0xfd,0x28,0xe3
+,0x06,0xfe,0x8a,0x75,0x33,0xb4,0xf9,0x9f,0xac,0x0c,0xe6,0xba,0xcf,0xe9,0xdc,0x88
+,0x41,0x66,0x8f,0x54,0xce,0xaa,0x82,0x83,0x9f,0x2c,0x34,0x55,0xa5,0x93,0x20,0x6a
+,0xe0,0x40,0x13,0x86,0x54,0xb4,0xd9,0x05,0xb1,0xf7,0xa0,0x1a,0xc1,0xe1,0x84,0xa1
+,0x5e,0x7c,0xf6,0x11,0x68,0x8f,0x3e,0x63,0xcf,0x4a,0xe7,0x61,0xe0,0xd6,0x1e,0x3a
+,0x67,0x42,0x3a,0x84,0x13,0x4c,0x9e,0x20,0x22,0x05,0x83,0x15,0xb4,0x3a,0xef,0x34
+,0x19,0x66,0xfc,0xad,0x87,0x00,0x40,0x68,0xae,0x96,0xec,0x33,0x39,0x5c,0x94,0xd7
+,0x35,0x08,0x1b,0xa2,0x7e,0x0a,0x57,0xf8,0x77,0x24,0x31,0x60,0xd0,0x28,0x96,0x45
+,0x7e,0x66,0xe2,0xf2,0x39,0x4e,0x46,0x9f,0xff,0xae,0x58,0x52,0x78,0xf0,0x8f,0x7f
+,0x90,0x04,0x5d,0x96,0xc5,0x20,0xd3,0x93,0x5b,0x14,0x73,0xe6,0xb7,0xd4,0xf8,0xac
+,0x2e,0xae,0x9a,0x85,0x71,0x21,0x2c,0x93,0xed,0x9a,0x04,0x56,0x49,0xf2,0xd7,0x56
+,0x94,0xd8,0x66,0x86,0xb6,0x16,0x1a,0xf3,0x41,0x77,0x47,0x01,0x96,0x93,0x3e,0x65
+,0xa0,0xb6,0xa3,0x4a,0x54,0xc3,0xc4,0x02,0x16,0xcb,0x31,0x23,0xb3,0xac,0x76,0x83
+,0xed,0x07,0xec,0xa7,0x23,0x3e,0x70,0x8a,0xf4,0x1a,0xb4,0x0f,0xf5,0xd8,0xa3,0xca
+,0xf2,0x50,0xf7,0xb6,0x22,0x1d,0xf1,0x6f,0x6a,0xde,0xac,0xf6,0x5d,0x7c,0xb9,0x2c
+,0x9f,0xbf,0xcd,0x12,0x14,0x7c,0x6d,0x89,0xe3,0x26,0x66,0x06,0x62,0x40,0x53,0xfc
+,0xd5,0xa1,0x5e,0x14,0xfe,0x07,0x46,0x17,0x9e,0x71,0x62,0xda,0x10,0xeb,0xb3,0xfa
+,0x11,0x4e,0xc5,0x21,0x6f,0x9e,0x1d,0x61,0x44,0x22,0xd0,0xb6,0x73,0x03,0xd1,0x51
+,0x89,0x0b,0x48,0x32,0xcd,0x00,0xde,0x6f,0x2d,0xf3,0xbc,0xda,0x8a,0x20,0x64,0x3b
+,0xce,0x01,0x4e,0x0e,0x50,0x88,0xde,0x8b,0xca,0x8b,0xc7,0x11,0x3a,0x91,0x45,0xba
+,0x3f,0xe8,0x26,0xc3,0x0d,0xc5,0x70,0x47,0x70,0xde,0xb2,0xbd,0x09,0xdb,0xf3,0xdf
+,0xa5,0x51,0x72,0x02,0x0d,0x7f,0x5b,0x95,0xf0,0x3d,0xdd,0xdd,0x3b,0x7c,0x77,0x7c
+,0x7a,0xd1,0xbb,0xfc,0xf0,0x43,0x02,0x38,0x89,0x31,0x09,0x70,0xb3,0xbc,0x98,0x7f
+,0xa4,0x35,0x5a,0xde,0x3f,0x70,0x6e,0x24,0xf6,0x80,0xba,0xda,0xc1,0xdd,0x73,0x5d
+,0xb3,0x26,0xf1,0x55,0xca,0x02,0x78,0x14,0xdd,0xd7,0xc1,0xfb,0x76,0x25,0xa7,0x95
+,0x48,0xe7,0xe9,0x03,0xf0,0xa7,0x4d,0x87,0x0f,0x6e,0x47,0x83,0x0b,0xc4,0x91,0x7d
+,0xea,0x12,0x2c,0x59,0x7c,0xd6,0xce,0x24,0x1b,0x12,0x6d,0x8a,0xe0,0xe0,0xac,0xa0
+,0x72,0x24,0x45,0x8d,0x17,0xc9,0x7c,0x42,0x34,0x9b,0x4d,0x51,0x1e,0x09,0xc4,0x78
+,0x65,0x91,0x88,0x2e,0x1e,0x09,0xe6,0xd0,0x61,0x42,0x33,0x14,0xc2,0xff,0x4c,0x1f
+,0x52,0xf3,0xef,0x44,0xfb,0xcd,0x67,0x97,0x1f,0x76,0x64,0xac,0xb3,0x29,0xc0,0x9a
+,0x91,0x5d,0x45,0x80,0x7b,0xba,0x2e,0x27,0x07,0x7b,0x60,0xff,0x2a,0x96,0x10,0x5c
+,0xee,0x43,0xe0,0x13,0x71,0x5b,0x5f,0x81,0x56,0x5a,0x75,0x8d,0x3f,0x05,0x76,0x85
+,0x8c,0x8e,0x86,0xac,0xf7,0x1f,0xa2,0x40,0xe0,0x20,0x80,0x70,0x7d,0xa2,0x32,0x2f
+,0xba,0x2f,0x54,0x0c,0x40,0xf7,0xc5,0x7e,0x15,0xb8,0xa2,0x2f,0x73,0x66,0xf3,0xc4
+,0xa9,0x91,0x27,0x85,0xd6,0xf9,0xc5,0x5f,0x5e,0x20,0xcf,0x12,0x8c,0x88,0x92,0xcd
+,0x7b,0x2a,0xf8,0x8e,0x0c,0x37,0xec,0xc3,0x2f,0xd8,0x65,0x5d,0x03,0x6a,0x97,0xaa
+,0xbd,0xcb,0xc4,0xa5,0x28,0x96,0x88,0x78,0xde,0x2f,0x34,0xfe,0x67,0x82,0xf4,0x9d
+,0x5b,0xbb,0xcb,0xca,0x11,0x6f,0x1a,0x65,0x4d,0x73,0x8d,0xb3,0x74,0xd1,0xe7,0xae
+,0xc7,0x7b,0xc6,0x47,0x71,0x6b,0xf6,0x9e,0x3b,0x05,0xd7,0x63,0x27,0xfa,0xb1,0x11
+,0xde,0x81,0xf8,0x40,0xb8,0x46,0xe6,0x85,0xf1,0x69,0x98,0xb4,0x09,0xf8,0xb5,0xd7
+,0x03,0xad,0xd1,0x49,0x88,0x98,0x18,0x30,0xce,0x4c,0xd8,0x79,0xc9,0xe5,0xaa,0xb6
+,0x0f,0xf8,0xfc,0xb3,0x9e,0x49,0x6c,0xaf,0x60,0x5b,0xe9,0x65,0x45,0x1c,0x34,0xd8
+,0xbd,0x99,0x79,0x02,0xb4,0xb6,0xba,0x60,0x53,0x89,0x57,0x53,0x47,0x53,0x49,0x72
+,0x20,0x89,0x27,0xe2,0x18,0xad,0xc5,0xea,0x96,0x93,0x9b,0xb0,0x9c,0xc7,0x3d,0xe8
+,0x3a,0xe4,0x07,0xc4,0x18,0xb8,0x22,0xb8,0x4d,0xc4,0x56,0xa9,0x5e,0x9c,0x08,0x9a
+,0xb1,0xf2,0x14,0x67,0x2f,0x7d,0x92,0x47,0x82,0x03,0x32,0x30,0x58,0xcd,0xdd,0x79
+,0x9f,0x0d,0x81,0xea,0xf4,0x10,0xcc,0xef,0xc4,0x03,0x19,0x62,0xaa,0x49,0xe6,0x2b
+,0x45,0x86,0xdd,0x36,0x20,0x08,0x25,0x52,0xf1,0xe1,0xc9,0x0e,0xfa,0x81,0x8d,0xd5
+,0xb6,0x3f,0xc0,0xcf,0x01,0x90,0xc8,0x4a,0xfd,0xa7,0xf3,0x49,0x42,0x2c,0x20,0x16
+,0xa9,0x25,0x41,0x15,0x36,0x03,0x81,0x24,0x57,0xb6,0x3d,0x35,0x12,0x94,0x23,0xd8
+,0x4b,0x0c,0x61,0x64,0x5c,0xae,0x82,0x78,0x49,0xe7,0xd0,0xfd,0x02,0x34,0x08,0x64
+,0x1d,0x89,0x3f,0x68,0xf0,0x0b,0x9b,0x6c,0x4c,0xfc,0x05,0x1f,0x64,0xb9,0x19,0xe8
+,0xd7,0xff,0xcd,0x68,0xe2,0x49,0xc9,0x19,0xf0,0x82,0x35,0x3d,0x6d,0x04,0x80,0xf9
+,0xec,0x04,0x16,0xd8,0xc0,0x10,0x73,0xdf,0x36,0xb4,0x1b,0x78,0x33,0x94,0x16,0x6b
+,0x19,0x20,0xd7,0xe2,0xc3,0x69,0x76,0x56,0x33,0xe1,0xe1,0x11,0xa7,0xc2,0x63,0xb5
+,0x8d,0xfa,0xc3,0xc1,0xe1,0x9c,0x64,0x77,0xb3,0xc3,0xc9,0xe6,0x38,0x47,0x1f,0xd1
+,0x8e,0x9d,0x31,0x52,0xef,0x1a,0x4e,0x33,0xb8,0x03,0x33,0x16,0xff,0x84,0xdd,0x8e
+,0xdf,0x98,0xf0,0x6a,0xe6,0x41,0x44,0x17,0x71,0x61,0x3c,0xe4,0xea,0x72,0x13,0xec
+,0x3c,0xa6,0x4c,0x15,0x2c,0x59,0xd8,0xa9,0x96,0x8b,0x8f,0xcb,0x22,0x2b,0xd3,0x2e
+,0xb7,0x87,0x7a,0x37,0x08,0xd5,0x55,0x74,0x9e,0x9d,0xf9,0x72,0x31,0x87,0x7a,0x3c
+,0xcc,0xb0,0xca,0x5e,0x54,0xf1,0x60,0xa9,0x29,0xdc,0x59,0xcd,0xa5,0xa9,0xaf,0xa6
+,0xd5,0xa0,0x4b,0x7f,0x2d,0x45,0x1e,0x2a,0x85,0xa2,0x41,0x73,0xc1,0xab,0xd6,0xe5
+,0x45,0xf0,0x0c,0x48,0xc9,0x69,0x09,0xaf,0xe2,0x8b,0x64,0x38,0x9d,0xdf,0x3d,0x4f
+,0xd6,0x03,0x5d,0xb1,0x84,0xfb,0x4b,0xb6,0xea,0x20,0xdf,0x5c,0x87,0xcd,0x50,0x9a
+,0xc1,0xd1,0xca,0x77,0xa3,0x2c,0x17,0x65,0x3d,0xd1,0x25,0x7c,0x04,0xbe,0xe1,0xe0
+,0xcc,0x6c,0xb6,0xcb,0x80,0x2e,0x85,0x1f,0x18,0x3d,0x81,0x5b,0xab,0xe1,0xda,0x01
+,0x44,0x4b,0x5d,0xa7,0x82,0x5b,0x23,0xac,0xd3,0x0e,0x6e,0x11,0x55,0x0b,0x4f,0x6c
+,0x6a,0x62,0xd9,0xd1,0x2f,0x3a,0x2f,0xa0,0x92,0xa9,0xc5,0x8e,0x67,0xec,0x68,0x4f
+,0xa4,0x47,0x62,0x57,0x35,0xc2,0x22,0xf4,0xf0,0xb2,0x08,0xb9,0xab,0xdd,0x51,0x59
+,0x92,0x4f,0x33,0xd2,0x10,0x08,0x91,0xb6,0x9e,0x88,0x0e,0x77,0xf0,0x05,0x5c,0xe6
+,0x0b,0x46,0x00,0xb5,0x57,0xc4,0xdd,0x93,0x12,0x9a,0x4d,0xba,0x2b,0x6a,0x4f,0xbe
+,0xbb,0xa5,0xb0,0x5f,0xb0,0x59,0x31,0xac,0xe3,0x5b,0x78,0x00,0xf4,0x69,0x91,0x20
+,0x8a,0x4c,0x4c,0x0e,0x12,0xf7,0x41,0x3d,0x65,0xf2,0x68,0xc2,0x2c,0x1a,0xb8,0x0e
+,0xd3,0x7c,0x90,0x05,0xd1,0x9c,0xd3,0x72,0x3e,0xc8,0x10,0x10,0x79,0x3b,0xcb,0x59
+,0x07,0x62,0x5d,0x21,0xb9,0x87,0xe7,0x7b,0x47,0xa1,0x4b,0x1c,0xa0,0x3d,0x35,0x62
+,0xad,0xf9,0x5a,0xa1,0x5a,0x45,0x57,0xcd,0xa9,0x5b,0xf7,0x19,0xae,0x81,0x21,0xed
+,0x3d,0x52,0x7d,0x4a,0xdb,0x92,0x3e,0xd1,0xc9,0x86,0xe5,0x55,0x67,0xfc,0xe9,0x9a
+,0xe1,0x82,0x99,0x41,0x52,0x17,0x43,0xb1,0xde,0x89,0xd2,0x0f,0xf6,0xb4,0xd4,0x11
+,0x78,0x8d,0x60,0x60,0x22,0x6a,0xe3,0x8d,0xe3,0x5c,0x02,0x02,0x90,0x7e,0x88,0x93
+,0x66,0x09,0xbb,0x6d,0x5d,0x7d,0x25,0x52,0x54,0x91,0x23,0x0d,0x3b,0xb6,0x71,0x1a
+,0x54,0x76,0xab,0x10,0x2d,0x56,0xf3,0xb5,0x42,0x8f,0xff,0x9b,0x89,0x1f,0x1e,0x04
+,0xa5,0x7f,0xeb,0xab,0xd7,0x6d,0xfe,0x4d,0x7e,0x7d,0xb5,0xf1,0xa7,0xd7,0x01,0xa3
+,0xb4,0x2c,0x6f,0xe0,0xa1,0x5b,0x65,0x76,0x5a,0x2e,0x7b,0x6f,0x58,0x6c,0x28,0xbb
+,0xc1,0xe4,0x04,0xf9,0x04,0xab,0x46,0x1f,0xc8,0x1e,0x72,0x43,0xfe,0xfa,0xd4,0x50
+,0xdb,0x7e,0x6a,0xec,0x27,0x91,0x63,0x93,0x5a,0x2e,0x59,0xa9,0x2b,0x9f,0xf8,0x89
+,0xaf,0xfa,0x6b,0xb3,0x28,0x8a,0x0a,0x10,0x05,0x5e,0x52,0x17,0xdc,0x49,0xd6,0xc4
+,0x93,0xdc,0x96,0xd8,0xb3,0xb1,0xea,0xac,0x64,0x19,0x76,0xc3,0x0d,0x89,0xed,0xe7
+,0xd0,0xe2,0x64,0xd0,0xdc,0xb1,0x9d,0x27,0x28,0xe1,0xfb,0x29,0x19,0x25,0x3c,0xc4
+,0xb5,0xcd,0x2f,0xc2,0x37,0xbc,0x43,0x2e,0x0d,0x6a,0x6a,0x06,0x50,0x4d,0x16,0xb7
+,0x1d,0x7d,0x83,0x83,0xf1,0x67,0xf3,0x0d,0x0c,0xde,0xf4,0x0f,0x54,0xa4,0xf4,0x0f
+,0x91,0x4f,0xfa,0x7b,0xcc,0x7f,0xcf,0x92,0x9f,0x8b,0x05,0xfe,0x25,0x56,0x0a,0xff
+,0xf2,0x99,0xa5,0x7f,0x1d,0x4e,0x29,0xfd,0xcc,0x11,0x7d,0x7f,0x86,0x3d,0x6f,0xa1
+,0x5c,0x75,0x56,0xfa,0x4c,0x07,0x7c,0x8f,0xc9,0x66,0x57,0x2c,0xb4,0xc2,0xf7,0xce
+,0x85,0x98,0x6e,0x47,0xd1,0x4d,0xe3,0x4d,0x00,0x5a,0x12,0x41,0x2a,0xb0,0xbe,0x50
+,0xfa,0x68,0xd8,0xd8,0x77,0xb8,0x12,0x23,0xa2,0x59,0x12,0xac,0xcb,0xda,0x86,0x79
+,0xe3,0x94,0xed,0x79,0x40,0x51,0x83,0xfc,0x30,0x2a,0x68,0x32,0xce,0x94,0x70,0x48
+,0x66,0x3c,0x15,0x9e,0x03,0xcb,0x57,0x7b,0xd5,0xa9,0x89,0x78,0x81,0x42,0x6c,0x26
+,0xb6,0xfb,0x02,0xa4,0x1f,0xe0,0xaf,0x6a,0x6b,0x4c,0xe5,0x65,0x6a,0x6b,0xab,0x2b
+,0x91,0xd3,0x2f,0x62,0x71,0xcb,0xbb,0x99,0x42,0xb1,0x4f,0xb3,0xc4,0x54,0x30,0x5a
+,0xe6,0x7e,0xe1,0xb5,0x1d,0x4e,0xb8,0xeb,0xb5,0x18,0x54,0xd1,0x11,0x80,0xd9,0xa0
+,0x28,0x6e,0x33,0x58,0xc4,0xee,0xbe,0x63,0x0f,0xe8,0x5c,0x84,0xad,0xc4,0x6c,0x6e
+,0x7d,0xcd,0x0e,0x7a,0x65,0xb5,0x00,0x89,0xa3,0x7d,0x46,0xa7,0x4c,0x8f,0x18,0x6f
+,0x78,0x23,0xb2,0x24,0x3e,0xcc,0x39,0x40,0x59,0x83,0x60,0x9a,0x9a,0x74,0x95,0x4e
+,0xe7,0x77,0x5a,0x42,0xa9,0x9b,0xfd,0xe4,0x5f,0xfe,0xf2,0x17,0x64,0xc3,0x44,0xb6
+,0xcb,0xd2,0xa3,0x84,0xfa,0x20,0xeb,0xbd,0x64,0x3a,0x60,0x8b,0x03,0x76,0xd2,0xc4
+,0x67,0xcd,0xf4,0xf1,0x61,0x6d,0xde,0x94,0x2e,0x15,0xa5,0x4b,0x5a,0x0f,0xe6,0xc2
+,0x61,0xc8,0x44,0x61,0x04,0x0a,0x13,0xab,0x20,0xd2,0xea,0xb9,0x56,0x49,0x02,0x1d
+,0x7e,0xb5,0xf3,0x72,0x0b,0xa1,0x2b,0x5a,0xa1,0x1d,0x95,0x93,0x64,0x73,0xe7,0xd5
+,0x46,0x1b,0x19,0x78,0xb7,0xb6,0x5e,0xed,0x80,0x52,0xe0,0xc7,0xaf,0x5e,0xef,0xbc
+,0x7e,0xc5,0x3f,0xbe,0xfc,0xfa,0xd5,0xce,0x9f,0xe4,0xe9,0x57,0x9b,0x5b,0x3b,0xf0
+,0xf0,0xa9,0xa7,0x78,0xd3,0x68,0xad,0x1a,0x26,0x2b,0x8f,0x4c,0xf2,0x9a,0xd6,0xe1
+,0x59,0xad,0x98,0x9a,0x86,0x47,0xcc,0x27,0xf4,0xd4,0x3d,0xcf,0x70,0xf7,0x68,0xe3
+,0x4b,0x8f,0x28,0x9a,0xbe,0xb0,0xb0,0x0c,0x70,0x9f,0x7f,0x87,0x0f,0xac,0x24,0xc4
+,0x76,0x79,0xb9,0xe8,0x7c,0x3d,0xf2,0xf5,0xc9,0x4c,0x26,0x2b,0xcc,0x4f,0x7d,0x92
+,0x26,0xa8,0xef,0x8d,0x24,0xbe,0x91,0xd0,0x72,0xdc,0xb8,0xf8,0x98,0x8d,0x7a,0x47
+,0x8c,0xb9,0x0b,0xbc,0x70,0x1b,0x89,0x0e,0x2a,0x43,0x03,0x5e,0xc5,0x27,0xd7,0xe6
+,0xcd,0xf7,0xfd,0x83,0x1e,0x3b,0x1c,0x02,0xa7,0x5e,0xfa,0xec,0x76,0xa5,0x07,0x61
+,0x0a,0xb0,0x97,0x18,0x6f,0x4b,0x3c,0xf1,0xa0,0x17,0x4e,0x87,0x98,0xaf,0x13,0x9b
+,0x98,0x04,0x67,0xb6,0xd9,0x12,0xcb,0xba,0xd4,0x69,0x12,0xd7,0x01,0x8b,0x1a,0x63
+,0x36,0x21,0xa1,0x93,0xdf,0xd2,0xd9,0x60,0x51,0x10,0x4b,0x2f,0x99,0x1f,0xce,0x0f
+,0x0e,0x18,0xc9,0xe7,0xc3,0xb5,0x2a,0x53,0x80,0x8c,0xcf,0xa9,0xe4,0xe9,0x54,0xe2
+,0x44,0x01,0x4b,0xbf,0x00,0x7c,0xdd,0x3b,0x6a,0x6d,0xaf,0x7f,0x71,0x1c,0x5f,0x8b
+,0xbf,0x48,0x9a,0x2f,0x15,0x5e,0x0c,0xae,0x43,0xc9,0x72,0x68,0x44,0x0d,0x51,0x48
+,0xa3,0xc4,0xc5,0x5a,0x3b,0xe7,0xdf,0xae,0xb9,0xb4,0x0a,0xac,0xbe,0x1f,0x0f,0x92
+,0x88,0xf2,0xe0,0x3b,0x35,0x36,0xbf,0xdb,0x3d,0x3d,0x95,0x94,0x14,0x53,0xf3,0xdd
+,0xd9,0xb1,0x64,0xac,0x64,0x2b,0x8c,0xbd,0x5a,0xce,0x7a,0x3d,0x1c,0xa4,0x9c,0xbd
+,0x2e,0x73,0xba,0x1f,0x89,0x5d,0x55,0x57,0x82,0x32,0x1f,0xc6,0xd4,0x64,0xba,0x88
+,0x8b,0xd2,0xe2,0x26,0x52,0xc7,0xee,0xc0,0xf7,0xa7,0x1a,0xe0,0xe3,0xbe,0x81,0x3e
+,0x77,0xe5,0xf0,0xf1,0x7b,0x4c,0xb6,0xbe,0xf2,0x94,0x5d,0x18,0x6e,0xfd,0x90,0x20
+,0x05,0x38,0x15,0x48,0x63,0x5f,0xf5,0x17,0x6c,0xd0,0xaa,0x27,0x9e,0x41,0x27,0x10
+,0xb3,0x80,0x31,0x34,0x1a,0xdf,0xc9,0x07,0x38,0xf2,0x32,0xb2,0xe3,0xb1,0x4f,0x01
+,0x1b,0xc0,0x99,0x16,0xe1,0x28,0x9d,0x16,0xee,0x63,0x9a,0x84,0x75,0xd1,0x86,0x70
+,0xc6,0xfc,0x3a,0xe2,0xdc,0xb4,0xb3,0xfe,0x22,0x64,0x9f,0x04,0x22,0x4d,0xf3,0x6b
+,0xf3,0xc5,0xd5,0x17,0xf1,0x17,0x3f,0x7c,0x61,0xbe,0x18,0x7c,0x51,0x7c,0x91,0x7f
+,0x51,0x7d,0x91,0x7e,0xf1,0x40,0x7f,0x5f,0x7f,0x11,0xfa,0x43,0x28,0xd4,0xb0,0xbb
+,0x1e,0xf9,0x12,0xd0,0x0c,0x15,0xf5,0xec,0x08,0xcf,0x78,0x28,0xd4,0x42,0x6a,0xe0
+,0x6d,0xc4,0x49,0xda,0xe7,0xe2,0xae,0xa0,0xf9,0x13,0x6a,0x3c,0x6a,0xe9,0x12,0x3a
+,0xfb,0xcb,0x9f,0x5d,0x3d,0x11,0x76,0xf1,0x0b,0x4e,0x9e,0xb3,0x5b,0x5c,0x1b,0x7e
+,0x34,0x7b,0x5f,0x9c,0x7d,0x71,0xfa,0x45,0xff,0x8b,0x83,0x2f,0x3e,0xd0,0xdf,0x18
+,0x8d,0x5a,0x99,0xfc,0x20,0xa0,0xb0,0x80,0x92,0xc2,0x5d,0x3d,0x58,0xeb,0x2f,0xf4
+,0x4b,0xbf,0xf4,0x15,0x5a,0xb7,0x60,0x62,0x7e,0xf9,0x73,0xac,0xda,0x64,0xb7,0xb5
+,0xab,0x93,0xdd,0xff,0x38,0xbb,0x30,0x27,0x47,0xa7,0x67,0x17,0xfe,0xe3,0x30,0xeb
+,0x0f,0x83,0xad,0xc0,0xbd,0x93,0x0a,0xde,0xe1,0x3d,0xb8,0x51,0xdb,0x46,0xbc,0xad
+,0x7c,0xf6,0x58,0xfb,0x7c,0xce,0xcf,0xf3,0xe0,0x02,0x65,0x80,0x1d,0x05,0xf2,0x2d
+,0x0d,0x7f,0xbe,0xcb,0x9f,0x6f,0xc9,0x02,0x9d,0xf0,0xde,0xb3,0x2a,0x05,0xbb,0x4e
+,0x2d,0x45,0x75,0x77,0x1f,0x04,0x1d,0x63,0x1c,0x44,0x28,0x89,0xbf,0x7c,0xb0,0x7c
+,0xd7,0x2f,0xad,0x44,0xbd,0xba,0xcd,0x73,0xc6,0xc9,0x02,0xe9,0x51,0x35,0x9b,0x8f
+,0xbc,0x27,0xa5,0xa8,0x23,0x4b,0x23,0x39,0x7e,0xd0,0xff,0xc7,0x62,0xd9,0x41,0x72
+,0x01,0x89,0x11,0xca,0xa0,0x47,0x61,0x14,0x39,0x36,0x94,0x46,0x3d,0x62,0xfb,0x10
+,0xdc,0x55,0x6e,0x77,0xbb,0xf7,0xf7,0xf7,0x1d,0xe1,0x71,0x3b,0xc5,0x62,0xdc,0x9d
+,0x2f,0x6f,0xba,0x6c,0xed,0xe9,0x0e,0x8b,0x41,0xd9,0xa5,0x3b,0x9b,0xfe,0xa7,0x0c
+,0x64,0x8c,0xda,0x96,0x99,0x8c,0xb7,0x3a,0xaf,0x3b,0x55,0xb8,0x96,0xac,0xec,0x1e
+,0x32,0x4a,0xd9,0xe1,0xbe,0xf8,0xff,0x68,0x0e,0x26,0xe8,0x02,0x77,0x8f,0xa1,0x35
+,0x0e,0x40,0xcb,0xf8,0x09,0x31,0x69,0xc4,0x3c,0x3d,0xce,0x2b,0x8f,0xea,0x25,0xe8
+,0x3f,0xfc,0xb0,0xf9,0xb2,0xa5,0xc9,0xf8,0x34,0xea,0x50,0x6f,0xf7,0x62,0x61,0x73
+,0x02,0x0d,0xb9,0x61,0xac,0x03,0x3e,0x2a,0xea,0x47,0xa7,0x74,0x77,0xb1,0xcb,0x0a
+,0x42,0x3e,0x07,0xd2,0xfb,0xe1,0x7e,0xa4,0x1d,0x6b,0xe8,0xa7,0x21,0xc6,0xcc,0xd2
+,0x6a,0x52,0x00,0x0d,0x16,0x82,0x09,0xdd,0xaf,0xf6,0xf6,0x54,0x5d,0x34,0xae,0xcc
+,0x7f,0x33,0x41,0xb0,0x37,0x95,0x0b,0x8e,0x3f,0x13,0xf7,0xab,0xf8,0xd8,0x1c,0xef
+,0xbe,0x01,0xe1,0x74,0x14,0x9c,0xd6,0x95,0x38,0x29,0x2b,0x92,0x72,0x31,0x3a,0xa0
+,0x89,0xc8,0xa9,0x1e,0x90,0xae,0x66,0x6b,0x9b,0xdd,0x92,0xc8,0x8a,0xe6,0x86,0x1f
+,0xab,0xa5,0x98,0x63,0xc4,0x04,0xd6,0x3f,0x38,0x39,0x3f,0x46,0xb6,0x60,0x6a,0x38
+,0x19,0xa5,0x6e,0xdd,0x25,0x51,0x86,0x0c,0x74,0x8d,0x8a,0x76,0x6d,0xc1,0x35,0xb1
+,0x41,0xb0,0xe8,0x01,0xb6,0xc2,0x5e,0xef,0x4f,0xf2,0xbe,0x3f,0x86,0xf6,0x17,0xe1
+,0x31,0xe2,0xd8,0xbd,0x64,0xff,0x9a,0xf3,0x65,0xe5,0xbf,0x22,0xe6,0x27,0x14,0xa2
+,0x7d,0x48,0xe5,0x5a,0xce,0x96,0xcf,0x7c,0xc2,0xaa,0x11,0xb7,0x82,0xb1,0x03,0xa1
+,0x1e,0x7f,0xe8,0x9f,0x9c,0xa3,0xe2,0x9f,0x8d,0xfc,0xdd,0xad,0x66,0x41,0x7c,0x9c
+,0x3c,0xf3,0x65,0xf0,0x96,0x63,0xb4,0xe4,0x72,0xb5,0x83,0xcd,0x1f,0xab,0x09,0xeb
+,0x23,0xd9,0x01,0x44,0x46,0xc7,0x7a,0xdd,0xfb,0x62,0x39,0x1d,0xe2,0x62,0x56,0x4f
+,0x3b,0x15,0x00,0x3e,0xa0,0xbb,0x76,0x4a,0xb0,0x76,0x0e,0x4f,0x40,0xad,0x07,0xba
+,0xa9,0xea,0x9a,0x4a,0x26,0x0a,0x44,0x41,0x26,0xa9,0x73,0x4e,0x0e,0xdb,0xa0,0xae
+,0x75,0x3e,0xb8,0x3f,0x7e,0xed,0x10,0xa5,0x00,0x9c,0xa2,0x78,0x83,0xf3,0xa4,0x33
+,0xd6,0x2a,0x4d,0x10,0x7e,0xb9,0x55,0x51,0x52,0xe2,0x4c,0x99,0xe5,0xa5,0x1f,0xe5
+,0xd6,0xfc,0xec,0x73,0xb2,0xef,0x7b,0xdc,0x91,0xe5,0x34,0x0d,0x59,0x6c,0x15,0x9c
+,0x03,0x0e,0xe5,0xe6,0xd1,0x05,0xe0,0x76,0x6e,0x0b,0x87,0xc5,0x76,0x68,0x8c,0x77
+,0x3b,0x09,0x31,0xf9,0x53,0xb8,0x3d,0x6d,0x20,0x87,0x9e,0xa8,0x10,0x6d,0xeb,0x3c
+,0x11,0x80,0x27,0x09,0x15,0x0a,0x0a,0xa0,0xc9,0x2a,0x6e,0xf0,0xf1,0xdf,0xe8,0x58
+,0xfe,0x8c,0x1b,0x05,0x02,0x1e,0x77,0x8a,0x88,0xc5,0x4d,0x57,0x7b,0xd6,0x65,0x2d
+,0x27,0x87,0x0f,0xd3,0x94,0xcb,0x47,0xfd,0x16,0x13,0x94,0xc0,0x5a,0x79,0x3f,0x6d
+,0x60,0xb4,0xae,0xe2,0x64,0x74,0x08,0x44,0xa4,0x5a,0xfe,0xb6,0xd8,0x22,0xbc,0xc1
+,0x4d,0xc8,0x26,0x2b,0x31,0x12,0x6c,0x7a,0xc2,0xf5,0xec,0xb6,0x14,0x65,0x0f,0xa3
+,0x00,0xd5,0x34,0x2e,0xcf,0xb8,0xb9,0x79,0xcf,0x36,0x07,0x67,0xca,0x7d,0xd0,0x90
+,0x3a,0x69,0x17,0xfc,0xa4,0x8a,0x2b,0x18,0x0f,0x0b,0xc2,0xa3,0x12,0x39,0x27,0x94
+,0x2d,0xb0,0x59,0xa2,0x6c,0x21,0x96,0xe3,0x12,0xe9,0x79,0xcb,0x39,0xff,0xc8,0xe0
+,0xe2,0xc4,0x15,0xe3,0x32,0x13,0x97,0x51,0x47,0x4c,0x96,0x6c,0x78,0xe2,0x60,0x27
+,0xc0,0x95,0xf1,0x86,0xa7,0x2d,0x28,0xe4,0x9d,0x5b,0x68,0xad,0xc4,0xe8,0xdb,0x54
+,0x52,0x34,0x3f,0x8b,0x82,0xe3,0x14,0x83,0x2c,0x81,0x4d,0x07,0x24,0x11,0x16,0xbb
+,0xe7,0xf0,0x17,0x6b,0x38,0x0d,0xb3,0x4d,0x20,0xdf,0x5a,0x88,0x8a,0x68,0x51,0xd9
+,0x18,0xb5,0xe1,0x97,0xf2,0x7b,0xa8,0x7f,0x68,0xdb,0xc8,0x05,0x39,0xb0,0x88,0x8f
+,0x74,0x02,0xcb,0xe5,0x1c,0x00,0x3c,0xc3,0x88,0xcd,0x3a,0xd0,0x3d,0x51,0x61,0x4c
+,0xee,0xee,0xb2,0x52,0xb8,0xb3,0xd2,0xdb,0x82,0x64,0xea,0x4d,0x33,0x71,0xf8,0x87
+,0x89,0xdf,0x37,0xe2,0xf7,0x70,0x03,0x9b,0x9c,0x2d,0xc7,0x42,0x6e,0x91,0xab,0x8c
+,0xe5,0x77,0x58,0xb0,0xec,0x8f,0x2d,0xc0,0x87,0xb3,0xe3,0xb9,0x4c,0x26,0x58,0x20
+,0x96,0xab,0x68,0xcd,0xe3,0x98,0x9b,0x53,0x54,0xbc,0x62,0xde,0x89,0xbe,0x57,0x07
+,0x75,0xee,0xff,0x9a,0x5b,0xb1,0x2e,0x4e,0xd4,0x9a,0x30,0x59,0x78,0x04,0x55,0xab
+,0x50,0x9f,0x95,0x0d,0xa1,0x7b,0x1b,0xc5,0xdb,0x91,0xf5,0x13,0xc8,0xaa,0x17,0xb8
+,0x92,0xa1,0xbb,0xed,0xd8,0xb4,0x3a,0x75,0x84,0xbd,0xcb,0xcb,0xa3,0xfd,0x1d,0x0e
+,0x61,0x11,0x3b,0xb7,0x9e,0xe9,0x9b,0xe9,0x2d,0x09,0xdf,0xf1,0xa5,0xc8,0xdb,0xcf
+,0xd6,0xe4,0x8b,0xe6,0x97,0xab,0x1e,0x77,0x6a,0x47,0x4b,0x02,0x07,0xae,0xe2,0x8f
+,0x43,0x3e,0x39,0x91,0xb1,0xb8,0xfa,0xe1,0xbb,0x07,0x7f,0x6f,0x89,0x6c,0xe7,0x81
+,0xf6,0xc2,0x9b,0xc2,0xcb,0xfa,0x8a,0xbd,0x67,0xdb,0xc0,0xd1,0xf9,0xd8,0x78,0x93
+,0x0a,0xfe,0x50,0x5b,0x43,0x6e,0x39,0x4b,0x27,0x66,0x23,0xf4,0x97,0xae,0xd5,0xc3
+,0x7d,0x64,0x81,0xcc,0x7f,0x2e,0x16,0x5d,0xd6,0xae,0x38,0x66,0xce,0x7b,0xd6,0x4d
+,0x6a,0x88,0x9b,0x0f,0xbf,0xb5,0x4e,0xc8,0xf5,0xb9,0x49,0x41,0x00,0xda,0xe1,0x28
+,0xcb,0xfb,0x77,0x0f,0x75,0xf7,0x64,0xe7,0x9d,0xec,0x9c,0x93,0xe3,0x43,0x0b,0xff
+,0x09,0x4f,0x12,0xe7,0x91,0x89,0xb7,0x2a,0x99,0x20,0x3a,0x9a,0xe3,0x17,0x62,0xe2
+,0x0a,0x2a,0xa0,0x3b,0x65,0xc8,0x79,0xed,0x3c,0x4a,0xc4,0x85,0xf8,0x51,0x9c,0xbd
+,0x45,0x81,0xe5,0x8a,0xa9,0x7b,0x48,0xd6,0x38,0x52,0xfc,0x51,0x22,0x9a,0xd6,0xa3
+,0xc0,0xc5,0x9e,0x28,0x22,0x4d,0x88,0xbe,0xac,0xce,0xcd,0x9c,0xec,0x69,0x30,0x2d
+,0x6e,0xd8,0xdd,0x4f,0x76,0xba,0x07,0xb0,0x51,0xef,0xe2,0x4a,0xb0,0x45,0x7f,0xd1
+,0xfb,0xb8,0xdf,0xe0,0xc1,0xfc,0xe7,0xdd,0x48,0xb0,0x0a,0xbb,0x55,0x31,0x13,0xfb
+,0x18,0x0c,0xa8,0xd6,0x41,0x0f,0x2a,0x96,0x2e,0x86,0xc9,0x81,0xd1,0xc4,0xf6,0xb4
+,0x7e,0xf7,0xcf,0xfc,0x66,0xf8,0xd3,0x80,0x88,0x42,0x5e,0xc9,0xcf,0x02,0xf9,0x60
+,0x97,0x84,0x9e,0xc4,0xf2,0x16,0xfe,0xa2,0xa5,0xdc,0x9e,0x6f,0x8e,0xbf,0xed,0xfd
+,0xa0,0xa8,0xb6,0x0c,0x37,0x60,0x37,0x68,0x6c,0xf5,0x63,0x92,0x94,0xd8,0x39,0xa1
+,0x42,0x23,0x8a,0x59,0xd9,0x2f,0xd8,0xce,0x3a,0x4c,0x68,0x5d,0x80,0xed,0x09,0xf1
+,0x98,0xbe,0xa0,0xc8,0xc9,0x44,0x9c,0x60,0x74,0x68,0x4a,0x0b,0x02,0xb5,0x2a,0x81
+,0x1b,0x2c,0xb3,0xb7,0xc2,0x3e,0xe9,0x6b,0xea,0xd3,0xc2,0x29,0x81,0xc4,0x68,0x2f
+,0x48,0x07,0x89,0x39,0xd5,0x90,0x36,0xe9,0x90,0xca,0xa3,0xcc,0x7a,0xb2,0x2a,0xc4
+,0x01,0x19,0x08,0x78,0xd3,0x34,0x51,0x10,0x03,0x1c,0x17,0xe8,0x3f,0x80,0x7e,0x00
+,0x26,0x91,0x3e,0x7f,0xca,0xb8,0xaa,0x34,0x6b,0x81,0x2a,0xc4,0x81,0x49,0xf3,0xb8
+,0x4e,0xd3,0xfb,0xb2,0x7a,0x64,0xe5,0x65,0x3e,0x24,0xb6,0xf4,0x36,0x28,0x51,0xd0
+,0x4d,0x8e,0x77,0x2b,0x17,0x45,0xfa,0x80,0xc1,0xd2,0x94,0x13,0xb5,0x4a,0x1c,0xb7
+,0x2e,0xbf,0xd1,0x80,0x5e,0xbd,0x3e,0x38,0x9e,0xe6,0xd5,0xa5,0x70,0x9a,0x1f,0xdf
+,0xdf,0x9b,0xdf,0x4b,0x2e,0x4a,0x44,0xbb,0xc8,0xf5,0x2b,0x59,0xba,0xfe,0x7e,0x74
+,0xce,0x11,0x43,0x58,0x87,0xd3,0xcb,0x93,0xcf,0xb1,0xc7,0x94,0xf8,0xec,0xbd,0xc2
+,0xfe,0x11,0x21,0x40,0xf6,0x1e,0x71,0x35,0x35,0xf8,0x06,0xe7,0x52,0x06,0xfa,0x61
+,0x83,0x00,0x3d,0xdc,0x03,0x26,0xe3,0x95,0x1e,0x17,0x44,0x73,0x45,0xf1,0x6b,0xff
+,0xdb,0x6b,0x64,0x7f,0x0b,0x5a,0x65,0xd7,0x21,0xc1,0x30,0xb0,0x3d,0x90,0x89,0xb5
+,0xb9,0x76,0x7b,0x1b,0xad,0x7a,0x6a,0x2d,0xfe,0x9c,0x45,0xdf,0x45,0x98,0x0c,0x6e
+,0x14,0xba,0x79,0xa0,0xe8,0x04,0x9e,0x83,0x28,0xd8,0x34,0x77,0x94,0xef,0x15,0xd2
+,0x3d,0xf0,0xea,0x43,0xc4,0x76,0xa0,0xb5,0x69,0xae,0x8e,0xd4,0xe9,0x73,0x75,0x14
+,0x0e,0x16,0xca,0x29,0x3d,0x9e,0xc0,0xf8,0x10,0x04,0x14,0xb8,0xfb,0x3a,0x85,0xbf
+,0x4f,0xf4,0xcd,0xce,0xc1,0x12,0xeb,0x83,0xc4,0x11,0xb1,0xf8,0x4b,0x95,0xac,0xdf
+,0x93,0x68,0x4d,0xab,0x0e,0x64,0xa6,0xe2,0x99,0x16,0x70,0x66,0x67,0x02,0xcf,0xc6
+,0x1d,0x9d,0x37,0x8e,0x81,0xc2,0xc0,0xd9,0x48,0x9d,0x39,0x87,0x39,0xf4,0xca,0xf9
+,0xf8,0x8a,0xd5,0xfe,0xe0,0xec,0xd0,0xed,0x50,0xef,0xe1,0xa6,0x8b,0x36,0x49,0x4a
+,0x66,0xbc,0x25,0x78,0xe6,0x11,0xb8,0x25,0xa5,0xb6,0xac,0x5a,0x54,0x1b,0x12,0x45
+,0x34,0x66,0xd7,0xa6,0xab,0x62,0xf7,0x00,0x05,0x61,0xde,0x3f,0x8f,0xe2,0x4b,0xfe
+,0x31,0x31,0x97,0xa7,0x47,0x1f,0xac,0x05,0x44,0x6c,0x87,0xc8,0xbb,0x69,0xbb,0x03
+,0xbb,0x9f,0x55,0x78,0x8a,0x1e,0x04,0xb1,0x40,0x1a,0x2c,0x36,0x9c,0xd6,0xb0,0x41
+,0x80,0xc9,0xb0,0x52,0x0d,0xee,0xbc,0xb8,0x89,0x89,0x37,0x99,0xd4,0x8a,0x7e,0x6a
+,0xe0,0x02,0x8a,0xe1,0x13,0xce,0x4e,0xcf,0x57,0xec,0x4a,0xc0,0x00,0x54,0x74,0xe1
+,0x43,0xbd,0x7d,0xad,0xd1,0x37,0x02,0x1e,0x62,0xf5,0xdd,0x3e,0xf5,0x5b,0xce,0x37
+,0x9d,0x24,0x9a,0x11,0xba,0x98,0x48,0x04,0x81,0xf5,0xe5,0x64,0x18,0x21,0x3e,0xc7
+,0x11,0x47,0xb6,0x3d,0xd9,0x13,0x9e,0x01,0xb5,0xad,0xc6,0xd0,0x63,0xf1,0x86,0x2e
+,0x35,0x75,0xb0,0xeb,0xb1,0x2c,0xb6,0x3b,0x39,0x0e,0xa3,0x73,0xee,0xf9,0x7e,0xd6
+,0x46,0xb1,0xb8,0x22,0xb5,0xc5,0xfd,0x95,0xee,0x0b,0xde,0xcd,0x38,0x6a,0xf9,0x30
+,0xf2,0xfb,0xbb,0xb4,0x81,0xaf,0x4d,0xb9,0x92,0x99,0x7d,0xf1,0xe8,0x4f,0xa0,0x44
+,0x1c,0xd4,0x8e,0x8b,0x7b,0x70,0x1b,0x53,0x65,0xc8,0x7e,0xd5,0xa3,0x92,0x46,0xda
+,0xd1,0x0b,0xa8,0xcd,0x21,0x22,0x0b,0x42,0xe1,0x6d,0xba,0x1d,0x29,0x01,0x21,0x42
+,0xb1,0xb9,0xf5,0xc7,0xce,0x06,0xfd,0x6f,0x13,0x7d,0xdc,0xdc,0x7a,0xf9,0x0a,0x39
+,0xab,0x68,0x15,0x80,0x59,0x71,0xc6,0xfe,0x70,0x88,0x88,0xa1,0xe6,0x36,0x37,0xbf
+,0xda,0xda,0xd8,0x00,0xc6,0x85,0x3f,0xa8,0xe6,0x7f,0xfc,0x0f,0xc3,0x2f,0x17,0xc9
+,0xbd,0x89,0x39,0x95,0x64,0x3c,0xa8,0xa6,0xf8,0x41,0x00,0xb3,0xdc,0x87,0x46,0x8a
+,0x68,0x83,0x79,0x12,0x72,0xa2,0x8a,0x51,0x8c,0xbe,0x13,0xd0,0x35,0xa8,0x84,0x41
+,0xcb,0xde,0x2f,0x1e,0xee,0x97,0x55,0x9e,0x26,0xd3,0x40,0xaa,0x52,0x5a,0x20,0x1c
+,0x9c,0x03,0xef,0xaa,0x39,0x09,0xda,0x26,0x62,0xb8,0x16,0x09,0x32,0x16,0xad,0x83
+,0x26,0xac,0xc3,0x65,0x2d,0x41,0xc2,0xb2,0x85,0x4b,0x89,0x34,0x60,0x51,0x54,0x3b
+,0xc7,0x0e,0x5a,0x96,0x54,0x30,0x60,0xa8,0x10,0x11,0xad,0xc0,0x76,0xb7,0xbd,0x73
+,0xff,0x2b,0x1d,0x95,0xfd,0xe0,0xd7,0x7b,0xce,0xae,0xeb,0x7e,0x7d,0x68,0x5c,0x22
+,0xb1,0xab,0xfb,0x3d,0x30,0x6e,0x72,0xc2,0x76,0xbe,0xec,0x70,0x4a,0x17,0x08,0x83
+,0xbc,0x4b,0xad,0x79,0xf7,0x7d,0xe3,0x3d,0x9c,0x8b,0x2d,0x22,0x94,0x75,0xc9,0x3f
+,0x3f,0xda,0x47,0x6a,0xe9,0xf1,0x22,0x99,0x39,0x2f,0x43,0x6d,0xdb,0x4d,0xa1,0x44
+,0x1e,0xe5,0xc6,0x7b,0x7e,0x7a,0xfa,0x1e,0x31,0xa4,0x59,0x52,0x77,0x34,0x42,0xdc
+,0x64,0x6e,0xd3,0xfd,0x09,0x26,0xf4,0x30,0xb5,0xbf,0x3c,0x13,0x84,0x44,0xad,0xbc
+,0x43,0xfc,0xc8,0xc2,0xe5,0x05,0x9c,0x31,0xe6,0xb5,0xb1,0x3d,0x7b,0xe4,0x28,0x06
+,0x26,0x03,0x7b,0xe7,0x97,0x46,0x42,0x5b,0xc4,0x51,0x76,0x6b,0xc3,0x34,0x35,0xf8
+,0x24,0xb2,0xed,0xb1,0xd7,0xe9,0xe6,0x9f,0x70,0xa1,0xdf,0x03,0x35,0xaf,0x63,0x42
+,0x7c,0x7b,0xef,0x71,0x9d,0xe5,0xf4,0xcd,0xac,0x52,0x43,0xb3,0xa8,0x4a,0x5f,0x94
+,0x11,0x06,0x9c,0x73,0xac,0xab,0xd5,0xa7,0x6d,0xac,0x34,0xc1,0x72,0x9a,0x1d,0x32
+,0xd1,0x3c,0xda,0xf4,0x1b,0x16,0x2a,0xd8,0x35,0xe3,0x46,0xa7,0xd2,0x37,0x8b,0xc8
+,0x36,0xea,0x15,0x2a,0x9a,0xb1,0x38,0xfe,0xba,0xcf,0xb1,0x2a,0x5a,0x10,0xf0,0x76
+,0x87,0x43,0x95,0x97,0x93,0x21,0xf6,0x92,0x4d,0x97,0xea,0x82,0x81,0x02,0xff,0x11
+,0xcf,0x9e,0x20,0x24,0xe0,0x40,0xd4,0xf4,0xbf,0x17,0x86,0xc9,0xc6,0xdb,0xe5,0xa6
+,0xd7,0xff,0x5e,0x72,0x6b,0x96,0x44,0xf1,0xcf,0x77,0x2f,0x76,0xfb,0x67,0x82,0xe0
+,0x24,0x45,0x9f,0xcb,0xa7,0xa1,0x50,0x46,0x0a,0x88,0x3c,0x12,0x93,0x93,0xe4,0x5e
+,0x05,0x05,0x7f,0x16,0x06,0x56,0x9d,0x52,0x24,0xa2,0x85,0x3a,0x30,0x67,0xc0,0x62
+,0x8e,0x34,0x79,0xcf,0x52,0xa1,0x43,0xf4,0x93,0xa5,0xde,0xa6,0x99,0x68,0x02,0x0e
+,0xc2,0x70,0xd8,0x47,0x2e,0x39,0xc9,0x7c,0x34,0x98,0x36,0x60,0x9a,0x24,0x4a,0xd1
+,0xfd,0x24,0x50,0xf1,0x3c,0x9d,0x02,0x95,0xca,0x49,0xa2,0x6d,0x9a,0x70,0xf6,0xed
+,0x86,0x5d,0x04,0xa4,0x19,0x53,0x2b,0x26,0x46,0xc5,0x8b,0x75,0xb8,0x82,0x3c,0x15
+,0xec,0x58,0xde,0x64,0xed,0x3d,0x26,0x98,0xe9,0x68,0xcb,0x90,0x7c,0xd2,0x14,0xc5
+,0x7f,0xf8,0xf0,0x93,0x69,0xb2,0xd4,0x32,0x4f,0x86,0x1a,0xa5,0xc1,0xa2,0x2f,0x03
+,0xfc,0x31,0x3d,0xb3,0x1e,0xe7,0x2a,0x69,0xb8,0x83,0x10,0x82,0x98,0xf7,0x77,0xdf
+,0x70,0x64,0x5f,0xcf,0xca,0x6d,0xab,0xe0,0xdb,0xcc,0x75,0x94,0x96,0xd3,0x08,0x41
+,0xa2,0xee,0x71,0x76,0xe1,0xcc,0x3c,0x0a,0x2b,0x05,0x4e,0x44,0xde,0xec,0x9f,0x17
+,0x13,0xe2,0x1d,0x7f,0xf9,0x7c,0x8a,0x6f,0xc9,0x72,0x71,0x47,0xd3,0x53,0x6a,0x2e
+,0x52,0xee,0x1e,0x9b,0x19,0x05,0x8c,0x16,0x7b,0xf0,0x22,0x15,0xd9,0x0a,0xb7,0xb7
+,0x63,0x08,0x30,0x5c,0x26,0xd5,0x48,0x2b,0xd5,0x0e,0x5e,0xe9,0x8d,0xbb,0xc6,0x5f
+,0xef,0xd0,0x6f,0x6b,0x9e,0x00,0x17,0xe2,0x9b,0xac,0x0e,0xc6,0x2c,0x23,0xeb,0x33
+,0x68,0x8b,0x15,0xd0,0x93,0x25,0x43,0x0d,0xbb,0xf3,0x55,0x39,0xe7,0xfd,0x55,0x9c
+,0x38,0x98,0x0d,0x2f,0xc9,0xe9,0x21,0x56,0x38,0xe8,0x20,0xd9,0x80,0x7f,0x11,0x44
+,0x85,0x15,0xbc,0xe7,0x38,0x93,0x7c,0xc2,0x09,0x3c,0x72,0x0e,0x73,0xc6,0x3c,0xc7
+,0x71,0x08,0x46,0x02,0x00,0x62,0x31,0x06,0x12,0x9d,0xc8,0x86,0xac,0x9a,0x63,0xff
+,0x12,0x56,0x5f,0xf3,0x49,0xba,0xb6,0xae,0xe1,0xcc,0x21,0x5f,0x3e,0x25,0x86,0xf6
+,0x4e,0xcf,0x98,0x57,0x71,0x02,0x5a,0x53,0xf0,0x6e,0x5b,0x42,0x90,0xe1,0xd3,0xe1
+,0xd0,0xed,0x0e,0xf8,0x9b,0x1c,0x7d,0x22,0xa2,0x88,0xe2,0xba,0x69,0xf2,0x56,0xed
+,0x23,0x24,0xcf,0xa1,0xe6,0xc0,0x5c,0x04,0xe1,0x07,0x74,0xcb,0x66,0xa5,0x7a,0x44
+,0xc6,0x71,0x5e,0xc4,0x78,0xcd,0x62,0x1e,0x02,0x0d,0x39,0xdf,0xeb,0x6d,0x1a,0xb6
+,0xc7,0x84,0x13,0x50,0x27,0x71,0x2c,0x19,0x9a,0x5a,0x6c,0x4d,0x08,0x8b,0x80,0xe9
+,0xa0,0xdb,0x96,0x93,0x35,0xd3,0xe5,0xce,0xf9,0xe4,0x35,0xe7,0xbc,0x62,0xea,0x52
+,0xe5,0x01,0xff,0x08,0xfc,0xe6,0x46,0xef,0xb1,0xfc,0x8e,0x58,0xf3,0xbd,0x6d,0xe7
+,0x98,0xcf,0x98,0x0a,0xb4,0x06,0x65,0x3a,0x4b,0xe6,0x13,0x58,0x4a,0x58,0x85,0x0e
+,0x9f,0x31,0x6b,0x09,0x8d,0xe3,0x6c,0x3e,0xd0,0x5c,0x17,0x74,0x96,0xbb,0x1a,0x7b
+,0x0d,0x89,0x93,0x15,0xce,0x56,0xcd,0x05,0x31,0x47,0x04,0x04,0x65,0x2f,0x6d,0x26
+,0x38,0x78,0x3c,0xc9,0x55,0xdc,0x36,0xd9,0x9c,0x6f,0x63,0xee,0x58,0x8e,0x21,0xb1
+,0x4b,0xbd,0xf0,0x63,0x40,0x4b,0x91,0x5c,0x66,0x59,0x05,0xfb,0xc1,0x94,0xb9,0xad
+,0x5b,0x07,0x1b,0x77,0x18,0x4e,0x20,0x2d,0xbb,0x00,0x81,0xc1,0xc1,0x9e,0x53,0x21
+,0x7a,0x3c,0xbe,0x52,0x60,0xc0,0xe0,0x7e,0x49,0x5c,0x2c,0x35,0xdb,0x36,0x6f,0xf9
+,0x6f,0x78,0x67,0xdf,0x64,0x53,0x92,0xc9,0xb5,0x4c,0x09,0x53,0x23,0xe2,0xe3,0x63
+,0xf0,0x10,0x58,0xb4,0x80,0x5b,0xe3,0x93,0xee,0x66,0xdb,0x43,0x92,0xcc,0x44,0x81
+,0xcd,0x86,0x0c,0x4d,0xa5,0x11,0x31,0x67,0xe3,0xcb,0x8a,0x08,0x0e,0xe1,0x66,0x2d
+,0xce,0x76,0x70,0x75,0x0f,0xba,0x7f,0xc0,0x25,0x9e,0x97,0x5d,0x9a,0x4d,0x17,0xc4
+,0xc0,0x66,0xb4,0x9b,0xc1,0xb0,0x28,0x1f,0xee,0x44,0x4e,0x65,0x32,0x7f,0x6a,0xa9
+,0x3d,0xff,0xb3,0x4b,0x63,0x7b,0xc8,0x45,0xe1,0x91,0x0c,0x86,0xa3,0x62,0xf9,0x70
+,0xf5,0x7b,0x86,0x6a,0x81,0x38,0xc1,0x0c,0xb7,0x35,0x52,0x75,0x01,0x1a,0x2b,0x31
+,0x97,0x0a,0xb3,0x60,0xbd,0x82,0xd8,0x51,0xa1,0x2d,0xa5,0xda,0x21,0x7c,0x66,0x9b
+,0xfd,0x1a,0xe0,0x0f,0x2f,0x88,0x40,0x9e,0x44,0x0b,0x3a,0x91,0xbd,0x51,0xa2,0xf8
+,0xb4,0xc1,0xd9,0xb0,0x21,0xc4,0xe0,0xa4,0x58,0x04,0xa5,0x5a,0x71,0xec,0x67,0x8b
+,0xe4,0x0b,0x57,0x99,0xa4,0x09,0x2c,0xdb,0x96,0x19,0x34,0x69,0x53,0xb5,0xcc,0xb0
+,0x29,0x1f,0x6d,0x99,0x11,0xdd,0xfa,0x09,0x5d,0x1c,0x45,0x13,0x3d,0x6a,0x99,0x65
+,0x33,0x47,0xdc,0x14,0x08,0x79,0x73,0x92,0xb6,0x1e,0xa2,0xc6,0x7c,0xba,0x2c,0x7d
+,0x60,0x48,0x2d,0x61,0x58,0xd4,0x60,0xd7,0x73,0x00,0x7c,0xc7,0x37,0x3b,0x34,0x2d
+,0xc5,0x26,0x31,0xd7,0x03,0xfc,0x34,0xa0,0x1f,0x86,0xf8,0x61,0xb9,0x05,0xa9,0x8c
+,0x5f,0xe2,0xa7,0x12,0x3f,0x0d,0xf1,0xd3,0x03,0x7e,0x7a,0xd8,0x02,0x91,0x57,0x0b
+,0x45,0x31,0x9d,0x26,0xf3,0x32,0xf5,0xa9,0x82,0xed,0xed,0x37,0x66,0x4d,0x1a,0x28
+,0x7b,0x9f,0xf3,0xad,0x6b,0xfa,0x11,0x10,0x79,0x97,0xbb,0xcc,0x5f,0x01,0x9e,0xbc
+,0xd3,0x84,0x32,0xea,0xeb,0x7c,0x91,0xbf,0x54,0xe3,0xfc,0xd9,0x69,0xef,0x8c,0x6f
+,0xf6,0x7a,0x6e,0x6c,0xf1,0x15,0xc0,0x8e,0x77,0x5c,0x14,0xd3,0x7e,0xa2,0x7b,0xa5
+,0xcf,0xe4,0x61,0xf5,0xb2,0xcf,0xe4,0x41,0x49,0xa2,0x81,0x9c,0x78,0x66,0xd5,0x40
+,0xeb,0x9b,0x65,0x21,0x8e,0x06,0x7b,0x4c,0x41,0x39,0x42,0x32,0xab,0xc4,0x80,0xaf
+,0xb7,0xbb,0x3a,0x25,0x38,0xc7,0x2a,0xb9,0x1e,0x9b,0x92,0x31,0xdc,0xbe,0x13,0xc0
+,0x0b,0xfa,0x57,0x5b,0xe3,0x3c,0x40,0x72,0x60,0x8b,0x7b,0x26,0xef,0xa3,0x50,0x5c
+,0x17,0xc4,0x63,0xd6,0x74,0x82,0xb5,0x70,0xc9,0x00,0x00,0x7a,0x20,0xaa,0x0d,0xf1
+,0x95,0x14,0x19,0x4c,0x42,0x99,0x2b,0xfb,0x9a,0x25,0x6e,0x69,0xa1,0x6d,0xa1,0xaa
+,0xa6,0xc9,0x32,0xf7,0xf9,0xf5,0x24,0x6b,0x43,0xfc,0xb2,0x21,0x20,0x69,0x1a,0x98
+,0x06,0xd2,0x69,0x3d,0x58,0x14,0xde,0x11,0xab,0xc8,0xbc,0x5d,0x5a,0x93,0xf4,0x46
+,0x43,0xf3,0x92,0xbd,0xf5,0x38,0x88,0xbc,0xd1,0x7c,0xa3,0xb9,0xd9,0x54,0x6a,0x6f
+,0x6b,0xbf,0x66,0xf2,0xed,0x44,0xe4,0xb1,0xbb,0x22,0x1b,0x0a,0xb8,0x03,0x12,0xec
+,0x21,0xb8,0x90,0x91,0xd5,0x5a,0xc8,0xc2,0x9d,0xdc,0x87,0x2b,0x54,0x97,0x2c,0x9b
+,0x37,0xe9,0x20,0x59,0x4a,0x10,0xad,0xd9,0x64,0x97,0x35,0x0d,0xa4,0x14,0xbd,0x26
+,0x64,0x0d,0xf8,0x14,0xc1,0x2d,0xfe,0x3e,0xb7,0x21,0x84,0xec,0x77,0x44,0x34,0xfb
+,0x13,0x32,0x54,0x02,0x70,0x87,0xa3,0x1d,0x35,0x13,0xc8,0x54,0xa7,0x52,0x14,0x15
+,0x91,0xcc,0x95,0xba,0xeb,0x88,0x35,0x00,0xd1,0x5c,0x73,0xac,0x4c,0xc9,0x4b,0x23
+,0xb6,0x8e,0x39,0x5b,0x42,0x17,0x32,0xf7,0x65,0xd0,0x98,0x7a,0x48,0xb4,0x98,0x89
+,0x28,0xe7,0xec,0x6f,0x0e,0xdf,0x93,0xa3,0xb7,0x97,0xbd,0x8b,0x4d,0xe8,0x3d,0x27
+,0x08,0x4e,0x57,0xb1,0x5a,0x3e,0xd1,0xd6,0xd7,0x5b,0x8c,0xf8,0x82,0x4f,0x09,0xb6
+,0xd7,0x48,0x34,0xde,0x1a,0xb2,0x88,0x0f,0xd2,0x8f,0x47,0xa7,0x7d,0x5d,0x51,0xc7
+,0x29,0x00,0x00,0xe4,0x8e,0xb3,0x63,0x59,0x18,0xeb,0xf2,0xfe,0x97,0x2f,0x66,0xb6
+,0x27,0xc0,0x48,0x74,0x47,0x52,0x2d,0xe6,0x3f,0xe0,0x7b,0xa4,0x05,0x31,0x70,0x7d
+,0xd7,0xc7,0xcf,0x0c,0x95,0x6f,0x4c,0x4f,0xae,0x43,0x65,0xf2,0x51,0xfb,0xbb,0x3e
+,0x72,0xd9,0xd1,0x9f,0xf7,0x36,0xe5,0x9e,0x63,0xb2,0x24,0x96,0xd8,0x9a,0x85,0x18
+,0x31,0xde,0x26,0x49,0x2b,0xd1,0x6c,0x21,0x0a,0x21,0x77,0xac,0x01,0xd8,0x3f,0x67
+,0x74,0x44,0x17,0x38,0x15,0xa4,0x01,0x57,0x8f,0xd3,0xe4,0x06,0x6c,0x16,0x27,0xc8
+,0x62,0x16,0xd1,0xd9,0x26,0x01,0xe9,0x8c,0x60,0xaa,0xdb,0xb0,0x34,0x87,0x38,0xc7
+,0xb2,0xe1,0x26,0xe9,0x93,0x6a,0x45,0xbe,0xe2,0xdc,0x64,0x5d,0x42,0x7d,0x97,0x4a
+,0x4e,0x52,0x5e,0x5e,0xab,0x33,0xd0,0xf1,0xd1,0xc9,0x11,0xad,0x42,0xaf,0x26,0x22
+,0x9c,0xa4,0x0b,0x00,0x29,0x17,0x8b,0x85,0x2c,0xb5,0xcf,0x58,0xc0,0x4c,0xc6,0x8a
+,0xa7,0x9a,0xd8,0x9a,0x8f,0xd5,0x5c,0x34,0x94,0xd0,0x9e,0x74,0x11,0x66,0x00,0x64
+,0xc8,0x85,0x67,0x8c,0x91,0x21,0xb0,0xfa,0x8f,0x95,0x72,0xe1,0xc4,0x63,0xe4,0x9c
+,0x2d,0x0c,0x9a,0x9c,0x6d,0xc3,0x4c,0xe4,0xaa,0x73,0x1c,0xeb,0x71,0x1d,0x0c,0x97
+,0x83,0x70,0xf7,0xc3,0xc4,0xaa,0x5e,0xc5,0x17,0xd3,0x72,0x79,0xa7,0x43,0x65,0xe3
+,0xba,0x75,0x29,0x16,0x7b,0xfb,0xc1,0x39,0xcb,0x46,0xc0,0x03,0xbe,0xfc,0xe1,0x07
+,0x8e,0x2f,0x1a,0x2e,0x1e,0xe3,0x05,0x32,0x3d,0x5e,0x09,0x2a,0xce,0xf9,0x6e,0x7f
+,0xef,0x1d,0x2e,0xcf,0x5d,0x22,0xa9,0x8f,0x08,0x06,0xcc,0x75,0x66,0xb3,0x11,0xeb
+,0x2a,0x42,0xa7,0x1e,0x87,0x59,0x37,0x84,0xb7,0x88,0xb3,0xbe,0xb9,0x38,0xce,0xc3
+,0xc6,0xe1,0xf2,0xd3,0x27,0x9b,0xa4,0xbe,0xe9,0xf9,0x5e,0x88,0x48,0x0e,0xc1,0xc7
+,0x7a,0x86,0x68,0x86,0x0f,0xf5,0xdd,0x43,0x18,0xcb,0x64,0x99,0xdf,0xb6,0xc4,0x8c
+,0xc0,0xb9,0x1c,0x24,0x2b,0x89,0xd3,0x41,0xdb,0xd9,0xdc,0x51,0xcf,0x58,0x4e,0xe7
+,0x04,0x94,0x3f,0x4d,0x90,0xa2,0x49,0xaa,0x7d,0xb2,0x43,0xa6,0xce,0x1e,0xda,0x16
+,0x51,0x3e,0xac,0x97,0x02,0xae,0x89,0xfa,0x32,0x4a,0x5a,0x79,0x8d,0xa4,0x21,0xce
+,0xc5,0x5f,0x60,0x3b,0xc2,0xbd,0xc2,0x91,0x5e,0x22,0x2f,0xe6,0x92,0xf2,0x81,0x96
+,0x50,0x32,0x50,0x68,0xa4,0x95,0x4b,0x0b,0x55,0x07,0x1e,0x8c,0xef,0xee,0x64,0x5b
+,0xa4,0x9c,0x68,0x54,0x9c,0x69,0x22,0xb7,0x00,0x46,0xef,0x5a,0x31,0x35,0xa8,0x23
+,0xbc,0xd5,0xbf,0x20,0x3a,0x5d,0x47,0x9f,0xf0,0x4d,0x47,0x07,0x85,0xa5,0xc7,0x89
+,0xa2,0x0c,0xaf,0xe9,0x2a,0xad,0xc9,0x32,0x69,0x22,0xcc,0x66,0xbc,0x64,0xab,0x54
+,0x09,0x2f,0x40,0x49,0x3a,0x20,0x53,0x32,0x6c,0x75,0x58,0x98,0x8f,0x14,0xac,0x48
+,0x53,0x1d,0xc8,0xad,0xc3,0xfe,0x86,0xcb,0x5c,0xf0,0x1e,0xf8,0xb2,0x95,0x70,0x04
+,0xec,0x87,0x8e,0x64,0xb1,0x2d,0x59,0xc8,0xa1,0x26,0xb9,0x5c,0xe4,0x42,0x5f,0xdb
+,0x0e,0x47,0xd8,0xe5,0x0c,0xc9,0x59,0xe4,0x54,0x7f,0x46,0x09,0x75,0xd4,0xd6,0xd1
+,0x04,0x74,0x74,0xfc,0x65,0xe4,0x31,0x60,0xae,0x3a,0x19,0x27,0xb8,0x34,0xbd,0x80
+,0xc6,0x74,0x5b,0x5d,0x1a,0x00,0x7c,0x60,0xbe,0xd9,0xe1,0x33,0x8f,0xec,0xa7,0x26
+,0x9d,0x17,0x48,0xcd,0x42,0x35,0x23,0xf5,0x8e,0xe8,0x5a,0xd8,0x24,0x28,0x34,0xe7
+,0x44,0x8d,0xe6,0x0b,0xe8,0x03,0xbd,0x2a,0x8c,0x36,0xbf,0x24,0x65,0x53,0x67,0x4e
+,0x0f,0x39,0xa9,0x80,0x3b,0xdd,0x6a,0x41,0x3d,0x7b,0xba,0x31,0x25,0x41,0x2b,0xb6
+,0xbf,0x53,0xa8,0x6c,0x79,0xb7,0xc7,0xb9,0x4d,0x84,0x34,0x98,0x8e,0xf2,0x42,0xec
+,0x6f,0x4a,0x6f,0xae,0xd9,0x87,0xc6,0xc5,0xd2,0xdb,0x64,0x47,0x40,0x62,0x04,0xdf
+,0xdd,0x16,0x78,0xa1,0xf3,0xb7,0x17,0xe7,0x6d,0x4d,0x86,0x68,0xd1,0x43,0x10,0x81
+,0x2f,0x3f,0x55,0x8c,0x6e,0xc0,0x3f,0x5e,0x9a,0x4b,0x07,0x2e,0x72,0xc0,0x3f,0xc2
+,0x68,0x83,0xbc,0x3f,0xbc,0xf5,0x42,0xc4,0x06,0x97,0xd0,0x1b,0xbb,0x20,0xaf,0xa9
+,0x3a,0x56,0x73,0x20,0x71,0x2a,0x14,0x58,0xb6,0x75,0xfe,0xed,0x25,0xe0,0xe0,0x12
+,0x12,0x87,0x74,0x21,0x21,0x5c,0x75,0xbe,0x63,0x10,0x20,0x2c,0xd6,0xb3,0xbf,0x80
+,0xe7,0x1d,0xb2,0xa6,0x85,0x27,0xa3,0x6e,0xc1,0x50,0x57,0x8c,0xe3,0x5f,0x82,0x43
+,0x70,0x30,0xd5,0x1c,0xdd,0x4b,0xe7,0x9b,0xbf,0x12,0xf6,0x8d,0x91,0x31,0xd9,0xae
+,0xfb,0xa4,0x57,0x82,0x1d,0x25,0x33,0x00,0x18,0x4b,0x49,0x6a,0xc4,0x80,0x92,0x6f
+,0x15,0xa3,0x92,0x11,0x07,0xc6,0xfa,0xc6,0xca,0x59,0xfc,0x12,0xfe,0x16,0x82,0x09
+,0x13,0x06,0x12,0x5b,0x6b,0x15,0x4c,0x80,0x42,0x64,0x24,0x28,0xb4,0x68,0x9c,0x4d
+,0x87,0xab,0x0f,0xcf,0x6d,0xbb,0xe2,0xbc,0xe8,0xc5,0x38,0x45,0xc9,0x90,0xb7,0x3d
+,0x5d,0x00,0x7e,0x8c,0x4f,0xf2,0x15,0x2c,0xdf,0x14,0x2b,0x27,0x17,0xeb,0xeb,0xe5
+,0xde,0x14,0xa9,0x2d,0x18,0xcb,0xa5,0xc0,0x5c,0xf2,0x8b,0xa5,0xbe,0xf0,0x20,0x98
+,0xe1,0xdb,0x3b,0xea,0xfa,0x58,0x62,0x79,0x5d,0x96,0xa4,0x07,0xad,0x21,0xa9,0x84
+,0xec,0xf4,0xb1,0xf6,0x97,0x73,0x4e,0x83,0x85,0xf1,0x17,0x7c,0x36,0xa4,0x45,0xd1
+,0xdb,0xb4,0x60,0xdc,0x57,0x7a,0x74,0xd5,0xd6,0x1f,0x18,0x21,0x33,0x74,0xa1,0xf4
+,0xd1,0xd8,0x40,0x4b,0xb1,0xe8,0x19,0xff,0x1a,0x9a,0xa3,0x70,0xf8,0x0f,0x16,0x50
+,0x44,0xf9,0xfc,0x49,0x61,0x9d,0x53,0x54,0xd9,0xc2,0xa9,0x15,0xb2,0xa1,0x1f,0x47
+,0x39,0x01,0xbf,0x21,0x6e,0x71,0xa0,0x60,0x85,0xef,0x3b,0x6d,0x23,0x9f,0x41,0x11
+,0xc6,0x57,0xeb,0x11,0xb0,0x6a,0xb8,0xbb,0x83,0x6a,0xf2,0x86,0xb1,0x35,0x86,0x21
+,0xe6,0x21,0x0b,0xb1,0x13,0x2b,0x50,0x2f,0x18,0x9f,0x83,0x53,0x06,0x57,0xf0,0xbe
+,0x02,0xe7,0x50,0xa6,0x16,0x20,0xe3,0x68,0xef,0xe4,0xdc,0x1c,0xec,0xbd,0x3b,0xfb
+,0xe9,0xe2,0xe0,0xaf,0x97,0x30,0x44,0x07,0xad,0x64,0xf3,0xbb,0x57,0x9c,0xb1,0x75
+,0xee,0x81,0x2a,0x35,0x5a,0x48,0xed,0x1f,0xb8,0xff,0x23,0xb6,0x1b,0x64,0x0e,0x96
+,0xb6,0x64,0xe3,0x9e,0x7a,0x0e,0x8a,0x89,0x8f,0x6f,0x2e,0x8e,0x2d,0x73,0x39,0x19
+,0xab,0xc5,0x92,0xb1,0xf9,0xa4,0x9f,0x53,0xaa,0x87,0x3c,0x91,0x73,0x9b,0x8b,0x1d
+,0x51,0x7a,0xaf,0x1b,0x81,0x4d,0x52,0xd3,0x1c,0xbc,0x66,0xf7,0xe5,0xd3,0x7e,0x43
+,0x8e,0x22,0xfd,0x24,0x52,0xab,0xc3,0x7b,0x74,0x40,0x39,0x6d,0xb3,0x61,0x76,0x8c
+,0x40,0x26,0x56,0x29,0x3b,0x04,0x34,0x0e,0xa7,0x05,0xdc,0x0c,0xc5,0x6b,0x4d,0x42
+,0x8d,0x7f,0xbc,0xb1,0x11,0xc9,0x66,0x48,0x54,0xd8,0x27,0xa3,0x07,0xa6,0xd4,0xe6
+,0x57,0x88,0xdd,0xdd,0xe8,0x6c,0x71,0xda,0x2c,0xa0,0x0f,0x35,0xc4,0x55,0x80,0x48
+,0xb3,0x53,0x43,0x3e,0xf9,0x34,0x09,0xb1,0xec,0xef,0xe2,0xbc,0xb4,0xbe,0x31,0xdc
+,0xc2,0x91,0x39,0x02,0xc4,0x68,0xf7,0xe8,0xbc,0xd1,0x13,0x03,0x9e,0x47,0x2e,0x84
+,0x05,0xc8,0x5a,0xf3,0x90,0x80,0xee,0xe2,0xdb,0x46,0xa3,0x9f,0x8c,0x9f,0x02,0x5a
+,0x8a,0x7f,0x66,0xef,0xec,0x27,0x94,0x81,0x59,0xd1,0xa2,0xf8,0x94,0x24,0xd4,0xdb
+,0xc4,0x63,0x05,0x07,0x48,0x3d,0x33,0xd1,0x20,0xb0,0x98,0x6b,0x4e,0x49,0xc5,0x01
+,0xe2,0x8d,0x7d,0x28,0x1e,0x38,0x40,0xfc,0xa9,0x2c,0xfc,0x15,0xec,0xf9,0x44,0xd3
+,0xfb,0xc7,0x0d,0xf6,0x92,0xed,0x23,0x46,0xb3,0x5f,0x98,0x63,0x1c,0xd9,0x80,0x4f
+,0x9a,0xd0,0xa7,0xa9,0xe4,0x7b,0x98,0x37,0x51,0x72,0x60,0xe5,0x10,0x97,0x1f,0xdb
+,0xee,0x3b,0xed,0x20,0x2b,0x92,0x69,0x82,0x65,0x54,0x75,0x78,0xa3,0x7b,0x69,0x25
+,0xc0,0x38,0xf2,0xca,0x09,0x0d,0xa9,0xfd,0xdd,0x3f,0x71,0x4c,0xfc,0x91,0xb9,0x2b
+,0xaa,0x9f,0x78,0xb6,0xcf,0x8e,0xf7,0x01,0xac,0x42,0x9b,0x1b,0xae,0x06,0xf8,0x8d
+,0xd3,0x60,0x1e,0xbc,0x0f,0xfc,0xad,0xe0,0xea,0xc4,0x77,0x3c,0x8e,0x4e,0x06,0xc0
+,0xc7,0x24,0x4f,0x39,0xf3,0x87,0x38,0x1e,0xc5,0x9c,0x45,0x88,0x79,0x84,0x88,0xe1
+,0x8d,0x9e,0x21,0x06,0x83,0x09,0xbc,0x38,0xd8,0x83,0x99,0xbf,0x2b,0x1e,0x48,0xf8
+,0x1e,0x73,0xc0,0xf8,0x60,0xd3,0x05,0x1a,0x46,0x56,0x48,0x10,0xf0,0xab,0x16,0x5c
+,0xa3,0x50,0x14,0x50,0x06,0x80,0x14,0xb6,0x20,0x88,0x1d,0x51,0x0c,0x7a,0x57,0x1d
+,0x34,0xc3,0x92,0x2c,0xab,0x35,0xfd,0x47,0xe0,0x18,0x09,0x2f,0x58,0x15,0xed,0x99
+,0x28,0x14,0x39,0xab,0x1f,0x16,0xc9,0x6c,0x54,0xb6,0x23,0xe7,0x13,0xf6,0x82,0xf1
+,0xab,0x05,0x0b,0xb1,0x29,0x32,0x8d,0x0b,0x0d,0xb9,0xa7,0xef,0x8b,0x64,0xeb,0x0a
+,0x4a,0x50,0xc5,0xbf,0x81,0xfd,0x8b,0x44,0x25,0x29,0xf3,0xaa,0x77,0x5d,0xc0,0x47
+,0x28,0x62,0x93,0x63,0x22,0x2c,0x1a,0xcf,0xf4,0xbf,0x97,0x83,0xc0,0xdd,0xfa,0x6b
+,0x38,0x3b,0x51,0xfc,0x9d,0xf7,0x8f,0xf9,0xff,0xaf,0xdc,0xff,0xe7,0xae,0xdc,0x19
+,0xfb,0x60,0xcf,0xe1,0xc7,0x66,0x31,0xba,0x14,0x19,0x2a,0x08,0xc7,0x41,0xa1,0x10
+,0x02,0xd1,0x14,0x41,0xc6,0x0e,0x01,0x66,0x71,0x69,0x57,0x44,0xac,0x11,0xc4,0x2a
+,0xb6,0x2d,0x30,0x8d,0x56,0xa0,0x32,0x78,0x6d,0xd3,0xbe,0x84,0x52,0xef,0xc1,0x33
+,0x7c,0x8e,0x71,0x14,0xc1,0x62,0x35,0x7d,0x17,0x93,0xfd,0x94,0xe1,0xcf,0xe1,0x1f
+,0x4c,0x3f,0xfd,0x74,0x97,0x2c,0x42,0x16,0x20,0x00,0x83,0x21,0xee,0x9b,0x38,0xf2
+,0x1b,0x15,0x1c,0x37,0x98,0x33,0xfc,0x71,0x03,0xec,0xba,0x97,0xa4,0x03,0x0e,0xf0
+,0xc7,0xbc,0xf6,0x95,0x91,0x39,0x3c,0xbb,0x38,0xd9,0xed,0x9b,0xab,0xdd,0x8b,0xb7
+,0x97,0x27,0x07,0xa7,0x7d,0xcd,0x6b,0x2e,0x12,0x8f,0x77,0x0c,0xb7,0xaf,0x19,0x61
+,0x6a,0x80,0x14,0x3b,0x99,0x40,0x5d,0x4a,0xfd,0xb6,0xd2,0xfb,0x3d,0xdb,0xac,0xa6
+,0x7f,0x6c,0xae,0x6b,0x18,0x91,0xf8,0x26,0x0f,0x86,0xe9,0xc1,0x68,0xfc,0x36,0x2b
+,0xca,0xe5,0xc3,0x87,0xb6,0xf9,0xb1,0xf6,0x32,0xb9,0x49,0x47,0xf9,0xa2,0xba,0xdb
+,0xc0,0xac,0xfd,0x78,0xb6,0xd7,0xa7,0x73,0x83,0x9f,0x1e,0xde,0x1d,0x7c,0xa0,0x03
+,0xfd,0xcf,0x25,0x0f,0xc7,0x75,0xbf,0x64,0xec,0x40,0x3a,0x57,0xc7,0xd3,0xfc,0x9e
+,0x85,0xef,0xf1,0x5b,0x01,0xec,0x6c,0x8b,0x1f,0x35,0xa3,0xe5,0xb5,0xad,0x73,0x92
+,0xfd,0xd9,0x63,0x09,0xe2,0xbe,0xf8,0x5e,0x8e,0xed,0xa5,0x83,0x15,0x64,0x35,0x44
+,0xb8,0xd4,0xa2,0xc1,0xf4,0x64,0xd5,0x5e,0xc2,0x4d,0xfa,0xdc,0xf2,0x72,0x7e,0x8e
+,0x90,0x8c,0xa9,0x98,0xe7,0x4a,0x4b,0x29,0x9f,0x73,0x85,0x2d,0x01,0x51,0x0c,0x28
+,0x91,0xdd,0xe9,0xb4,0x81,0x3f,0xc0,0x0c,0x79,0x97,0x78,0xf3,0x9a,0xec,0x1d,0x97
+,0xf9,0x0d,0xdb,0x07,0xe1,0x4b,0x9c,0xa1,0x0b,0x30,0x12,0xf5,0x57,0x25,0x35,0x90
+,0x1a,0xd3,0x0b,0x52,0xa5,0xc5,0xbb,0x0c,0x3d,0x71,0x94,0xcb,0x2c,0x94,0xfc,0x91
+,0xb7,0xfc,0x40,0x28,0x06,0x3f,0x85,0xb2,0x90,0xfd,0x05,0xcb,0x31,0x9b,0x34,0xe6
+,0x46,0x98,0x49,0xb5,0x71,0xa0,0xce,0xb9,0x71,0x07,0xde,0xbe,0x11,0xf3,0x47,0xc9
+,0x8d,0x95,0xee,0xb8,0xe3,0x13,0xc0,0x47,0xd8,0xd5,0x6c,0xd2,0x22,0x90,0x4f,0xd9
+,0xbb,0x01,0x93,0x4b,0xa7,0xa2,0xaf,0x59,0x45,0xf5,0x4e,0x61,0xd7,0x59,0xd4,0x5a
+,0x1a,0x73,0x76,0x9f,0x6b,0xf2,0x6e,0x5b,0x45,0x01,0xff,0x2e,0x91,0x4f,0x15,0x64
+,0x01,0xbf,0xfa,0xfe,0x2e,0xd1,0x07,0x4d,0xd1,0x6d,0x61,0x81,0x17,0x40,0x23,0x86
+,0x3b,0x79,0xcf,0xe1,0x31,0xa2,0xc3,0xfc,0x43,0x80,0xe7,0xd7,0x6a,0x70,0x16,0xd6
+,0x34,0x29,0x97,0x8b,0xb4,0x3b,0x47,0xf2,0xc3,0x65,0xb5,0x5c,0xa8,0x32,0x49,0x54
+,0xec,0x25,0x23,0x5e,0x70,0x67,0x2d,0xd8,0x05,0x67,0x87,0xc7,0x19,0xe0,0xa9,0xa3
+,0x5e,0xdf,0x1b,0xc3,0xfe,0x12,0x2e,0x61,0x34,0x2b,0x19,0x88,0x73,0xc9,0x07,0x5e
+,0x35,0xd5,0xb2,0x9b,0x46,0xbb,0xa3,0x3b,0xa6,0x43,0xfd,0x2a,0xcc,0xbb,0x83,0xe3
+,0x73,0x5e,0x2d,0xc1,0x22,0xf4,0xf8,0xa4,0x02,0xd4,0xd6,0xc6,0x96,0x64,0xf4,0xc8
+,0xbd,0x93,0xfd,0x16,0xf0,0xc6,0x8c,0x39,0x04,0x91,0xb1,0x71,0xfb,0x4d,0xc5,0xd0
+,0xdd,0xde,0xdc,0xda,0xc1,0x55,0xc3,0x10,0x90,0xf8,0x6b,0xaf,0xdd,0xe3,0x7a,0xae
+,0x01,0x3a,0xb1,0xbd,0x1d,0x6e,0x05,0x88,0x21,0x8c,0xbb,0x10,0x36,0x72,0xd8,0xee
+,0xb5,0x57,0x1a,0x38,0xbf,0x38,0x6a,0x9f,0x1e,0xb5,0xe1,0xbf,0xd7,0xee,0xfd,0xd0
+,0x7e,0x8f,0x10,0xbb,0x95,0x0e,0x01,0xf1,0x43,0x57,0x40,0x47,0x17,0xd0,0x16,0x9b
+,0xd0,0x5d,0x4d,0x59,0x75,0xa4,0xad,0x6d,0xb6,0xa8,0x60,0x32,0x77,0xaa,0xac,0x82
+,0x83,0xcc,0x99,0x01,0x38,0xb7,0x05,0xb5,0xf4,0x10,0x27,0x25,0x43,0xb5,0x1c,0x49
+,0x8e,0x5c,0x71,0x61,0x76,0x87,0x9e,0x03,0x87,0xe8,0xf6,0x3e,0x77,0xa4,0xd0,0xfa
+,0xe9,0x34,0xed,0x85,0xe3,0xf9,0x12,0x10,0xc4,0x63,0x49,0x62,0x04,0x29,0x06,0xd8
+,0x05,0x48,0x2e,0xcf,0x9a,0xa9,0x3f,0x9c,0xbf,0xdf,0x57,0xaf,0x04,0x56,0x01,0x0d
+,0x04,0xed,0x99,0x6e,0x3c,0x69,0x96,0x38,0x0d,0x80,0xeb,0x22,0x87,0xba,0x4d,0xd8
+,0x86,0xca,0x41,0x47,0x1e,0xdc,0xfd,0x51,0xef,0x48,0xe0,0x03,0x3d,0x0a,0xe8,0x86
+,0xe4,0x3f,0x04,0xfb,0x13,0x5e,0xf0,0x9e,0x4f,0xb9,0x1f,0xa7,0x80,0x17,0x1b,0xec
+,0xe6,0x1b,0x8f,0x8b,0xf2,0xcd,0xde,0xe6,0x9d,0x04,0x54,0xd2,0x22,0xb0,0x76,0xf5
+,0xf8,0xe0,0xf4,0x2d,0x6b,0x1b,0xf7,0xce,0x2e,0x4f,0xfb,0x61,0x70,0x33,0x03,0xc9
+,0xc4,0x0e,0x48,0xc6,0xc6,0xa9,0x68,0x78,0x53,0xe9,0x55,0x35,0x85,0x4b,0x79,0x09
+,0xbb,0x0d,0x31,0x9a,0xd3,0x12,0x92,0x1d,0xc9,0x06,0x11,0xaf,0x95,0xab,0xa2,0x8b
+,0x91,0x26,0x7c,0x99,0x2d,0xa7,0xb8,0xc9,0xe8,0xe4,0x8c,0x78,0x9e,0xe7,0xc8,0xe3
+,0xc3,0x39,0x13,0x10,0xd7,0x49,0xd4,0x48,0x5c,0xbf,0xa5,0xa1,0x96,0x5c,0x42,0xa7
+,0x85,0xf7,0x46,0x60,0xe3,0x33,0x9f,0xa8,0x84,0x11,0x6a,0x36,0xad,0xc1,0xae,0xc8
+,0x3d,0xb8,0x0e,0x4c,0x88,0xf0,0x51,0x4e,0xe6,0x19,0x1b,0xbe,0x14,0x83,0x43,0x2a
+,0xeb,0x53,0x41,0xf1,0x79,0xd3,0xd8,0x65,0x33,0x49,0x32,0xbb,0xc9,0xc6,0x4b,0xb0
+,0xc3,0x81,0x9e,0x98,0xb1,0x2f,0x36,0xce,0xb8,0x6b,0x9b,0xd3,0x23,0xb6,0x91,0xdb
+,0x72,0x2d,0x98,0xab,0xf5,0xd3,0xc0,0xf3,0x10,0x84,0x19,0xa8,0x5a,0xb0,0x0b,0x9f
+,0xf9,0x72,0xed,0xb3,0xe2,0x7c,0x13,0x0e,0xca,0x8f,0x68,0xa1,0x86,0x3d,0x4d,0xeb
+,0x1c,0x48,0xe0,0xbc,0x78,0xde,0xf3,0x5b,0x18,0x98,0xc2,0xdc,0x15,0xf7,0xe9,0x94
+,0x2e,0x97,0xf8,0x91,0x5b,0x9d,0x23,0xa9,0xd2,0x52,0x41,0xae,0x90,0x21,0x0a,0x98
+,0x7e,0x3e,0x70,0x8c,0x57,0x96,0x33,0x72,0xaa,0x86,0x1d,0x3b,0x2e,0x05,0x4c,0x86
+,0x53,0x0f,0xdb,0x6c,0x8d,0x03,0x90,0xe1,0x4e,0x58,0x11,0x0e,0x7d,0x72,0x4f,0x4e
+,0xa6,0x79,0xaf,0x94,0x1b,0x90,0xe4,0x16,0x88,0xed,0xf8,0xe5,0x21,0xf8,0xe5,0x49
+,0x74,0x51,0x59,0x4b,0x5d,0x29,0x5c,0xf9,0xc1,0xf1,0xa1,0xd7,0x53,0xef,0xaa,0x87
+,0xc5,0x62,0x00,0x9d,0xf0,0x00,0x24,0x35,0x56,0xe3,0xc1,0x40,0x1d,0xcf,0x92,0xc6
+,0xc1,0xc7,0x65,0x46,0x72,0xa8,0xfa,0x2a,0xc5,0xbb,0x43,0xee,0x89,0x4b,0x6e,0x37
+,0x7c,0xcc,0x93,0x19,0x15,0x2f,0xad,0x2f,0x66,0xda,0x78,0x27,0x57,0x9c,0x69,0xa6
+,0xf5,0xaa,0x93,0x69,0xaf,0x05,0xf0,0x3b,0xae,0x87,0x8e,0x4c,0xf4,0x9a,0x54,0x45
+,0x96,0x35,0x69,0xba,0x3c,0x9f,0xb9,0x3c,0xa7,0x9b,0x95,0xb1,0x4c,0x4c,0xaf,0xc1
+,0x36,0x6c,0xe1,0x09,0x4b,0x09,0x12,0x36,0x6a,0xc5,0x1f,0x76,0x65,0x75,0xe1,0x8c
+,0x66,0xbb,0xd2,0xd3,0x24,0x78,0xea,0x7e,0xe3,0xda,0xb5,0xc9,0xf1,0x78,0xa5,0x8c
+,0x75,0x31,0xe8,0xd0,0x50,0x00,0xca,0xc5,0xc8,0x60,0xf4,0x03,0x3d,0xe7,0xbc,0xd2
+,0xbd,0x1a,0x7e,0xc7,0x2f,0x7c,0x0b,0xaa,0xeb,0xc7,0x1c,0x8b,0xaf,0x8d,0xb3,0xb2
+,0xda,0x36,0x19,0x7e,0x29,0x5c,0x5e,0xc6,0x86,0xbc,0x8a,0xd3,0xd1,0x2c,0xff,0xf8
+,0xe9,0xda,0x6f,0x10,0xeb,0x49,0xea,0x82,0x6f,0x98,0x67,0xe1,0xf8,0x37,0x8b,0x28
+,0xc9,0x51,0x15,0x38,0xea,0x2e,0x06,0x43,0x02,0xf2,0x18,0x79,0xc0,0x15,0xf3,0xca
+,0x0e,0xab,0x0d,0x1d,0x2e,0x07,0xac,0xcc,0x75,0x04,0x52,0xd5,0xfa,0xec,0xa8,0xa2
+,0x20,0x61,0xdd,0x4e,0xb7,0xd3,0xb1,0xbe,0x86,0x43,0xe6,0x7c,0xd2,0xc6,0x5e,0xad
+,0x86,0x9a,0xc3,0xe4,0x42,0x42,0xcc,0x13,0x30,0xec,0x92,0x6c,0xca,0xd9,0xdf,0x33
+,0x86,0x96,0x97,0xe0,0x08,0xcb,0x62,0xfb,0xd7,0x9e,0xc2,0xfa,0x82,0x33,0x1b,0xbd
+,0xae,0x8f,0x1c,0x82,0x84,0x1d,0x39,0x80,0x36,0x32,0x1f,0xfd,0xa7,0x36,0x60,0xa7
+,0x9b,0x76,0xba,0xd3,0x10,0x6d,0xb8,0x1e,0xa1,0xd8,0x82,0x9b,0x30,0xc2,0xdf,0x9e
+,0xaa,0x5c,0x83,0x25,0x99,0x72,0x5f,0xe9,0x92,0x3a,0x4f,0x67,0x1f,0xcb,0x4f,0x6c
+,0x14,0xb2,0x68,0x9e,0x31,0x7b,0x47,0xa8,0x25,0xe9,0x42,0x7e,0x70,0x4b,0x56,0x43
+,0xc3,0x79,0xfe,0xf6,0x11,0x4c,0x46,0xaa,0xc9,0x1b,0xa4,0xd3,0xe1,0x48,0x22,0x8f
+,0x15,0x4a,0x33,0xaa,0xf1,0x96,0xee,0x83,0x55,0xc1,0xb9,0xc7,0x8f,0x8b,0xb1,0x9f
+,0xf8,0xa6,0xf5,0x01,0xa5,0x25,0xb2,0xbc,0x95,0xae,0x1b,0x2e,0x40,0x73,0x3e,0x79
+,0x2c,0x83,0xd2,0x3e,0x57,0x5b,0x6a,0xfe,0x2b,0x4b,0x38,0x33,0xff,0xd9,0x95,0xf9
+,0x68,0x7e,0x65,0x09,0x4a,0xb5,0xec,0xa4,0x0f,0x73,0xce,0x02,0xa0,0x3d,0xa7,0xb5
+,0x31,0xcf,0xaf,0x4d,0xb4,0x3a,0xff,0x70,0x95,0xe6,0xee,0x8b,0x9e,0x02,0x53,0x46
+,0x1d,0x9a,0xb1,0x15,0x5b,0xf2,0x8a,0xf8,0xe5,0x84,0x58,0xd6,0x85,0x65,0xba,0xcb
+,0xf6,0x67,0x14,0x81,0x2e,0xc1,0x59,0x23,0x76,0xbf,0xe7,0xcc,0x6e,0x6c,0xe7,0x6a
+,0xb3,0x09,0x9b,0x0d,0xe0,0x73,0xe7,0xb1,0xe0,0xad,0xd9,0x62,0xd7,0x63,0xab,0x30
+,0x57,0xb4,0x73,0xcf,0x2c,0x42,0xca,0xe2,0x54,0x13,0x3e,0xef,0xaa,0x94,0xc2,0xa8
+,0xbb,0x93,0xee,0x50,0x93,0x56,0x6f,0x03,0x20,0x70,0xb3,0xf3,0xd5,0x8c,0x58,0xc5
+,0x3f,0x6d,0x94,0x41,0xdc,0x90,0x74,0xd2,0xf2,0xa2,0x0a,0x06,0x2c,0x3e,0x4d,0xfa
+,0x4a,0xce,0x0b,0x43,0xd3,0x59,0x37,0x60,0x12,0xcf,0x06,0x35,0x55,0x93,0x76,0xa6
+,0x2e,0x88,0x2a,0x32,0x3d,0x49,0x56,0xf3,0xe5,0x35,0x60,0xeb,0x8f,0x4e,0xf7,0x2e
+,0x0e,0x20,0x06,0x1a,0x65,0x7d,0xe2,0x71,0xe3,0xad,0xc2,0xc0,0x94,0xa1,0x6f,0x55
+,0x36,0x2c,0xc3,0x9d,0xc3,0x7e,0xfe,0x0b,0x3c,0xf5,0x4d,0x23,0xc1,0x29,0xa6,0x4e
+,0x33,0x54,0x3a,0x6b,0xbb,0x2f,0x71,0x17,0xda,0x94,0xf5,0xe6,0xf6,0x48,0x22,0xca
+,0xda,0x0f,0xdb,0x62,0x66,0x73,0x89,0xa6,0x01,0x0f,0x23,0xb7,0xaf,0x22,0xa9,0x88
+,0x13,0x97,0x6f,0x77,0xc4,0x2a,0x21,0x6b,0xf6,0xb7,0xb1,0xa2,0x08,0x31,0x07,0x75
+,0xed,0xd2,0x45,0xca,0x7c,0xd4,0x3d,0xcd,0x1a,0x3b,0x82,0x79,0x58,0xa4,0x3d,0x4d
+,0xb8,0xbc,0x1d,0x71,0x70,0xa3,0x0b,0x33,0x25,0xf6,0x1a,0xbf,0x3b,0x88,0xe6,0x8a
+,0xd8,0xb2,0x48,0x22,0xca,0x34,0x2c,0x0f,0x29,0x48,0xb4,0x5d,0x8d,0xd4,0x5f,0xe6
+,0xf5,0x02,0xf2,0x75,0x17,0xc7,0xaf,0x8f,0xc5,0xd0,0x94,0xd1,0x46,0x7d,0x50,0xe6
+,0x83,0xf7,0x97,0xc0,0x01,0x6d,0x23,0x3b,0x0c,0x0d,0x7f,0x9a,0xe4,0xcd,0x7b,0xba
+,0x72,0x5b,0x6d,0x03,0xcc,0xb5,0x8a,0x56,0x70,0x42,0x02,0xf9,0xfd,0x4d,0x93,0x66
+,0x7f,0x91,0x90,0x74,0x93,0x72,0x2e,0x1e,0xa8,0xba,0x67,0xc9,0x03,0xfd,0x73,0x9f
+,0xe4,0x6d,0x33,0x86,0x12,0x79,0x34,0xf3,0x13,0x03,0x8c,0x91,0x51,0x76,0xb1,0xb8
+,0x0b,0xa8,0xd2,0x85,0xa4,0xdc,0xe1,0x69,0x77,0x1e,0x69,0x92,0x39,0x5e,0xe1,0x7e
+,0xfc,0xee,0x76,0x29,0xd2,0x35,0x4f,0x8f,0x45,0x05,0x0c,0xf1,0xc0,0x83,0xc8,0x6f
+,0x8e,0x7d,0x74,0xca,0x41,0x26,0x24,0x2b,0x21,0x6e,0xdb,0x36,0xc4,0x6d,0x15,0x55
+,0x9c,0x78,0xae,0x00,0x80,0xcd,0x7d,0xd0,0x5f,0x0c,0x1e,0xd8,0xec,0x09,0x9a,0xf1
+,0x62,0x26,0x30,0x1c,0xf3,0x10,0x61,0x43,0x87,0xf9,0x2b,0x08,0x1b,0xf3,0x86,0x96
+,0x61,0xff,0xbb,0x38,0x16,0xcb,0x6f,0x0c,0x7a,0x17,0x17,0x79,0xec,0x9c,0x94,0x57
+,0xb2,0x45,0x20,0xa9,0x1f,0xfb,0x10,0x22,0x08,0xdb,0x96,0x09,0xdb,0xf6,0xdd,0x9a
+,0xb1,0x77,0xde,0xfd,0xe8,0x5a,0x33,0xac,0xf0,0xfc,0x5f,0xe6,0x53,0x9b,0x84,0x45
+,0x36,0xb5,0xea,0x68,0x35,0x36,0x3a,0x84,0xa4,0x5e,0x4a,0x51,0xd6,0x5b,0xc9,0xeb
+,0x15,0x20,0xf3,0x20,0x93,0x0b,0x02,0x18,0x0a,0x46,0x7b,0x4b,0x39,0xf6,0xc2,0xa1
+,0x98,0x2f,0xaa,0xc1,0x3d,0x1c,0x43,0xaf,0xe2,0x64,0x6a,0x5d,0x1f,0xac,0xc7,0x83
+,0x4f,0xd4,0x02,0x6f,0xf1,0xbd,0x9e,0x28,0x51,0x10,0xb0,0xc3,0xa7,0xc7,0x26,0x38
+,0xd4,0xc3,0x37,0x4d,0xd3,0xb9,0x1c,0x85,0xe0,0xf3,0xf2,0x8e,0x2d,0x2c,0x6c,0x03
+,0xbd,0xe8,0xef,0x09,0x0c,0x20,0xa3,0x2a,0xd6,0x30,0xbe,0xd8,0x27,0x38,0x19,0xfe
+,0x8c,0x37,0x91,0xf6,0xc2,0xe2,0xb8,0x58,0x0f,0xb2,0x1a,0x92,0x8b,0xcd,0x3d,0xeb
+,0xda,0xe4,0x1c,0xb3,0x46,0xea,0x5b,0xfc,0x8d,0x98,0xd1,0x29,0xe2,0x19,0x43,0x60
+,0xa8,0xff,0x00,0xed,0xd2,0x32,0x0d,0x9c,0x6c,0x69,0xa9,0x1e,0x8b,0xe5,0xc2,0x62
+,0x8e,0x6f,0x47,0x0d,0xc0,0x21,0xd2,0x09,0xa2,0x17,0xa6,0xb7,0xb9,0x6d,0x9e,0xe4
+,0x21,0xe3,0x30,0xd9,0x74,0x26,0x59,0xc8,0x5f,0x6e,0x53,0x5b,0x25,0xa3,0xb5,0xd2
+,0x07,0x2e,0x76,0x4f,0x50,0x9f,0xd9,0x73,0x7e,0xfd,0xaa,0xf6,0xda,0x3d,0xe7,0xdb
+,0x82,0x0b,0x7c,0xb5,0xed,0xef,0x0f,0xad,0xca,0xa4,0x01,0xb7,0xef,0x80,0x96,0xde
+,0x92,0x99,0x64,0x9a,0x2c,0xe4,0x93,0x23,0x12,0xbd,0x00,0x57,0x09,0xd3,0x8a,0x17
+,0x39,0xbb,0xde,0xe9,0x19,0xcd,0xe4,0x85,0x76,0x94,0x19,0x4b,0x90,0x5d,0x2c,0xf4
+,0x72,0xee,0xd0,0x2d,0x21,0x9b,0xfa,0x02,0xf3,0x82,0x88,0x24,0xa6,0x52,0xd2,0x0b
+,0xd1,0xa7,0x78,0x1a,0x26,0x92,0xf5,0x48,0x1b,0x09,0xd1,0x97,0xa5,0x8c,0x6e,0x0d
+,0xda,0x76,0xb4,0x89,0xf0,0x93,0xbb,0xd0,0x98,0x68,0xe4,0x48,0x77,0x21,0x7b,0x46
+,0x8a,0x70,0xb8,0x57,0xad,0x08,0xfb,0x20,0xe0,0xca,0x70,0xeb,0x78,0xd9,0xdf,0x7b
+,0xe6,0x1c,0xe3,0x50,0x5d,0xc5,0x59,0xbe,0x28,0x3f,0xf1,0x9e,0xa4,0xcf,0xed,0x5d
+,0x1c,0x9d,0xf7,0x01,0xbb,0xf5,0x59,0x7e,0x64,0x7c,0x6e,0xf9,0xf1,0x27,0x8b,0xc8
+,0x15,0xde,0x29,0x3d,0x8e,0x88,0xe3,0xac,0xf5,0xc5,0xa2,0x63,0xc4,0x45,0x07,0xbf
+,0xb1,0xe9,0x8a,0xeb,0x95,0x02,0x58,0xbf,0x1a,0xeb,0x90,0xb2,0xe0,0xa6,0x5f,0xd1
+,0x94,0xd2,0x38,0x89,0x2c,0x4a,0x06,0x59,0xad,0x83,0x8f,0xfb,0x62,0x59,0xe3,0x60
+,0x98,0xe9,0x55,0x66,0x81,0x32,0x18,0x6b,0x82,0xb6,0x67,0x76,0xf0,0xa1,0x4f,0x1b
+,0x2f,0x9d,0x8b,0x75,0x92,0x96,0xc7,0x67,0xad,0xf7,0x20,0xa3,0x07,0x9c,0xaa,0x9c
+,0x39,0xd8,0x61,0x5d,0xb8,0x6f,0xba,0x7c,0xa1,0xa1,0xdf,0x99,0xbe,0x14,0x07,0x82
+,0xa1,0x4d,0x9f,0x41,0x82,0xeb,0x6a,0xc4,0xc6,0xaa,0x1b,0x83,0xaa,0x71,0xe3,0x83
+,0xc6,0xf9,0x59,0x8f,0x56,0x4a,0x20,0x98,0x59,0xdb,0xb8,0x80,0x18,0xd4,0x87,0x97
+,0x48,0xe0,0x58,0x55,0x3a,0xad,0x27,0xc0,0x07,0xe0,0x6d,0xaa,0x11,0xe7,0x71,0xc6
+,0xec,0xb3,0x6a,0xa7,0x43,0x00,0x89,0x1f,0x19,0x98,0x5c,0x9a,0x10,0x40,0x62,0x1b
+,0x47,0x81,0x64,0x5a,0x3a,0xc5,0x16,0x02,0x4f,0x69,0xb3,0x5e,0xde,0x65,0xa0,0x63
+,0x05,0x7d,0x15,0x86,0xaf,0x14,0x30,0x29,0x92,0x29,0x0b,0x22,0x70,0x44,0x22,0xa1
+,0x41,0x75,0xdb,0x43,0xcc,0xc2,0xf5,0x7d,0xe1,0x97,0x8c,0x73,0x37,0xc3,0x1f,0x52
+,0x51,0x3f,0x05,0xb7,0x96,0xcd,0x70,0xd1,0xb3,0xdf,0x72,0x81,0x77,0xdc,0xb9,0x78
+,0x24,0x71,0x9d,0xa3,0x27,0xd9,0x27,0xb1,0x24,0xf2,0x45,0xf0,0x11,0xb6,0xfb,0xec
+,0x04,0xc4,0x6c,0x34,0x20,0x03,0x64,0xf8,0xea,0x7e,0x2e,0x9c,0xa8,0x83,0x1f,0xc9
+,0x39,0x11,0xdf,0x41,0xaf,0xe7,0x61,0x00,0x17,0x33,0xce,0xc4,0x76,0xa5,0x2f,0xae
+,0xda,0xfa,0xc3,0xf5,0xf5,0xd5,0x17,0xd7,0xfa,0x09,0xc9,0x12,0x89,0x6a,0x1c,0x4e
+,0x1f,0x06,0x97,0x34,0x1d,0x54,0x40,0x82,0x78,0x92,0x36,0xbd,0xee,0x5e,0x1c,0xbc
+,0xbd,0x3c,0xde,0xbd,0xa0,0xfd,0x75,0x8e,0x4a,0x47,0x67,0xa7,0x5d,0xe6,0x37,0xfe
+,0x80,0xcf,0x45,0x6c,0x0c,0x95,0x08,0x96,0x98,0x27,0x39,0xce,0x38,0x24,0x0b,0x91
+,0x83,0xc6,0xbf,0xb4,0x0e,0xb2,0xd8,0x0f,0xec,0x18,0xe5,0x02,0x40,0xad,0x07,0x0b
+,0xd6,0x32,0x42,0xd9,0xb6,0x1d,0x95,0xed,0xbb,0x2b,0xa1,0xa0,0x3c,0x98,0x46,0xa6
+,0xd2,0x20,0x10,0xa2,0x60,0xc1,0x8d,0xdf,0x31,0xfd,0xfb,0x42,0x22,0x8c,0xf8,0x86
+,0xcd,0x23,0xb1,0x5a,0x71,0x56,0xbc,0xb9,0x28,0xc1,0x38,0x6d,0xbc,0x6d,0xfe,0xcb
+,0x53,0xc1,0x02,0x3e,0xd5,0xb3,0x0c,0x40,0x3e,0x3a,0xf1,0x5f,0x20,0x2d,0x6c,0x6a
+,0x3d,0x55,0xb9,0x0d,0xf0,0x3c,0x4f,0x66,0xa1,0xa7,0x9e,0x6c,0xec,0x8e,0x95,0x0f
+,0xbd,0xa3,0x05,0xdb,0x27,0x7d,0x02,0xda,0xa6,0x85,0x9d,0x81,0xc6,0x9e,0x63,0x2b
+,0xcb,0x29,0x63,0xe3,0x2d,0xec,0x86,0xa1,0x09,0xe9,0x17,0xc6,0x1e,0xd2,0xd0,0x44
+,0xa3,0x30,0xfe,0x08,0x9a,0x52,0xa8,0xf0,0xac,0xb2,0x3e,0xd7,0xae,0xa5,0xb6,0x37
+,0xc9,0x8c,0x9c,0xf1,0xa4,0xf9,0x63,0x72,0x33,0x10,0xdb,0x09,0xbf,0xf6,0x4e,0xf7
+,0x52,0x7c,0x49,0x5c,0x3c,0x22,0x7e,0x59,0x45,0x49,0xc7,0x81,0x24,0x7d,0xe6,0x42
+,0xe4,0x63,0xe2,0x85,0x5e,0xd6,0x93,0x0c,0x73,0x5e,0x27,0xbb,0x26,0x76,0x9e,0x11
+,0x76,0x9e,0x2d,0x18,0xe1,0x20,0x92,0xa5,0xf1,0xfd,0x57,0x67,0xbd,0xae,0x82,0xde
+,0xfd,0x28,0x7d,0xb3,0x57,0x1c,0xb6,0xd9,0x12,0x31,0xb7,0x99,0x32,0x8f,0xf6,0x04
+,0xb0,0x7b,0xc7,0x50,0x51,0x39,0x6b,0x28,0x81,0x4c,0x10,0xda,0x61,0x58,0x5e,0x25
+,0xa3,0xd1,0xb0,0xe7,0x8c,0x49,0x9e,0x11,0xe4,0xe0,0x01,0x87,0xc8,0x66,0x34,0xe5
+,0x56,0x8c,0x11,0x40,0x45,0x71,0xca,0x7d,0xa8,0x3a,0x06,0x5f,0xe1,0x00,0x9f,0x94
+,0xee,0xe9,0x1b,0x75,0x3d,0x08,0x30,0x2a,0x25,0x80,0x37,0x37,0xde,0x6c,0x13,0x49
+,0x92,0x4f,0xd3,0x64,0x6c,0xac,0xb6,0x79,0x47,0x1c,0x73,0xdb,0xbc,0x95,0x4e,0x3c
+,0x58,0xea,0x5a,0x8a,0x01,0x5e,0xdb,0x56,0x4e,0x2d,0xb7,0x5e,0x6e,0x3e,0x9a,0x21
+,0x4d,0x16,0xa0,0x88,0xfc,0x56,0x6c,0xfd,0x61,0x0b,0xb0,0xef,0x38,0x0c,0x42,0x9b
+,0x9c,0xb6,0x14,0x5b,0xf9,0x30,0xbb,0xcb,0x86,0x4b,0xed,0x22,0x26,0x8c,0xe1,0x8a
+,0xac,0xf8,0xa2,0x8e,0xd6,0xea,0xd0,0xe7,0xbc,0xc3,0x1d,0x32,0x91,0x15,0x59,0xac
+,0xff,0x60,0x90,0xe4,0x44,0x62,0x78,0x0c,0x1d,0x02,0x03,0x3f,0xe8,0x5a,0xf4,0x22
+,0x8b,0x54,0xe8,0xac,0xdd,0x03,0x3f,0x0d,0xb3,0x21,0xb1,0xe9,0x3f,0xd9,0x43,0x62
+,0xcc,0xdf,0x89,0x55,0xe1,0x43,0xc1,0xb9,0xd2,0xb4,0x1e,0xcb,0x34,0x6d,0xa6,0xa7
+,0x59,0xbe,0xc4,0x12,0x68,0x0e,0x9d,0x15,0x6f,0xe0,0xb5,0x7f,0xac,0x75,0x04,0x5f
+,0x64,0x2f,0xac,0x89,0xb0,0x5a,0x75,0x07,0xc2,0x84,0x32,0xfa,0x8d,0xf6,0x20,0x55
+,0x6a,0xa9,0x66,0x47,0xf4,0x4d,0x0c,0xbe,0x9a,0x7d,0xdc,0x98,0x7f,0x40,0x88,0x1a
+,0xd6,0xbb,0x82,0x19,0xa7,0x61,0xd9,0xd9,0x42,0x2c,0x77,0xa1,0xa8,0x3a,0xc0,0x71
+,0x11,0xb2,0x84,0x24,0x8f,0x43,0x12,0xd0,0x04,0xbf,0x43,0x32,0x67,0x64,0xaa,0xe0
+,0x56,0xb1,0xc0,0x7b,0x78,0x3f,0xb0,0xe2,0x5a,0xfa,0xde,0xb4,0x68,0x6f,0xb4,0xab
+,0x14,0x75,0xd6,0x6e,0x6c,0xb4,0xb9,0xef,0xda,0x0c,0x3d,0x8d,0xe5,0xa6,0x13,0x8f
+,0x27,0x0d,0x51,0xd0,0x1e,0xeb,0x5d,0xe7,0x30,0x7b,0xd6,0x86,0x6b,0xf2,0x1d,0xbd
+,0x12,0x88,0x29,0x7d,0x81,0x84,0xd0,0x24,0xe3,0xad,0xc6,0x8c,0xc8,0xf2,0xae,0x9d
+,0x72,0xae,0x9a,0x92,0xce,0x24,0xdd,0xe3,0xe8,0xc2,0xd8,0x98,0xb7,0x69,0xe5,0x76
+,0x7d,0x6a,0x23,0x10,0x43,0xb0,0x10,0xcb,0xc0,0x31,0x79,0xa2,0x3a,0x6f,0x7f,0xa1
+,0x8e,0x64,0x20,0xd0,0xf9,0x5f,0xad,0x34,0x81,0xcd,0x4e,0x8f,0x96,0x9f,0xc1,0xda
+,0x77,0x56,0x1a,0x44,0xad,0x77,0xcf,0xd7,0xaa,0x7d,0x69,0xa5,0x5a,0xdb,0xd8,0x04
+,0x1f,0xc6,0x4c,0x8d,0xb1,0xc9,0xa4,0xa8,0x9a,0x4d,0x41,0x60,0x88,0x1c,0x8e,0x88
+,0x16,0xe6,0x1a,0x7e,0x64,0xc9,0xa9,0x60,0x62,0x93,0x10,0xc6,0xe4,0x13,0x03,0x47
+,0xaa,0x81,0xb6,0x4c,0xf1,0xfd,0x22,0x99,0xfb,0x28,0x54,0x67,0x93,0x95,0xe0,0x1b
+,0x9e,0xdc,0x1f,0xdb,0x36,0x07,0xc3,0x1f,0xf8,0xc6,0x96,0x00,0x49,0x36,0xe2,0x44
+,0x9c,0xb9,0x53,0xc1,0x9b,0xeb,0xfc,0x98,0xac,0x33,0xd1,0x85,0x80,0x26,0x20,0xcc
+,0x3b,0x9c,0x3f,0xd3,0xfc,0x08,0xc8,0x05,0xba,0x86,0x0f,0xce,0x0e,0x31,0xae,0x53
+,0x03,0x5e,0x14,0x5f,0xf8,0x51,0x88,0xc5,0x53,0x82,0xe2,0x72,0xcf,0x72,0x07,0xcc
+,0x5f,0x7d,0x03,0x56,0xec,0x96,0x71,0xd5,0xbb,0x43,0x34,0x5d,0xd2,0x2e,0xeb,0x4c
+,0xb3,0x6b,0xa9,0x06,0x9a,0xda,0x93,0x8e,0xef,0xad,0xed,0xf0,0xf1,0x9c,0xdb,0x41
+,0xb9,0x2f,0x21,0xf3,0xeb,0x93,0x87,0x8a,0x4b,0x22,0x57,0x82,0xde,0x73,0xa6,0xc9
+,0x74,0x9e,0x76,0x24,0x06,0xf4,0xd1,0x48,0x0f,0xd5,0xa3,0xad,0xde,0x29,0x56,0x09
+,0x30,0x5b,0x67,0x29,0xa2,0xa3,0xfa,0x1c,0x24,0x2e,0xab,0x82,0x49,0x44,0x53,0x0f
+,0x74,0xca,0x2d,0x82,0x8c,0xef,0x81,0xf8,0xf0,0xfd,0xd2,0x2e,0x97,0x48,0x2e,0x5a
+,0x7f,0x15,0xbc,0xc5,0x57,0xdc,0x98,0x1d,0x3f,0x94,0xb4,0xbe,0x22,0x96,0x47,0xe2
+,0xa0,0x30,0x7b,0x75,0x53,0x8d,0xdf,0x0b,0xc1,0xe2,0x34,0xf7,0xfe,0xf0,0x07,0xc1
+,0xc6,0x76,0x91,0xec,0x59,0x16,0xf2,0xe7,0x5a,0x70,0x2a,0x24,0xf1,0x04,0xe7,0x18
+,0x4c,0x10,0x22,0x25,0xca,0x4c,0x8f,0xb7,0xc5,0xe6,0x89,0xd5,0xeb,0x73,0x20,0x26
+,0x2f,0xcf,0xcf,0x30,0x1f,0xd8,0x09,0xe2,0x4c,0xb9,0x7d,0x88,0x0a,0xf8,0xa3,0x7b
+,0x85,0x7d,0xab,0x3d,0xb3,0xbf,0x72,0x15,0xba,0x2d,0x44,0x75,0x6f,0xfc,0x17,0xde
+,0x10,0xa7,0x04,0x0c,0x5c,0x34,0xcf,0x5b,0x7f,0x5b,0x5e,0x35,0xed,0x7d,0x21,0xbf
+,0xfa,0x0d,0x2f,0x03,0xc3,0x5c,0x0c,0x7c,0x0f,0x94,0xcc,0xb9,0x10,0x04,0xc7,0x39
+,0xf0,0x32,0x31,0x4f,0x22,0x9d,0xe2,0x1a,0xaa,0xa3,0xa5,0x26,0x32,0xdf,0xc4,0x51
+,0x5e,0xa6,0x70,0xc2,0x41,0x37,0x2d,0xb2,0x6f,0x08,0x3f,0xc1,0x39,0x7d,0x99,0x59
+,0x0f,0x86,0x1c,0x8a,0x5a,0x56,0xc6,0xfa,0x17,0xc3,0xc7,0xbe,0x2e,0xbb,0xbd,0xee
+,0x45,0xf7,0x90,0xa5,0x6d,0xef,0xe9,0x2d,0xec,0x50,0xcf,0x02,0xff,0xa9,0x23,0x14
+,0xcf,0xc3,0x85,0xba,0xb7,0x8c,0x38,0x4f,0xf5,0x21,0x4c,0xaa,0xca,0xf8,0x44,0x35
+,0x1d,0x00,0xab,0xeb,0x3c,0x07,0x88,0xe3,0x0b,0x0f,0x96,0xb6,0x25,0x41,0x42,0x48
+,0xac,0xfa,0x82,0x36,0x65,0x0f,0xef,0x2f,0x34,0x0c,0x60,0x54,0x6f,0xcc,0xb2,0x77
+,0xcc,0xb5,0x99,0xcb,0xdc,0xb2,0x54,0xff,0x03,0x15,0x2f,0x68,0x80,0xb4,0x1b,0xc0
+,0x29,0xc3,0x40,0x62,0x25,0x3b,0x4c,0x5f,0xdb,0xfc,0xb8,0x59,0x6f,0xc9,0xe6,0x1a
+,0xfa,0xf1,0x4f,0xb4,0xe5,0x25,0x5a,0x6d,0x22,0xa9,0x30,0xe0,0x21,0x15,0x88,0x7b
+,0x7c,0x66,0x7b,0x1d,0xea,0x62,0x52,0xe9,0x82,0xd7,0x5b,0x92,0x7b,0x91,0x27,0xbf
+,0xac,0x53,0x25,0x15,0x6e,0x00,0x85,0xa8,0xd3,0x44,0xbd,0x3c,0x14,0x26,0xa3,0xd6
+,0xc4,0xd5,0x46,0xfc,0x27,0x4e,0x58,0xbf,0x6b,0x4f,0xd9,0x69,0x5b,0x1c,0xb5,0xb2
+,0x6a,0xc9,0x77,0x25,0x31,0x4a,0xa7,0x34,0x4f,0xe2,0xde,0x55,0xab,0x3b,0xb6,0x3f
+,0xbc,0x9d,0x16,0x37,0xe0,0x71,0x83,0x7a,0x89,0x9b,0x86,0x72,0x65,0x51,0xba,0x47
+,0xf2,0x83,0x6a,0xe6,0x90,0x8b,0x43,0x18,0x1c,0xbb,0x5f,0xeb,0xe5,0x6d,0x16,0x71
+,0xa5,0x0d,0x34,0x37,0xcb,0xa9,0x0f,0xcd,0xf7,0x15,0xd5,0x7c,0xa8,0xbe,0xcb,0x8c
+,0x15,0x59,0x6f,0xe8,0x5e,0x4c,0xaa,0xd7,0x46,0x62,0x08,0xf5,0x5a,0x6b,0x49,0x3b
+,0x55,0xa1,0x92,0xbd,0x6f,0x2f,0x68,0xa5,0x0a,0x68,0x00,0x27,0x50,0xe5,0xe3,0x0f
+,0xcc,0x9d,0x6e,0xb7,0xeb,0x18,0x06,0xb7,0xea,0x8e,0xf2,0xd0,0x2e,0xa5,0x9d,0xcb
+,0xb2,0x58,0x05,0xec,0x0b,0xaa,0x5e,0x6f,0xc9,0x8c,0x92,0x69,0x99,0x6a,0x7b,0xfe
+,0xb8,0xf3,0xa4,0xb3,0xe5,0x4f,0xbe,0xa0,0x43,0x73,0x6b,0x70,0xef,0x8f,0xde,0xaf
+,0x0c,0x86,0x0a,0x3e,0x76,0x8b,0xe9,0xb0,0x4b,0xf4,0xae,0x6b,0x34,0xcd,0xb0,0x64
+,0x07,0x75,0x22,0x12,0xed,0x8a,0x17,0x54,0xe4,0x85,0xe0,0xb4,0x84,0x3c,0xa1,0x07
+,0xd9,0xad,0x2f,0x1f,0x55,0xa0,0xf6,0x5e,0x28,0x49,0x62,0x45,0x1c,0x20,0x9e,0xbc
+,0x74,0xa5,0x07,0xa5,0x1d,0xc6,0x8e,0x49,0xea,0xdb,0x5a,0x43,0xf0,0xcb,0x75,0x21
+,0xb7,0xbe,0x43,0x2a,0xb9,0xfc,0xc8,0x27,0x35,0xd7,0xa0,0x77,0x26,0x4b,0x9e,0x55
+,0x6e,0xb2,0xab,0xfa,0xc0,0x64,0x2d,0x76,0xf1,0x72,0x22,0x20,0x7d,0x65,0xe9,0xce
+,0xe5,0xda,0x8f,0x8c,0x01,0x28,0x13,0x13,0xd5,0xe5,0x80,0xa6,0xcd,0x3e,0xed,0x83
+,0xa7,0x44,0x07,0x5b,0x99,0xf2,0x36,0xa3,0x1a,0x43,0x95,0x23,0x18,0x57,0xcd,0xac
+,0xfd,0xdb,0x1a,0x07,0xdc,0x90,0x90,0x0c,0x65,0xf8,0x34,0x14,0x31,0x19,0x29,0xe7
+,0x47,0x2a,0xf0,0xc4,0xd7,0xb5,0x4c,0x3f,0x42,0x81,0x0c,0xcc,0xad,0xd1,0xac,0xfa
+,0xa9,0xac,0x16,0xa2,0xab,0x25,0x89,0x46,0x7f,0xe1,0x2b,0x9a,0xfe,0x75,0xa9,0x08
+,0xae,0x79,0xaf,0xe0,0x5a,0x5a,0x5a,0xbd,0xbe,0x13,0xba,0xf1,0xa6,0x0d,0x5d,0x87
+,0x2b,0x4d,0xc2,0x3c,0x4d,0x2f,0x47,0x03,0xb9,0xa9,0xd1,0xbb,0x1c,0x41,0x4b,0x9b
+,0x22,0x96,0xd7,0x24,0x0c,0x09,0xa0,0x67,0x94,0xb8,0x85,0x72,0xf6,0x68,0x97,0x18
+,0x11,0x57,0x4a,0xd7,0xca,0x21,0x9f,0xc0,0x67,0x12,0xc1,0xda,0xec,0x4d,0x6e,0x21
+,0x03,0x05,0xc8,0x4b,0x87,0x25,0xe8,0x4a,0x22,0x05,0xc7,0x82,0x74,0x56,0xaf,0x61
+,0x23,0xb6,0xc4,0xd0,0x0f,0x45,0x15,0x7b,0x01,0xc9,0x3c,0x70,0x36,0x09,0xab,0x63
+,0x6a,0x87,0x70,0xbd,0x89,0xe3,0x5e,0xfc,0x5e,0x8c,0xef,0x1b,0xe7,0x12,0x9e,0x4b
+,0xd2,0x6f,0x9d,0x23,0xb4,0x6b,0x8a,0x90,0x2c,0xaf,0xc8,0x2f,0xd3,0x6a,0xa4,0xf9
+,0x68,0x26,0xec,0x61,0xf1,0x19,0x89,0x8d,0x25,0x41,0x60,0x7c,0x67,0xbe,0xdb,0x3d
+,0xbe,0x3c,0x08,0x2d,0xf5,0x7c,0x9c,0x44,0xbb,0xe6,0x34,0x71,0xf5,0xbc,0xe6,0x13
+,0x07,0x54,0x97,0x32,0x40,0x6e,0x8a,0x33,0xae,0x86,0x4f,0xf6,0x71,0x20,0x16,0x41
+,0x61,0x61,0x6c,0x3d,0xb8,0x9b,0xaa,0xbd,0xe2,0xc9,0x9b,0x3b,0xae,0x20,0x41,0x5b
+,0xac,0xdc,0xb5,0xaf,0x60,0xe1,0x0b,0x23,0x2a,0x59,0x4b,0xd0,0x0a,0xc6,0x55,0x66
+,0x43,0xce,0xf2,0x77,0x7f,0xed,0x48,0xd0,0x15,0xad,0x76,0xa9,0x36,0x14,0x12,0x22
+,0xad,0xbf,0x6c,0x66,0x83,0x69,0x83,0x74,0xa5,0x43,0x9b,0x6f,0x4e,0xcc,0x47,0xc0
+,0xff,0x1a,0x38,0xfc,0x08,0x8e,0x24,0x97,0xd3,0x29,0x31,0x84,0x29,0xe7,0x69,0x52
+,0xfb,0x85,0x60,0x70,0x23,0x8e,0xb8,0x69,0x23,0xe2,0x64,0x09,0x10,0x2a,0x22,0xc1
+,0x70,0xad,0xdf,0xfd,0x73,0x36,0xfc,0xaa,0x5c,0xce,0x7e,0xf1,0x5f,0x3b,0x8e,0x49
+,0xf2,0x52,0x33,0x36,0xb0,0x05,0x23,0x31,0x6f,0x8e,0xfa,0xf5,0xf8,0x55,0x4e,0x37
+,0x30,0x82,0x57,0x0e,0x2e,0xc5,0xe1,0xd2,0xfc,0x5c,0x2c,0x17,0x62,0xb0,0x38,0x67
+,0x07,0x08,0xe0,0x30,0x70,0xd2,0x03,0x54,0xd5,0x6c,0x5c,0x76,0xe2,0xb6,0x38,0x4d
+,0xd3,0xbf,0xce,0x8d,0xd0,0xe3,0x3d,0xd9,0x7b,0xb7,0xfb,0xed,0x81,0x95,0x37,0x24
+,0x61,0xee,0x23,0xf3,0xab,0x3e,0x85,0xed,0xbb,0xdd,0x97,0x88,0x04,0x80,0x43,0xeb
+,0x79,0x8f,0x08,0xc8,0x63,0xeb,0xe9,0x90,0x16,0xac,0x0c,0x1f,0x2d,0x1f,0x3e,0x09
+,0xae,0x8f,0x38,0x89,0xad,0xa4,0x62,0x2c,0x35,0x15,0xa3,0xdb,0x7b,0x0c,0xb8,0x0e
+,0x4d,0xed,0x50,0xa1,0x2b,0xe5,0x4a,0xa2,0x23,0x1f,0xca,0x6d,0x98,0x63,0xc7,0x68
+,0x09,0xa3,0x2d,0x2e,0x66,0x80,0x82,0x90,0xb3,0xa9,0x16,0xa8,0xe6,0x60,0x02,0x23
+,0x56,0x98,0xc5,0x92,0xf3,0x88,0x71,0x6f,0x1a,0x17,0x8a,0xca,0xed,0x99,0x72,0x97
+,0x0b,0xba,0x0e,0x6c,0x63,0xfb,0x6c,0x73,0x0a,0x56,0xfa,0xbb,0x8f,0x05,0xe1,0x99
+,0x93,0x50,0x90,0xc0,0xfb,0x10,0x1e,0x48,0x36,0x5f,0x12,0x03,0x38,0xc0,0x8a,0xd0
+,0xb8,0xcc,0xd9,0xdd,0xa5,0xe9,0x70,0x72,0x75,0xb0,0xfe,0xf6,0x1d,0x0a,0x20,0xc5
+,0x43,0x43,0xd5,0xe1,0x54,0x72,0x05,0x31,0xd2,0x5a,0x32,0xe3,0xd2,0x28,0x56,0x9a
+,0x88,0x3c,0x4c,0xe0,0x5f,0xdd,0xb2,0x6a,0xbb,0xf1,0x03,0x22,0x33,0x85,0x6f,0x8a
+,0xa2,0xd3,0xa2,0xa2,0x85,0x61,0xb0,0x0c,0x6c,0x1e,0x92,0x25,0x5d,0x26,0x27,0xb5
+,0xb8,0x2f,0x52,0x76,0x3f,0xa8,0xa9,0x5d,0x96,0x25,0x9b,0x9c,0xdb,0x8c,0x48,0x8b
+,0x88,0x8a,0xc8,0xcf,0x16,0x67,0x8a,0x02,0x06,0x8a,0x66,0xfe,0x81,0xff,0x1e,0xba
+,0x01,0x0b,0x12,0x43,0x5b,0xd1,0x64,0x42,0x79,0x44,0x87,0xc4,0x82,0xe2,0xb1,0x61
+,0xcb,0x5f,0x0f,0x93,0x25,0xbc,0x17,0x3e,0xa5,0xf5,0x2d,0xe2,0xb7,0xbd,0x90,0xa2
+,0xba,0xb1,0x23,0xe0,0xa8,0xe9,0x4c,0x3b,0x60,0xf5,0xa1,0x64,0x4d,0xf9,0x24,0x91
+,0xc4,0x5d,0x2d,0xa1,0x11,0xc7,0x44,0xf5,0xe1,0x8a,0x61,0x37,0x35,0x02,0x46,0x40
+,0xa5,0x60,0x9c,0x92,0x38,0x19,0xfe,0xb4,0x04,0xca,0x84,0x35,0x3b,0x8c,0x5b,0x86
+,0x20,0x2d,0x89,0xdc,0xae,0x5f,0x24,0xdc,0x1d,0xf5,0xa6,0x5d,0x8e,0x46,0x00,0x3c
+,0x01,0x4d,0xd4,0xe4,0x58,0x05,0x73,0xfa,0x7e,0xac,0x6c,0x7d,0xdc,0xbf,0xbc,0xd8
+,0x85,0x6f,0x9b,0x10,0x5a,0x10,0x12,0x95,0x0a,0x14,0xbb,0x01,0x5e,0x37,0x5a,0xc4
+,0xe6,0xae,0x4f,0x8c,0x4d,0xb2,0x32,0x62,0x23,0x34,0x50,0xdf,0x76,0xf3,0x00,0x17
+,0x84,0xbd,0x31,0x6c,0xe9,0xb5,0xd9,0x5a,0xd4,0x44,0x20,0x2b,0x51,0x6a,0xba,0xc0
+,0xd7,0x26,0x6b,0xc8,0x58,0xb7,0x5c,0xf0,0x2f,0x43,0xfa,0x05,0x40,0xfc,0x92,0xdd
+,0x62,0xad,0x5c,0x03,0xd8,0x0f,0x1b,0xba,0xda,0xaa,0xfc,0x15,0xf7,0x08,0xdf,0xe9
+,0xbc,0x42,0x6c,0x42,0x99,0xf4,0x86,0xfb,0x1f,0xc5,0xfb,0xb3,0xf7,0xee,0xe8,0x90
+,0xcf,0xee,0xec,0xe4,0xca,0xa9,0xf7,0xc5,0x8b,0xfd,0xec,0x02,0x2f,0x7a,0x07,0x17
+,0xdf,0x1d,0x5c,0x78,0x68,0x0f,0x8b,0x89,0xc3,0x11,0x50,0x44,0xac,0x90,0x62,0x99
+,0xd8,0x07,0x86,0x4c,0x85,0x9a,0x00,0x66,0x06,0xa9,0x23,0x28,0x36,0xd6,0xe9,0x48
+,0x2d,0xb2,0x73,0x3e,0x02,0x0c,0xa2,0xea,0x8f,0xe4,0xd6,0xcb,0x96,0x4d,0x1c,0xa2
+,0xd8,0x0f,0x03,0xc1,0x44,0x5d,0x22,0xb9,0x25,0xe2,0x44,0x92,0xc6,0xee,0x50,0x2c
+,0x82,0xe1,0xfb,0xf1,0x22,0x19,0xf2,0x91,0x63,0x47,0x3a,0xc6,0x41,0x65,0x5b,0x63
+,0x70,0x68,0x3f,0xa2,0x43,0xec,0xfa,0xc2,0x58,0xcb,0x40,0x84,0xd0,0xce,0xa9,0xc5
+,0x20,0x1b,0x79,0xab,0x30,0xbb,0x79,0xb9,0xfb,0x40,0xf2,0xb6,0xab,0xa5,0x80,0x15
+,0xff,0x03,0xb0,0xbd,0x56,0xf4,0x6c,0x5e,0x1c,0xee,0x99,0x57,0x2f,0x5f,0x6e,0x50
+,0x37,0xc7,0x63,0x46,0x4b,0x25,0xca,0x0c,0x00,0xc2,0x0e,0x68,0xcc,0x49,0xe3,0xc4
+,0x55,0x51,0xe4,0xbd,0x22,0xff,0xad,0x95,0xab,0x46,0xbf,0x4f,0x22,0xb2,0xff,0xa8
+,0xd0,0xf7,0x90,0x86,0xd1,0x65,0x67,0x51,0x65,0xe9,0x5e,0x5b,0xe6,0xac,0x81,0xf0
+,0x58,0xa2,0x8b,0x34,0xb6,0x43,0xe7,0xc4,0x5f,0xbe,0xf0,0x8d,0x66,0xb4,0x41,0x05
+,0xec,0x55,0xa9,0xb0,0xed,0x6a,0xc8,0x14,0x8a,0xbd,0x68,0x73,0x63,0x63,0xc3,0x1a
+,0x4f,0x05,0xf3,0x84,0x31,0x18,0x27,0xd9,0x88,0x64,0x68,0x2d,0xf2,0xcd,0x37,0xbc
+,0x87,0x6c,0xb1,0x56,0xe0,0xe1,0x26,0x1e,0x43,0xe1,0x16,0xf0,0x97,0x3d,0xdc,0xe9
+,0xe9,0x86,0xdc,0x1b,0x0c,0x47,0x5f,0x8c,0xb3,0x93,0x59,0xbe,0x28,0x97,0x0f,0xdf
+,0x7d,0x0a,0xe8,0x05,0x62,0x2c,0x7e,0x7f,0xd5,0xfe,0xfd,0xd5,0xc3,0xb5,0x38,0x02
+,0x7c,0xb8,0x0e,0x80,0x60,0x23,0x9f,0xf9,0xf7,0x2a,0xee,0x5b,0x9f,0xb7,0x18,0x5c
+,0xd7,0x74,0x9a,0x4e,0x77,0x4e,0xb1,0x65,0xf1,0x11,0x4e,0x3e,0x6b,0x49,0x0e,0x4b
+,0xff,0xbc,0xa0,0xa1,0x49,0x71,0x25,0x6f,0xb4,0x00,0x5e,0x32,0xba,0xaf,0x4a,0x74
+,0x96,0x11,0x63,0x60,0x37,0x29,0xef,0x1c,0xfb,0xf4,0x99,0xf3,0xac,0x62,0xcc,0x0b
+,0x7c,0xeb,0x36,0x7d,0x64,0x97,0xe0,0x3a,0x8a,0xb5,0x7c,0x97,0x48,0xb2,0x24,0xf6
+,0x64,0x0c,0x9b,0x64,0x21,0x40,0xdd,0xf6,0xd5,0x32,0xb7,0x2f,0x91,0x5d,0x8b,0x89
+,0x44,0xc2,0x90,0xd7,0x43,0xcb,0x9f,0x73,0xb6,0x49,0x1b,0x45,0x20,0xfa,0x74,0xc7
+,0xf6,0x4b,0x82,0x53,0xec,0x98,0xc0,0x89,0x6b,0x49,0x22,0xc0,0x82,0x05,0xd3,0x26
+,0xff,0x9d,0x01,0x72,0xac,0xcc,0x24,0x05,0x38,0xe7,0xbd,0xfc,0x02,0xae,0x56,0xec
+,0xf2,0x3d,0x75,0xf1,0x09,0xbc,0x4a,0xb4,0x8c,0x4b,0xb8,0x07,0x90,0x10,0x2f,0x30
+,0x08,0x2e,0xb1,0xa7,0xa2,0x5b,0x8d,0x04,0xf2,0x41,0xa6,0xca,0xaa,0x3f,0x6b,0x02
+,0x57,0xc9,0x69,0xec,0x34,0xc3,0xe2,0xb7,0x07,0xdf,0x83,0x50,0x01,0xbe,0x6e,0xca
+,0xf9,0x7d,0xe9,0xa8,0xd0,0xed,0x3f,0xd1,0xaf,0xfd,0x0c,0xd7,0xa1,0x51,0x7a,0x63
+,0xe1,0x79,0x66,0x0d,0x41,0xfb,0xb0,0xb9,0xce,0x35,0x21,0xaa,0xae,0x9c,0xbd,0x38
+,0x03,0x83,0xcc,0xac,0x06,0xa2,0x5c,0x4b,0x8b,0x27,0x13,0x18,0x90,0x87,0x95,0xac
+,0x9d,0x85,0xc3,0x7a,0x52,0x4c,0xdb,0xa0,0xa8,0x6c,0x0b,0x39,0x05,0xec,0x18,0x06
+,0xa2,0x73,0x22,0xe1,0x5c,0x0e,0x8f,0x4f,0x9c,0x1d,0x25,0xcc,0xd8,0xdc,0x65,0x89
+,0xe1,0x1c,0x1a,0xda,0x57,0x7b,0x7c,0x6f,0xb3,0x69,0xc1,0xf1,0xa5,0x24,0xfc,0xec
+,0xc8,0x0f,0x51,0x63,0x1d,0xdf,0xb8,0xd8,0x3d,0x61,0x5a,0x7e,0xdb,0x9d,0x75,0xc7
+,0x7a,0x15,0xf8,0x7c,0x1f,0x5b,0x5f,0xad,0x0b,0x9d,0x04,0xac,0x15,0x89,0xd9,0x53
+,0x46,0xad,0x97,0x59,0x63,0xf9,0x9a,0x7f,0xe4,0xc5,0xa1,0xbd,0x87,0x28,0x89,0x8f
+,0xce,0xac,0xe3,0x8e,0xbc,0x6c,0x32,0x9b,0xc9,0xaa,0xef,0xb3,0xb7,0x49,0x56,0xef
+,0x67,0xba,0x6b,0x33,0x61,0x20,0xcb,0x82,0xa4,0xc2,0xa8,0x14,0x4a,0x97,0xbe,0xe2
+,0x05,0x1d,0x55,0x7f,0xb3,0xc9,0xdd,0xef,0x46,0x76,0xcd,0xcb,0x33,0xa2,0x2c,0xf6
+,0x10,0x32,0x3d,0xe7,0x8c,0x83,0x2e,0xdd,0x98,0x6e,0x37,0x4d,0xc1,0xaa,0x91,0x8b
+,0xa5,0x4f,0xeb,0xa8,0xe9,0x7c,0xe2,0xcd,0xce,0xd6,0xcb,0x57,0xf1,0x62,0xf0,0xba
+,0xf3,0xd5,0x4d,0xa7,0x1a,0x7f,0x62,0xb6,0x88,0xb9,0xa2,0x26,0x90,0x27,0x5a,0x01
+,0x47,0x60,0xd1,0x17,0x1d,0x41,0x90,0xed,0x27,0x19,0x26,0x5c,0xb0,0x90,0x1b,0xa3
+,0x8f,0xe0,0xdd,0x3b,0xbf,0x14,0xff,0x83,0x29,0x54,0xa3,0x32,0x5d,0x2d,0x21,0x25
+,0x7c,0xda,0x65,0xff,0x02,0x48,0x99,0xd1,0xb1,0x13,0xd6,0x10,0xa5,0x95,0xb5,0x9a
+,0x4b,0x78,0x43,0x91,0x7b,0x5b,0x63,0xc7,0xc4,0xb7,0x5b,0xea,0x83,0x34,0x49,0x23
+,0x25,0x12,0x9c,0x18,0x46,0x6d,0x3e,0xaa,0xf8,0xc4,0x8f,0x62,0x80,0xa0,0x0a,0xed
+,0x2d,0xff,0x0d,0x01,0x5f,0x86,0x31,0xd8,0xd7,0x6d,0x47,0x28,0xf4,0x4a,0x0b,0x39
+,0x7f,0x39,0x87,0x87,0x12,0x14,0x7f,0xfa,0x95,0x11,0x71,0x10,0x90,0x31,0xa9,0x9d
+,0x0e,0xda,0xe9,0xbc,0x6a,0x7f,0x65,0x0d,0x7d,0xde,0xf5,0x4e,0x0a,0x79,0xc5,0x40
+,0xbd,0x55,0xee,0x44,0xd0,0x76,0x64,0xdb,0xa6,0xbb,0x41,0x9b,0x36,0xa7,0x56,0xe2
+,0x66,0x59,0xb0,0x54,0xa0,0x09,0xf7,0x05,0xaa,0xd5,0x31,0x9a,0x06,0x82,0x51,0xa3
+,0xd5,0xb8,0x1e,0x61,0xf7,0xba,0x19,0x13,0x53,0x3a,0xef,0x68,0x08,0xd6,0x55,0x46
+,0xe7,0x8c,0x56,0xef,0x36,0x5d,0x94,0x6d,0xe7,0x41,0x41,0x3c,0x94,0xe0,0xb3,0xd9
+,0xbb,0x7c,0x11,0x89,0x9a,0x44,0x2c,0xc4,0x89,0x1c,0x0d,0xec,0xd7,0x66,0xb9,0x84
+,0xa7,0x61,0x69,0x62,0x9a,0x63,0x22,0xf8,0x8a,0xcf,0xe2,0x11,0xae,0x75,0xa1,0x59
+,0x7d,0x4e,0x15,0x3c,0xf3,0x44,0xe5,0x38,0x39,0x88,0xe9,0x5d,0x1e,0x1e,0x1e,0x7d
+,0xf8,0xe9,0xf8,0xe0,0x54,0xe1,0xe1,0x91,0xbd,0x4d,0xf0,0x4f,0x8f,0x8f,0x4e,0xe5
+,0xc7,0xdc,0x9c,0xef,0x5e,0xb0,0xd4,0x77,0x74,0x7a,0x7e,0xd9,0x37,0x57,0x67,0x97
+,0x7d,0xfa,0x17,0x40,0x3d,0x7b,0xc0,0xe1,0x97,0xa7,0xc1,0xc5,0xc3,0x2c,0xb5,0xc3
+,0x13,0x96,0xdb,0x4a,0xea,0x70,0xa9,0xb5,0x87,0xb5,0x96,0x05,0x7d,0x01,0x1c,0x71
+,0x48,0xb8,0xa6,0x8f,0x16,0xf4,0x96,0x61,0x7e,0x85,0x81,0x6c,0x26,0x49,0xdb,0x24
+,0x44,0x45,0x93,0x01,0x9c,0x92,0x92,0x4f,0x44,0x6c,0xe8,0xc9,0xcd,0x0d,0xfd,0xa6
+,0xf8,0x8f,0x3d,0x29,0x49,0x02,0xe3,0x38,0x84,0x3a,0xda,0x12,0xe9,0x12,0x83,0xea
+,0x4a,0x12,0x9e,0xcd,0x8d,0x36,0xb1,0x02,0xb7,0xf8,0x6b,0x86,0xbf,0xc6,0x68,0x83
+,0xd1,0x7b,0x30,0x5c,0x2d,0xe4,0x91,0x61,0x37,0x36,0x98,0xea,0xf2,0x04,0x08,0x13
+,0xae,0x84,0x48,0x3e,0xc4,0xa3,0x70,0xb3,0x2a,0x28,0xc9,0xd5,0xe8,0x58,0x70,0xe5
+,0x24,0xda,0xf3,0x19,0xaf,0x75,0x45,0xa4,0x51,0xa8,0x9f,0xd2,0xa6,0x2b,0x52,0x61
+,0x47,0xc0,0xe0,0x94,0x78,0x7b,0x2f,0x3f,0x8d,0x3d,0x15,0x2d,0xcd,0x33,0x91,0x64
+,0xb8,0x1f,0xed,0x07,0x82,0x3c,0x24,0x16,0xfd,0x66,0x25,0x19,0x91,0x3c,0x46,0xc8
+,0xd7,0x61,0x3d,0x65,0x39,0x28,0x62,0xc5,0x10,0x43,0x4d,0x1a,0xc2,0xda,0x7a,0x6e
+,0xd6,0x4b,0xb3,0x7e,0x63,0xd6,0x47,0x66,0x7d,0x69,0xd6,0xc7,0x66,0x7d,0xdf,0xac
+,0x67,0x66,0x7d,0x62,0xd6,0x2b,0xb3,0xde,0x37,0xeb,0x1f,0xcc,0xfa,0xf7,0x66,0xfd
+,0x07,0xb3,0x5e,0xac,0xb5,0xe0,0xf5,0xc6,0xb6,0x5e,0x41,0xed,0x1a,0x21,0x54,0x4f
+,0x1b,0xa1,0x2a,0x53,0xae,0x42,0xad,0xf5,0x6c,0x83,0x89,0x59,0x1f,0x98,0xf5,0xe1
+,0x9a,0x2a,0x12,0xe9,0x68,0x65,0x36,0xce,0xd7,0x5a,0x01,0x4a,0x86,0xa8,0x1a,0x68
+,0xd8,0x2b,0x0f,0x6c,0x3b,0xa2,0x8a,0x66,0x77,0xc0,0xca,0x93,0x1b,0x48,0xdc,0xcd
+,0x42,0x80,0x0a,0x3f,0xaf,0xef,0xae,0xbc,0x60,0xed,0x7a,0xeb,0x33,0x7d,0xcf,0xf4
+,0x88,0x63,0xec,0x7e,0xb5,0xb9,0x15,0xad,0xbf,0x01,0x12,0x31,0xd8,0x61,0x44,0x54
+,0xd1,0xab,0x26,0x3d,0x6d,0x19,0xaa,0xbd,0x07,0x1b,0xc7,0x4a,0xce,0x30,0x3c,0x67
+,0x83,0x37,0x3b,0x53,0x1e,0xed,0x33,0x60,0x63,0x2b,0x5a,0xdf,0xaf,0x3d,0x9b,0xa4
+,0x0f,0x2d,0x1e,0xfa,0x67,0x1a,0x17,0x87,0xa1,0x32,0x34,0xba,0x74,0x02,0x2f,0x3f
+,0xaf,0x1f,0x1a,0xc3,0x69,0x57,0x39,0x33,0xcc,0x3a,0x8c,0xcd,0x1a,0x95,0x1e,0xea
+,0x5d,0x3f,0xaf,0xbf,0xb5,0x2f,0x18,0x4b,0xda,0x3f,0x9f,0x20,0x02,0x76,0xc1,0x97
+,0x01,0xad,0x12,0xcd,0xa7,0x39,0xe2,0xb4,0x6c,0xf5,0x3f,0x9f,0xd7,0x67,0xc6,0x48
+,0xae,0x1d,0x51,0xee,0xb9,0xe7,0xb9,0x7c,0x9e,0xc3,0x22,0xd6,0x4f,0x35,0xc8,0xd1
+,0xe5,0x90,0xb4,0xa5,0x0a,0x6a,0xb6,0x7b,0x66,0x82,0x6c,0xdb,0xf2,0xbc,0x94,0xf9
+,0x23,0xd1,0x03,0x13,0x47,0xc3,0xaf,0x78,0xf8,0x4c,0xa7,0x38,0x5f,0x88,0x4e,0xc1
+,0x67,0xda,0x12,0xfe,0x05,0xa7,0x10,0xd1,0xe1,0x2f,0x8d,0x0d,0x4e,0x8f,0xd6,0x2f
+,0xf5,0xe7,0xda,0x10,0xf1,0x99,0x07,0xb7,0x7c,0x3e,0xe1,0x38,0x9e,0x7f,0x70,0xcf
+,0x19,0x7a,0x89,0xdd,0x54,0xd7,0x1f,0x31,0x52,0x44,0xb6,0x0e,0x44,0x19,0xa4,0x55
+,0x3e,0xd3,0x7e,0xc4,0x0b,0x5f,0xd4,0xb6,0xf2,0xc9,0x18,0xce,0xd2,0x65,0x0b,0x47
+,0xb4,0x6d,0xfd,0x13,0xdf,0xf2,0x7f,0x66,0x33,0xca,0x99,0xd5,0x2d,0x79,0x47,0x7c
+,0x34,0xbb,0x9f,0xaa,0x83,0x06,0x7f,0x95,0xb6,0x9e,0x20,0x54,0xfa,0x87,0xfc,0x7c
+,0x60,0x9f,0x67,0x9c,0x63,0x2e,0xc2,0x2e,0x3b,0x84,0xce,0x42,0x7e,0x0f,0x66,0x65
+,0xa4,0x2f,0x6a,0x0d,0xd0,0xf3,0x4c,0x77,0x94,0x1e,0x75,0xcc,0xec,0x94,0x86,0x9e
+,0x3c,0xf8,0x75,0x55,0x3a,0xe5,0x96,0x7f,0x65,0xca,0x79,0x61,0xdf,0xc0,0xd4,0x41
+,0x32,0x40,0x5e,0xc2,0x85,0x87,0x75,0x41,0x74,0x44,0x69,0xc2,0x19,0xd9,0xaf,0xb6
+,0x15,0x3e,0x63,0xdd,0x0f,0x7b,0x72,0x3f,0xf9,0x4d,0x2f,0xcb,0xee,0x9e,0x4b,0x62
+,0x67,0xfe,0x94,0x17,0x92,0x34,0x8c,0xec,0x2a,0x1e,0x15,0x22,0x02,0x15,0x0f,0x43
+,0xb9,0x5d,0xe4,0xf2,0xf1,0xaa,0x15,0x4b,0xc5,0x7c,0xf6,0x30,0x5b,0x99,0x35,0xa5
+,0x24,0xfc,0x42,0x82,0x60,0x1b,0x0a,0x88,0x9e,0x80,0x0b,0xd8,0xad,0x8d,0xe0,0xc3
+,0x0a,0x42,0x0e,0x8d,0x89,0x1a,0x0e,0x03,0x1e,0xb1,0x96,0xb8,0x93,0x84,0x82,0xfa
+,0x0c,0x27,0xcc,0x2c,0x0b,0x84,0xd4,0x68,0x04,0xfe,0x87,0x33,0x5f,0x00,0x92,0x54
+,0x92,0x3b,0x05,0x6f,0x64,0x7c,0xc5,0x8e,0x7a,0x8d,0x0d,0x77,0x1c,0x50,0xeb,0xc3
+,0x4e,0x80,0xdb,0xea,0x47,0xbd,0xc4,0x55,0x2a,0x58,0xc7,0x00,0xbe,0x10,0xb0,0x0c
+,0xc0,0x66,0xa8,0x54,0x58,0x9a,0xde,0xbb,0x83,0x63,0xbd,0x30,0xf6,0x4e,0x50,0x80
+,0x03,0xa9,0x43,0x28,0x52,0x48,0x7f,0x02,0x9d,0x08,0x4c,0x0a,0x9b,0xca,0x86,0x55
+,0x64,0x08,0x9f,0xb1,0xa9,0xf9,0x34,0xb9,0x21,0xa7,0x1c,0xd6,0x28,0x0f,0xc6,0x2a
+,0xb5,0xb9,0xc5,0x6c,0xa4,0x1b,0x3b,0x73,0xa9,0xb6,0xa8,0x6d,0x31,0x8a,0xab,0xc2
+,0x07,0x70,0xa3,0x0e,0x5a,0x79,0x51,0x2a,0xa2,0x11,0x73,0x39,0x92,0xcf,0x9b,0xf3
+,0x11,0x76,0xa2,0x67,0xb2,0x7f,0x71,0xf5,0x4c,0x3f,0x05,0x47,0xcf,0x5a,0xba,0x07
+,0x97,0x5b,0x50,0x94,0x5a,0x8c,0x20,0x10,0x21,0x01,0x44,0xb3,0x05,0xef,0x34,0x4e
+,0xa8,0x79,0x2f,0x6d,0x10,0x89,0xc1,0x67,0xf8,0xfe,0xc7,0xe7,0x5b,0xdc,0x1a,0xcd
+,0x1f,0x9c,0x28,0xc7,0x21,0x08,0x30,0x9b,0x49,0x22,0xe7,0x39,0xda,0x54,0x67,0x17
+,0x45,0x0b,0x96,0xc6,0x38,0x63,0x94,0x76,0x05,0xbc,0xc2,0x53,0x6f,0x53,0x2e,0xc7
+,0xc7,0xc2,0x43,0x36,0xd3,0x4f,0x9a,0xa3,0xd2,0x43,0xb5,0x50,0xed,0xd3,0x22,0x8f
+,0x05,0x1a,0xa6,0xb4,0x59,0xef,0x65,0x31,0x34,0xff,0x85,0x9d,0x7f,0x8e,0x9e,0x96
+,0x65,0xd1,0x3c,0xb2,0x3c,0x8f,0xab,0x9e,0xf8,0x12,0x6d,0xf3,0xcb,0xf3,0x2c,0x49
+,0x81,0x43,0x88,0x13,0xe0,0xd7,0x27,0x02,0x9a,0x1a,0xdb,0x5a,0xbc,0x5b,0x91,0x1c
+,0x82,0x6e,0x5a,0xda,0x41,0x6b,0xe2,0xd7,0xcf,0xb1,0x42,0x21,0xf4,0x85,0xc0,0xe3
+,0xa0,0x87,0x82,0x1c,0x0e,0x69,0xc6,0x23,0x72,0xd2,0xde,0x0c,0x79,0x04,0xcc,0x09
+,0xe2,0x95,0x7c,0x81,0xb7,0xb8,0xe5,0x0a,0x07,0xc2,0xaf,0x48,0x89,0x6d,0xab,0xdc
+,0x7b,0x0e,0xc5,0x41,0x01,0xa4,0x53,0x56,0x19,0xd5,0xfa,0xd2,0x0c,0xe0,0x0a,0xff
+,0x70,0xbe,0xdb,0x7f,0xc7,0xfb,0xee,0x0f,0x47,0x87,0x3d,0x7f,0x72,0xee,0x93,0x39
+,0xbc,0xfc,0x25,0x31,0x90,0x8d,0x07,0xc2,0x53,0x76,0x5b,0xfa,0xb5,0x6c,0x8f,0x5c
+,0x15,0xf1,0xe1,0x43,0xd1,0xfe,0x59,0xc4,0xff,0x6b,0x4f,0x25,0x34,0x7e,0x69,0xa5
+,0x3d,0x4d,0xaf,0xc7,0xad,0x76,0x3d,0xda,0xe6,0xbe,0xf8,0x4c,0xb2,0x42,0x79,0x68
+,0x7a,0xbd,0x7d,0x5a,0x03,0x4e,0xc2,0x88,0xd1,0xd9,0x64,0x02,0x9a,0x40,0xc1,0xa7
+,0x17,0x40,0x52,0x4a,0x41,0x94,0x1c,0x24,0x22,0xe4,0xd3,0xc6,0x0b,0x86,0xe7,0x71
+,0x78,0x70,0xf4,0x43,0x78,0xdf,0x6b,0x60,0x04,0xfd,0x74,0x71,0x76,0xd6,0xe7,0x1f
+,0x8e,0x4e,0x8f,0xfa,0x12,0xde,0x52,0x6a,0x12,0x24,0xc1,0xf7,0x91,0x88,0x3c,0x87
+,0x0f,0xc4,0x76,0x65,0xb9,0x3e,0x2c,0x62,0x90,0x05,0x32,0x12,0xf0,0x22,0x6e,0x51
+,0xd0,0x60,0x71,0xf0,0x7c,0xdb,0xcc,0x6f,0x3a,0xb4,0x7a,0x8b,0x31,0xcc,0x61,0xed
+,0x92,0x94,0x2c,0x77,0xd5,0x61,0x5f,0x7b,0x97,0xd4,0xf9,0x4f,0x8b,0xed,0x5b,0x38
+,0xf8,0x79,0xda,0x92,0x08,0x3b,0x2f,0x6d,0xfc,0xcd,0x3c,0xc9,0xb3,0x81,0x1f,0xfa
+,0x63,0x3e,0xb0,0xfa,0x73,0xeb,0xba,0x36,0x10,0x48,0x0c,0x2b,0x38,0x70,0xa0,0x47
+,0x13,0x05,0x69,0x00,0xd0,0xf4,0x71,0xb4,0x96,0x82,0x02,0x8b,0x97,0x10,0xec,0x10
+,0x7e,0xc5,0x1f,0xcb,0x41,0x05,0xe4,0xa2,0x24,0x3d,0xcd,0x3f,0xde,0xcb,0xb2,0x4b
+,0x5e,0x71,0xf3,0x19,0x42,0xee,0xd5,0x8e,0x98,0x12,0x6d,0x00,0x93,0xcb,0xea,0x67
+,0x75,0xb0,0x6a,0x59,0xe3,0x0e,0x34,0x6d,0xea,0x39,0x20,0x83,0x53,0x81,0xd6,0x0a
+,0x3e,0xbe,0x48,0x80,0xd0,0xbf,0x4b,0x7c,0xe0,0x3d,0x74,0x5e,0x12,0xf0,0xbd,0xcc
+,0x6f,0x73,0xa0,0x06,0x43,0xc2,0x03,0x28,0xb7,0x14,0x10,0x47,0x2e,0x48,0x6c,0xb6
+,0x6a,0xfe,0xe4,0x8d,0xe6,0x18,0x99,0x4b,0x9a,0x29,0x15,0x32,0x9f,0xc2,0x8d,0x0a
+,0x79,0x90,0xf1,0x76,0x10,0xe5,0xd5,0x12,0x30,0x1d,0x8e,0x53,0xe4,0xa4,0xcf,0x6c
+,0xaa,0x14,0x2a,0xcb,0x43,0x84,0x5d,0x90,0xf1,0x3a,0x65,0xc0,0xda,0x72,0xb3,0xb8
+,0xf9,0x59,0xb3,0xbe,0xa8,0xba,0xc9,0xad,0x4f,0x95,0x0c,0x9e,0x89,0x25,0x14,0x8d
+,0x07,0xcc,0x1a,0x8a,0x40,0x2a,0xb2,0xaa,0xaf,0x94,0x61,0xfe,0xf3,0xcf,0x0c,0xfe
+,0xfb,0xe6,0x80,0x35,0x98,0xa3,0xcf,0x87,0x2e,0x00,0x0a,0xa9,0x85,0x6a,0xb7,0x3c
+,0x8b,0x8e,0xce,0x11,0xbe,0xf4,0x99,0x65,0x83,0x5c,0xed,0x36,0x60,0x40,0x1e,0x0b
+,0x2a,0x44,0x5b,0x92,0xbf,0xa1,0x78,0xc4,0xf2,0x66,0xc7,0xf1,0xb5,0x66,0x2d,0x5e
+,0x13,0xd3,0x74,0x19,0x40,0xbd,0x48,0x21,0xce,0x09,0x62,0x35,0x62,0x13,0x75,0xfb
+,0x90,0xae,0x6a,0x07,0xc2,0x7c,0x20,0x6d,0xf3,0xe5,0x07,0x11,0xf1,0xcb,0x00,0x9c
+,0x35,0x90,0xcb,0x56,0x9b,0x50,0x1d,0xd8,0x97,0xfa,0xeb,0x33,0x55,0x47,0x56,0xd2
+,0xc2,0x14,0x00,0x19,0x88,0xd3,0xd7,0xd9,0x1c,0xba,0x6d,0x46,0x55,0xb3,0x77,0xba
+,0xcf,0xd6,0x24,0x1e,0xe2,0x56,0xfe,0x67,0x54,0xdb,0x27,0xad,0x58,0xaa,0xf6,0x0b
+,0x6d,0xb4,0x6d,0x82,0x08,0xd6,0xa0,0xab,0x7d,0xdf,0x82,0x4c,0x1f,0xb6,0x05,0x7d
+,0x93,0x76,0xee,0x3d,0xdc,0x57,0x98,0x2a,0xca,0x74,0x8b,0x4e,0xdc,0x66,0x85,0x0a
+,0x8c,0x8e,0x7e,0xcd,0x61,0xb7,0x1f,0x3c,0x54,0xbc,0xd6,0x77,0xc5,0x64,0xf6,0xf3
+,0xed,0x19,0x6b,0x0c,0x3e,0xf4,0xf7,0x46,0xce,0x8c,0x1f,0x97,0x29,0x67,0x3f,0xae
+,0xaf,0x3e,0x23,0xa6,0x22,0xe3,0x7c,0x05,0xf6,0xac,0x6d,0x14,0xe5,0xc5,0x83,0xf8
+,0x26,0xa6,0x83,0x0f,0x34,0x05,0x14,0x9a,0xbd,0xae,0xa0,0x00,0xf9,0xcb,0xa7,0x96
+,0x05,0x42,0x76,0xc0,0x82,0x03,0xe5,0xe2,0x57,0x85,0x21,0xf1,0x7f,0xe4,0x0f,0xac
+,0xbc,0xa8,0xd4,0xc1,0xa7,0x29,0xf7,0x14,0x31,0xd8,0xf8,0x56,0xfd,0xa4,0xc5,0xc4
+,0xdb,0x92,0x40,0xa8,0x9e,0x39,0x1a,0x2f,0x2e,0xec,0x83,0x31,0x77,0xc6,0x58,0x74
+,0x5d,0x9b,0x0f,0xe8,0x3f,0xe8,0x7b,0x9f,0x5c,0x5f,0x33,0x1b,0x20,0x66,0xcc,0xcf
+,0xc6,0xdc,0x7c,0xca,0xe6,0x5b,0x4f,0xde,0x91,0x3c,0x32,0xa6,0x17,0xe1,0xf3,0xa8
+,0x70,0xae,0x57,0x44,0x47,0xe8,0x0c,0xbb,0x3f,0x24,0xff,0xad,0x88,0xea,0x36,0x96
+,0xce,0xd5,0x98,0xb1,0xf4,0x72,0xe6,0x07,0xed,0x0e,0x12,0x17,0x24,0x21,0x8a,0xee
+,0x5d,0x46,0xdd,0x90,0x4c,0x0c,0x70,0x3a,0xc3,0x90,0xfb,0xc6,0xc1,0x71,0xd4,0x5e
+,0x44,0xa5,0x62,0x05,0xd1,0xd5,0xc0,0x38,0x1e,0xac,0x5d,0x47,0x53,0x24,0x37,0x7d
+,0xa2,0x96,0x6b,0x3d,0x8f,0xe2,0xd8,0x36,0xaf,0x7f,0x5c,0x2a,0x39,0x8e,0x7d,0xd7
+,0x57,0x71,0x0c,0x27,0xbc,0x38,0x94,0xef,0x8c,0x05,0x8e,0x28,0x9c,0xf3,0x7d,0x5c
+,0xdd,0x45,0x31,0x47,0x1e,0x72,0x1c,0xa5,0x14,0x53,0xbb,0x59,0x98,0xb9,0x1d,0xed
+,0xc9,0x44,0xe1,0x43,0x57,0xdb,0xcc,0x63,0x1b,0x58,0xdf,0x24,0x33,0x1e,0x5e,0x95
+,0x93,0x6c,0x8e,0xc6,0xf8,0x93,0x80,0xe7,0xe1,0xc6,0xce,0x68,0x7b,0x2f,0x80,0x4f
+,0x84,0xc7,0x74,0x46,0xe1,0xd2,0x49,0x8d,0x71,0x42,0x0e,0x6d,0xec,0x6d,0xbd,0x31
+,0x7e,0x45,0x0d,0x95,0xc4,0xe4,0x94,0xbe,0xf3,0x17,0x29,0x10,0xbe,0x8c,0x3e,0x95
+,0xfd,0x6b,0xdc,0xae,0x0f,0x36,0x5d,0x2f,0xb9,0x4b,0xbb,0x70,0x80,0x65,0x33,0x4c
+,0x72,0x93,0x4e,0x4b,0x8e,0xb7,0x87,0x40,0xe2,0x76,0x28,0x54,0x07,0x72,0xff,0x80
+,0x4f,0x47,0xf4,0x2d,0x8f,0x31,0x2f,0xa8,0x20,0x87,0xf0,0xda,0x7d,0xc5,0x9a,0x73
+,0xbc,0xf7,0xe1,0xbb,0xb1,0x2a,0x9f,0x75,0x46,0x18,0x81,0xdd,0x9a,0x3f,0x96,0xd9
+,0xb0,0x3b,0xce,0x86,0x62,0x07,0x06,0xd7,0xd9,0x1d,0x3b,0x2d,0x83,0x54,0xa5,0x0f
+,0xfb,0x3f,0x96,0xa4,0xf2,0x5e,0x88,0xfb,0xb2,0x4f,0xc0,0xef,0xa2,0x5c,0xec,0xf8
+,0x3c,0x69,0xce,0x83,0x07,0x30,0x9c,0x75,0x8c,0x5d,0x41,0xbd,0x07,0x05,0x64,0x24
+,0x78,0x1b,0xe5,0xcb,0x67,0x07,0x4f,0xc2,0xd8,0x63,0x57,0xf4,0x5e,0x92,0xfc,0xf1
+,0xce,0x65,0x42,0x15,0x3f,0x40,0x62,0xdb,0xe9,0x1d,0xa8,0x86,0x24,0x80,0xf9,0x96
+,0xae,0xc1,0x28,0x81,0xb7,0x81,0x53,0xa6,0x30,0xc3,0xc4,0xbc,0xe5,0xc3,0xae,0xba
+,0x08,0x76,0xc7,0x0c,0xd3,0x79,0x7e,0x71,0xf6,0xb6,0x36,0x3e,0x09,0xc1,0x15,0x67
+,0x4f,0x7e,0xc9,0x4e,0x76,0xb2,0x9f,0x41,0x8e,0xf8,0x59,0x2c,0x51,0x39,0xa9,0x7d
+,0x21,0x98,0xd1,0x7c,0xd9,0x8c,0xb4,0x09,0x12,0x09,0xcb,0x8e,0x25,0x40,0xf5,0x24
+,0x5e,0x8b,0x31,0x0b,0x09,0x9c,0x70,0x86,0x4b,0x73,0xea,0x12,0x19,0xa2,0xcd,0x81
+,0x2d,0xcc,0x7c,0x0c,0xcf,0xe2,0x82,0xdf,0xfb,0x63,0x54,0x2f,0x71,0x9f,0x4d,0x87
+,0x1c,0xbb,0x23,0xe8,0xe5,0xb1,0xc4,0x38,0x45,0x90,0x28,0x68,0x77,0x68,0x0c,0x9c
+,0x72,0x4f,0x20,0xe3,0x00,0x12,0x71,0xcd,0x42,0x2d,0x50,0x69,0xca,0x14,0x5e,0x33
+,0x06,0x75,0x90,0x3f,0x2e,0x3e,0x9b,0xad,0x69,0xf2,0x67,0x6f,0xc5,0xb0,0x16,0x05
+,0xdf,0x27,0xf2,0xc2,0x70,0x12,0xff,0xf3,0x2f,0x57,0xd7,0x82,0x22,0x24,0x82,0x08
+,0x37,0xf5,0x6c,0x2f,0xfd,0x8d,0x51,0xde,0x42,0x2e,0x21,0x46,0x6d,0x3e,0x40,0xa6
+,0x6e,0xfa,0x1d,0x98,0x92,0xc4,0xcf,0x7e,0x36,0x83,0x59,0xe0,0x21,0x05,0x74,0x39
+,0xc9,0x31,0x21,0xae,0x51,0x9c,0x74,0x48,0x25,0xb2,0xe4,0x51,0x61,0x78,0x25,0xff
+,0xd0,0x20,0x5d,0x54,0xc8,0x2e,0x13,0xa6,0x2d,0x62,0x17,0x28,0xd0,0xed,0x48,0x22
+,0xb5,0xf4,0x0d,0xf1,0x45,0x8c,0x1c,0xcb,0x70,0x53,0x61,0x66,0x21,0xa0,0x53,0x89
+,0xda,0x07,0x5d,0xb2,0xd0,0x74,0x5e,0xf9,0x4a,0x9c,0x3c,0xbc,0x98,0x90,0xa3,0x4b
+,0xb4,0x07,0x82,0xc4,0xc1,0x86,0x91,0x1b,0x46,0xc9,0xc5,0xee,0x10,0xf7,0x8b,0xc8
+,0x7f,0x2e,0xf8,0xb8,0xa0,0xb4,0x0a,0xbc,0x3c,0x98,0x2e,0xee,0x3b,0x77,0x94,0xfd
+,0xf3,0x90,0x93,0x8d,0xef,0x3f,0x1b,0x2d,0x07,0x48,0x5c,0x71,0xa4,0xe8,0x30,0xbf
+,0x6f,0x8d,0x83,0x89,0xf4,0x70,0x68,0x41,0x87,0xdc,0x10,0xec,0xd0,0x60,0x3e,0xd0
+,0xd4,0x1b,0xf0,0xb5,0x8b,0x66,0x69,0x92,0x8b,0xf1,0xc1,0xce,0xbe,0xf6,0x48,0xa1
+,0x19,0xd3,0xaa,0x0b,0xb7,0xf9,0x70,0x66,0x44,0x0e,0x3a,0xaf,0x8b,0x84,0x49,0x2d
+,0x76,0xc9,0x65,0xf9,0x49,0x9e,0x6d,0x21,0x99,0x3a,0x64,0x54,0x6b,0x6b,0x41,0x73
+,0x92,0x86,0x29,0xe6,0x8e,0xb0,0x70,0x6b,0x13,0x67,0xf3,0x98,0x24,0x0d,0xe4,0x7c
+,0xa9,0x70,0x6f,0x8c,0x65,0xff,0x90,0xb0,0xa7,0xc6,0x66,0xfb,0x65,0xfb,0x55,0xfc
+,0xf5,0xf6,0x16,0x63,0x4d,0xcd,0x97,0x1c,0x98,0xee,0x19,0x91,0x94,0x63,0xf0,0xb3
+,0xa7,0xfc,0xa5,0xcb,0xb9,0xa5,0x26,0xac,0xd2,0x9a,0x5b,0x85,0x29,0xe2,0xdc,0xd4
+,0x81,0x99,0xfc,0x5f,0x32,0x92,0x6a,0x4c,0x4f,0x1a,0x36,0x8c,0x40,0x79,0xd3,0xc0
+,0x68,0x2c,0xe9,0x35,0x7c,0xd7,0xca,0x4a,0xd2,0x08,0xa5,0xa3,0xf1,0xe4,0xf6,0x78
+,0xbe,0xe8,0x95,0xcb,0xfb,0x07,0xe0,0x94,0x72,0x36,0x84,0xfc,0x93,0xe9,0xf5,0x2f
+,0x8e,0x4e,0xdf,0x8a,0x4e,0xec,0x10,0x0a,0xa0,0x0f,0xe6,0x2f,0x7f,0x31,0x82,0x95
+,0xc2,0x50,0x43,0x0c,0xf6,0x0b,0x21,0x17,0xde,0xc8,0x9c,0xde,0x23,0x5d,0x80,0x32
+,0xb2,0x69,0x07,0xfe,0x16,0x1d,0x73,0x1a,0x7a,0x92,0x66,0xa5,0x75,0x5c,0x0e,0x55
+,0x3d,0x51,0xe6,0x61,0x83,0x41,0x00,0x24,0xac,0x51,0xb6,0x33,0xc6,0x14,0xc7,0xcc
+,0x12,0xad,0x86,0xc7,0x79,0xed,0x8a,0x85,0xed,0x4d,0x75,0x5f,0xb6,0xb6,0x23,0x16
+,0xdd,0xb3,0xb2,0x3b,0x49,0x4a,0x38,0xae,0x23,0xad,0x7d,0x98,0x1b,0x1a,0x04,0x81
+,0x58,0x2b,0x1b,0x2a,0xcd,0x97,0xa8,0x41,0xb2,0x2d,0x58,0xd6,0x8a,0xe0,0xb6,0x01
+,0xc2,0x21,0xed,0x4c,0xba,0xa3,0x70,0x9a,0xd0,0x12,0xb1,0x74,0xd0,0xdc,0xf9,0x86
+,0xa0,0xfa,0x41,0x19,0xba,0xc3,0x7c,0xb5,0x85,0x31,0x0e,0xca,0x4d,0x1f,0xdd,0x1b
+,0x16,0x74,0x38,0xad,0xa4,0x01,0xf9,0x0e,0x2e,0x1b,0x29,0x41,0x64,0xcf,0xc2,0x3a
+,0xd9,0x4a,0x3d,0xa3,0xe9,0xb0,0x7c,0xd3,0x0f,0x46,0xf3,0x93,0xda,0x96,0x52,0x23
+,0x67,0xcd,0x2b,0x66,0xe3,0xe3,0xa7,0x2d,0x95,0xc6,0xe7,0x1d,0x10,0x95,0x29,0x00
+,0x17,0xe9,0x84,0x0e,0x6e,0x1f,0x79,0x6c,0xb2,0xda,0x34,0x69,0x3c,0x61,0xf9,0xd3
+,0xe2,0xc4,0x14,0xba,0xdf,0xa3,0xc3,0x7d,0x98,0xf8,0xab,0x14,0xc8,0x13,0x3c,0x7d
+,0x5e,0x62,0x68,0xd9,0x36,0x2a,0x8e,0x6f,0xe9,0x7f,0xff,0x64,0x0d,0xc3,0xd5,0x77
+,0x66,0xdc,0x92,0x21,0x19,0x99,0xfa,0x49,0xe8,0x64,0xb1,0xd8,0x8e,0xe0,0x89,0xac
+,0x3a,0xd6,0x6d,0x09,0xf5,0x61,0x27,0x32,0x4e,0x83,0x0e,0x53,0xb6,0x31,0x5f,0xec
+,0x18,0x4e,0xef,0x10,0x70,0xa4,0x3b,0xff,0xdb,0x58,0x6a,0x68,0x03,0x91,0x39,0x2a
+,0x24,0xda,0x0d,0xec,0x79,0x6c,0x83,0x44,0x9b,0xdf,0x18,0xbd,0xff,0xe1,0x7d,0xcf
+,0x88,0x0d,0xe6,0xcf,0xc6,0x3e,0x63,0xe5,0xc9,0x82,0xbb,0xa1,0xa3,0x95,0xa1,0xa5
+,0x1f,0x8d,0xda,0xdb,0xdc,0x04,0x8f,0x2b,0x5b,0xe9,0xcf,0xd6,0x7c,0x8b,0xc7,0x53
+,0xf7,0xf8,0x1b,0x7d,0xcc,0xd3,0x9b,0x1a,0xd9,0xeb,0xae,0x8d,0x98,0x58,0x79,0x5b
+,0x7f,0xc7,0x37,0x10,0x4f,0xdd,0xe3,0x6f,0xec,0x63,0xee,0x8e,0x1a,0x9c,0xa8,0x04
+,0x35,0x63,0xce,0x18,0xdd,0x6f,0xa6,0xbc,0x6b,0x0c,0xf3,0x0a,0xd0,0x81,0xfd,0x23
+,0xfe,0x44,0x4a,0x7b,0x9e,0xc3,0x12,0xa1,0xd3,0x61,0x65,0xbe,0x2c,0x8d,0xf2,0x2f
+,0x22,0xd0,0xdc,0xb0,0x3a,0x0f,0x8b,0xb5,0xcd,0x61,0xa5,0x88,0x9f,0xe6,0xea,0xe8
+,0x6f,0x93,0x93,0x6a,0xe3,0xb4,0x76,0xf9,0x24,0x83,0xe7,0xe6,0x02,0x71,0xe2,0x0a
+,0x32,0x15,0xc6,0x32,0x71,0xac,0x16,0xca,0x22,0xec,0xa7,0x29,0xef,0x51,0x21,0x85
+,0xa8,0x9f,0xd8,0x20,0x4d,0x2b,0xb8,0xd8,0x86,0x0a,0xd7,0x10,0x4c,0x34,0x70,0x60
+,0xce,0xc4,0xe7,0x01,0x0d,0x39,0xea,0x85,0x51,0x5d,0xc5,0xf3,0xbb,0xa7,0x99,0x80
+,0xea,0x8c,0x8e,0x83,0xa4,0x67,0x54,0xaf,0xb6,0x2a,0xaa,0x05,0x73,0x8a,0x15,0x2c
+,0xe2,0x88,0xc5,0xa9,0xbc,0x86,0xde,0xbf,0x88,0xee,0xa0,0x26,0xc3,0xad,0xee,0xa8
+,0x17,0x9c,0xe6,0xd4,0xb9,0x67,0xac,0x1e,0xd6,0x64,0xef,0xf0,0x8d,0x60,0x51,0x61
+,0xf4,0xab,0x2f,0x60,0x7f,0x1f,0xa6,0xed,0x48,0x5b,0xaf,0x17,0x3a,0xeb,0xa1,0x9d
+,0x9b,0x74,0x92,0x4c,0x47,0x9c,0x56,0x4a,0x2a,0x21,0x35,0x14,0x54,0x76,0xec,0x3d
+,0xae,0x76,0x1d,0xf1,0xa8,0x7c,0x06,0x30,0xc3,0x26,0x41,0xbe,0x8a,0xb3,0x3b,0x41
+,0xc8,0xb5,0xce,0x8f,0xd6,0x39,0x58,0xf0,0xb0,0x9d,0x4b,0xe4,0xaf,0xcf,0xcf,0x93
+,0x04,0xc7,0x6d,0x07,0xf0,0x2f,0x8f,0x13,0x07,0x46,0xc5,0xb7,0x65,0x64,0xab,0x07
+,0x88,0x3f,0x15,0x9d,0x25,0x9c,0xe2,0x1c,0x1c,0xeb,0xff,0x47,0xbc,0x31,0x23,0x5c
+,0x7c,0xac,0x5d,0xba,0xd5,0x94,0x80,0xb4,0xb8,0x89,0x4d,0x63,0xd0,0xb4,0x41,0xbb
+,0x76,0x36,0x6b,0xd9,0xc7,0x04,0x1e,0x0f,0xe6,0x6f,0x5e,0x84,0x16,0xfb,0x55,0xe1
+,0x52,0xfd,0xf6,0xe8,0xf8,0x38,0x98,0x0e,0x99,0x20,0x22,0xa1,0xf4,0x01,0x62,0x9b
+,0x34,0x9d,0x34,0x93,0x11,0x97,0xe9,0x4e,0x76,0xb7,0xd4,0x11,0xf7,0x4b,0x6c,0x3d
+,0xc7,0xbe,0x69,0x63,0x4e,0xb4,0x57,0x54,0xf1,0x3b,0x8f,0x2a,0x1e,0x7b,0xf7,0x41
+,0x3d,0xc6,0x9a,0x13,0x47,0xd8,0x7a,0xb0,0x3e,0x96,0x91,0xb3,0x62,0xe0,0x5c,0x35
+,0xdb,0xb1,0x9a,0xd8,0xcd,0x81,0xf3,0xb4,0x77,0xa9,0xbc,0x5e,0x94,0xba,0x72,0x5c
+,0xc4,0x6d,0xae,0x02,0xae,0xab,0xef,0x26,0x37,0x1f,0x7f,0x0d,0x7c,0x99,0x36,0x99
+,0xb8,0xad,0x22,0x24,0xc2,0xe9,0xd4,0x66,0xde,0x2f,0x63,0x18,0xe8,0xd5,0x02,0xa8
+,0xe6,0xa5,0xc3,0x67,0xb6,0x38,0x8f,0xdc,0x6d,0xb7,0x2a,0x99,0x42,0x1c,0x5b,0x37
+,0xd6,0x77,0x8d,0x10,0x74,0x18,0x1a,0xde,0x4b,0x4e,0x3f,0x39,0x5e,0x24,0xf3,0x49
+,0xcd,0x73,0x00,0xf6,0x70,0xac,0xd2,0x61,0xcd,0x5f,0x4b,0x31,0x69,0xbd,0xde,0xa4
+,0xd7,0x8e,0xd7,0x89,0x9f,0x6d,0xc7,0x07,0x8c,0x85,0x1b,0x53,0xc7,0xbc,0x89,0x2d
+,0x28,0xcd,0x3d,0xe6,0xbe,0x9e,0x5f,0x00,0x4b,0xf7,0xbb,0xa3,0x8b,0x7e,0xfb,0xe2
+,0xa0,0xd7,0xee,0xbd,0xbb,0x68,0xf7,0xda,0xdc,0xc6,0xfa,0xc9,0xc1,0x09,0x43,0xea
+,0x7e,0x09,0x4c,0x5d,0x0c,0x9d,0x13,0xb6,0x07,0x58,0xb8,0x4d,0x11,0xf3,0x98,0x8b
+,0x7f,0xa6,0x19,0xd1,0xc1,0x79,0x74,0xb5,0xd2,0xf9,0xee,0x09,0x9c,0xb1,0x0d,0x5e
+,0xdd,0x8c,0x3f,0x78,0xa7,0xd4,0x3f,0x89,0xdb,0x88,0xc0,0x64,0x30,0x14,0x52,0xce
+,0x38,0xb0,0xe2,0xab,0x9a,0xc2,0x38,0x69,0xf5,0x62,0x36,0x61,0x84,0x44,0x6e,0x3d
+,0x0e,0x42,0xf7,0x91,0x97,0xe2,0xf2,0x97,0x3c,0x64,0xb3,0xe5,0x2c,0xf0,0xcb,0x62
+,0xfe,0xd7,0x42,0x1d,0x43,0x2f,0x19,0xa4,0x45,0x50,0x05,0xa2,0x77,0xf7,0x77,0xf8
+,0xe9,0xb4,0xa9,0x24,0x6b,0x1d,0x27,0xb8,0x0e,0x1e,0x29,0x12,0x74,0x08,0xc6,0xa8
+,0x88,0xea,0x8a,0x5d,0x13,0xed,0xd1,0xb9,0xa6,0xa3,0x79,0x79,0xde,0xdd,0x3f,0x7b
+,0x7f,0x8a,0x33,0x7d,0x7c,0x70,0xd8,0xef,0x5e,0x1c,0xbd,0x7d,0xc7,0x88,0x3c,0x1c
+,0xfb,0x22,0x5c,0xb7,0x38,0xc0,0xd6,0x5f,0x6b,0x04,0x31,0x56,0x9b,0x48,0x2e,0x3b
+,0x66,0x82,0xf1,0x55,0x67,0xcc,0x21,0x2b,0xf2,0x2e,0x02,0x04,0x69,0x29,0x69,0xfe
+,0x6a,0xb3,0xb8,0x79,0x2d,0x71,0xb1,0xe4,0x54,0x61,0xc9,0x6c,0x30,0x51,0x58,0xc0
+,0xdd,0xfe,0x81,0xe2,0x8b,0x1f,0x89,0xba,0x70,0xa1,0x10,0x5a,0xce,0x6b,0xe6,0x92
+,0xbf,0xc0,0x67,0x2a,0x11,0x1f,0x00,0xc1,0x1a,0x58,0xb1,0xfc,0x97,0x0e,0x4b,0xc5
+,0x06,0xb7,0x86,0x81,0xca,0x1e,0x45,0x4b,0xf5,0x79,0x89,0x77,0x33,0xc0,0x22,0xe9
+,0xd3,0x27,0xad,0x42,0x48,0xa9,0x51,0x02,0x36,0x3b,0xd3,0x19,0xd1,0x0a,0x2e,0xb2
+,0x68,0xc8,0x2e,0xdf,0x7c,0xcd,0x41,0x55,0x48,0xc3,0x62,0x84,0xc2,0xef,0xe9,0x4f
+,0x7c,0x72,0x12,0xef,0xef,0xf7,0x27,0x93,0xed,0xd9,0x6c,0xbb,0xd7,0xbb,0xea,0x80
+,0x3e,0x5f,0x5f,0x55,0x9f,0xae,0xf5,0x1a,0x12,0x33,0x73,0x50,0x9d,0x95,0x54,0xa8
+,0x7e,0x75,0xb5,0xb7,0x77,0xfd,0xfd,0xf7,0xd7,0x27,0x27,0xfb,0xfb,0x93,0xc9,0x6c
+,0x76,0xd5,0x29,0xcb,0xeb,0x2b,0xae,0xef,0xeb,0x2e,0x7c,0x5d,0x8b,0x86,0xe0,0x43
+,0x9f,0x30,0x19,0x6e,0xfa,0xe9,0x6e,0x77,0x52,0x05,0x98,0xcc,0x4e,0xf0,0x46,0x50
+,0xb9,0xaf,0x62,0x6a,0x59,0x43,0x47,0x8c,0x62,0xdc,0x22,0xf6,0xa5,0xb2,0x9e,0x04
+,0xea,0x40,0xd4,0xc4,0xdd,0x20,0x21,0x58,0x6c,0xa8,0x65,0xe5,0x97,0x86,0x45,0xda
+,0x70,0x16,0x31,0x2c,0x3d,0x99,0xbd,0xe7,0xb1,0xec,0x4a,0xe4,0x59,0xd0,0x48,0x92
+,0x3a,0x18,0xb6,0x2a,0x36,0x98,0x99,0xe0,0x2b,0x0c,0x2e,0x8c,0xe8,0x9e,0xbc,0xd8
+,0x36,0x5f,0xc2,0x01,0xbe,0x6d,0x62,0xb8,0x2f,0xaa,0x36,0xf9,0x1b,0x84,0xf9,0x80
+,0x2f,0x07,0x62,0xeb,0x9f,0x2d,0xfe,0x25,0xfd,0x52,0x8f,0x72,0xec,0x06,0x20,0x38
+,0x20,0xfd,0x0c,0x49,0x5d,0xdc,0x93,0x5c,0xbe,0xfe,0xcc,0x1b,0xa2,0xfa,0xfc,0x5d
+,0x0b,0x32,0x79,0xbb,0xb3,0xb9,0xb1,0xf5,0xaa,0x6d,0x66,0xfc,0xef,0xdf,0xb6,0xda
+,0x66,0x2c,0x3f,0xbd,0xa4,0x5b,0x52,0x7e,0xa2,0xb7,0x73,0xf9,0xe9,0x2b,0x9a,0x2e
+,0xf9,0xe9,0xb5,0x9b,0x74,0x78,0x43,0x64,0x80,0x19,0x56,0x4f,0xb1,0x28,0x02,0x5d
+,0x0b,0xf4,0x91,0x5e,0x70,0x15,0xc0,0x95,0x79,0x36,0x4f,0xc5,0x0f,0xd3,0xc2,0x54
+,0x2b,0x1f,0x63,0xb5,0x03,0x0a,0x61,0x1b,0xad,0xc1,0xc1,0x6a,0x68,0xd6,0xdf,0x6d
+,0xaf,0x9f,0x6c,0xaf,0xf7,0xd6,0x34,0x71,0x4f,0x9c,0xb1,0x11,0xbd,0x34,0x6b,0xee
+,0x8d,0x5c,0xe1,0x47,0x36,0x6a,0x11,0xb7,0xa4,0xc4,0xc5,0x3a,0x78,0x1b,0x09,0xc6
+,0xa7,0x33,0x82,0xce,0xcd,0xe8,0x16,0xce,0x9c,0x17,0x3d,0x27,0x47,0x1a,0xa8,0xab
+,0xa6,0x1f,0x16,0xfb,0xc3,0x8b,0x67,0x7b,0xd4,0x2f,0xe6,0x9c,0xaa,0xda,0xca,0x02
+,0x44,0x63,0xd9,0x96,0x91,0x0f,0x1e,0x2d,0xe6,0xed,0xa2,0x23,0x26,0x39,0x33,0x4f
+,0xb2,0x45,0x10,0x4d,0xe3,0xbd,0x3e,0x86,0x7c,0x24,0xe1,0xb2,0xca,0x5e,0xc9,0x5d
+,0x21,0x95,0xb5,0x96,0xa6,0x42,0x2d,0x27,0xd9,0xbc,0x64,0x13,0x27,0x34,0x80,0x2c
+,0xe4,0xc0,0x4c,0xe5,0x9c,0x20,0x11,0x41,0x4b,0xc2,0x20,0xab,0x62,0x7c,0x7d,0xa0
+,0x16,0x9a,0x33,0x62,0x4a,0x97,0x42,0x14,0x0a,0x0f,0x9f,0x19,0xa9,0x84,0x53,0xe4
+,0x42,0xf4,0x44,0x07,0xd0,0x0e,0x8d,0x9d,0x62,0xc3,0x13,0x98,0xc6,0x20,0x7a,0x5f
+,0xee,0x02,0x1e,0x92,0x3f,0x66,0x74,0xfd,0x22,0x83,0x95,0x5e,0xcd,0xce,0x4b,0x87
+,0xef,0x56,0x45,0xd1,0xd0,0x44,0x50,0x9a,0x20,0x40,0x0c,0x5c,0x6c,0x05,0xcb,0xed
+,0xa7,0xd6,0x20,0x22,0x24,0x68,0x6c,0x2d,0xaa,0x47,0xf8,0xd5,0x53,0xde,0xa9,0xeb
+,0x01,0x27,0x08,0x6c,0x4b,0x29,0x70,0xcd,0xac,0x3c,0x73,0x3d,0x42,0xe0,0x1e,0x2c
+,0x77,0xc3,0xaa,0xef,0x99,0x87,0x6b,0x56,0x80,0x5b,0x2b,0x8d,0x04,0xbf,0x28,0xe0
+,0xcb,0x32,0xef,0x56,0x24,0x9b,0xd8,0xbc,0x9f,0x1c,0x08,0x90,0xa7,0x55,0x00,0xfc
+,0x19,0xf7,0xd9,0xa5,0x1a,0xa5,0x9a,0xee,0x35,0x91,0x2c,0xda,0xd5,0xad,0x1a,0x37
+,0x41,0x5c,0x72,0x33,0x9b,0xdb,0x24,0x48,0xf6,0x6e,0x0d,0xbf,0xa2,0x00,0x9f,0x44
+,0x1d,0xb5,0x27,0xab,0x2f,0x96,0x4c,0xfa,0x44,0xdd,0xdd,0x54,0xcf,0x97,0xc2,0xe1
+,0x0b,0xa9,0x8d,0x57,0x75,0x08,0xce,0xbd,0x9e,0xfd,0x17,0x78,0xa5,0x9d,0xa0,0xb3
+,0x1c,0x4c,0x71,0xe0,0x58,0x35,0x39,0x33,0x27,0x47,0xcc,0xe5,0x9f,0x98,0x93,0xdd
+,0x0f,0xd7,0xe6,0xef,0xc2,0x5b,0x99,0xcf,0x01,0x8f,0xff,0x0f,0xa1,0x89,0xb4,0xe2
+,0x12,0x67,0x62,0x99,0xac,0x25,0x71,0xa9,0xd9,0x27,0xb9,0x3e,0x38,0xbc,0xba,0x64
+,0x58,0x07,0xb6,0xc9,0x81,0x0f,0xd9,0xc0,0xa2,0x0a,0xd5,0xc0,0x41,0xdc,0xa4,0x5f
+,0xa3,0x85,0xc0,0xba,0x16,0x56,0x54,0x52,0xee,0xa1,0x63,0x9e,0x71,0xb2,0xd1,0x0c
+,0x5d,0xf6,0x56,0x13,0x63,0x2e,0xe6,0x9c,0x3b,0x6d,0xed,0x11,0xe2,0x70,0x91,0x58
+,0x37,0x28,0xc9,0xb4,0x84,0x9b,0x17,0x5a,0xc6,0xb0,0x8b,0xec,0x26,0x4f,0xcc,0x48
+,0x24,0x63,0x95,0xfa,0xc7,0xe8,0xb7,0x28,0x5c,0x2b,0x8e,0xd1,0x9b,0x15,0xbf,0xd6
+,0x48,0x24,0xd3,0xd3,0xd8,0xb5,0xf0,0x6c,0x98,0xab,0x10,0xb3,0x0e,0xbc,0xb3,0x45
+,0x58,0xe3,0x0c,0x96,0x18,0x6e,0x4d,0x18,0x4a,0xcb,0x20,0xa3,0x81,0xb5,0x50,0x4b
+,0xf7,0x6e,0x55,0xd9,0x26,0x4d,0x87,0x6a,0xc5,0x51,0x11,0x22,0x68,0xd2,0x47,0xdd
+,0x5a,0xf2,0xc4,0x4b,0x2a,0x22,0xf1,0xb8,0x22,0x46,0x30,0x81,0x02,0x2e,0x9b,0xce
+,0xf2,0xf9,0x47,0x92,0x14,0x18,0xac,0x93,0xb3,0xb1,0xba,0xd4,0x08,0x0c,0x83,0xc7
+,0x04,0x42,0xb2,0x78,0xe9,0xea,0x05,0x59,0x0d,0x2d,0x03,0x07,0x5d,0xb1,0xda,0xa5
+,0xb9,0x09,0x2f,0x67,0x44,0x4d,0x46,0xc6,0x48,0x86,0x31,0xeb,0xa7,0x63,0xda,0xa8
+,0x36,0x5d,0x47,0xcb,0x85,0x0e,0xd5,0xd6,0x0e,0xc4,0xf6,0x93,0x18,0x59,0xc4,0xb1
+,0xb2,0x13,0xed,0x07,0xce,0x41,0x32,0x12,0x1a,0xc8,0x1f,0x90,0x75,0x82,0x38,0xeb
+,0x11,0x24,0x31,0x36,0x96,0x15,0x23,0xb5,0x95,0xe2,0xc6,0xa4,0xd3,0xc4,0x20,0x9c
+,0xea,0x2f,0x15,0x45,0x9c,0x96,0x44,0x52,0xd7,0x27,0x9c,0x1b,0x28,0x08,0x81,0x40
+,0x53,0x2d,0x03,0x55,0x82,0x71,0x2e,0x0d,0x32,0xda,0x08,0x8a,0x30,0xa8,0x73,0xfd
+,0x27,0xa4,0x07,0xa1,0xaa,0xee,0x5d,0x50,0x64,0x02,0xb7,0x98,0xe6,0x4c,0x18,0xdc
+,0x96,0x14,0xe6,0x04,0xc0,0x66,0xcf,0xa6,0x68,0xd5,0x2b,0x5d,0x5c,0x17,0x5b,0xae
+,0x95,0xa1,0x71,0x09,0x92,0xd8,0xce,0x5d,0xa6,0x63,0xd1,0x32,0x7e,0x9b,0xbd,0x61
+,0xf4,0x6c,0x76,0x63,0x2c,0xe1,0x15,0xb2,0xe4,0xd0,0x24,0xe7,0x57,0x63,0x5b,0x18
+,0x59,0xe7,0x47,0x6e,0x5f,0xaa,0x65,0xd4,0xaa,0xe5,0x48,0x44,0xe4,0x13,0x37,0xfd
+,0xa0,0xfb,0x9c,0xde,0x03,0xd9,0x26,0x6d,0xfa,0x22,0xad,0x3a,0xe3,0x83,0xc3,0x2a
+,0x2f,0xb6,0xf8,0xf5,0x5c,0xb3,0xae,0x6a,0x6e,0x8c,0xcf,0xdf,0x8a,0x7c,0xc9,0x56
+,0xf7,0x0b,0xe8,0x1f,0xba,0x99,0x8d,0x05,0x41,0xfb,0x6a,0x73,0x4b,0x97,0xd3,0xd5
+,0xfd,0x68,0x34,0x6c,0x5d,0xd1,0xb9,0x41,0x37,0xd8,0x13,0x64,0x21,0x23,0x85,0x44
+,0xc6,0x1c,0xdc,0xea,0x38,0xa9,0xee,0x85,0xa4,0x78,0xe1,0xd7,0x08,0x20,0xc0,0x85
+,0xd7,0x5c,0x0a,0xbe,0x37,0x60,0xc5,0xac,0x7b,0x66,0xad,0xb7,0xb6,0x72,0x65,0xbd
+,0x4c,0x71,0x6c,0xb9,0x09,0xc9,0x1c,0xc5,0x9f,0x65,0xb9,0xc4,0x1f,0x42,0xc1,0xff
+,0xba,0xe4,0xed,0x61,0x62,0x98,0xb8,0x95,0xca,0xeb,0x54,0xf9,0xaf,0xb8,0xb3,0x26
+,0xe9,0xd5,0x10,0x49,0xc0,0x3c,0xfc,0xf7,0xe7,0x07,0x57,0x6d,0xfc,0xcd,0x36,0x1c
+,0x0e,0xe2,0x5f,0x8c,0xf6,0x43,0xf0,0xe0,0x4b,0x49,0x8c,0xa6,0x11,0x22,0x4e,0x1f
+,0x1f,0xf8,0xbe,0x27,0x0d,0x5b,0x86,0x51,0x4a,0xc4,0x93,0x02,0x18,0xb7,0xec,0x8f
+,0xe3,0x7e,0x77,0xf7,0x48,0x4d,0xd3,0x22,0xa0,0xa1,0xfb,0xca,0x75,0xb2,0x3f,0xd4
+,0xb4,0x28,0xe6,0x2c,0xad,0xca,0x3d,0xd0,0x0c,0xf1,0xc0,0x35,0x4d,0x1b,0xfb,0xff
+,0x27,0x9f,0x1e,0xed,0xef,0x38,0x2d,0x3e,0xfa,0x3e,0xf0,0xa6,0xcf,0x8b,0xfb,0x36
+,0x54,0x55,0x16,0x14,0x85,0x5d,0x40,0xf8,0xde,0x01,0x3b,0x1b,0x60,0x86,0xc3,0x2a
+,0x17,0x76,0x58,0x62,0xad,0xa4,0x71,0x86,0xb8,0xb2,0x20,0x22,0xfa,0x45,0xbe,0x21
+,0x88,0xa1,0x60,0xff,0xfb,0x0b,0x6b,0x12,0x5e,0xa3,0x19,0x58,0x13,0x01,0x6d,0xa9
+,0xc8,0x3d,0x98,0x5c,0x76,0x8a,0x60,0x68,0x8b,0xbc,0xc0,0xef,0x5c,0x04,0xd0,0x18
+,0xad,0x67,0x34,0x59,0x4b,0xe6,0x30,0x68,0x85,0xca,0x7c,0x71,0x37,0x2b,0x1c,0xc1
+,0xd3,0x11,0x05,0x49,0x2b,0x94,0x5f,0xd0,0x91,0xaa,0x33,0xad,0x8d,0x91,0x6d,0x0e
+,0x0b,0xc0,0xb6,0xb5,0xf4,0xc5,0xa2,0xf1,0xad,0xf8,0x76,0x5d,0xa4,0xb8,0x64,0x2c
+,0x08,0x14,0xbe,0xaf,0x2f,0x34,0xec,0x49,0x24,0x60,0x20,0xc7,0xc0,0x61,0x98,0xe8
+,0xc5,0x7d,0xb2,0x48,0x6d,0x2b,0x44,0xda,0x69,0x89,0xd5,0x40,0x94,0xdc,0x40,0x0a
+,0x6d,0xda,0x30,0x98,0x16,0xe7,0xe2,0x84,0x9b,0xb8,0x4a,0x9c,0x8f,0xf3,0x60,0x4c
+,0x0c,0xd2,0x48,0xd7,0xca,0xfe,0xc1,0x55,0x7c,0x70,0xba,0x7f,0xcd,0x62,0xca,0x5e
+,0xc1,0x00,0x95,0x4e,0x26,0xbf,0xd4,0x62,0xfc,0x97,0xa6,0x70,0xc0,0x4e,0xb9,0xec
+,0x1f,0xc6,0x5f,0xb7,0x9f,0xc1,0xb9,0xea,0x44,0x68,0xd1,0xaa,0xc8,0x42,0x10,0xd5
+,0xc0,0x8d,0x58,0x08,0xf0,0xe5,0x97,0x1f,0xe8,0x4f,0x8b,0x91,0x23,0x6d,0x68,0x57
+,0x24,0xaf,0x5c,0x59,0x51,0x9f,0x0d,0x01,0x6a,0xe0,0x3d,0x23,0x19,0xe6,0xa9,0x13
+,0x8c,0xe4,0x23,0xc3,0x44,0x2c,0x33,0x46,0x23,0xb8,0xc7,0x3d,0x6c,0xd3,0xd8,0xc4
+,0x23,0x55,0x72,0x88,0x3a,0x08,0x8f,0x39,0x08,0x47,0xb2,0x65,0x9f,0xd1,0x30,0xc0
+,0x63,0x5f,0xbb,0xa4,0x6c,0xe2,0x08,0xc9,0xf1,0x4d,0x1c,0x46,0xa8,0xf0,0x2d,0xce
+,0x75,0x2b,0xb1,0x4e,0xd3,0x03,0x9b,0xcb,0x96,0x77,0x95,0x8d,0xf3,0xb6,0x92,0x86
+,0xcb,0x36,0xc2,0x7b,0x54,0x71,0xde,0xc0,0x3d,0x27,0x8c,0x11,0x25,0xad,0x3a,0x1d
+,0xc4,0x73,0x85,0x96,0x1c,0x25,0x17,0x18,0xc5,0x3c,0x8c,0x90,0x24,0x5b,0x76,0x49
+,0xce,0x11,0xf5,0x76,0xcc,0x95,0x1d,0x4e,0xcc,0x8f,0x1b,0xac,0x03,0xff,0x31,0x87
+,0xe7,0xda,0x9e,0xe4,0x66,0x36,0x7a,0xc7,0x98,0x0f,0x1a,0x12,0xea,0x73,0xe1,0x8c
+,0x1a,0x35,0xf7,0x82,0x0f,0x9a,0x58,0x0a,0x5b,0x79,0xe5,0x05,0xd7,0x0c,0x26,0xfe
+,0x61,0x6b,0x58,0x94,0x75,0x93,0xa1,0xec,0x1f,0x0b,0x6c,0xa2,0xc2,0x15,0x13,0x01
+,0x8e,0x0e,0x58,0xfb,0x31,0xe7,0xb3,0x86,0x7a,0x6b,0x3f,0x2e,0xe8,0xb7,0x4e,0xf4
+,0xd4,0x43,0xcd,0x3b,0xa8,0x09,0xff,0xde,0xfe,0x35,0xbf,0x34,0xdf,0x1f,0xb6,0x23
+,0xa9,0xbb,0xab,0x47,0x42,0xac,0x79,0xb6,0x2e,0x49,0xc0,0xc1,0x6c,0x90,0xd8,0x48
+,0x9c,0xcc,0xf2,0x72,0x51,0xd7,0xcb,0xef,0x79,0x65,0x25,0x9c,0x42,0xe8,0xb8,0xaa
+,0x17,0x3e,0x9f,0x20,0x78,0x8b,0x09,0xd3,0x94,0x95,0x5e,0x2b,0x88,0xa8,0x57,0x70
+,0x94,0xe0,0xc7,0x88,0x2f,0x69,0x8b,0x91,0x1a,0xfe,0x17,0x02,0xca,0x73,0x6f,0x34
+,0x22,0xb0,0xc6,0xab,0x09,0x28,0xa4,0x5a,0x84,0x98,0x9b,0xc9,0xd2,0x7b,0x17,0x55
+,0xa7,0x2a,0x7f,0x30,0x7f,0xd0,0x65,0x0b,0x88,0x56,0x68,0x76,0x06,0x89,0x97,0x91
+,0x70,0x22,0x14,0x07,0x26,0xee,0xfa,0x5a,0x2a,0x89,0xbe,0x75,0xd4,0x5d,0x31,0x5f
+,0x83,0xb0,0xf0,0x26,0x2b,0x6d,0x6f,0x59,0x01,0xf2,0x86,0xf1,0xbd,0x84,0xb5,0x6f
+,0x22,0x21,0xa1,0xe5,0xb2,0x52,0xf8,0xbd,0xa4,0x30,0x1a,0x52,0xaf,0x37,0xba,0x1b
+,0x74,0xea,0x67,0x12,0x24,0x17,0x5f,0xb6,0xd0,0x04,0x15,0x66,0x97,0xee,0x58,0xf2
+,0x3d,0x46,0x3e,0x86,0xc3,0x77,0x66,0x9b,0x43,0x9f,0xd5,0x45,0x94,0xd5,0xbf,0x92
+,0xf3,0x88,0x7f,0xe4,0x80,0x61,0x22,0x9a,0xdf,0x99,0xa3,0xf3,0x3d,0xfa,0x78,0xed
+,0x7e,0x87,0x9a,0x9f,0xbe,0x00,0x17,0x0c,0xce,0xe1,0xc1,0x69,0xc6,0x35,0x9a,0x17
+,0x4d,0x64,0x73,0x0d,0x0b,0xc6,0x49,0xec,0xda,0xdb,0xa7,0xc2,0xb5,0x85,0xbe,0xe1
+,0xb7,0x56,0x48,0x85,0x35,0xd2,0xbf,0xad,0xe6,0x4a,0xfa,0x81,0xba,0x80,0xcb,0x83
+,0xc6,0x35,0xb7,0xa9,0x75,0xe2,0x98,0x24,0xae,0x56,0x98,0x61,0x02,0x99,0xe9,0x64
+,0x12,0x81,0x2b,0x68,0x4d,0xf7,0xcb,0xc6,0x3b,0x9b,0x4f,0x58,0x88,0xbb,0x7a,0x7f
+,0x51,0x81,0x65,0x25,0x79,0x27,0x89,0x17,0xa0,0x6f,0xbc,0xe5,0xbf,0x07,0xc9,0x3c
+,0xb9,0x21,0xb6,0xbf,0xca,0xb4,0x8c,0x4c,0x18,0x23,0xac,0xba,0xb9,0x62,0xda,0x69
+,0x91,0xfa,0x9c,0x0a,0xc7,0x87,0x1b,0x24,0x38,0xb9,0x25,0x8e,0x49,0x5e,0xc9,0xad
+,0x26,0x61,0x4a,0x4b,0x76,0x59,0x89,0x6e,0x24,0x38,0x14,0x7e,0x27,0x8c,0x4c,0xe5
+,0x51,0xb9,0x13,0x64,0x94,0xf2,0x5a,0xf8,0xd4,0x67,0x88,0xe7,0x0a,0xf6,0xfb,0x1d
+,0xd3,0x54,0x9f,0x82,0xc8,0x29,0x70,0xfc,0x42,0xb2,0x07,0xbe,0xee,0x3c,0x8f,0xbd
+,0x8d,0x3d,0x9f,0xc0,0xe4,0x4c,0xfc,0x23,0xf1,0x81,0x37,0x29,0x67,0x21,0xa0,0x07
+,0xd9,0x0c,0xa7,0x36,0x1e,0x68,0xc6,0xaf,0x95,0x8e,0x9b,0xb5,0x6c,0xb6,0xd6,0xf1
+,0xac,0xd0,0xdc,0x5a,0xcb,0x20,0xdf,0xf7,0xd9,0xdf,0x7f,0x45,0x01,0x49,0x97,0x45
+,0x71,0x2f,0x66,0x8b,0xe0,0x9c,0x4c,0x12,0x90,0x60,0x22,0x8d,0x6a,0xdc,0x68,0x07
+,0xa9,0xe1,0x11,0x89,0xca,0xb1,0x06,0x0a,0x78,0xe5,0x6b,0x71,0xfa,0x02,0x3a,0x85
+,0x0b,0xb8,0xa2,0x3b,0x61,0x68,0x0e,0x7e,0x64,0xb3,0x6d,0xbe,0x92,0xac,0x5e,0x5f
+,0x19,0xb5,0xf0,0x88,0xaf,0xc7,0xf9,0x22,0x65,0xe8,0x20,0x4e,0x82,0xe6,0x2c,0xe7
+,0x2d,0xed,0xba,0x57,0xe7,0x30,0xa1,0x46,0xb7,0x82,0xef,0x71,0x0f,0x97,0xf3,0xbf
+,0xb8,0xe1,0x0a,0x6a,0xc8,0xc9,0xd1,0xde,0xc5,0x99,0xea,0xc2,0x89,0xb3,0xe0,0x89
+,0x43,0x67,0xc2,0xe7,0xd4,0x89,0xc1,0xa2,0xb0,0x16,0x3f,0xd7,0xc0,0x12,0x5e,0x55
+,0xc3,0x54,0x70,0x77,0xf4,0x2e,0xb3,0xb7,0x1b,0xa2,0x80,0xe4,0x2d,0xcb,0x10,0x9e
+,0x96,0x32,0xeb,0x23,0x65,0x5a,0x92,0xad,0x5b,0x1c,0xc9,0x2b,0xd7,0xc6,0x6a,0xa8
+,0x23,0xb3,0x3f,0x99,0xcd,0x47,0xe5,0xbf,0x4e,0x6c,0xb4,0x7c,0x7d,0xe6,0xbf,0x6a
+,0x0e,0x4e,0xc1,0x00,0xfc,0x64,0x1d,0x17,0x89,0x5d,0xb5,0xe5,0x9e,0x7c,0x3d,0xd4
+,0x06,0xf1,0xfe,0x58,0xa9,0x6b,0x29,0x96,0x82,0x89,0x42,0x46,0x6f,0xbc,0xa1,0x6b
+,0xf0,0xf5,0x2b,0xdf,0x87,0x6c,0x38,0x4e,0xf3,0x9a,0x9a,0x45,0x34,0x3c,0xe2,0x6b
+,0x73,0x71,0xb8,0xf7,0x6a,0x73,0x6b,0xcb,0x02,0xc9,0x5c,0xd2,0x61,0x74,0xb3,0x77
+,0xc7,0x19,0x3e,0xc6,0x3e,0x33,0x8b,0x4d,0x2e,0x5e,0x6b,0x4d,0x53,0x7d,0xfc,0x92
+,0xb2,0x26,0x8a,0x70,0xaa,0x6a,0x78,0x83,0x2e,0x79,0x75,0x8c,0x79,0xa3,0x99,0xb9
+,0x9b,0x26,0xf9,0x4f,0xd9,0xf0,0x3a,0x5a,0x68,0xca,0x06,0x57,0x14,0x6f,0xa4,0x54
+,0x44,0x57,0xc4,0x4f,0x88,0xb4,0xfc,0xe5,0x66,0xf0,0x16,0xee,0x89,0xd7,0x0e,0xd8
+,0xd0,0x7c,0x36,0x9b,0x52,0x33,0x1d,0x83,0xa6,0xfd,0x04,0xb2,0x1d,0xb6,0xaa,0x05
+,0xcb,0xdb,0x9b,0x9f,0x7c,0x04,0x87,0x96,0xf8,0xe9,0x63,0x51,0x4a,0x65,0x3a,0x30
+,0xae,0xf6,0x7f,0xba,0x32,0x8a,0xfe,0xc4,0x31,0x5d,0xf4,0x8a,0xc3,0xf2,0xf1,0xcb
+,0xb5,0x9b,0xe4,0x99,0x86,0xf4,0x22,0x87,0x91,0xe4,0x21,0xd2,0x8c,0x82,0x8e,0x8b
+,0xbe,0x5b,0x91,0x90,0xa8,0x3c,0xfc,0xb1,0x06,0xa0,0xcc,0xcc,0x29,0x71,0x12,0x27
+,0x90,0x48,0xa9,0xef,0xcc,0xa8,0x02,0xeb,0xc3,0xba,0xde,0x4e,0xd4,0xb4,0xaa,0x1e
+,0x2e,0xe4,0xd4,0x3c,0x16,0x09,0xd9,0xab,0x82,0xb8,0x56,0xdb,0xc1,0x90,0x4b,0x28
+,0x84,0xe4,0x77,0x86,0x79,0x3b,0x34,0xf8,0xc1,0x1d,0x43,0xad,0xa5,0x0e,0xe1,0x19
+,0xee,0x85,0x0e,0xb1,0x41,0x82,0x5f,0x38,0x8e,0x8a,0xee,0x9b,0xb6,0x4a,0xaf,0xf8
+,0x1d,0x49,0xb2,0x25,0x22,0xe3,0x99,0xe2,0xcc,0x48,0x8a,0x9a,0x93,0xb9,0x30,0x19
+,0x51,0x5b,0xdd,0x53,0x10,0xb8,0xa1,0x61,0x8a,0x0e,0xbb,0x39,0x52,0x8d,0x68,0x58
+,0x9a,0x37,0xc8,0x82,0x08,0x8f,0x5c,0x4c,0x36,0xd8,0x56,0xc2,0x62,0x34,0x32,0xd7
+,0x96,0x05,0xda,0x07,0x1c,0x98,0x04,0xd1,0xc0,0x65,0x3f,0xc9,0x2b,0x37,0x40,0x96
+,0xc0,0xd8,0x23,0xc0,0x07,0x74,0xe0,0x97,0x6c,0xe8,0x3c,0xbd,0xac,0x6b,0xfc,0x51
+,0xf7,0x0c,0x7e,0x5e,0x0b,0x0b,0xc0,0x0f,0xf4,0x12,0xd1,0x61,0xbb,0x78,0xe9,0x05
+,0x3b,0xb6,0x4a,0xa8,0xbe,0x47,0x69,0x0a,0xd0,0x22,0x05,0x1a,0x95,0x85,0xbd,0x20
+,0x0f,0x99,0xcd,0x62,0x0c,0x7e,0x18,0xea,0x62,0xbb,0x8b,0xee,0x75,0x5d,0xa0,0x99
+,0x64,0xab,0xf5,0x78,0x2c,0xb9,0x2d,0xd9,0xa2,0xc1,0xad,0x86,0xd7,0xc2,0xa3,0x2d
+,0x11,0x30,0x87,0xec,0x9a,0x0f,0x09,0x3b,0xbd,0x79,0x10,0x83,0x30,0x91,0xd6,0xa7
+,0x3e,0x19,0x96,0x18,0x88,0xe7,0x7e,0x9c,0xfb,0xdd,0x06,0xb9,0x84,0xd5,0xd8,0x36
+,0x7a,0x01,0x6c,0x2d,0xf8,0x3e,0xab,0x76,0x6e,0x9b,0x8f,0x20,0x68,0xc0,0x56,0x96
+,0x91,0x79,0x4d,0x87,0xf5,0xcb,0xb6,0x52,0x95,0xdd,0x7c,0x3e,0xc8,0xbe,0xb3,0xc1
+,0x16,0xac,0x30,0xa4,0xc5,0x26,0x1b,0x4c,0xc5,0xb6,0x59,0x68,0xc2,0x3c,0x36,0xab
+,0xe2,0xde,0x08,0x52,0x7b,0xea,0x8b,0x07,0x2a,0x99,0x0e,0xdc,0x53,0x9b,0x87,0xcb
+,0xc3,0xa2,0xac,0x71,0x8c,0xdb,0x5a,0xab,0x36,0x29,0xc3,0x62,0x4c,0xf3,0x71,0xa8
+,0xd9,0x75,0xce,0xad,0x39,0xb1,0x4f,0x27,0x69,0x97,0xcd,0xc5,0xd7,0x48,0x1a,0x85
+,0xec,0x25,0x89,0x66,0xad,0x76,0xd5,0xb0,0x8f,0x00,0xe8,0x87,0x02,0x2b,0xf9,0x57
+,0xad,0xbf,0x02,0x38,0x84,0x59,0x0a,0xa9,0x0f,0x93,0x72,0xd8,0x50,0x6c,0x22,0x4d
+,0x29,0x61,0xfd,0x05,0x48,0x34,0x16,0xc4,0x41,0x8b,0x4b,0xc4,0xb3,0x31,0x2f,0x6e
+,0x83,0x8f,0xc9,0x92,0x48,0x07,0xdd,0x8c,0xd6,0x42,0x50,0xfb,0x0d,0xcd,0x40,0xa6
+,0xfe,0x79,0xa8,0x2f,0x51,0x85,0x76,0x28,0x4f,0xeb,0xbd,0xde,0xf0,0xb3,0x31,0x40
+,0x1e,0xbd,0xe9,0xfd,0x60,0xb6,0xe2,0x05,0xb9,0x54,0x98,0x66,0xda,0x05,0x0c,0xe8
+,0xa1,0x10,0xfc,0x5e,0x9e,0xb5,0x40,0x2a,0x92,0x01,0x96,0xb7,0x2a,0x49,0x5b,0xaa
+,0x4e,0x61,0xa3,0x9f,0xcb,0x19,0xa9,0x22,0xdb,0xbd,0xfc,0xc6,0xcd,0x39,0x61,0x92
+,0x89,0x04,0x2e,0xb9,0x5e,0x4d,0x06,0xa6,0x4b,0xe6,0xcd,0xe3,0x0a,0x88,0x75,0xb9
+,0xd2,0x21,0x0d,0x9e,0x11,0xb3,0x8d,0xf5,0xae,0x86,0xf7,0x27,0x0c,0x30,0xde,0x01
+,0x11,0xe2,0xad,0x67,0x04,0x32,0xb1,0x89,0xb4,0x3a,0xc6,0x25,0xe0,0xe4,0xa3,0xa7
+,0x7e,0x4c,0xd2,0x1d,0xf1,0x03,0xd6,0x9e,0xf8,0xe3,0x04,0x77,0x55,0x77,0x63,0x72
+,0x9e,0x9b,0xcb,0x8b,0xe3,0xeb,0x48,0x3c,0x98,0x69,0xf0,0xf1,0xc2,0x46,0xc3,0xf9
+,0x8c,0x45,0x2a,0x80,0xda,0x37,0x1c,0x7d,0xa0,0x0e,0xbd,0x24,0x30,0xc3,0x6d,0x7b
+,0x98,0xde,0x2c,0xc7,0xab,0x21,0x28,0x7a,0x1e,0xa6,0x85,0xa8,0x6f,0xb8,0xcc,0x58
+,0x10,0x1c,0x9c,0xe2,0x25,0x8a,0xcf,0x50,0x5f,0x26,0x27,0x1e,0x16,0x03,0x1e,0xf0
+,0x8e,0xa0,0xc8,0x96,0xea,0x22,0xab,0x47,0xd7,0x07,0x3a,0xcf,0x51,0x67,0x4e,0x1c
+,0x7c,0x0c,0x0d,0xea,0x0e,0xed,0xac,0x5d,0xfb,0x4d,0xf8,0x16,0x89,0x5e,0x95,0x75
+,0x1c,0x43,0xf6,0xc9,0x3d,0x3f,0xeb,0xf5,0x39,0x2d,0x05,0xb0,0x6e,0x23,0xf5,0xac
+,0x65,0xef,0x33,0x9e,0x8f,0x49,0x55,0xcd,0xb7,0xbb,0xdd,0xfb,0xfb,0xfb,0x8e,0xbe
+,0xeb,0xd0,0x59,0x8c,0xbe,0x08,0x5e,0x97,0x4f,0xdf,0xbb,0x29,0x65,0xd7,0xec,0xab
+,0x38,0xf1,0x41,0x96,0x46,0x4d,0xc7,0x8c,0x19,0x2d,0x51,0x9e,0xe2,0xd2,0x6b,0xbd
+,0x2a,0x55,0x68,0x76,0x40,0xd8,0xb6,0x62,0xf3,0x49,0xc4,0x9d,0xfa,0x17,0xfa,0x8f
+,0x15,0xf6,0xfe,0x7d,0x9a,0x73,0xd5,0x51,0x4f,0x61,0x9c,0x3b,0xbf,0xfb,0x27,0x3d
+,0x41,0xb3,0xb6,0xf6,0x03,0xbb,0xe5,0x5f,0xc5,0x1b,0xe7,0xf3,0x05,0x87,0x2e,0x95
+,0xf9,0x01,0x9c,0x70,0x05,0xdf,0x52,0xf8,0xc0,0x5f,0xf5,0xe6,0x0a,0xf5,0x42,0x7c
+,0x81,0x5b,0xb0,0x7b,0xbe,0x6b,0x9d,0x1b,0xae,0xdf,0xab,0xd4,0x48,0x10,0x0f,0x0d
+,0x43,0x9c,0x7a,0x68,0x6e,0x7d,0xf5,0x55,0xdb,0x08,0xb2,0xd8,0x54,0xbd,0xdd,0x73
+,0x81,0x1e,0x4a,0x61,0xd4,0x40,0x3c,0xb3,0x6b,0x4e,0xd2,0x26,0x48,0xca,0xe0,0x83
+,0x5a,0x86,0xb9,0x0c,0x61,0x16,0xc7,0x21,0x86,0x20,0xc3,0x67,0x06,0x30,0x5a,0x6c
+,0xa7,0x2a,0x2a,0xe7,0x8c,0xce,0xe1,0x15,0x32,0x56,0x89,0x37,0x5c,0xe9,0x35,0x5e
+,0xd8,0x8e,0x89,0xb6,0x93,0xc7,0x81,0xd4,0x46,0x82,0x4c,0xa8,0x97,0xa7,0x5b,0x3a
+,0x8b,0x1d,0x9b,0xc3,0xdb,0x25,0xf0,0x74,0xf1,0xed,0xce,0xbd,0x38,0xc7,0xd8,0x54
+,0x50,0x9f,0x73,0x66,0xe5,0x62,0x61,0x67,0x06,0x71,0xd0,0xc2,0x65,0xd7,0x52,0x95
+,0x31,0x1c,0x12,0x27,0x9b,0x56,0xf8,0xa3,0x50,0x63,0x1d,0xc2,0xc8,0xb1,0xbc,0x6b
+,0x33,0xe0,0x3d,0x76,0x73,0x87,0x9d,0xea,0xf0,0xcd,0x95,0x5d,0x10,0x5f,0x1d,0xdb
+,0x19,0x9b,0x91,0x18,0xc4,0x5d,0x52,0x47,0xb1,0x67,0xb4,0xb0,0x2f,0x4d,0x9f,0x69
+,0x24,0x99,0xde,0x83,0xc8,0x2c,0x82,0xed,0x80,0x6b,0x5e,0x7c,0x8a,0xa0,0x19,0xb7
+,0x46,0x9c,0x70,0xac,0xaa,0xa4,0xaa,0x1a,0x7d,0x22,0x42,0xa9,0x72,0x76,0xf5,0xed
+,0x24,0x72,0x04,0xdd,0x82,0xf0,0x12,0x65,0x95,0x42,0xe3,0x8d,0x18,0x12,0xc2,0x7e
+,0xbe,0x28,0x5d,0x06,0x00,0x69,0x23,0x13,0xfd,0x78,0xcd,0xa5,0x8e,0xb7,0x16,0xb5
+,0xf2,0x73,0x71,0x23,0x38,0x7d,0x74,0x84,0xc0,0xbb,0x30,0x10,0x14,0x8f,0x0d,0x29
+,0x88,0xb6,0x45,0x40,0xaf,0xe8,0x82,0xc9,0x03,0x90,0xa4,0x93,0xdd,0x6f,0x0f,0x0e
+,0x8f,0x77,0xdf,0xf6,0x8c,0xab,0xde,0x8e,0x1a,0x0d,0xb8,0x87,0x8a,0xf3,0xc0,0x79
+,0xcb,0x86,0xf1,0xf3,0x11,0x60,0xc7,0x20,0x58,0xf1,0xd0,0x66,0x97,0x4f,0x15,0x7d
+,0x1a,0x72,0xe9,0x8e,0x0d,0x7c,0x15,0xef,0xbf,0x7a,0xba,0x02,0xda,0x96,0x80,0x5e
+,0x0c,0x16,0x31,0xd1,0xa5,0x61,0x0d,0x00,0xd1,0xdf,0x74,0x06,0x86,0x74,0x87,0xd1
+,0x4b,0xff,0x55,0x3b,0x9c,0xeb,0x43,0x99,0xef,0xc4,0xaa,0x6e,0xd8,0x39,0x8f,0x5b
+,0x8f,0x4b,0x22,0xbc,0xf1,0x5d,0x22,0xe1,0x61,0x6c,0x2c,0x0e,0xe3,0xd0,0xe9,0x45
+,0xc6,0x94,0xc8,0x0a,0x6c,0x56,0x0d,0xe6,0x68,0xc5,0x03,0xa0,0x62,0xd3,0x6c,0xce
+,0xe8,0xd0,0x83,0x31,0x9d,0x05,0x63,0xb3,0x3f,0x03,0xfb,0x36,0x7d,0xe0,0x4c,0xc5
+,0x8a,0x05,0xfb,0x6c,0xdc,0x2a,0xf3,0x7c,0xab,0x91,0xab,0x96,0x2e,0xfc,0xc6,0xc8
+,0xd5,0x81,0x39,0x15,0x62,0x78,0x1a,0xec,0x30,0xc1,0xca,0x76,0x07,0xe0,0x35,0xcc
+,0x66,0x8d,0xe3,0xac,0xaa,0xa6,0x69,0x0c,0x62,0x94,0xd0,0x79,0x1d,0x53,0x45,0x41
+,0x93,0x91,0x7a,0x37,0x8f,0x9c,0xc7,0x07,0x74,0xca,0xbc,0xa0,0xff,0x09,0x5b,0x62
+,0x5b,0xad,0xc1,0x26,0x65,0x3e,0xff,0xb7,0x44,0x23,0x09,0x34,0xd2,0x5e,0xef,0x3b
+,0x56,0x79,0xeb,0x9d,0xcd,0x39,0x1f,0xf6,0x94,0xdd,0xeb,0x8e,0x88,0x7f,0x49,0x7d
+,0x56,0x64,0x46,0x83,0x22,0xe6,0x81,0x3a,0x21,0x46,0x65,0xa2,0x08,0xf6,0x5b,0x16
+,0x5f,0x8e,0xc8,0xc9,0xbc,0x06,0xc7,0xa1,0xd9,0x16,0x51,0x9e,0xe1,0x6d,0x4f,0xd9
+,0xef,0xe4,0x54,0x03,0x9b,0x98,0xdb,0x16,0x30,0x0e,0x3e,0xf0,0xd3,0x84,0x45,0x7b
+,0x59,0x86,0xe6,0xcb,0x0d,0x69,0xbd,0x2b,0xd8,0x63,0xd4,0x0e,0x9f,0x27,0x44,0x38
+,0x88,0x08,0x45,0x33,0xb9,0xc1,0xb4,0x71,0x91,0xcc,0xbb,0x56,0x7d,0xe7,0x50,0xf0
+,0xd4,0x23,0x9e,0xee,0x12,0x38,0x46,0x20,0xa8,0xdb,0x35,0xcd,0x30,0x7c,0x75,0xec
+,0x91,0xb8,0xc4,0xaa,0x20,0x0a,0x0f,0xb0,0xaf,0x82,0x0f,0x72,0x6a,0x37,0xce,0x23
+,0x0d,0x31,0x84,0x7b,0x56,0xad,0xf9,0xb4,0x06,0xe2,0x5a,0x97,0xdf,0x74,0xcf,0xa0
+,0x52,0xdb,0x96,0x7a,0xf1,0xf8,0xc2,0x71,0x2d,0x9f,0x06,0x2c,0x8b,0x8e,0xea,0x58
+,0x29,0x2e,0x32,0xed,0x69,0xec,0xf4,0x31,0x42,0xb3,0xfe,0x17,0x47,0x98,0xc6,0xc3
+,0xc1,0xff,0xaa,0x65,0x1d,0x65,0xce,0x45,0x2c,0x51,0x96,0x4a,0xfe,0xee,0x77,0xff
+,0x07,0xfc,0x3a,0xab,0x03,0x1f,0x58,0x01,0x00};
@@ -10,19 +10,36 @@
 
 #include "toys.h"
 
+// Huffman coding uses bits to traverse a binary tree to a leaf node,
+// By placing frequently occurring symbols at shorter paths, frequently
+// used symbols may be represented in fewer bits than uncommon symbols.
+// (length[0] isn't used but code's clearer if it's there.)
+
+// Codes up to HUFF_FAST bits long are decoded with a single table lookup
+#define HUFF_FAST 10
+
+struct huff {
+  unsigned short length[16];  // How many symbols have this bit length?
+  unsigned short symbol[288]; // sorted by bit length, then ascending order
+  unsigned short fast[1<<HUFF_FAST]; // next bits -> symbol<<4|length, or 0
+};
+
 struct deflate {
   // Huffman codes: base offset and extra bits tables (length and distance)
   char lenbits[29], distbits[30];
   unsigned short lenbase[29], distbase[30];
-  void *fixdisthuff, *fixlithuff;
+  struct huff fixdisthuff, fixlithuff, disthuff, lithuff;
 
   // CRC
   void (*crcfunc)(struct deflate *dd, char *data, unsigned len);
-  unsigned crctable[256], crc;
+  unsigned crc;
 
 
   // Tables only used for deflation
-  unsigned short *hashhead, *hashchain;
+  unsigned short *hashhead, *hashchain, *symbols;
+  unsigned char lencode[256], distcode[512];
+  unsigned short good, lazy, nice, chain;
+  char fast;
 
   // Compressed data buffer (extra space malloced at end)
   unsigned pos, len;
@@ -67,42 +84,50 @@ static int bitbuf_skip(struct bitbuf *bb, int bits)
   return pos<len;
 }
 
-// Optimized single bit inlined version
-static inline int bitbuf_bit(struct bitbuf *bb)
+// Make sure at least 8 bytes past bitpos are in the buffer (unless at EOF),
+// moving leftover data to the start of the buffer before reading more.
+// (A gzip stream always ends with an 8 byte trailer, so this won't block
+// waiting for data past the end of a valid stream.)
+static void bitbuf_fill(struct bitbuf *bb)
 {
-  int bufpos = bb->bitpos>>3;
-
-  if (bufpos == bb->len) {
-    bitbuf_skip(bb, -1);
-    bufpos = 0;
+  int pos = bb->bitpos>>3, len;
+
+  if (bb->fd == -1 || bb->len-pos >= 8) return;
+  memmove(bb->buf, bb->buf+pos, bb->len -= pos);
+  bb->bitpos &= 7;
+  while (bb->len<8) {
+    if (1>(len = read(bb->fd, bb->buf+bb->len, bb->max-bb->len))) break;
+    bb->len += len;
   }
+}
+
+// Return the next X (up to 32) bits from the bitbuf without consuming them,
+// little endian. Bits past EOF read as zero.
+static inline unsigned bitbuf_peek(struct bitbuf *bb, int bits)
+{
+  unsigned long long ll = 0;
+  int pos, len;
 
-  return (bb->buf[bufpos]>>(bb->bitpos++&7))&1;
+  bitbuf_fill(bb);
+  pos = bb->bitpos>>3;
+  if ((len = bb->len-pos)>=8) memcpy(&ll, bb->buf+pos, 8);
+  else if (len>0) memcpy(&ll, bb->buf+pos, len);
+
+  return (SWAP_LE64(ll)>>(bb->bitpos&7))&((1ULL<<bits)-1);
+}
+
+// Consume bits already examined with bitbuf_peek()
+static inline void bitbuf_eat(struct bitbuf *bb, int bits)
+{
+  if ((bb->bitpos += bits) > bb->len<<3) error_exit("inflate EOF");
 }
 
 // Fetch the next X bits from the bitbuf, little endian
 static unsigned bitbuf_get(struct bitbuf *bb, int bits)
 {
-  int result = 0, offset = 0;
+  unsigned result = bitbuf_peek(bb, bits);
 
-  while (bits) {
-    int click = bb->bitpos >> 3, blow, blen;
-
-    // Load more data if buffer empty
-    if (click == bb->len) {
-      bitbuf_skip(bb, -1);
-      click = 0;
-    }
-
-    // grab bits from next byte
-    blow = bb->bitpos & 7;
-    blen = 8-blow;
-    if (blen > bits) blen = bits;
-    result |= ((bb->buf[click] >> blow) & ((1<<blen)-1)) << offset;
-    offset += blen;
-    bits -= blen;
-    bb->bitpos += blen;
-  }
+  bitbuf_eat(bb, bits);
 
   return result;
 }
@@ -150,7 +175,7 @@ static void inflate_out(struct deflate *dd, int len)
   if (dd->crcfunc) dd->crcfunc(dd, dd->data, len);
 }
 
-static void output_byte(struct deflate *dd, char sym)
+static inline void output_byte(struct deflate *dd, char sym)
 {
   int pos = dd->pos++ & 32767;
 
@@ -158,16 +183,6 @@ static void output_byte(struct deflate *dd, char sym)
   if (pos == 32767) inflate_out(dd, 32768);
 }
 
-// Huffman coding uses bits to traverse a binary tree to a leaf node,
-// By placing frequently occurring symbols at shorter paths, frequently
-// used symbols may be represented in fewer bits than uncommon symbols.
-// (length[0] isn't used but code's clearer if it's there.)
-
-struct huff {
-  unsigned short length[16];  // How many symbols have this bit length?
-  unsigned short symbol[288]; // sorted by bit length, then ascending order
-};
-
 // Create simple huffman tree from array of bit lengths.
 
 // The symbols in the huffman trees are sorted (first by bit length
@@ -176,7 +191,7 @@ struct huff {
 static void len2huff(struct huff *huff, char bitlen[], int len)
 {
   int offset[16];
-  int i;
+  int i, j, n, code, rev, sym;
 
   // Count number of codes at each bit length
   memset(huff, 0, sizeof(struct huff));
@@ -187,26 +202,45 @@ static void len2huff(struct huff *huff, char bitlen[], int len)
   *huff->length = *offset = 0;
   for (i = 1; i<16; i++) offset[i] = offset[i-1] + huff->length[i-1];
   for (i = 0; i<len; i++) if (bitlen[i]) huff->symbol[offset[bitlen[i]]++] = i;
+
+  // Fill in lookup table for short codes. Codes are stored most significant
+  // bit first so table index is code reversed, repeated for each value of
+  // the unused high bits.
+  for (i = 1, code = sym = 0; i<=HUFF_FAST; i++, code <<= 1) {
+    for (j = 0; j<huff->length[i]; j++, code++, sym++) {
+      for (n = rev = 0; n<i; n++) rev |= ((code>>n)&1)<<(i-n-1);
+      for (; rev < 1<<HUFF_FAST; rev += 1<<i)
+        huff->fast[rev] = (huff->symbol[sym]<<4)|i;
+    }
+  }
 }
 
 // Fetch and decode next huffman coded symbol from bitbuf.
-// This takes advantage of the sorting to navigate the tree as an array:
-// each time we fetch a bit we have all the codes at that bit level in
-// order with no gaps.
+// Short codes come straight out of the lookup table, longer ones take
+// advantage of the sorting to navigate the tree as an array: each time we
+// look at another bit we have all the codes at that bit level in order
+// with no gaps.
 static unsigned huff_and_puff(struct bitbuf *bb, struct huff *huff)
 {
   unsigned short *length = huff->length;
-  int start = 0, offset = 0;
+  unsigned bits = bitbuf_peek(bb, 15), sym = huff->fast[bits&((1<<HUFF_FAST)-1)];
+  int start = 0, offset = 0, len = sym&15;
 
   // Traverse through the bit lengths until our code is in this range
-  for (;;) {
-    offset = (offset << 1) | bitbuf_bit(bb);
-    start += *++length;
-    if ((offset -= *length) < 0) break;
-    if ((length - huff->length) & 16) error_exit("bad symbol");
+  if (!len) {
+    for (;;) {
+      offset = (offset << 1) | (bits&1);
+      bits >>= 1;
+      start += *++length;
+      if ((offset -= *length) < 0) break;
+      if ((length - huff->length) & 16) error_exit("bad symbol");
+    }
+    sym = huff->symbol[start+offset]<<4;
+    len = length - huff->length;
   }
+  bitbuf_eat(bb, len);
 
-  return huff->symbol[start + offset];
+  return sym>>4;
 }
 
 // Decompress deflated data from bitbuf to dd->outfd.
@@ -217,6 +251,9 @@ static void inflate(struct deflate *dd, struct bitbuf *bb)
   // repeat until spanked
   for (;;) {
     int final, type;
+    // bit lengths (with bits[-1] and room for a repeat to overshoot), not in
+    // libbuf so inflate can run in a thread
+    char lens[1+288+32+138];
 
     final = bitbuf_get(bb, 1);
     type = bitbuf_get(bb, 2);
@@ -252,7 +289,7 @@ static void inflate(struct deflate *dd, struct bitbuf *bb)
 
       // Dynamic huffman codes?
       if (type == 2) {
-        struct huff *h2 = ((struct huff *)libbuf)+1;
+        struct huff *h2 = &dd->lithuff;
         int i, litlen, distlen, hufflen;
         char *hufflen_order = "\x10\x11\x12\0\x08\x07\x09\x06\x0a\x05\x0b"
                               "\x04\x0c\x03\x0d\x02\x0e\x01\x0f", *bits;
@@ -266,7 +303,7 @@ static void inflate(struct deflate *dd, struct bitbuf *bb)
         // a complicated way: an array of bit lengths (hufflen many
         // entries, each 3 bits) is used to fill out an array of 19 entries
         // in a magic order, leaving the rest 0. Then make a tree out of it:
-        memset(bits = libbuf+1, 0, 19);
+        memset(bits = lens+1, 0, 19);
         for (i=0; i<hufflen; i++) bits[hufflen_order[i]] = bitbuf_get(bb, 3);
         len2huff(h2, bits, 19);
 
@@ -288,12 +325,12 @@ static void inflate(struct deflate *dd, struct bitbuf *bb)
         if (i > litlen+distlen) error_exit("bad tree");
 
         len2huff(lithuff = h2, bits, litlen);
-        len2huff(disthuff = ((struct huff *)libbuf)+2, bits+litlen, distlen);
+        len2huff(disthuff = &dd->disthuff, bits+litlen, distlen);
 
       // Static huffman codes
       } else {
-        lithuff = dd->fixlithuff;
-        disthuff = dd->fixdisthuff;
+        lithuff = &dd->fixlithuff;
+        disthuff = &dd->fixdisthuff;
       }
 
       // Use huffman tables to decode block of compressed symbols
@@ -311,9 +348,19 @@ static void inflate(struct deflate *dd, struct bitbuf *bb)
           len = dd->lenbase[sym] + bitbuf_get(bb, dd->lenbits[sym]);
           sym = huff_and_puff(bb, disthuff);
           dist = dd->distbase[sym] + bitbuf_get(bb, dd->distbits[sym]);
-          sym = dd->pos & 32767;
 
-          while (len--) output_byte(dd, dd->data[(dd->pos-dist) & 32767]);
+          // Copy in chunks that don't wrap either end of the ring buffer,
+          // bytewise if source and destination overlap.
+          while (len) {
+            int from = (dd->pos-dist)&32767, to = dd->pos&32767, n = len;
+
+            if (n > 32768-to) n = 32768-to;
+            if (n > 32768-from) n = 32768-from;
+            if (dist >= n) memcpy(dd->data+to, dd->data+from, n);
+            else for (sym = 0; sym<n; sym++) dd->data[to+sym] = dd->data[from+sym];
+            len -= n;
+            if (!((dd->pos += n)&32767)) inflate_out(dd, 32768);
+          }
 
         // End of block
         } else break;
@@ -327,42 +374,347 @@ static void inflate(struct deflate *dd, struct bitbuf *bb)
   if (dd->pos & 32767) inflate_out(dd, dd->pos&32767);
 }
 
+static int cmp_unsigned(const void *a, const void *b)
+{
+  unsigned aa = *(unsigned *)a, bb = *(unsigned *)b;
+
+  return (aa>bb)-(aa<bb);
+}
+
+// Calculate huffman code lengths for symbols with nonzero freq[], limited to
+// max bits. Uses Moffat and Katajainen's in-place minimum redundancy algorithm
+// then moves overlong codes up the tree, rebalancing to keep the code complete.
+static void freq2len(unsigned *freq, char *bitlen, int count, int max)
+{
+  unsigned sorted[288], a[288], num[16], i, j, n = 0, total, root, leaf;
+  int avail = 1, used = 0, depth = 0;
+
+  // Pack frequency above symbol so sorting groups by frequency. (A complete
+  // code needs at least 2 symbols, so pad with unused ones if necessary.)
+  memset(bitlen, 0, count);
+  for (i = 0; i<count; i++) if (freq[i]) sorted[n++] = (freq[i]<<9)+i;
+  for (i = 0; n<2; i++) if (!freq[i]) sorted[n++] = i;
+  qsort(sorted, n, sizeof(unsigned), cmp_unsigned);
+  for (i = 0; i<n; i++) a[i] = sorted[i]>>9;
+
+  // Combine two lightest nodes until one is left, a[] holds parent pointers
+  a[0] += a[1];
+  for (root = 0, leaf = 2, i = 1; i<n-1; i++) {
+    if (leaf>=n || a[root]<a[leaf]) {
+      a[i] = a[root];
+      a[root++] = i;
+    } else a[i] = a[leaf++];
+    if (leaf>=n || (root<i && a[root]<a[leaf])) {
+      a[i] += a[root];
+      a[root++] = i;
+    } else a[i] += a[leaf++];
+  }
+
+  // Convert parent pointers to internal node depths, then count leaves at
+  // each depth (clamped to max)
+  a[n-2] = 0;
+  for (i = n-2; i--;) a[i] = a[a[i]]+1;
+  memset(num, 0, sizeof(num));
+  for (root = n-2; avail>0; depth++) {
+    for (used = 0; root<n && a[root]==depth; root--) used++;
+    for (; avail>used; avail--) num[depth>max ? max : depth]++;
+    avail = 2*used;
+  }
+
+  // Shorten codes exceeding max by splitting leaves from shorter lengths
+  for (total = 0, i = 1; i<=max; i++) total += num[i]<<(max-i);
+  for (; total > 1<<max; total--) {
+    num[max]--;
+    for (i = max-1; i; i--) if (num[i]) {
+      num[i]--;
+      num[i+1] += 2;
+      break;
+    }
+  }
+
+  // Least frequent symbols get longest codes
+  for (i = max, j = 0; i; i--) while (num[i]--) bitlen[sorted[j++]&511] = i;
+}
+
+// Convert bit lengths to bit-reversed canonical huffman codes for bitbuf_put()
+static void len2code(char *bitlen, unsigned short *code, int count)
+{
+  unsigned short num[16], next[16];
+  int i, j, c;
+
+  memset(num, 0, sizeof(num));
+  for (i = 0; i<count; i++) num[bitlen[i]]++;
+  for (*num = c = 0, i = 1; i<16; i++) next[i] = c = (c+num[i-1])<<1;
+  for (i = 0; i<count; i++) {
+    if (!bitlen[i]) continue;
+    for (c = next[bitlen[i]]++, j = bitlen[i], code[i] = 0; j--; c >>= 1)
+      code[i] = (code[i]<<1)|(c&1);
+  }
+}
+
+// Run length encode bit lengths to code length alphabet (RFC 1951 3.2.7),
+// low 5 bits are symbol, rest are extra bit value. Returns number of entries.
+static int rle_lens(char *bits, int count, unsigned short *out)
+{
+  int i, j, run, len, n = 0;
+
+  for (i = 0; i<count; i = j) {
+    for (j = i+1; j<count && bits[j]==bits[i]; j++);
+    run = j-i;
+    if (!bits[i]) for (; run>2; run -= len) {
+      len = run>138 ? 138 : run;
+      out[n++] = len>10 ? 18+((len-11)<<5) : 17+((len-3)<<5);
+    } else {
+      out[n++] = bits[i];
+      for (run--; run>2; run -= len)
+        out[n++] = 16+(((len = run>6 ? 6 : run)-3)<<5);
+    }
+    while (run-- > 0) out[n++] = bits[i];
+  }
+
+  return n;
+}
+
+// Output one block of collected symbols, picking cheapest of dynamic huffman,
+// fixed huffman, or stored encoding. Raw data needed to output stored block.
+static void deflate_block(struct deflate *dd, struct bitbuf *bb, unsigned nsym,
+  char *raw, unsigned rawlen, int final)
+{
+  unsigned short *sym = dd->symbols, litcode[288], distcode[30], rle[320],
+    clcode[19];
+  unsigned litfreq[288], distfreq[30], clfreq[19], i, j, dyn, fix, hlit,
+    hdist, hclen, nrle;
+  char *order = "\x10\x11\x12\0\x08\x07\x09\x06\x0a\x05\x0b\x04\x0c\x03\x0d"
+    "\x02\x0e\x01\x0f", *extra = "\2\3\7", bits[288+30], fixbits[288+30],
+    clbits[19], *litbits, *distbits;
+
+  // Count symbol frequencies
+  memset(litfreq, 0, sizeof(litfreq));
+  memset(distfreq, 0, sizeof(distfreq));
+  memset(clfreq, 0, sizeof(clfreq));
+  for (i = 0; i<nsym; i++) {
+    if (!sym[2*i]) litfreq[sym[2*i+1]]++;
+    else {
+      litfreq[257+dd->lencode[sym[2*i+1]-3]]++;
+      j = sym[2*i]-1;
+      distfreq[dd->distcode[j<256 ? j : 256+(j>>7)]]++;
+    }
+  }
+  litfreq[256]++;
+
+  // Build dynamic tables, then run length encode them and build a table for
+  // that too
+  freq2len(litfreq, bits, 286, 15);
+  for (hlit = 286; !bits[hlit-1]; hlit--);
+  freq2len(distfreq, bits+hlit, 30, 15);
+  for (hdist = 30; !bits[hlit+hdist-1]; hdist--);
+  nrle = rle_lens(bits, hlit+hdist, rle);
+  for (i = 0; i<nrle; i++) clfreq[rle[i]&31]++;
+  freq2len(clfreq, clbits, 19, 7);
+  for (hclen = 19; hclen>4 && !clbits[(int)order[hclen-1]]; hclen--);
+
+  // Calculate sizes of dynamic and fixed encodings in bits
+  for (i = 0; i<288; i++) fixbits[i] = 8 + (i>143) - ((i>255)<<1) + (i>279);
+  memset(fixbits+288, 5, 30);
+  dyn = 14+3*hclen;
+  for (i = 0; i<nrle; i++) {
+    dyn += clbits[j = rle[i]&31];
+    if (j>15) dyn += extra[j-16];
+  }
+  for (fix = i = 0; i<286; i++) {
+    j = i>256 ? dd->lenbits[i-257] : 0;
+    dyn += litfreq[i]*(bits[i]+j);
+    fix += litfreq[i]*(fixbits[i]+j);
+  }
+  for (i = 0; i<30; i++) {
+    dyn += distfreq[i]*(bits[hlit+i]+dd->distbits[i]);
+    fix += distfreq[i]*(5+dd->distbits[i]);
+  }
+
+  // Is a stored block (byte aligned, 4 byte header per 64k) cheaper?
+  if ((fix<dyn ? fix : dyn) >= 32*(rawlen/65535+1)+8*rawlen+7) {
+    do {
+      j = rawlen>65535 ? 65535 : rawlen;
+      bitbuf_put(bb, final && j==rawlen, 1);
+      bitbuf_put(bb, 0, 2);
+      bitbuf_put(bb, 0, (8-bb->bitpos)&7);
+      bitbuf_put(bb, j, 16);
+      bitbuf_put(bb, 0xffff&~j, 16);
+      for (i = 0; i<j; i++) bitbuf_put(bb, *raw++, 8);
+    } while (rawlen -= j);
+
+    return;
+  }
+
+  bitbuf_put(bb, final, 1);
+  if (fix<=dyn) {
+    bitbuf_put(bb, 1, 2);
+    hlit = 288;
+    litbits = fixbits;
+    distbits = fixbits+288;
+  } else {
+    bitbuf_put(bb, 2, 2);
+    bitbuf_put(bb, hlit-257, 5);
+    bitbuf_put(bb, hdist-1, 5);
+    bitbuf_put(bb, hclen-4, 4);
+    for (i = 0; i<hclen; i++) bitbuf_put(bb, clbits[(int)order[i]], 3);
+    len2code(clbits, clcode, 19);
+    for (i = 0; i<nrle; i++) {
+      j = rle[i]&31;
+      bitbuf_put(bb, clcode[j], clbits[j]);
+      if (j>15) bitbuf_put(bb, rle[i]>>5, extra[j-16]);
+    }
+    litbits = bits;
+    distbits = bits+hlit;
+  }
+  len2code(litbits, litcode, hlit);
+  len2code(distbits, distcode, 30);
+
+  // Output symbols
+  for (i = 0; i<nsym; i++, sym += 2) {
+    if (!*sym) bitbuf_put(bb, litcode[sym[1]], litbits[sym[1]]);
+    else {
+      j = dd->lencode[sym[1]-3];
+      bitbuf_put(bb, litcode[257+j], litbits[257+j]);
+      bitbuf_put(bb, sym[1]-dd->lenbase[j], dd->lenbits[j]);
+      j = *sym-1;
+      j = dd->distcode[j<256 ? j : 256+(j>>7)];
+      bitbuf_put(bb, distcode[j], distbits[j]);
+      bitbuf_put(bb, *sym-dd->distbase[j], dd->distbits[j]);
+    }
+  }
+  bitbuf_put(bb, litcode[256], litbits[256]);
+}
+
+// Hash the 3 bytes at pos into the hash chains, returning previous position
+// with the same hash (or 0 for none).
+static unsigned deflate_hash(struct deflate *dd, unsigned pos)
+{
+  unsigned char *s = (void *)(dd->data+pos);
+  unsigned h = ((*s<<10)^(s[1]<<5)^s[2])&32767, prev = dd->hashhead[h];
+
+  dd->hashchain[pos&32767] = prev;
+  dd->hashhead[h] = pos;
+
+  return prev;
+}
+
+// Walk the hash chain from match looking for something longer than best
+// (but at most max bytes) matching data at pos. Returns length, sets *dist.
+static unsigned deflate_match(struct deflate *dd, unsigned pos, unsigned match,
+  unsigned max, unsigned best, unsigned *dist)
+{
+  char *s = dd->data+pos, *m;
+  unsigned chain = dd->chain, limit = pos>32768 ? pos-32768 : 0, len;
+
+  if (max>258) max = 258;
+  if (best>=max) return best;
+  if (best>=dd->good) chain >>= 2;
+  for (; match>limit && chain--; match = dd->hashchain[match&32767]) {
+    // Check the byte that would make this longer than best first
+    m = dd->data+match;
+    if (m[best]!=s[best] || *m!=*s || m[1]!=s[1]) continue;
+    for (len = 2; len<max && m[len]==s[len]; len++);
+    if (len>best) {
+      *dist = pos-match;
+      if ((best = len)>=dd->nice || len==max) break;
+    }
+  }
+
+  return best;
+}
+
 // Deflate from dd->infd to bitbuf
-// For deflate, dd->len = input read, dd->pos = input consumed
+// LZ77 with lazy matching (check whether next byte starts a longer match
+// before committing to this one) finding matches through hash chains.
+// The 64k buffer holds 32k of history and up to 32k lookahead: when the
+// lookahead runs low, flush the block, slide the top half down and read more.
 static void deflate(struct deflate *dd, struct bitbuf *bb)
 {
   char *data = dd->data;
-  int len, final = 0;
+  unsigned short *sym = dd->symbols;
+  unsigned pos = 0, end = 0, start = 0, nsym = 0, len = 2, dist = 0, prevlen,
+    prevdist, match, wait = 0, i;
+  int eof = 0, rd;
 
   dd->crc = ~0;
+  memset(dd->hashhead, 0, 65536);
 
-  while (!final) {
-    // Read next half-window of data if we haven't hit EOF yet.
-    len = readall(dd->infd, data+(dd->len&32768), 32768);
-    if (len < 0) perror_exit("read"); // TODO: add filename
-    if (len != 32768) final++;
-    if (dd->crcfunc) dd->crcfunc(dd, data+(dd->len&32768), len);
-    // dd->len += len;  crcfunc advances len TODO
-
-    // store block as literal
-// TODO: actually compress!
-    bitbuf_put(bb, final, 1);
-    bitbuf_put(bb, 0, 1);
-
-    bitbuf_put(bb, 0, (8-bb->bitpos)&7);
-    bitbuf_put(bb, len, 16);
-    bitbuf_put(bb, 0xffff & ~len, 16);
-
-    // repeat until spanked
-    while (dd->pos != dd->len) {
-      unsigned pos = dd->pos&65535;
+  for (;;) {
+    // Top up lookahead, sliding window down if buffer full
+    if (!eof && end-pos<262) {
+      if (end == 65536) {
+        if (nsym) deflate_block(dd, bb, nsym, data+start, pos-wait-start, 0);
+        nsym = 0;
+        start = pos-wait-32768;
+        pos -= 32768;
+        end -= 32768;
+        memmove(data, data+32768, 32768);
+        // adjust hashhead and hashchain
+        for (i = 0; i<65536; i++)
+          dd->hashhead[i] = dd->hashhead[i]>32768 ? dd->hashhead[i]-32768 : 0;
+      }
+      if (0>(rd = readall(dd->infd, data+end, 65536-end))) perror_exit("read");
+      if (dd->crcfunc) dd->crcfunc(dd, data+end, rd);
+      if ((end += rd) != 65536) eof++;
+    }
+    if (pos == end) break;
+
+    match = (end-pos>2) ? deflate_hash(dd, pos) : 0;
+
+    // Fast levels take the first match found, and only index short matches
+    if (dd->fast) {
+      len = match ? deflate_match(dd, pos, match, end-pos, 2, &dist) : 2;
+      if (len>2) {
+        sym[2*nsym] = dist;
+        sym[2*nsym++ +1] = len;
+        for (i = pos+1, pos += len; len<=dd->lazy && i<pos; i++)
+          if (end-i>2) deflate_hash(dd, i);
+      } else {
+        sym[2*nsym] = 0;
+        sym[2*nsym++ +1] = (unsigned char)data[pos++];
+      }
+      len = 2;
 
-      bitbuf_put(bb, data[pos], 8);
+    // Otherwise look for a match here unless the previous one's long enough.
+    } else {
+      prevlen = len;
+      prevdist = dist;
+      len = 2;
+      if (match && prevlen<dd->lazy) {
+        len = deflate_match(dd, pos, match, end-pos, prevlen, &dist);
+        if (len == 3 && dist>4096) len = 2;
+      }
 
-      // need to refill buffer?
-      if (!(32767 & ++dd->pos) && !final) break;
+      // Output previous match if current one isn't better, else output
+      // previous byte as a literal (if not already covered by a match).
+      if (prevlen>2 && len<=prevlen) {
+        sym[2*nsym] = prevdist;
+        sym[2*nsym++ +1] = prevlen;
+        for (i = pos+1, pos += prevlen-1; i<pos; i++)
+          if (end-i>2) deflate_hash(dd, i);
+        wait = 0;
+        len = 2;
+      } else {
+        if (wait) {
+          sym[2*nsym] = 0;
+          sym[2*nsym++ +1] = (unsigned char)data[pos-1];
+        }
+        wait = 1;
+        pos++;
+      }
+    }
+    if (nsym == 16384) {
+      deflate_block(dd, bb, nsym, data+start, pos-wait-start, 0);
+      start = pos-wait;
+      nsym = 0;
     }
   }
+  if (wait) {
+    sym[2*nsym] = 0;
+    sym[2*nsym++ +1] = (unsigned char)data[pos-1];
+  }
+  deflate_block(dd, bb, nsym, data+start, pos-start, 1);
   bitbuf_flush(bb);
 }
 
@@ -370,13 +722,17 @@ static void deflate(struct deflate *dd, struct bitbuf *bb)
 static struct deflate *init_deflate(int compress)
 {
   int i, n = 1;
-  struct deflate *dd = xmalloc(sizeof(struct deflate)+32768*(compress ? 4 : 1));
+  struct deflate *dd = xmalloc(sizeof(struct deflate)+32768*(compress ? 8 : 1));
+  char bits[288];
 
   memset(dd, 0, sizeof(struct deflate));
-  // decompress needs 32k history, compress adds 64k hashhead and 32k hashchain
+  // decompress needs 32k history, compress has 64k window, 32k entry hashhead
+  // and hashchain (adjacent so window slide can adjust both in one pass),
+  // and 16k symbol pairs.
   if (compress) {
     dd->hashhead = (unsigned short *)(dd->data+65536);
-    dd->hashchain = (unsigned short *)(dd->data+65536+32768);
+    dd->hashchain = dd->hashhead+32768;
+    dd->symbols = dd->hashchain+32768;
   }
 
   // Calculate lenbits, lenbase, distbits, distbase
@@ -400,12 +756,24 @@ static struct deflate *init_deflate(int compress)
     dd->distbits[i] = n;
   }
 
-// TODO layout and lifetime of this?
+  // Reverse lookup from match length and distance to code (distances past
+  // 256 looked up by 128 byte chunk, see deflate_block())
+  if (compress) {
+    for (i = 0; i<29; i++)
+      for (n = 0; n<1<<dd->lenbits[i] && dd->lenbase[i]+n<259; n++)
+        dd->lencode[dd->lenbase[i]+n-3] = i;
+    for (i = 0; i<30; i++) for (n = 0; n<1<<dd->distbits[i]; n++) {
+      int j = dd->distbase[i]+n-1;
+
+      dd->distcode[j<256 ? j : 256+(j>>7)] = i;
+    }
+  }
+
   // Init fixed huffman tables
-  for (i=0; i<288; i++) libbuf[i] = 8 + (i>143) - ((i>255)<<1) + (i>279);
-  len2huff(dd->fixlithuff = ((struct huff *)libbuf)+3, libbuf, 288);
-  memset(libbuf, 5, 30);
-  len2huff(dd->fixdisthuff = ((struct huff *)libbuf)+4, libbuf, 30);
+  for (i=0; i<288; i++) bits[i] = 8 + (i>143) - ((i>255)<<1) + (i>279);
+  len2huff(&dd->fixlithuff, bits, 288);
+  memset(bits, 5, 30);
+  len2huff(&dd->fixdisthuff, bits, 30);
 
   return dd;
 }
@@ -431,12 +799,7 @@ static int is_gzip(struct bitbuf *bb)
 
 static void gzip_crc(struct deflate *dd, char *data, unsigned len)
 {
-  int i;
-  unsigned crc, *crc_table = dd->crctable;
-
-  crc = dd->crc;
-  for (i = 0; i<len; i++) crc = crc_table[(crc^data[i])&0xff] ^ (crc>>8);
-  dd->crc = crc;
+  dd->crc = crc32_update(dd->crc, data, len, 1);
   dd->len += len;
 }
 
@@ -456,22 +819,32 @@ unsigned adler32(char *buf, unsigned len, unsigned crc)
 }
 */
 
-long long gzip_fd(int infd, int outfd)
+// Compress infd to outfd at level 1-9 (fastest to smallest)
+long long gzip_fd(int infd, int outfd, int level)
 {
   struct bitbuf *bb = bitbuf_init(outfd, 4096);
   struct deflate *dd = init_deflate(1);
   long long rc;
+  char header[] = "\x1f\x8b\x08\0\0\0\0\0\0\xff";
+  // good, lazy, nice, chain length for each level (same tuning as zlib)
+  unsigned short tune[][4] = {{4, 4, 8, 4}, {4, 5, 16, 8}, {4, 6, 32, 32},
+    {4, 4, 16, 16}, {8, 16, 32, 32}, {8, 16, 128, 128}, {8, 32, 128, 256},
+    {32, 128, 258, 1024}, {32, 258, 258, 4096}};
+
+  if (level<1) level = 1;
+  if (level>9) level = 9;
+  memcpy(&dd->good, tune[level-1], sizeof(*tune));
+  dd->fast = level<4;
 
   // Header from RFC 1952 section 2.2:
   // 2 ID bytes (1F, 8b), gzip method byte (8=deflate), FLAG byte (none),
-  // 4 byte MTIME (zeroed), Extra Flags (2=maximum compression),
+  // 4 byte MTIME (zeroed), Extra Flags (2=maximum compression, 4=fastest),
   // Operating System (FF=unknown)
 
   dd->infd = infd;
-  xwrite(bb->fd, "\x1f\x8b\x08\0\0\0\0\0\x02\xff", 10);
+  header[8] = 2*(level==9)+4*(level==1);
+  xwrite(bb->fd, header, 10);
 
-  // Little endian crc table
-  crc_init(dd->crctable, 1);
   dd->crcfunc = gzip_crc;
 
   deflate(dd, bb);
@@ -494,8 +867,6 @@ long long gunzip_common(struct bitbuf *bb, struct deflate *dd)
 {
   long long rc = 0;
 
-  // Little endian crc table
-  crc_init(dd->crctable, 1);
   dd->crcfunc = gzip_crc;
 
   do {
@@ -24,11 +24,15 @@ int dirtree_notdotdot(struct dirtree *catch)
 // Create a dirtree node from a path, with stat and symlink info.
 // (This doesn't open directory filehandles yet so as not to exhaust the
 // filehandle space on large trees, dirtree_handle_callback() does that.)
+// With DIRTREE_LAZYSTAT and a known d_type only st_mode is filled in
+// (and symlink isn't read), call dirtree_stat() for the rest.
 
-struct dirtree *dirtree_add_node(struct dirtree *parent, char *name, int flags)
+static struct dirtree *dirtree_node(struct dirtree *parent, char *name,
+  int flags, int type)
 {
   struct dirtree *dt = 0;
   struct stat st;
+  char buf[4096];
   int len = 0, linklen = 0, statless = 0;
 
   if (name) {
@@ -36,8 +40,12 @@ struct dirtree *dirtree_add_node(struct dirtree *parent, char *name, int flags)
     int fd = parent ? parent->dirfd : AT_FDCWD,
       sym = AT_SYMLINK_NOFOLLOW*!(flags&DIRTREE_SYMFOLLOW);
 
+    // Following a symlink means we need stat to know what it points to
+    if ((flags&DIRTREE_LAZYSTAT) && type!=DT_UNKNOWN && (type!=DT_LNK || sym))
+      statless = -1;
+
     // stat dangling symlinks
-    if (fstatat(fd, name, &st, sym)) {
+    else if (fstatat(fd, name, &st, sym)) {
       // If we got ENOENT without NOFOLLOW, try again with NOFOLLOW.
       if (errno!=ENOENT || sym || fstatat(fd, name, &st, AT_SYMLINK_NOFOLLOW)) {
         if (flags&DIRTREE_STATLESS) statless++;
@@ -45,8 +53,8 @@ struct dirtree *dirtree_add_node(struct dirtree *parent, char *name, int flags)
       }
     }
     if (!statless && S_ISLNK(st.st_mode)) {
-      if (0>(linklen = readlinkat(fd, name, libbuf, 4095))) goto error;
-      libbuf[linklen++]=0;
+      if (0>(linklen = readlinkat(fd, name, buf, 4095))) goto error;
+      buf[linklen++]=0;
     }
     len = strlen(name);
   }
@@ -55,11 +63,13 @@ struct dirtree *dirtree_add_node(struct dirtree *parent, char *name, int flags)
   dt = xmalloc((len = sizeof(struct dirtree)+len+1)+linklen);
   memset(dt, 0, sizeof(struct dirtree));
   dt->parent = parent;
-  if (statless) dt->again = DIRTREE_STATLESS;
-  else memcpy(&dt->st, &st, sizeof(struct stat));
+  if (statless) {
+    if (statless>0) dt->again = DIRTREE_STATLESS;
+    dt->st.st_mode = type<<12;
+  } else memcpy(&dt->st, &st, sizeof(struct stat));
   if (name) strcpy(dt->name, name);
   else *dt->name = 0, dt->st.st_mode = S_IFDIR;
-  if (linklen) dt->symlink = memcpy(len+(char *)dt, libbuf, linklen);
+  if (linklen) dt->symlink = memcpy(len+(char *)dt, buf, linklen);
 
   return dt;
 
@@ -76,6 +86,28 @@ error:
   return 0;
 }
 
+struct dirtree *dirtree_add_node(struct dirtree *parent, char *name, int flags)
+{
+  return dirtree_node(parent, name, flags&~DIRTREE_LAZYSTAT, DT_UNKNOWN);
+}
+
+// Fill out st of node DIRTREE_LAZYSTAT skipped, returning 0 if stat failed.
+// Only works from the callback (when the parent's dirfd is open).
+
+struct stat *dirtree_stat(struct dirtree *node)
+{
+  struct stat st;
+
+  if (node->again&DIRTREE_STATLESS) return 0;
+  if (!node->st.st_blksize) {
+    if (fstatat(dirtree_parentfd(node), node->name, &st, AT_SYMLINK_NOFOLLOW))
+      return 0;
+    memcpy(&node->st, &st, sizeof(struct stat));
+  }
+
+  return &node->st;
+}
+
 // Return path to this node.
 
 // Initial call can pass in NULL to plen, or point to an int initialized to 0
@@ -146,6 +178,73 @@ static struct dirtree *dirtree_handle_callback(struct dirtree *new,
   return (flags & DIRTREE_ABORT)==DIRTREE_ABORT ? DIRTREE_ABORTVAL : new;
 }
 
+// Read directory entries in big batches (musl's readdir() uses a 2k buffer)
+// returning name and d_type of each. Takes ownership of fd.
+
+struct dirtree_dir {
+  DIR *dir;
+  int fd, pos, len;
+  char buf[];
+};
+
+static struct dirtree_dir *dirtree_opendir(int fd)
+{
+  struct dirtree_dir *dd;
+
+#ifdef SYS_getdents64
+  dd = xmalloc(sizeof(struct dirtree_dir)+65536);
+  dd->dir = 0;
+  dd->fd = fd;
+  dd->pos = dd->len = 0;
+#else
+  dd = xzalloc(sizeof(struct dirtree_dir));
+  if (!(dd->dir = fdopendir(fd))) {
+    close(fd);
+    free(dd);
+    dd = 0;
+  }
+#endif
+
+  return dd;
+}
+
+static char *dirtree_readdir(struct dirtree_dir *dd, int *type)
+{
+#ifdef SYS_getdents64
+  struct {
+    unsigned long long ino;
+    long long off;
+    unsigned short reclen;
+    unsigned char type;
+    char name[];
+  } *de;
+
+  if (dd->pos>=dd->len) {
+    if (1>(dd->len = syscall(SYS_getdents64, dd->fd, dd->buf, 65536))) return 0;
+    dd->pos = 0;
+  }
+  de = (void *)(dd->buf+dd->pos);
+  dd->pos += de->reclen;
+  *type = de->type;
+
+  return de->name;
+#else
+  struct dirent *de = readdir(dd->dir);
+
+  if (!de) return 0;
+  *type = de->d_type;
+
+  return de->d_name;
+#endif
+}
+
+static void dirtree_closedir(struct dirtree_dir *dd)
+{
+  if (dd->dir) closedir(dd->dir);
+  else close(dd->fd);
+  free(dd);
+}
+
 // Recursively read/process children of directory node, filtering through
 // callback().
 
@@ -153,12 +252,14 @@ int dirtree_recurse(struct dirtree *node,
           int (*callback)(struct dirtree *node), int dirfd, int flags)
 {
   struct dirtree *new = 0, *next, **ddt = &(node->child);
-  struct dirent *entry;
-  DIR *dir = 0;
+  struct dirtree_dir *dir = 0;
+  char *name;
+  int type, fd;
 
-  // fdopendir() doesn't support AT_FDCWD, closedir() closes fd from opendir()
-  if (AT_FDCWD == (node->dirfd = dirfd)) dir = opendir(".");
-  else if (node->dirfd != -1) dir = fdopendir(xdup(node->dirfd));
+  // Read from a dup so closing it doesn't close caller's dirfd
+  if (AT_FDCWD == (node->dirfd = dirfd)) fd = open(".", O_RDONLY|O_CLOEXEC);
+  else fd = (node->dirfd == -1) ? -1 : dup(node->dirfd);
+  if (fd != -1) dir = dirtree_opendir(fd);
 
   if (!dir) {
     if (!(flags & DIRTREE_SHUTUP)) {
@@ -176,16 +277,14 @@ int dirtree_recurse(struct dirtree *node,
     else if (new == DIRTREE_ABORTVAL) goto done;
     else ddt = &new->next;
 
-  // according to the fddir() man page, the filehandle in the DIR * can still
-  // be externally used by things that don't lseek() it.
-  } else while ((entry = readdir(dir))) {
-    if ((flags&DIRTREE_PROC) && !isdigit(*entry->d_name)) continue;
-    if ((flags&DIRTREE_BREADTH) && isdotdot(entry->d_name)) continue;
-    if (!(new = dirtree_add_node(node, entry->d_name, flags))) continue;
-    if ((flags&DIRTREE_SYMFOLLOW) && entry->d_type==DT_LNK
+  // The dup shares the file position with dirfd, but callbacks only use
+  // the *at() functions which don't lseek() it.
+  } else while ((name = dirtree_readdir(dir, &type))) {
+    if ((flags&DIRTREE_PROC) && !isdigit(*name)) continue;
+    if ((flags&DIRTREE_BREADTH) && isdotdot(name)) continue;
+    if (!(new = dirtree_node(node, name, flags, type))) continue;
+    if ((flags&DIRTREE_SYMFOLLOW) && type==DT_LNK
       && !S_ISLNK(new->st.st_mode)) new->again |= DIRTREE_SYMFOLLOW;
-    if (!new->st.st_blksize && !new->st.st_mode)
-      new->st.st_mode = entry->d_type<<12;
     new = dirtree_handle_callback(new, callback);
     if (new == DIRTREE_ABORTVAL) goto done;
     if (new) {
@@ -201,7 +300,7 @@ int dirtree_recurse(struct dirtree *node,
   }
 
 done:
-  if (dir) closedir(dir);
+  if (dir) dirtree_closedir(dir);
   node->dirfd = -1;
 
   return (new == DIRTREE_ABORTVAL) ? DIRTREE_ABORT : flags;
@@ -225,3 +324,404 @@ struct dirtree *dirtree_read(char *path, int (*callback)(struct dirtree *node))
 {
   return dirtree_flagread(path, 0, callback);
 }
+
+// Parallel traversal: worker threads open and read directories (statting
+// their contents) from per-thread deques, newest first, stealing the oldest
+// from each other when they run out. By default callbacks happen in the
+// calling thread in the same order as dirtree_flagread() while workers read
+// subdirectories ahead, with DIRTREE_UNORDERED callbacks happen in whichever
+// worker read the directory (so must be thread safe) and the tree isn't kept
+// (no DIRTREE_SAVE). COMEAGAIN still happens after all of a directory's
+// contents. DIRTREE_BREADTH isn't supported.
+
+struct dirtree_job {
+  struct dirtree_job *next, *up;
+  struct dirtree *node, *kids;
+  int flags, pfd, err, pending;
+  char state, inq;
+};
+
+// Job states
+#define DTJ_QUEUED  0
+#define DTJ_RUNNING 1
+#define DTJ_DONE    2
+#define DTJ_CLAIMED 3
+#define DTJ_CANCEL  4
+
+static struct {
+  pthread_mutex_t lock;
+  pthread_cond_t cond, ready; // work queued, job finished reading
+  struct dirtree_deque {
+    struct dirtree_job **job;
+    int top, bottom, size;
+  } *dq;
+  int (*callback)(struct dirtree *node);
+  int threads, flags, done, abort, ahead;
+} dtp;
+
+// Flags that change how a directory is read
+#define DTJ_READFLAGS (DIRTREE_SYMFOLLOW|DIRTREE_PROC|DIRTREE_LAZYSTAT)
+
+static struct dirtree_job *dirtree_newjob(struct dirtree *node, int flags)
+{
+  struct dirtree_job *job = xzalloc(sizeof(struct dirtree_job));
+
+  job->node = node;
+  job->flags = flags;
+  job->pfd = node->parent ? dup(node->parent->dirfd) : AT_FDCWD;
+  job->pending = 1;
+
+  return job;
+}
+
+static void dirtree_freejob(struct dirtree_job *job)
+{
+  if (job->pfd >= 0) close(job->pfd);
+  free(job);
+}
+
+// Call with lock held
+static void dirtree_push(int me, struct dirtree_job *job)
+{
+  struct dirtree_deque *dq = dtp.dq+me;
+
+  if (dq->bottom == dq->size) {
+    if (dq->top) {
+      memmove(dq->job, dq->job+dq->top, (dq->bottom -= dq->top)*sizeof(job));
+      dq->top = 0;
+    } else dq->job = xrealloc(dq->job, (dq->size += 64)*sizeof(job));
+  }
+  dq->job[dq->bottom++] = job;
+  job->inq = 1;
+}
+
+// Call with lock held. Returns 0 when traversal's finished.
+static struct dirtree_job *dirtree_getjob(int me)
+{
+  struct dirtree_deque *dq;
+  struct dirtree_job *job;
+  int i;
+
+  while (!dtp.done) {
+    for (i = 0; i<dtp.threads; i++) {
+      dq = dtp.dq+(me+i)%dtp.threads;
+      if (dq->top == dq->bottom) continue;
+      job = i ? dq->job[dq->top++] : dq->job[--dq->bottom];
+      if (dq->top == dq->bottom) dq->top = dq->bottom = 0;
+      job->inq = 0;
+
+      // Skip jobs main thread claimed or cancelled
+      if (job->state == DTJ_QUEUED) return job;
+      if (job->state == DTJ_CANCEL) dirtree_freejob(job);
+      i = -1;
+    }
+    pthread_cond_wait(&dtp.cond, &dtp.lock);
+  }
+
+  return 0;
+}
+
+// Open job's directory and read its contents into job->kids. Stat failures
+// are saved (errno in extra) for the callback's thread to report.
+static void dirtree_readjob(struct dirtree_job *job)
+{
+  struct dirtree *node = job->node, *new, **ddt = &job->kids;
+  struct dirtree_dir *dir = 0;
+  int type, flags = job->flags|DIRTREE_SHUTUP|DIRTREE_STATLESS;
+  char *name;
+
+  if (*node->name) node->dirfd = openat(job->pfd, node->name, O_CLOEXEC);
+  else node->dirfd = open(".", O_RDONLY|O_CLOEXEC);
+  if (job->pfd >= 0) close(job->pfd);
+  job->pfd = -1;
+  if (node->dirfd == -1 || !(dir = dirtree_opendir(dup(node->dirfd)))) {
+    job->err = errno;
+
+    return;
+  }
+  while ((name = dirtree_readdir(dir, &type))) {
+    if ((flags&DIRTREE_PROC) && !isdigit(*name)) continue;
+    if (!(new = dirtree_node(node, name, flags, type))) continue;
+    if (new->again&DIRTREE_STATLESS) new->extra = errno;
+    if ((flags&DIRTREE_SYMFOLLOW) && type==DT_LNK
+      && !S_ISLNK(new->st.st_mode)) new->again |= DIRTREE_SYMFOLLOW;
+    *ddt = new;
+    ddt = &new->next;
+  }
+  dirtree_closedir(dir);
+}
+
+// Report error opening directory, as dirtree_recurse() would
+static void dirtree_readfail(struct dirtree_job *job)
+{
+  char *path;
+
+  if (!(job->flags&DIRTREE_SHUTUP)) {
+    errno = job->err;
+    perror_msg_raw(path = dirtree_path(job->node, 0));
+    free(path);
+  }
+}
+
+// Handle stat failure of a node read by dirtree_readjob(), freeing it and
+// returning 1 unless caller asked for DIRTREE_STATLESS.
+static int dirtree_statfail(struct dirtree *new, int flags)
+{
+  char *path;
+
+  if (!(new->again&DIRTREE_STATLESS)) return 0;
+  errno = new->extra;
+  new->extra = 0;
+  if (flags&DIRTREE_STATLESS) return 0;
+  if (!(flags&DIRTREE_SHUTUP) && !isdotdot(new->name)) {
+    perror_msg_raw(path = dirtree_path(new, 0));
+    free(path);
+  }
+  new->parent->symlink = (char *)1;
+  free(new);
+
+  return 1;
+}
+
+// Unordered: a directory and everything under it is done, call COMEAGAIN
+// and pass completion up to parent directories.
+static void dirtree_finish(struct dirtree_job *job)
+{
+  struct dirtree_job *up;
+  int flags;
+
+  for (;;) {
+    pthread_mutex_lock(&dtp.lock);
+    flags = --job->pending;
+    pthread_mutex_unlock(&dtp.lock);
+    if (flags) return;
+
+    if (!dtp.abort && !job->err && (job->flags&DIRTREE_COMEAGAIN)) {
+      job->node->again |= DIRTREE_COMEAGAIN;
+      flags = dtp.callback(job->node);
+      if ((flags&DIRTREE_ABORT) == DIRTREE_ABORT) dtp.abort = 1;
+    }
+    if (job->node->dirfd != -1) close(job->node->dirfd);
+    job->node->dirfd = -1;
+    if ((up = job->up)) free(job->node);
+    free(job);
+    if (!(job = up)) break;
+  }
+  pthread_mutex_lock(&dtp.lock);
+  dtp.done = 1;
+  pthread_cond_broadcast(&dtp.cond);
+  pthread_mutex_unlock(&dtp.lock);
+}
+
+// Unordered: read directory and call callback on its contents, queueing
+// subdirectories on this thread's deque.
+static void dirtree_unordered(struct dirtree_job *job, int me)
+{
+  struct dirtree *new, *next;
+  struct dirtree_job *kid;
+  int flags;
+
+  if (!dtp.abort) dirtree_readjob(job);
+  if (job->err) dirtree_readfail(job);
+  for (new = job->kids; new; new = next) {
+    next = new->next;
+    new->next = 0;
+    if (dirtree_statfail(new, job->flags)) continue;
+    if (dtp.abort) flags = 0;
+    else if ((flags = dtp.callback(new))&DIRTREE_ABORT) {
+      if ((flags&DIRTREE_ABORT) == DIRTREE_ABORT) dtp.abort = 1;
+      flags = 0;
+    }
+    if (S_ISDIR(new->st.st_mode) && (flags&(DIRTREE_RECURSE|DIRTREE_COMEAGAIN)))
+    {
+      (kid = dirtree_newjob(new, flags))->up = job;
+      pthread_mutex_lock(&dtp.lock);
+      job->pending++;
+      dirtree_push(me, kid);
+      pthread_cond_signal(&dtp.cond);
+      pthread_mutex_unlock(&dtp.lock);
+    } else free(new);
+  }
+  job->kids = 0;
+  dirtree_finish(job);
+}
+
+static void *dirtree_worker(void *arg)
+{
+  struct dirtree_job *job;
+  int me = (long)arg;
+
+  pthread_mutex_lock(&dtp.lock);
+  while ((job = dirtree_getjob(me))) {
+    job->state = DTJ_RUNNING;
+    pthread_mutex_unlock(&dtp.lock);
+    if (dtp.flags&DIRTREE_UNORDERED) dirtree_unordered(job, me);
+    else dirtree_readjob(job);
+    pthread_mutex_lock(&dtp.lock);
+    if (!(dtp.flags&DIRTREE_UNORDERED)) {
+      job->state = DTJ_DONE;
+      pthread_cond_broadcast(&dtp.ready);
+    }
+  }
+  pthread_mutex_unlock(&dtp.lock);
+
+  return 0;
+}
+
+// Ordered: done with job, freeing what it read unless used.
+static void dirtree_release(struct dirtree_job *job, int used)
+{
+  int inq;
+
+  pthread_mutex_lock(&dtp.lock);
+  while (job->state == DTJ_RUNNING) pthread_cond_wait(&dtp.ready, &dtp.lock);
+  if (job->state == DTJ_DONE && !used) {
+    llist_traverse(job->kids, free);
+    if (job->node->dirfd != -1) close(job->node->dirfd);
+    job->node->dirfd = -1;
+  }
+  if ((inq = job->inq)) job->state = DTJ_CANCEL;
+  pthread_mutex_unlock(&dtp.lock);
+  if (!inq) dirtree_freejob(job);
+  dtp.ahead--;
+}
+
+// Ordered: handle callback for node in calling thread, using any directory
+// contents a worker read ahead. Returns same as dirtree_handle_callback().
+static struct dirtree *dirtree_ordered(struct dirtree *new,
+  struct dirtree_job *job)
+{
+  struct dirtree *kid, *next, *saved = 0, **ddt = &new->child;
+  struct dirtree_job *jobs = 0, **jj = &jobs, *kj;
+  int flags = dtp.callback(new), df = DIRTREE_RECURSE|DIRTREE_COMEAGAIN;
+
+  if (job && (!(S_ISDIR(new->st.st_mode) && (flags&df))
+      || ((job->flags^flags)&DTJ_READFLAGS)))
+  {
+    dirtree_release(job, 0);
+    job = 0;
+  }
+  if (S_ISDIR(new->st.st_mode) && (flags&df)) {
+    // Wait for worker reading this directory, or read it ourselves
+    if (job) {
+      pthread_mutex_lock(&dtp.lock);
+      while (job->state == DTJ_RUNNING)
+        pthread_cond_wait(&dtp.ready, &dtp.lock);
+      if (job->state == DTJ_QUEUED) job->state = DTJ_CLAIMED;
+      pthread_mutex_unlock(&dtp.lock);
+    } else {
+      dtp.ahead++;
+      (job = dirtree_newjob(new, flags))->state = DTJ_CLAIMED;
+    }
+    if (job->state == DTJ_CLAIMED) dirtree_readjob(job);
+    if (job->err) {
+      dirtree_readfail(job);
+      goto done;
+    }
+
+    // Queue subdirectories for workers to read ahead
+    pthread_mutex_lock(&dtp.lock);
+    for (kid = job->kids; kid && dtp.ahead<16*dtp.threads; kid = kid->next) {
+      if (!S_ISDIR(kid->st.st_mode) || (kid->again&DIRTREE_STATLESS)
+        || isdotdot(kid->name)) continue;
+      dtp.ahead++;
+      dirtree_push(0, *jj = dirtree_newjob(kid, flags));
+      jj = &(*jj)->next;
+    }
+    pthread_cond_broadcast(&dtp.cond);
+    pthread_mutex_unlock(&dtp.lock);
+
+    for (kid = job->kids; kid; kid = next) {
+      next = kid->next;
+      kid->next = 0;
+      if ((kj = jobs) && kj->node == kid) jobs = kj->next;
+      else kj = 0;
+      if (dirtree_statfail(kid, flags)) continue;
+      if ((saved = dirtree_ordered(kid, kj)) == DIRTREE_ABORTVAL) {
+        while ((kj = jobs)) {
+          jobs = kj->next;
+          dirtree_release(kj, 0);
+        }
+        llist_traverse(next, free);
+        break;
+      }
+      if (saved) {
+        *ddt = saved;
+        ddt = &saved->next;
+      }
+    }
+    job->kids = 0;
+    if (saved == DIRTREE_ABORTVAL) flags = DIRTREE_ABORT;
+    else if (flags & DIRTREE_COMEAGAIN) {
+      new->again |= DIRTREE_COMEAGAIN;
+      flags = dtp.callback(new);
+    }
+done:
+    if (new->dirfd != -1) close(new->dirfd);
+    new->dirfd = -1;
+    dirtree_release(job, 1);
+  }
+
+  // Free node that didn't request saving and has no saved children.
+  if (!new->child && !(flags & DIRTREE_SAVE)) {
+    free(new);
+    new = 0;
+  }
+
+  return (flags & DIRTREE_ABORT)==DIRTREE_ABORT ? DIRTREE_ABORTVAL : new;
+}
+
+// Like dirtree_flagread() using threads (counting the calling thread)
+struct dirtree *dirtree_parallel(char *path, int flags,
+  int (*callback)(struct dirtree *node), int threads)
+{
+  struct dirtree *new = dirtree_add_node(0, path, flags), *ret = 0;
+  pthread_t *tids;
+  int i, err = errno;
+
+  // Nothing to share out unless ordered output or a directory to descend into
+  if (threads<2 || !new || !callback
+    || ((flags&DIRTREE_UNORDERED) && !S_ISDIR(new->st.st_mode)))
+      return dirtree_handle_callback(new, callback);
+
+  memset(&dtp, 0, sizeof(dtp));
+  pthread_mutex_init(&dtp.lock, 0);
+  pthread_cond_init(&dtp.cond, 0);
+  pthread_cond_init(&dtp.ready, 0);
+  dtp.callback = callback;
+  dtp.flags = flags;
+  dtp.dq = xzalloc((dtp.threads = threads)*sizeof(struct dirtree_deque));
+  tids = xmalloc(threads*sizeof(pthread_t));
+  for (i = 1; i<threads; i++)
+    if ((errno = pthread_create(tids+i, 0, dirtree_worker, (void *)(long)i)))
+      perror_exit("pthread_create");
+  errno = err;
+
+  // Calling thread is a worker too when unordered
+  if (!(flags&DIRTREE_UNORDERED)) ret = dirtree_ordered(new, 0);
+  else if ((i = callback(new))&(DIRTREE_RECURSE|DIRTREE_COMEAGAIN)) {
+    pthread_mutex_lock(&dtp.lock);
+    dirtree_push(0, dirtree_newjob(new, i));
+    pthread_mutex_unlock(&dtp.lock);
+    dirtree_worker(0);
+    free(new);
+    if (dtp.abort) ret = DIRTREE_ABORTVAL;
+  } else free(new);
+
+  pthread_mutex_lock(&dtp.lock);
+  dtp.done = 1;
+  pthread_cond_broadcast(&dtp.cond);
+  pthread_mutex_unlock(&dtp.lock);
+  for (i = 1; i<threads; i++) pthread_join(tids[i], 0);
+
+  // Free jobs cancelled while queued
+  for (i = 0; i<threads; i++) {
+    while (dtp.dq[i].top<dtp.dq[i].bottom)
+      dirtree_freejob(dtp.dq[i].job[dtp.dq[i].top++]);
+    free(dtp.dq[i].job);
+  }
+  free(dtp.dq);
+  free(tids);
+
+  return ret;
+}
@@ -19,41 +19,57 @@
   prefix##_DIGEST_LENGTH, }
 #define SHA1_DIGEST_LENGTH SHA_DIGEST_LENGTH
 
-void hash_by_name(int fd, char *name, char *result)
+static struct hash {
+  char *name;
+  int (*init)(void *);
+  int (*update)(void *, void *, size_t);
+  int (*final)(void *, void *);
+  int digest_length;
+} algorithms[] = {
+  USE_MD5SUM(HASH_INIT("md5sum", MD5),)
+  USE_SHA1SUM(HASH_INIT("sha1sum", SHA1),)
+  USE_SHA224SUM(HASH_INIT("sha224sum", SHA224),)
+  USE_SHA256SUM(HASH_INIT("sha256sum", SHA256),)
+  USE_SHA384SUM(HASH_INIT("sha384sum", SHA384),)
+  USE_SHA512SUM(HASH_INIT("sha512sum", SHA512),)
+};
+
+struct browns {
+  struct hash *hash;
+  SHA512_CTX ctx; // Largest context
+};
+
+void *hash_init(char *name)
 {
-  // Largest context
-  SHA512_CTX ctx;
-  struct hash {
-    char *name;
-    int (*init)(void *);
-    int (*update)(void *, void *, size_t);
-    int (*final)(void *, void *);
-    int digest_length;
-  } algorithms[] = {
-    USE_MD5SUM(HASH_INIT("md5sum", MD5),)
-    USE_SHA1SUM(HASH_INIT("sha1sum", SHA1),)
-    USE_SHA224SUM(HASH_INIT("sha224sum", SHA224),)
-    USE_SHA256SUM(HASH_INIT("sha256sum", SHA256),)
-    USE_SHA384SUM(HASH_INIT("sha384sum", SHA384),)
-    USE_SHA512SUM(HASH_INIT("sha512sum", SHA512),)
-  }, * hash;
+  struct browns *hash = xmalloc(sizeof(struct browns));
   int i;
 
   // This should never NOT match, so no need to check
   for (i = 0; i<ARRAY_LEN(algorithms); i++)
     if (!strcmp(name, algorithms[i].name)) break;
-  hash = algorithms+i;
+  hash->hash = algorithms+i;
+  hash->hash->init(&hash->ctx);
 
-  hash->init(&ctx);
-  for (;;) {
-      i = read(fd, libbuf, sizeof(libbuf));
-      if (i<1) break;
-      hash->update(&ctx, libbuf, i);
-  }
-  hash->final(libbuf+128, &ctx);
+  return hash;
+}
+
+void hash_update(void *hash, void *data, size_t len)
+{
+  struct browns *h = hash;
+
+  h->hash->update(&h->ctx, data, len);
+}
+
+void hash_final(void *hash, char *result)
+{
+  struct browns *h = hash;
+  char digest[SHA512_DIGEST_LENGTH];
+  int i;
 
-  for (i = 0; i<hash->digest_length; i++)
-    result += sprintf(result, "%02x", libbuf[i+128]);
+  h->hash->final(digest, &h->ctx);
+  for (i = 0; i<h->hash->digest_length; i++)
+    result += sprintf(result, "%02x", digest[i]);
+  free(h);
 }
 
 // Builtin implementations
@@ -62,6 +78,8 @@ void hash_by_name(int fd, char *name, char *result)
 struct browns {
   unsigned *rconsttable32;
   unsigned long long *rconsttable64; // for sha384,sha512
+  void (*transform)(struct browns *hash);
+  int method, chunksize;
 
   // Crypto variables blanked after summing
   unsigned long long count, overflow;
@@ -280,12 +298,112 @@ static void sha2_64_transform(struct browns *hash)
   for (i=0; i<8; i++) hash->state.i64[i] += rot[i];
 }
 
+#if defined(__x86_64__)
+#include <cpuid.h>
+#include <immintrin.h>
+
+// Intel SHA extensions (sha_ni) do 4 rounds of sha1 or 2 rounds of sha256
+// per instruction, plus message schedule helpers. State lives in sse
+// registers in the order the instructions want, so shuffle it in and out.
+
+__attribute__((target("sha,sse4.1")))
+static void sha1_shani(struct browns *hash)
+{
+  __m128i abcd, save, e0, e1, m0, m1, m2, m3, tmp,
+    swap = _mm_set_epi8(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15);
+  unsigned *state = hash->state.i32;
+  char *data = hash->buffer.c;
+  int i;
+
+  save = abcd = _mm_shuffle_epi32(_mm_loadu_si128((void *)state), 0x1b);
+  e1 = _mm_set_epi32(state[4], 0, 0, 0);
+  m0 = _mm_shuffle_epi8(_mm_loadu_si128((void *)data), swap);
+  m1 = _mm_shuffle_epi8(_mm_loadu_si128((void *)(data+16)), swap);
+  m2 = _mm_shuffle_epi8(_mm_loadu_si128((void *)(data+32)), swap);
+  m3 = _mm_shuffle_epi8(_mm_loadu_si128((void *)(data+48)), swap);
+
+  // 20 groups of 4 rounds, m0 is this group's message words and m1-m3
+  // get extended 4 words at a time, then everything rotates down one.
+  e0 = _mm_add_epi32(e1, m0);
+  for (i = 0; i<20; i++) {
+    if (i) e0 = _mm_sha1nexte_epu32(e0, m0);
+    e1 = abcd;
+    switch (i/5) {
+      case 0: abcd = _mm_sha1rnds4_epu32(abcd, e0, 0); break;
+      case 1: abcd = _mm_sha1rnds4_epu32(abcd, e0, 1); break;
+      case 2: abcd = _mm_sha1rnds4_epu32(abcd, e0, 2); break;
+      default: abcd = _mm_sha1rnds4_epu32(abcd, e0, 3);
+    }
+    if (i>2 && i<19) m1 = _mm_sha1msg2_epu32(m1, m0);
+    if (i>1 && i<18) m2 = _mm_xor_si128(m2, m0);
+    if (i && i<17) m3 = _mm_sha1msg1_epu32(m3, m0);
+    tmp = m0, m0 = m1, m1 = m2, m2 = m3, m3 = tmp;
+    tmp = e0, e0 = e1, e1 = tmp;
+  }
+  e0 = _mm_sha1nexte_epu32(e0, _mm_set_epi32(state[4], 0, 0, 0));
+  abcd = _mm_add_epi32(abcd, save);
+
+  _mm_storeu_si128((void *)state, _mm_shuffle_epi32(abcd, 0x1b));
+  state[4] = _mm_extract_epi32(e0, 3);
+}
+
+__attribute__((target("sha,sse4.1")))
+static void sha256_shani(struct browns *hash)
+{
+  __m128i abef, cdgh, save[2], m[4], k, tmp,
+    swap = _mm_set_epi8(12,13,14,15,8,9,10,11,4,5,6,7,0,1,2,3);
+  unsigned *state = hash->state.i32;
+  int i;
+
+  // Registers hold ABEF and CDGH, high lane first
+  tmp = _mm_shuffle_epi32(_mm_loadu_si128((void *)state), 0xb1);
+  cdgh = _mm_shuffle_epi32(_mm_loadu_si128((void *)(state+4)), 0x1b);
+  save[0] = abef = _mm_alignr_epi8(tmp, cdgh, 8);
+  save[1] = cdgh = _mm_blend_epi16(cdgh, tmp, 0xf0);
+  for (i = 0; i<4; i++)
+    m[i] = _mm_shuffle_epi8(_mm_loadu_si128((void *)(hash->buffer.c+16*i)),
+      swap);
+
+  // 16 groups of 4 rounds, extending the message schedule 4 words ahead
+  for (i = 0; i<16; i++) {
+    k = _mm_add_epi32(m[i&3],
+      _mm_loadu_si128((void *)(hash->rconsttable32+4*i)));
+    cdgh = _mm_sha256rnds2_epu32(cdgh, abef, k);
+    abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(k, 0x0e));
+    if (i<12) m[i&3] = _mm_sha256msg2_epu32(_mm_add_epi32(
+      _mm_sha256msg1_epu32(m[i&3], m[(i+1)&3]),
+      _mm_alignr_epi8(m[(i+3)&3], m[(i+2)&3], 4)), m[(i+3)&3]);
+  }
+  abef = _mm_add_epi32(abef, save[0]);
+  cdgh = _mm_add_epi32(cdgh, save[1]);
+
+  tmp = _mm_shuffle_epi32(abef, 0x1b);
+  cdgh = _mm_shuffle_epi32(cdgh, 0xb1);
+  _mm_storeu_si128((void *)state, _mm_blend_epi16(tmp, cdgh, 0xf0));
+  _mm_storeu_si128((void *)(state+4), _mm_alignr_epi8(cdgh, tmp, 8));
+}
+
+// Does this processor have sha_ni (and the sse4.1 the above also uses)?
+static int shani(void)
+{
+  static int have = -1;
+  unsigned a, b, c, d;
+
+  if (have<0)
+    have = __get_cpuid_count(7, 0, &a, &b, &c, &d) && (b&(1<<29))
+      && __get_cpuid(1, &a, &b, &c, &d) && (c&(1<<19));
+
+  return have;
+}
+#endif
+
 // Fill 64/128-byte (512/1024-bit) working buffer, call transform() when full.
 
-static void hash_update(char *data, unsigned int len,
-  void (*transform)(struct browns *hash), int chunksize, struct browns *hash)
+void hash_update(void *h, void *d, size_t len)
 {
-  unsigned int i, j;
+  struct browns *hash = h;
+  unsigned i, j, chunksize = hash->chunksize;
+  char *data = d;
 
   j = hash->count & (chunksize - 1);
   if (hash->count+len<hash->count) hash->overflow++;
@@ -299,24 +417,21 @@ static void hash_update(char *data, unsigned int len,
     if (j+i != chunksize) break;
 
     // Process a frame
-    transform(hash);
+    hash->transform(hash);
     j=0;
     data += i;
     len -= i;
   }
 }
 
-void hash_by_name(int fd, char *name, char *result)
+// Start a new hash, name is the command name: md5sum, sha1sum, sha224sum...
+void *hash_init(char *name)
 {
-  unsigned long long count[2];
-  int i, chunksize, digestlen, method;
-  volatile unsigned *pp;
-  void (*transform)(struct browns *hash);
   struct browns *hash = xzalloc(sizeof(struct browns));
-  char buf;
+  int i, method;
 
   // md5sum, sha1sum, sha224sum, sha256sum, sha384sum, sha512sum
-  method = stridx("us2581", name[4]);
+  hash->method = method = stridx("us2581", name[4]);
 
   // Calculate table if we have floating point. Static version should drop
   // out at compile time when we don't need it.
@@ -331,10 +446,14 @@ void hash_by_name(int fd, char *name, char *result)
   } else hash->rconsttable64 = sha512nofloat; // sha384, sha512
 
   // select hash type
-  transform = (void *[]){md5_transform, sha1_transform, sha2_32_transform,
-    sha2_32_transform, sha2_64_transform, sha2_64_transform}[method];
-  digestlen = (char []){16, 20, 28, 32, 48, 64}[method];
-  chunksize = 64<<(method>=4);
+  hash->transform = (void *[]){md5_transform, sha1_transform,
+    sha2_32_transform, sha2_32_transform, sha2_64_transform,
+    sha2_64_transform}[method];
+#if defined(__x86_64__)
+  if ((method==1 || method==2 || method==3) && shani())
+    hash->transform = method==1 ? sha1_shani : sha256_shani;
+#endif
+  hash->chunksize = 64<<(method>=4);
   if (method<=1)
     memcpy(hash->state.i32, (unsigned []){0x67452301, 0xEFCDAB89, 0x98BADCFE,
       0x10325476, 0xC3D2E1F0}, 20);
@@ -354,12 +473,18 @@ void hash_by_name(int fd, char *name, char *result)
       0x510e527fade682d1, 0x9b05688c2b3e6c1f, 0x1f83d9abfb41bd6b,
       0x5be0cd19137e2179}, 64);
 
-  hash->count = 0;
-  for (;;) {
-    i = read(fd, libbuf, sizeof(libbuf));
-    if (i<1) break;
-    hash_update(libbuf, i, transform, chunksize, hash);
-  }
+  return hash;
+}
+
+// Write hex digest to result and free hash
+void hash_final(void *h, char *result)
+{
+  struct browns *hash = h;
+  unsigned long long count[2];
+  int i, method = hash->method, chunksize = hash->chunksize,
+    digestlen = (char []){16, 20, 28, 32, 48, 64}[method];
+  volatile unsigned *pp;
+  char buf;
 
   // End the message by appending a "1" bit to the data, ending with the
   // message size (in bits, big endian), and adding enough zero bits in
@@ -374,10 +499,10 @@ void hash_by_name(int fd, char *name, char *result)
     count[i] = !method ? SWAP_LE64(count[i]) : SWAP_BE64(count[i]);
   i = 8<<(method>=4);
   do {
-    hash_update(&buf, 1, transform, chunksize, hash);
+    hash_update(hash, &buf, 1);
     buf = 0;
   } while ((hash->count&(chunksize-1)) != chunksize-i);
-  hash_update((void *)(count+(method<4)), i, transform, chunksize, hash);
+  hash_update(hash, count+(method<4), i);
 
   // write digest to result
   if (method>=4) for (i=0; i<digestlen/8; i++)
@@ -385,10 +510,31 @@ void hash_by_name(int fd, char *name, char *result)
   else for (i=0; i<digestlen/4; i++)
     result += sprintf(result, "%08x",
             !method ? bswap_32(hash->state.i32[i]) : hash->state.i32[i]);
+  if (hash->rconsttable32 != (void *)md5nofloat) free(hash->rconsttable32);
+
   // Wipe variables. Cryptographer paranoia. Avoid "optimizing" out memset
   // by looping on a volatile pointer.
   for (pp = (void *)hash; pp-(unsigned *)hash<sizeof(*hash)/4; pp++) *pp = 0;
-  for (pp = (void *)libbuf; pp-(unsigned *)libbuf<sizeof(libbuf)/4; pp++)
-    *pp = 0;
+  free(hash);
 }
 #endif
+
+// Hash contents of fd with named algorithm, writing hex digest to result.
+// Doesn't use libbuf or toybuf so it's safe to call from multiple threads.
+void hash_by_name(int fd, char *name, char *result)
+{
+  void *hash = hash_init(name);
+  char *buf = xmalloc(65536);
+  volatile char *pp;
+  int len, used = 0;
+
+  while (0<(len = read(fd, buf, 65536))) {
+    hash_update(hash, buf, len);
+    if (len>used) used = len;
+  }
+  hash_final(hash, result);
+
+  // Wipe data too
+  for (pp = buf; pp-buf<used; pp++) *pp = 0;
+  free(buf);
+}
@@ -554,6 +554,90 @@ int same_dev_ino(struct stat *st, struct dev_ino *di)
   return st->st_ino==di->ino && st->st_dev==di->dev;
 }
 
+struct hardlink {
+  struct hardlink *next;
+  struct dev_ino di;
+  nlink_t left;
+  char name[];
+};
+
+static struct hardlink **hardlink_bucket(struct hardlinks *hl, dev_t dev,
+  ino_t ino)
+{
+  unsigned long long ll = (ino^((long long)dev<<32)^dev)*0x9E3779B97F4A7C15ULL;
+
+  return hl->hash+((ll>>32)&(hl->size-1));
+}
+
+// Have we seen st's dev+ino before? If so return the name it was first seen
+// as, else remember it as name and return 0. Once all st_nlink links have been
+// seen the entry is dropped (unless keep, for when symlinks are followed), but
+// the returned name stays valid until the next call.
+char *hardlink_seen(struct hardlinks *hl, struct stat *st, char *name,
+  int keep)
+{
+  struct hardlink *hh, **hhh, *next;
+  unsigned i, len;
+
+  free(hl->gone);
+  hl->gone = 0;
+
+  if (hl->size) {
+    for (hhh = hardlink_bucket(hl, st->st_dev, st->st_ino); (hh = *hhh);
+         hhh = &hh->next)
+    {
+      if (!same_dev_ino(st, &hh->di)) continue;
+      if (hh->left && !--hh->left) {
+        *hhh = hh->next;
+        hl->count--;
+        hl->gone = hh;
+      }
+
+      return hh->name;
+    }
+  }
+
+  // Grow table (doubling, so average chain length stays under 1)
+  if (hl->count>=hl->size) {
+    struct hardlink **old = hl->hash;
+
+    i = hl->size;
+    hl->hash = xzalloc(sizeof(*hl->hash)*(hl->size = i ? 2*i : 256));
+    while (i--) for (hh = old[i]; hh; hh = next) {
+      next = hh->next;
+      hhh = hardlink_bucket(hl, hh->di.dev, hh->di.ino);
+      hh->next = *hhh;
+      *hhh = hh;
+    }
+    free(old);
+  }
+
+  hh = xmalloc(sizeof(*hh)+(len = strlen(name)+1));
+  hh->di.dev = st->st_dev;
+  hh->di.ino = st->st_ino;
+  hh->left = keep ? 0 : st->st_nlink-1;
+  memcpy(hh->name, name, len);
+  hhh = hardlink_bucket(hl, hh->di.dev, hh->di.ino);
+  hh->next = *hhh;
+  *hhh = hh;
+  hl->count++;
+
+  return 0;
+}
+
+void hardlink_free(struct hardlinks *hl)
+{
+  struct hardlink *hh;
+
+  free(hl->gone);
+  while (hl->size--) while ((hh = hl->hash[hl->size])) {
+    hl->hash[hl->size] = hh->next;
+    free(hh);
+  }
+  free(hl->hash);
+  memset(hl, 0, sizeof(*hl));
+}
+
 
 
 // Return how long the file at fd is, if there's any way to determine it.
@@ -715,6 +799,16 @@ long long peek(void *ptr, unsigned size)
   return (IS_BIG_ENDIAN ? peek_be : peek_le)(ptr, size);
 }
 
+void poke_be(void *ptr, long long val, unsigned size)
+{
+  char *c = ptr;
+
+  while (size--) {
+    c[size] = val;
+    val >>= 8;
+  }
+}
+
 // Iterate through an array of files, opening each one and calling a function
 // on that filehandle and name. The special filename "-" means stdin if
 // flags is O_RDONLY, stdout otherwise. An empty argument list calls
@@ -852,6 +946,122 @@ void crc_init(unsigned *crc_table, int little_endian)
   }
 }
 
+#if defined(__x86_64__)
+#include <immintrin.h>
+
+// Fold 64 bytes at a time with carry-less multiply, then fold down to one
+// 128 bit remainder that has the same crc as the data, and return it as 16
+// bytes in data order. Based on Intel's "Fast CRC Computation for Generic
+// Polynomials Using PCLMULQDQ Instruction". Big endian byte swaps each
+// block so the bits are in polynomial order, little endian needs constants
+// bit reversed instead. Constants are x**(D+64) and x**D mod the polynomial
+// for fold distances D=512 and D=128.
+__attribute__((target("pclmul,ssse3")))
+static char *crc32_fold(unsigned crc, char *data, size_t len, char *out,
+  int little_endian)
+{
+  __m128i x[4], y, k,
+    swap = _mm_set_epi8(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15);
+  int i;
+
+  for (i = 0; i<4; i++) {
+    x[i] = _mm_loadu_si128((void *)(data+16*i));
+    if (!little_endian) x[i] = _mm_shuffle_epi8(x[i], swap);
+  }
+  x[0] = _mm_xor_si128(x[0], little_endian ? _mm_cvtsi32_si128(crc)
+    : _mm_set_epi32(crc, 0, 0, 0));
+
+  k = little_endian ? _mm_set_epi64x(0x1c6e41596, 0x154442bd4)
+    : _mm_set_epi64x(0x8833794c, 0xe6228b11);
+  for (data += 64, len -= 64; len>=64; data += 64, len -= 64) {
+    for (i = 0; i<4; i++) {
+      y = _mm_loadu_si128((void *)(data+16*i));
+      if (!little_endian) y = _mm_shuffle_epi8(y, swap);
+      x[i] = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x[i], k, 0),
+        _mm_clmulepi64_si128(x[i], k, 0x11)), y);
+    }
+  }
+
+  k = little_endian ? _mm_set_epi64x(0xccaa009e, 0x1751997d0)
+    : _mm_set_epi64x(0xc5b9cd4c, 0xe8a45605);
+  for (i = 1; i<4; i++)
+    *x = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(*x, k, 0),
+      _mm_clmulepi64_si128(*x, k, 0x11)), x[i]);
+  if (!little_endian) *x = _mm_shuffle_epi8(*x, swap);
+  _mm_storeu_si128((void *)out, *x);
+
+  return data;
+}
+#endif
+
+// Update a running crc32 with len bytes of data, using 8 lookup tables to
+// handle 8 bytes per step ("slicing by 8"), or carry-less multiply where the
+// processor has it. Little endian is the reflected crc used by gzip/zip/
+// ethernet, big endian is posix cksum's. Caller does any pre/post inversion.
+unsigned crc32_update(unsigned crc, void *data, size_t len, int little_endian)
+{
+  static unsigned *tables[2];
+  static int pclmul = -1;
+  unsigned *t, *old = 0, i, j, lo, hi;
+  char *p = data;
+
+  // Build tables on first use: table[0] is crc_init(), each later table
+  // advances the previous one another byte of zeroes. Only publish finished
+  // tables (other threads may be calling us), and if another thread won the
+  // race use its copy.
+  little_endian = !!little_endian;
+  if (!(t = __atomic_load_n(tables+little_endian, __ATOMIC_ACQUIRE))) {
+    t = xmalloc(8*256*sizeof(unsigned));
+    crc_init(t, little_endian);
+    for (i = 256; i<8*256; i++) {
+      j = t[i-256];
+      t[i] = little_endian ? (j>>8)^t[j&255] : (j<<8)^t[j>>24];
+    }
+    if (!__atomic_compare_exchange_n(tables+little_endian, &old, t, 0,
+      __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+    {
+      free(t);
+      t = old;
+    }
+  }
+
+#if defined(__x86_64__)
+  if (pclmul<0) pclmul = __builtin_cpu_supports("pclmul")
+    && __builtin_cpu_supports("ssse3");
+  if (pclmul && len>=64) {
+    char buf[16];
+
+    p = crc32_fold(crc, p, len, buf, little_endian);
+    len = (char *)data+len-p;
+    crc = crc32_update(0, buf, 16, little_endian);
+  }
+#endif
+
+  for (; len>=8; len -= 8, p += 8) {
+    memcpy(&lo, p, 4);
+    memcpy(&hi, p+4, 4);
+    if (little_endian) {
+      lo = SWAP_LE32(lo)^crc;
+      hi = SWAP_LE32(hi);
+      crc = t[7*256+(lo&255)]^t[6*256+((lo>>8)&255)]^t[5*256+((lo>>16)&255)]
+        ^t[4*256+(lo>>24)]^t[3*256+(hi&255)]^t[2*256+((hi>>8)&255)]
+        ^t[256+((hi>>16)&255)]^t[hi>>24];
+    } else {
+      lo = SWAP_BE32(lo)^crc;
+      hi = SWAP_BE32(hi);
+      crc = t[7*256+(lo>>24)]^t[6*256+((lo>>16)&255)]^t[5*256+((lo>>8)&255)]
+        ^t[4*256+(lo&255)]^t[3*256+(hi>>24)]^t[2*256+((hi>>16)&255)]
+        ^t[256+((hi>>8)&255)]^t[hi&255];
+    }
+  }
+  while (len--) {
+    i = *p++;
+    crc = little_endian ? t[(crc^i)&255]^(crc>>8) : (crc<<8)^t[(crc>>24)^i];
+  }
+
+  return crc;
+}
+
 // Init base64 table
 
 void base64_init(char *p)
@@ -1541,3 +1751,11 @@ int smemcmp(char *one, char *two, unsigned long len)
   return ii;
 }
 
+
+// Is len bytes of memory at buf all zeroes? (Each byte matches the next.)
+int allzero(void *buf, unsigned long len)
+{
+  char *s = buf;
+
+  return !len || (!*s && !memcmp(s, s+1, len-1));
+}
@@ -29,6 +29,12 @@ struct dev_ino {
   ino_t ino;
 };
 
+// Hash table of dev+ino seen so far, see hardlink_seen()
+struct hardlinks {
+  struct hardlink **hash, *gone;
+  unsigned size, count;
+};
+
 void llist_free_arg(void *node);
 void llist_free_double(void *node);
 void llist_traverse(void *list, void (*using)(void *node));
@@ -67,6 +73,10 @@ void get_optflags(void);
 #define DIRTREE_STATLESS   128
 // Don't look at any more files in this directory.
 #define DIRTREE_ABORT      256
+// Only fill in st_mode (from d_type) of children, see dirtree_stat()
+#define DIRTREE_LAZYSTAT   512
+// dirtree_parallel() calls callback from worker threads in any order
+#define DIRTREE_UNORDERED 1024
 
 #define DIRTREE_ABORTVAL ((struct dirtree *)1)
 
@@ -84,11 +94,14 @@ struct dirtree *dirtree_add_node(struct dirtree *p, char *name, int flags);
 char *dirtree_path(struct dirtree *node, int *plen);
 int dirtree_notdotdot(struct dirtree *catch);
 int dirtree_parentfd(struct dirtree *node);
+struct stat *dirtree_stat(struct dirtree *node);
 int dirtree_recurse(struct dirtree *node, int (*callback)(struct dirtree *node),
   int dirfd, int symfollow);
 struct dirtree *dirtree_flagread(char *path, int flags,
   int (*callback)(struct dirtree *node));
 struct dirtree *dirtree_read(char *path, int (*callback)(struct dirtree *node));
+struct dirtree *dirtree_parallel(char *path, int flags,
+  int (*callback)(struct dirtree *node), int threads);
 
 // Tell xopen and friends to print warnings but return -1 as necessary
 // The largest O_BLAH flag so far is arch/alpha's O_PATH at 0x800000 so
@@ -213,6 +226,7 @@ int highest_bit(unsigned long l);
 long long peek_le(void *ptr, unsigned size);
 long long peek_be(void *ptr, unsigned size);
 long long peek(void *ptr, unsigned size);
+void poke_be(void *ptr, long long val, unsigned size);
 struct string_list *find_in_path(char *path, char *filename);
 long long estrtol(char *str, char **end, int base);
 long long xstrtol(char *str, char **end, int base);
@@ -233,11 +247,16 @@ int anystart(char *s, char **try);
 int anystr(char *s, char **try);
 int same_file(struct stat *st1, struct stat *st2);
 int same_dev_ino(struct stat *st, struct dev_ino *di);
+char *hardlink_seen(struct hardlinks *hl, struct stat *st, char *name,
+  int keep);
+void hardlink_free(struct hardlinks *hl);
 off_t fdlength(int fd);
 void loopfiles_rw(char **argv, int flags, int permissions,
   void (*function)(int fd, char *name));
 void loopfiles(char **argv, void (*function)(int fd, char *name));
 void loopfiles_lines(char **argv, void (*function)(char **pline, long len));
+long long sendfile_holes(int in, int out, long long len, long long *consumed,
+  int sparse);
 long long sendfile_len(int in, int out, long long len, long long *consumed);
 long long xsendfile_len(int in, int out, long long len);
 void xsendfile_pad(int in, int out, long long len);
@@ -247,6 +266,7 @@ int copy_tempfile(int fdin, char *name, char **tempname);
 void delete_tempfile(int fdin, int fdout, char **tempname);
 void replace_tempfile(int fdin, int fdout, char **tempname);
 void crc_init(unsigned *crc_table, int little_endian);
+unsigned crc32_update(unsigned crc, void *data, size_t len, int little_endian);
 void base64_init(char *p);
 int yesno(int def);
 int fyesno(FILE *fp, int def);
@@ -272,6 +292,7 @@ unsigned tar_cksum(void *data);
 int is_tar_header(void *pkt);
 void octal_deslash(char *s);
 int smemcmp(char *one, char *two, unsigned long len);
+int allzero(void *buf, unsigned long len);
 
 #define HR_SPACE  1 // Space between number and units
 #define HR_B      2 // Use "B" for single byte units
@@ -288,6 +309,9 @@ void elf_print_flags(int arch, int flags);
 
 // hash.c
 
+void *hash_init(char *name);
+void hash_update(void *hash, void *data, size_t len);
+void hash_final(void *hash, char *result);
 void hash_by_name(int fd, char *name, char *result);
 
 // env.c
@@ -384,7 +408,7 @@ int comma_remove(char *optlist, char *opt);
 
 // deflate.c
 
-long long gzip_fd(int infd, int outfd);
+long long gzip_fd(int infd, int outfd, int level);
 long long gunzip_fd(int infd, int outfd);
 long long gunzip_mem(char *inbuf, int inlen, char *outbuf, int outlen);
 
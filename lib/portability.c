@@ -216,6 +216,33 @@ int xnotify_wait(struct xnotify *not, char **path)
   }
 }
 
+// kqueue watches open files rather than names, so we can wake up for writes
+// to (or renames of) the current file, but caller must poll for new files.
+int xnotify_file(struct xnotify *not, int id, int fd, char *path)
+{
+  struct kevent event;
+
+  if (fd != -1) {
+    EV_SET(&event, fd, EVFILT_VNODE, EV_ADD|EV_CLEAR,
+      NOTE_WRITE|NOTE_EXTEND|NOTE_ATTRIB|NOTE_DELETE|NOTE_RENAME, 0,
+      (void *)(long)id);
+    kevent(not->kq, &event, 1, NULL, 0, NULL);
+  }
+
+  return 0;
+}
+
+int xnotify_poll(struct xnotify *not, int ms, void (*changed)(int id))
+{
+  struct kevent event;
+  struct timespec ts = {ms/1000, (ms%1000)*1000000};
+
+  if (1>kevent(not->kq, NULL, 0, &event, 1, ms<0 ? NULL : &ts)) return 0;
+  changed((long)event.udata);
+
+  return 1;
+}
+
 #else
 
 #include <sys/inotify.h>
@@ -228,6 +255,7 @@ struct xnotify *xnotify_init(int max)
   if ((not->kq = inotify_init()) < 0) perror_exit("inotify_init");
   not->paths = xmalloc(max * sizeof(char *));
   not->fds = xmalloc(max * 2 * sizeof(int));
+  memset(not->fds, -1, max * 2 * sizeof(int));
 
   return not;
 }
@@ -261,6 +289,95 @@ int xnotify_wait(struct xnotify *not, char **path)
   }
 }
 
+// Watch path, and its directory for new files appearing at that name, so
+// xnotify_poll() can report changes to caller's file id. Call again after
+// reopening a replaced file. Returns 0 if caller should poll instead
+// (directory unwatchable, or filesystem doesn't see other machines' writes).
+int xnotify_file(struct xnotify *not, int id, int fd, char *path)
+{
+  // NFS, SMB, CIFS, SMB2, FUSE, 9P
+  unsigned remote[] = {0x6969, 0x517b, 0xff534d42, 0xfe534d42, 0x65735546,
+    0x01021997};
+  char *s = strrchr(path, '/'), *dir = ".";
+  struct statfs sf;
+  int i, wd, *w = not->fds+2*id, rc = 0;
+
+  if (s) dir = xstrndup(path, s-path+(s==path));
+
+  if (id>=not->count) not->count = id+1;
+  not->paths[id] = path;
+
+  // Move file watch from old file (if we're only one using it) to new one
+  wd = inotify_add_watch(not->kq, path,
+    IN_MODIFY|IN_ATTRIB|IN_MOVE_SELF|IN_DELETE_SELF);
+  if (*w != -1 && *w != wd && *w<not->nwds && not->wds[*w] == id) {
+    inotify_rm_watch(not->kq, *w);
+    not->wds[*w] = -1;
+  }
+  if ((*w = wd) != -1) {
+    if (wd>=not->nwds) {
+      not->wds = xrealloc(not->wds, (wd+256)*sizeof(int));
+      memset(not->wds+not->nwds, -1, (wd+256-not->nwds)*sizeof(int));
+      not->nwds = wd+256;
+    }
+    i = not->wds[wd];
+    not->wds[wd] = (i == -1 || i == id) ? id : -2;
+  }
+
+  // Directory watch spots replacement files
+  if (w[1] == -1)
+    w[1] = inotify_add_watch(not->kq, dir, IN_CREATE|IN_MOVED_TO|IN_ONLYDIR);
+  if (w[1] != -1 && !statfs(dir, &sf)) {
+    for (i = 0; i<ARRAY_LEN(remote); i++)
+      if ((unsigned)sf.f_type == remote[i]) break;
+    rc = i==ARRAY_LEN(remote);
+  }
+  if (s) free(dir);
+
+  return rc;
+}
+
+// Wait up to ms milliseconds (-1 forever) for events on xnotify_file()s,
+// calling changed(id) for each file that may have changed, or changed(-1)
+// if events were lost. Returns 0 on timeout.
+int xnotify_poll(struct xnotify *not, int ms, void (*changed)(int id))
+{
+  struct pollfd pfd = {.fd = not->kq, .events = POLLIN};
+  struct inotify_event *ev;
+  char buf[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+  int i, id, len;
+
+  if (1>poll(&pfd, 1, ms)) return 0;
+  if (0>(len = read(not->kq, buf, sizeof(buf)))) {
+    if (errno == EINTR) return 0;
+    perror_exit("inotify");
+  }
+  for (ev = (void *)buf; (char *)ev<buf+len; ev = (void *)(ev->name+ev->len)) {
+    if (ev->mask&IN_Q_OVERFLOW) changed(-1);
+
+    // Named events come from directory watches
+    else if (ev->len) {
+      for (i = 0; i<not->count; i++)
+        if (not->fds[2*i+1] == ev->wd
+          && !strcmp(getbasename(not->paths[i]), ev->name)) changed(i);
+    } else {
+      id = ev->wd<not->nwds ? not->wds[ev->wd] : -1;
+      if (id>=0) changed(id);
+      else for (i = 0; i<not->count; i++) {
+        // Shared file watch, or directory went away
+        if (id == -2 && not->fds[2*i] == ev->wd) changed(i);
+        else if ((ev->mask&IN_IGNORED) && not->fds[2*i+1] == ev->wd) {
+          not->fds[2*i+1] = -1;
+          changed(i);
+        }
+      }
+      if ((ev->mask&IN_IGNORED) && ev->wd<not->nwds) not->wds[ev->wd] = -1;
+    }
+  }
+
+  return 1;
+}
+
 #endif
 
 #ifdef __APPLE__
@@ -646,19 +763,64 @@ static int check_copy_file_range(void)
 
 // Return bytes copied from in to out. If bytes <0 copy all of in to out.
 // If consumed isn't null, amount read saved there (return is written or error)
-long long sendfile_len(int in, int out, long long bytes, long long *consumed)
-{
-  long long total = 0, len, ww;
-  int try_cfr = check_copy_file_range();
+// Thread safe (cp -j), so uses its own buffer rather than libbuf.
+//
+// If sparse, seek output past holes in input (SEEK_DATA/SEEK_HOLE) instead of
+// writing zeroes, and if sparse>1 past any block of zeroes we read. Only done
+// when out is a regular file, which should read as zeroes past its position.
+long long sendfile_holes(int in, int out, long long bytes, long long *consumed,
+  int sparse)
+{
+  long long total = 0, len, ww, ll, pos = -1, hole = -1, skip = 0;
+  char buf[4096];
+  int try_cfr = check_copy_file_range(), sought = 0;
+  struct stat st;
 
   if (consumed) *consumed = 0;
-  if (in>=0) while (bytes != total) {
+  if (in<0) return 0;
+  if (sparse && (fstat(out, &st) || !S_ISREG(st.st_mode))) sparse = 0;
+  // Only look for holes when allocated blocks don't cover input's length.
+  // (Also skips /proc files claiming size 0, which SEEK_DATA calls a hole.)
+  if (sparse && !fstat(in, &st) && st.st_blocks*512<st.st_size)
+    pos = lseek(in, 0, SEEK_CUR);
+  // copy_file_range() data doesn't go through buf to check for zeroes
+  if (sparse>1) try_cfr = 0;
+
+  while (bytes != total) {
     ww = 0;
-    len = bytes-total;
+    len = bytes<0 ? LLONG_MAX : bytes-total;
+
+    // Past last hole we found, look for the next one. ENXIO means the rest
+    // of the file's a hole. Other errors (or races) stop looking.
+#ifdef SEEK_DATA
+    if (pos>=0 && pos>=hole) {
+      if ((ll = lseek(in, pos, SEEK_DATA))<0)
+        ll = hole = errno==ENXIO ? lseek(in, 0, SEEK_END) : -1;
+      else hole = lseek(in, ll, SEEK_HOLE);
+      if (lseek(in, pos, SEEK_SET)!=pos || ll<pos || hole<ll) pos = -1;
+      else skip = ll-pos;
+    }
+#endif
+
+    // Seek past hole in output, in lieu of writing zeroes
+    if (skip) {
+      if (skip>len) skip = len;
+      if (lseek(in, skip, SEEK_CUR)<0 || lseek(out, skip, SEEK_CUR)<0)
+        return -1;
+      if (consumed) *consumed += skip;
+      total += skip;
+      pos += skip;
+      sought = 1;
+      skip = 0;
+
+      continue;
+    }
+    if (pos>=0 && len>hole-pos) len = hole-pos;
+    if (!len) break;
 
     errno = 0;
     if (try_cfr) {
-      if (bytes<0 || len>(1<<30)) len = (1<<30);
+      if (len>(1<<30)) len = (1<<30);
       len = syscall(try_cfr, in, 0, out, 0, len, 0);
       if (len < 0) {
         try_cfr = 0;
@@ -666,19 +828,34 @@ long long sendfile_len(int in, int out, long long bytes, long long *consumed)
         continue;
       }
     } else {
-      if (bytes<0 || len>sizeof(libbuf)) len = sizeof(libbuf);
-      ww = len = read(in, libbuf, len);
+      if (len>sizeof(buf)) len = sizeof(buf);
+      ww = len = read(in, buf, len);
+      if (sparse>1 && len>0 && allzero(buf, len)) {
+        if (lseek(out, len, SEEK_CUR)<0) return -1;
+        sought = 1;
+        ww = 0;
+      }
     }
     if (len<1 && errno==EAGAIN) continue;
     if (len<1) break;
     if (consumed) *consumed += len;
-    if (ww && writeall(out, libbuf, len) != len) return -1;
+    if (ww && writeall(out, buf, len) != len) return -1;
     total += len;
+    if (pos>=0) pos += len;
   }
 
+  // If we ended by seeking past a hole, extend the output file to cover it
+  if (sought && (ll = lseek(out, 0, SEEK_CUR))>0 && !fstat(out, &st)
+      && st.st_size<ll && ftruncate(out, ll)) return -1;
+
   return total;
 }
 
+long long sendfile_len(int in, int out, long long bytes, long long *consumed)
+{
+  return sendfile_holes(in, out, bytes, consumed, 0);
+}
+
 #ifdef __APPLE__
 // The absolute minimum POSIX timer implementation to build timeout(1).
 // Note that although timeout(1) uses POSIX timers to get the monotonic clock,
@@ -124,6 +124,16 @@ static inline char *basename(char *path) { return __xpg_basename(path); }
 char *strcasestr(const char *haystack, const char *needle);
 void *memmem(const void *haystack, size_t haystack_length,
   const void *needle, size_t needle_length);
+// And fallocate() is hiding behind _GNU_SOURCE (the 64 bit one on 32 bit)
+int fallocate(int fd, int mode, off_t offset, off_t len) __asm__("fallocate64");
+// As is recvmmsg(), in Linux since 2009.
+#include <sys/socket.h>
+struct mmsghdr {
+  struct msghdr msg_hdr;
+  unsigned int msg_len;
+};
+int recvmmsg(int sockfd, struct mmsghdr *msgvec, unsigned int vlen, int flags,
+  struct timespec *timeout);
 #endif // defined(glibc)
 
 #if !defined(__GLIBC__)
@@ -186,6 +196,26 @@ void *memmem(const void *haystack, size_t haystack_length,
 #endif
 #endif
 
+#ifdef __linux__
+// glibc only defines these with _GNU_SOURCE, musl lacks ZERO_RANGE
+#ifndef FALLOC_FL_KEEP_SIZE
+#define FALLOC_FL_KEEP_SIZE 1
+#define FALLOC_FL_PUNCH_HOLE 2
+#endif
+#ifndef FALLOC_FL_ZERO_RANGE
+#define FALLOC_FL_ZERO_RANGE 16
+#endif
+// glibc again (_GNU_SOURCE)
+#ifndef SEEK_DATA
+#define SEEK_DATA 3
+#define SEEK_HOLE 4
+#endif
+// Copy on write clone of a whole file (btrfs, xfs...), from linux/fs.h
+#ifndef FICLONE
+#define FICLONE _IOW(0x94, 9, int)
+#endif
+#endif
+
 #ifdef __linux__
 #include <sys/personality.h>
 #else
@@ -340,15 +370,19 @@ static inline void confstr(int a, char *b, int c) {strcpy(b, a ? "POSIXLY_CORREC
 #endif
 
 // Paper over the differences between BSD kqueue and Linux inotify for tail.
+// (xnotify_file() uses fds[] as file/directory watch pairs per id, and wds[]
+// to map watch descriptor back to id, or -2 if several ids share it.)
 
 struct xnotify {
   char **paths;
-  int max, *fds, count, kq;
+  int max, *fds, count, kq, *wds, nwds;
 };
 
 struct xnotify *xnotify_init(int max);
 int xnotify_add(struct xnotify *not, int fd, char *path);
 int xnotify_wait(struct xnotify *not, char **path);
+int xnotify_file(struct xnotify *not, int id, int fd, char *path);
+int xnotify_poll(struct xnotify *not, int ms, void (*changed)(int id));
 
 int sig_to_num(char *s);
 char *num_to_sig(int sig);
@@ -54,7 +54,8 @@ do_loudly()
 # and skip nonexistent libraries for it (probing in parallel).
 LIBRARIES=$(
   [ -z "$V" ] && X=/dev/null || X=/dev/stderr
-  for i in util crypt m resolv selinux smack attr crypto z log iconv tls ssl
+  for i in util crypt m resolv selinux smack attr crypto z log iconv tls ssl \
+    pthread
   do
     do_loudly ${CROSS_COMPILE}${CC} $CFLAGS $LDFLAGS -xc - -l$i >>$X 2>&1 \
       -o /dev/null <<<"int main(int argc,char*argv[]){return 0;}" &&
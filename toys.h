@@ -18,6 +18,7 @@
 #include <limits.h>
 #include <math.h>
 #include <paths.h>
+#include <pthread.h>
 #include <pwd.h>
 #include <regex.h>
 #include <sched.h>
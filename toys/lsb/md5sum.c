@@ -16,7 +16,7 @@
  *
  * coreutils supports --status but not -s, busybox supports -s but not --status
 
-USE_MD5SUM(NEWTOY(md5sum, "bc(check)s(status)[!bc]", TOYFLAG_USR|TOYFLAG_BIN))
+USE_MD5SUM(NEWTOY(md5sum, "j#<1bc(check)s(status)[!bc]", TOYFLAG_USR|TOYFLAG_BIN))
 USE_SHA1SUM(OLDTOY(sha1sum, md5sum, TOYFLAG_USR|TOYFLAG_BIN))
 USE_SHA224SUM(OLDTOY(sha224sum, md5sum, TOYFLAG_USR|TOYFLAG_BIN))
 USE_SHA256SUM(OLDTOY(sha256sum, md5sum, TOYFLAG_USR|TOYFLAG_BIN))
@@ -27,7 +27,7 @@ config MD5SUM
   bool "md5sum"
   default y
   help
-    usage: ???sum [-bcs] [FILE]...
+    usage: ???sum [-bcs] [-j N] [FILE]...
 
     Calculate hash for each input file, reading from stdin if none, writing
     hexadecimal digits to stdout for each input file (md5=32 hex digits,
@@ -35,6 +35,7 @@ config MD5SUM
 
     -b	Brief (hash only, no filename)
     -c	Check each line of each FILE is the same hash+filename we'd output
+    -j	Hash N files at once (output stays in order)
     -s	No output, exit status 0 if all hashes match, 1 otherwise
 
 config SHA1SUM
@@ -73,9 +74,21 @@ config SHA512SUM
 #include "toys.h"
 
 GLOBALS(
+  long j;
+
   int sawline;
+  struct hashjob *jobs;
+  long count, next;
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
 )
 
+// A file to hash. For -c, line is the expected hash (or 0 for a bad line).
+struct hashjob {
+  char *name, *line, *hash;
+  int err, done;
+};
+
 // Callback for loopfiles()
 // Call builtin or lib hash function, then display output if necessary
 static void do_hash(int fd, char *name)
@@ -85,58 +98,151 @@ static void do_hash(int fd, char *name)
   if (name) printf("%s  %s\n"+4*FLAG(b), toybuf, name);
 }
 
-static void do_c_line(char *line)
+// Open and hash job's file, called from worker threads so can't print or exit
+static void hash_job(struct hashjob *job)
+{
+  char hash[129] = "";
+  int fd = 0;
+
+  if (job->line && strcmp(job->name, "-")) fd = open(job->name, O_RDONLY);
+  if (fd == -1) job->err = errno;
+  else if (job->line) hash_by_name(fd, toys.which->name, hash);
+  if (fd>0) close(fd);
+  job->hash = xstrdup(hash);
+}
+
+// Report result of job, in order
+static void show_job(struct hashjob *job)
 {
-  int space = 0, fail = 0, fd;
+  int fail = 0;
+
+  if (!job->line) error_msg("bad line %s", job->name);
+  else if (job->err) {
+    errno = job->err;
+    perror_msg_raw(job->name);
+  }
+  if (FLAG(c) && job->line) {
+    if (strcasecmp(job->line, job->hash)) toys.exitval = fail = 1;
+    if (!FLAG(s)) printf("%s: %s\n", job->name, fail ? "FAILED" : "OK");
+  } else if (!FLAG(c) && !job->err)
+    printf("%s  %s\n"+4*FLAG(b), job->hash, job->name);
+  free(job->hash);
+}
+
+static void *hash_thread(void *unused)
+{
+  long i;
+
+  for (;;) {
+    pthread_mutex_lock(&TT.lock);
+    i = TT.next++;
+    pthread_mutex_unlock(&TT.lock);
+    if (i>=TT.count) break;
+    hash_job(TT.jobs+i);
+    pthread_mutex_lock(&TT.lock);
+    TT.jobs[i].done = 1;
+    pthread_cond_broadcast(&TT.cond);
+    pthread_mutex_unlock(&TT.lock);
+  }
+
+  return 0;
+}
+
+// Hash -j files at a time in worker threads, showing results in order
+static void hash_jobs(struct hashjob *jobs, long count)
+{
+  pthread_t *threads = xmalloc(TT.j*sizeof(pthread_t));
+  long i;
+
+  TT.jobs = jobs;
+  TT.count = count;
+  TT.next = 0;
+  pthread_mutex_init(&TT.lock, 0);
+  pthread_cond_init(&TT.cond, 0);
+  for (i = 0; i<TT.j && i<count; i++)
+    if ((errno = pthread_create(threads+i, 0, hash_thread, 0)))
+      perror_exit("pthread_create");
+  for (i = 0; i<count; i++) {
+    pthread_mutex_lock(&TT.lock);
+    while (!jobs[i].done) pthread_cond_wait(&TT.cond, &TT.lock);
+    pthread_mutex_unlock(&TT.lock);
+    show_job(jobs+i);
+  }
+  for (i = 0; i<TT.j && i<count; i++) pthread_join(threads[i], 0);
+  pthread_cond_destroy(&TT.cond);
+  pthread_mutex_destroy(&TT.lock);
+  free(threads);
+}
+
+// Split "hash  name" line into job, leaving job->line 0 if it's bad
+static void c_line_job(char *line, struct hashjob *job)
+{
+  int space = 0;
   char *name;
 
+  memset(job, 0, sizeof(*job));
+  job->name = line;
   for (name = line; *name; name++) {
     if (isspace(*name)) {
       space++;
       *name = 0;
     } else if (space) break;
   }
-  if (!space || !*line || !*name) return error_msg("bad line %s", line);
-
-  fd = !strcmp(name, "-") ? 0 : open(name, O_RDONLY);
-
+  if (!space || !*line || !*name) return;
+  job->name = name;
+  job->line = line;
   TT.sawline = 1;
-  if (fd==-1) {
-    perror_msg_raw(name);
-    *toybuf = 0;
-  } else do_hash(fd, 0);
-  if (strcasecmp(line, toybuf)) toys.exitval = fail = 1;
-  if (!FLAG(s)) printf("%s: %s\n", name, fail ? "FAILED" : "OK");
-  if (fd>0) close(fd);
 }
 
 // Used instead of loopfiles_line to report error on files containing no hashes.
 static void do_c_file(char *name)
 {
   FILE *fp = !strcmp(name, "-") ? stdin : fopen(name, "r");
+  struct hashjob *jobs = 0, job;
   char *line;
+  long count = 0;
 
   if (!fp) return perror_msg_raw(name);
 
   TT.sawline = 0;
 
+  // Check each line as we go, or read them all in to hash in parallel
   for (;;) {
     if (!(line = xgetline(fp))) break;
-    do_c_line(line);
-    free(line);
+    if (TT.j>1) {
+      if (!(count&255)) jobs = xrealloc(jobs, (count+256)*sizeof(*jobs));
+      c_line_job(line, jobs+count++);
+    } else {
+      c_line_job(line, &job);
+      hash_job(&job);
+      show_job(&job);
+      free(line);
+    }
   }
   if (fp!=stdin) fclose(fp);
+  if (count) {
+    hash_jobs(jobs, count);
+    while (count--) free(jobs[count].line ? : jobs[count].name);
+    free(jobs);
+  }
 
   if (!TT.sawline) error_msg("%s: no lines", name);
 }
 
 void md5sum_main(void)
 {
+  struct hashjob *jobs;
   int i;
 
   if (FLAG(c)) for (i = 0; toys.optargs[i]; i++) do_c_file(toys.optargs[i]);
   else {
     if (FLAG(s)) error_exit("-s only with -c");
-    loopfiles(toys.optargs, do_hash);
+    if (TT.j>1 && toys.optc) {
+      jobs = xzalloc(toys.optc*sizeof(*jobs));
+      for (i = 0; i<toys.optc; i++)
+        jobs[i].name = jobs[i].line = toys.optargs[i];
+      hash_jobs(jobs, toys.optc);
+      free(jobs);
+    } else loopfiles(toys.optargs, do_hash);
   }
 }
@@ -5,30 +5,39 @@
  * See https://www.ietf.org/rfc/rfc2616.txt
  *
  * TODO: multiple domains, https, actual inetd with ratelimit...
- * range, gzip, ETag (If-None-Match:, Last-Modified:), Date:
- * "Accept-Ranges: bytes"/"Range: bytes=xxx-[yyy]"
- * .htaccess (auth, forward)
+ * on the fly gzip, .htaccess (auth, forward)
  * optional conf file, error pages
- * -ifv -p [IP:]PORT -u [USER][:GRP] -c CFGFILE
+ * -if -u [USER][:GRP] -c CFGFILE
  * cgi: SERVER_PORT SERVER_NAME REMOTE_ADDR REMOTE_HOST REQUEST_METHOD
 
-USE_HTTPD(NEWTOY(httpd, ">1v", TOYFLAG_USR|TOYFLAG_BIN|TOYFLAG_LINEBUF))
+USE_HTTPD(NEWTOY(httpd, ">1j#<1=1p:v", TOYFLAG_USR|TOYFLAG_BIN|TOYFLAG_LINEBUF))
 
 config HTTPD
   bool "httpd"
   default y
   help
-    usage: httpd [-de STR] [-v] [DIR]
+    usage: httpd [-de STR] [-v] [-p [IP:]PORT [-j NUM]] [DIR]
 
-    Serve contents of directory as static web pages.
+    Serve contents of directory as static web pages. Handles one connection
+    on stdin/stdout (from inetd) unless -p says where to listen.
 
     -e	Escape STR as URL, printing result and exiting.
     -d	Decode escaped STR, printing result and exiting.
+    -j	Number of worker processes for -p (default 1)
+    -p	Listen on [IP:]PORT
     -v	Verbose
 */
 
 #define FOR_httpd
 #include "toys.h"
+#ifdef __linux__
+#include <sys/sendfile.h>
+#endif
+
+GLOBALS(
+  char *p;
+  long j;
+)
 
 char *rfc1123(char *buf, time_t t)
 {
@@ -68,23 +77,49 @@ char *mime(char *file)
   return toybuf;
 }
 
-// Stop: header time.
-static void header_time(int stat, char *str, char *more)
+// One client connection: request bytes read, reply text being written,
+// then file contents being sent.
+struct httpd_conn {
+  int in, out, file, keep, eof;
+  char *req, *reply;
+  long reqlen, replen, sent;
+  off_t pos;
+  long long left, time;
+};
+
+// Append len bytes (or strlen if len<0) to reply
+static void reply(struct httpd_conn *hc, char *s, long len)
+{
+  if (len<0) len = strlen(s);
+  hc->reply = xrealloc(hc->reply, hc->replen+len+1);
+  memcpy(hc->reply+hc->replen, s, len);
+  hc->replen += len;
+}
+
+// Stop: header time. Body length len<0 means unknown, so close after it.
+static void header_time(struct httpd_conn *hc, int stat, char *str, char *more,
+  long long len)
 {
-  char buf[64];
+  char buf[64], cl[64] = "", *s;
 
   if (!more) more = "";
+  if (len<0) hc->keep = 0;
+  else sprintf(cl, "Content-Length: %lld\r\n", len);
   if (FLAG(v)) dprintf(2, "REPLY: %d %s\n%s\n", stat, str, more);
-  xprintf("HTTP/1.1 %d %s\r\nServer: toybox httpd/%s\r\nDate: %s\r\n%s"
-    "Connection: close\r\n\r\n", stat, str, TOYBOX_VERSION,
-    rfc1123(buf, time(0)), more);
+  reply(hc, s = xmprintf("HTTP/1.1 %d %s\r\nServer: toybox httpd/%s\r\n"
+    "Date: %s\r\n%s%sConnection: %s\r\n\r\n", stat, str, TOYBOX_VERSION,
+    rfc1123(buf, time(0)), more, cl, hc->keep ? "keep-alive" : "close"), -1);
+  free(s);
 }
 
-static void error_time(int stat, char *str)
+static void error_time(struct httpd_conn *hc, int stat, char *str)
 {
-  header_time(stat, str, 0);
-  xprintf("<html><head><title>%d %s</title></head>"
+  char *s = xmprintf("<html><head><title>%d %s</title></head>"
     "<body><h3>%d %s</h3></body></html>", stat, str, stat, str);
+
+  header_time(hc, stat, str, 0, strlen(s));
+  reply(hc, s, -1);
+  free(s);
 }
 
 static int isunder(char *file, char *dir)
@@ -98,16 +133,147 @@ static int isunder(char *file, char *dir)
   return rc;
 }
 
-// Handle a connection on fd
-void handle(int infd, int outfd)
+// Parse Range: bytes= list into start/end pairs, returning how many numbers
+// that is (0 if nothing satisfiable), or -1 if it doesn't parse
+static int ranges(char *s, long long size, long long *rr)
 {
-  FILE *fp = fdopen(infd, "r");
-  char *s = xgetline(fp), *cut, *ss, *esc, *path, *word[3];
-  int i = sizeof(toybuf), fd;
+  long long start, end;
+  int nr = 0;
+
+  for (;; s++) {
+    s += strspn(s, " ");
+    end = size-1;
+    if (*s=='-') {
+      if (!isdigit(*++s)) return -1;
+      if (0>(start = size-strtoll(s, &s, 10))) start = 0;
+    } else {
+      if (!isdigit(*s)) return -1;
+      start = strtoll(s, &s, 10);
+      if (*s++!='-') return -1;
+      if (isdigit(*s) && (end = strtoll(s, &s, 10))<start) return -1;
+      if (end>=size) end = size-1;
+    }
+    if (start<=end) {
+      rr[nr++] = start;
+      rr[nr++] = end;
+    }
+    s += strspn(s, " ");
+    if (!*s) return nr;
+    if (*s!=',') return -1;
+  }
+}
 
-  if (!s) return;
+// Queue reply sending file fd, or whatever part of it the request headers
+// (Range, If-Range, If-None-Match, If-Modified-Since, Accept-Encoding) ask for
+static void reply_file(struct httpd_conn *hc, char *name, int fd,
+  struct stat *st, char **hdr)
+{
+  char buf[64], bound[17], *type = xstrdup(mime(name)), *more, *etag, *s, *ss;
+  long long *rr = 0, start, end, len;
+  struct stat gz;
+  struct tm tm;
+  int i, nr = -1, vary;
+
+  // Serve precompressed name.gz when there is one and client takes gzip
+  s = xmprintf("%s.gz", name);
+  vary = !stat(s, &gz) && S_ISREG(gz.st_mode) && isunder(s, ".");
+  if (vary && (ss = hdr[4]) && (ss = strcasestr(ss, "gzip"))) {
+    ss += 4+strspn(ss+4, " ");
+    if ((*ss!=';' || !(ss = strstr(ss, "q=")) || strtod(ss+2, 0)>0)
+      && -1 != (i = open(s, O_RDONLY)))
+    {
+      close(fd);
+      fd = i;
+      st = &gz;
+    }
+  }
+  free(s);
+  etag = xmprintf("\"%llx-%llx-%llx\"", (long long)st->st_ino,
+    (long long)st->st_size, (long long)st->st_mtime);
+  more = xmprintf("Last-Modified: %s\r\nETag: %s\r\nAccept-Ranges: bytes\r\n"
+    "%s%s", rfc1123(buf, st->st_mtime), etag,
+    vary ? "Vary: Accept-Encoding\r\n" : "",
+    st==&gz ? "Content-Encoding: gzip\r\n" : "");
 
-  if (!getsockname(0, (void *)&toybuf, &i)) {
+  // Conditional GET, If-None-Match overrides If-Modified-Since
+  if ((s = hdr[2])) i = !strcmp(s, "*") || strstr(s, etag);
+  else if ((s = hdr[3]) && strptime(s, "%a, %d %b %Y %T GMT",
+    memset(&tm, 0, sizeof(tm)))) i = st->st_mtime <= timegm(&tm);
+  else i = 0;
+  if (i) {
+    header_time(hc, 304, "Not Modified", more, st->st_size);
+    close(fd);
+    goto done;
+  }
+
+  // Range is ignored if it doesn't parse or If-Range says file changed
+  if ((s = hdr[0]) && strstart(&s, "bytes=")
+    && (!(ss = hdr[1]) || !strcmp(ss, etag) || !strcmp(ss, buf)))
+    nr = ranges(s, st->st_size, rr = xmalloc((strlen(s)+2)*sizeof(*rr)));
+
+  // Send no range, multipart/byteranges, or one range/whole file from fd.
+  // (Multiple ranges get read into memory, so only do that up to 1 meg.)
+  for (len = i = 0; i<nr; i += 2) len += rr[i+1]-rr[i]+1;
+  if (!nr) {
+    header_time(hc, 416, "Range Not Satisfiable", s = xmprintf(
+      "Content-Range: bytes */%lld\r\n", (long long)st->st_size), 0);
+    free(s);
+  } else if (nr>2 && len<=(1<<20)) {
+    xgetrandom(toybuf, 8);
+    for (i = 0; i<8; i++) sprintf(bound+2*i, "%02x", toybuf[i]);
+    start = hc->replen;
+    for (i = 0; i<nr; i += 2) {
+      reply(hc, s = xmprintf("\r\n--%s\r\nContent-Type: %s\r\nContent-Range: "
+        "bytes %lld-%lld/%lld\r\n\r\n", bound, type, rr[i], rr[i+1],
+        (long long)st->st_size), -1);
+      free(s);
+      for (end = rr[i]; end<=rr[i+1]; end += len) {
+        len = rr[i+1]+1-end;
+        if (len>sizeof(libbuf)) len = sizeof(libbuf);
+        if (1>(len = pread(fd, libbuf, len, end))) break;
+        reply(hc, libbuf, len);
+      }
+    }
+    reply(hc, s = xmprintf("\r\n--%s--\r\n", bound), -1);
+    free(s);
+
+    // Move body out of the way to put header in front
+    len = hc->replen-start;
+    memcpy(ss = xmalloc(len), hc->reply+start, len);
+    hc->replen = start;
+    header_time(hc, 206, "Partial Content", s = xmprintf("Content-Type: "
+      "multipart/byteranges; boundary=%s\r\n%s", bound, more), len);
+    free(s);
+    reply(hc, ss, len);
+    free(ss);
+  } else {
+    if (nr==2) header_time(hc, 206, "Partial Content", s = xmprintf(
+      "Content-Type: %s\r\nContent-Range: bytes %lld-%lld/%lld\r\n%s", type,
+      rr[0], rr[1], (long long)st->st_size, more), len);
+    else header_time(hc, 200, "Ok", s = xmprintf("Content-Type: %s\r\n%s",
+      type, more), len = st->st_size);
+    free(s);
+    hc->file = fd;
+    hc->pos = nr==2 ? *rr : 0;
+    hc->left = len;
+    fd = -1;
+  }
+  if (fd != -1) close(fd);
+done:
+  free(rr);
+  free(more);
+  free(etag);
+  free(type);
+}
+
+// Handle one request (header block s) from a connection, queueing reply
+static void handle(struct httpd_conn *hc, char *s)
+{
+  char *cut, *ss, *esc, *path, *word[3], *hdr[5] = {0}, *hdrs[] = {"Range:",
+    "If-Range:", "If-None-Match:", "If-Modified-Since:", "Accept-Encoding:"};
+  int i = sizeof(toybuf), fd;
+
+  if (!getsockname(hc->in, (void *)&toybuf, &i)) {
     if (FLAG(v))
       dprintf(2, "Hello %s\n%s\n", ntop((void *)toybuf), s);
   }
@@ -118,84 +284,251 @@ void handle(int infd, int outfd)
     while (*ss && !strchr(" \r\n", *ss)) ss++;
     while (*ss && strchr(" \r\n", *ss)) *(ss++) = 0;
     if (i==3) break;
-    if (!*ss) return header_time(400, "Bad Request", 0);
+    if (!*ss) {
+      hc->keep = 0;
+
+      return error_time(hc, 400, "Bad Request");
+    }
   }
 
-  // Process additional http/1.1 lines
-  while ((ss = xgetline(fp))) {
-    i = *chomp(ss);
+  // Process additional http/1.1 lines. HTTP/1.1 defaults to keep-alive.
+  hc->keep = !strcmp(word[2], "HTTP/1.1");
+  for (; *ss; ss = cut) {
+    if ((cut = strchr(ss, '\n'))) *(cut++) = 0;
+    else cut = ss+strlen(ss);
+    if (!*chomp(ss)) break;
     if (FLAG(v)) dprintf(2, "%s\n", ss);
 // TODO: any of
 //User-Agent: Wget/1.20.1 (linux-gnu) - do we want to log anything?
 //Accept: */* - 406 Too Snobbish
-//Accept-Encoding: identity - we can gzip?
 //Host: landley.net  - we could handle multiple domains?
-//Connection: Keep-Alive - probably don't care
-
-    free(ss);
-    if (!i) break;
+    if (strcasestart(&ss, "Connection:")) {
+      if (strcasestr(ss, "close")) hc->keep = 0;
+      else if (strcasestr(ss, "keep-alive")) hc->keep = 1;
+    } else for (i = 0; i<ARRAY_LEN(hdrs); i++)
+      if (strcasestart(&ss, hdrs[i])) hdr[i] = ss+strspn(ss, " \t");
   }
 
   if (!strcasecmp(word[0], "get")) {
     struct stat st;
 
-    if (*(ss = word[1])!='/') error_time(400, "Bad Request");
+    if (*(ss = word[1])!='/') return error_time(hc, 400, "Bad Request");
     while (*ss=='/') ss++;
     if (!*ss) ss = "./";
     else if ((cut = unescape_url(ss, 1))) setenv("QUERY_STRING", cut, 1);
 
     // TODO domain.com:/path/to/blah domain2.com:/path/to/that
     // TODO cgi PATH_INFO /path/to/filename.cgi/and/more/stuff?path&info
-    if (!isunder(ss, ".") || stat(ss, &st)) error_time(404, "Not Found");
-    else if (-1 == (fd = open(ss, O_RDONLY))) error_time(403, "Forbidden");
-    else if (!S_ISDIR(st.st_mode)) {
-      char buf[64];
-file:
-      header_time(200, "Ok", ss = xmprintf("Content-Type: %s\r\n"
-        "Content-Length: %lld\r\nLast-Modified: %s\r\n",
-        mime(ss), (long long)st.st_size, rfc1123(buf, st.st_mtime)));
-      free(ss);
-      xsendfile(fd, outfd);
-    } else if (ss[strlen(ss)-1]!='/') {
-      header_time(302, "Found", path = xmprintf("Location: %s/\r\n", word[1]));
+    if (!isunder(ss, ".") || stat(ss, &st)) error_time(hc, 404, "Not Found");
+    else if (-1 == (fd = open(ss, O_RDONLY))) error_time(hc, 403, "Forbidden");
+    else if (!S_ISDIR(st.st_mode)) reply_file(hc, ss, fd, &st, hdr);
+    else if (ss[strlen(ss)-1]!='/') {
+      header_time(hc, 302, "Found", path = xmprintf("Location: %s/\r\n",
+        word[1]), 0);
       free(path);
+      close(fd);
     } else {
       DIR *dd;
       struct dirent *dir;
+      long len;
 
       // Do we have an index.html?
-      path = ss;
-      ss = "index.html";
-      path = xmprintf("%s%s", path, ss);
+      path = xmprintf("%sindex.html", ss);
       if (stat(path, &st) || !S_ISREG(st.st_mode)) i = -1;
-      else if (-1 == (i = open(path, O_RDONLY))) error_time(403, "Forbidden");
+      else if (-1 == (i = open(path, O_RDONLY))) {
+        error_time(hc, 403, "Forbidden");
+        i = -2;
+      } else reply_file(hc, path, i, &st, hdr);
       free(path);
       if (i != -1) {
         close(fd);
-        fd = i;
 
-        goto file;
+        return;
       }
 
-      // List directory contents
-      header_time(200, "Ok", "Content-Type: text/html\r\n");
-      dprintf(outfd, "<html><head><title>Index of %s</title></head>\n"
-        "<body><h3>Index of %s</h3></body>\n", word[1], word[1]);
+      // List directory contents, then stick the header in front of it
+      len = hc->replen;
+      reply(hc, path = xmprintf("<html><head><title>Index of %s</title>"
+        "</head>\n<body><h3>Index of %s</h3></body>\n", word[1], word[1]), -1);
+      free(path);
       for (dd = fdopendir(fd); (dir = readdir(dd));) {
         esc = escape_url(dir->d_name, "<>&\"");
-        dprintf(outfd, "<a href=\"%s\">%s</a><br />\n", esc, esc);
+        reply(hc, path = xmprintf("<a href=\"%s\">%s</a><br />\n", esc, esc),
+          -1);
+        free(path);
         free(esc);
       }
-      dprintf(outfd, "</body></html>\n");
+      closedir(dd);
+      reply(hc, "</body></html>\n", -1);
+      path = xstrndup(hc->reply+len, hc->replen-len);
+      hc->replen = len;
+      header_time(hc, 200, "Ok", "Content-Type: text/html\r\n", strlen(path));
+      reply(hc, path, -1);
+      free(path);
+    }
+  } else error_time(hc, 501, "Not Implemented");
+}
+
+// Send up to len bytes of file at *pos, returns bytes written (or -1)
+static long send_file(int out, int in, off_t *pos, long long len)
+{
+  long ll;
+
+  if (len>(1<<30)) len = 1<<30;
+#ifdef __linux__
+  if (0<=(ll = sendfile(out, in, pos, len)) || errno==EAGAIN) return ll;
+#endif
+  if (len>sizeof(libbuf)) len = sizeof(libbuf);
+  if (0<(ll = pread(in, libbuf, len, *pos)) && 0<(ll = write(out, libbuf, ll)))
+    *pos += ll;
+
+  return ll;
+}
+
+// Advance connection as far as it goes without blocking, returning 0 when
+// it's done. Sends queued reply, then starts next buffered request.
+static int httpd_step(struct httpd_conn *hc, int revents)
+{
+  char *s, *end;
+  long len;
+
+  if ((revents&~POLLOUT) && !hc->eof) {
+    hc->req = xrealloc(hc->req, hc->reqlen+4096);
+    if (0<(len = read(hc->in, hc->req+hc->reqlen, 4096))) hc->reqlen += len;
+    else if (!len || errno!=EAGAIN) hc->eof = 1;
+  }
+
+  for (;;) {
+    if (hc->sent<hc->replen) {
+      if (0>(len = write(hc->out, hc->reply+hc->sent, hc->replen-hc->sent)))
+        return errno==EAGAIN;
+      hc->sent += len;
+    } else if (hc->left) {
+      if (1>(len = send_file(hc->out, hc->file, &hc->pos, hc->left)))
+        return len && errno==EAGAIN;
+      hc->left -= len;
+    } else {
+      if (hc->file != -1) close(hc->file);
+      hc->file = -1;
+      hc->sent = hc->replen = 0;
+      if (!hc->keep) return 0;
+
+      // Skip blank lines between requests, then find end of next header
+      for (len = 0; len<hc->reqlen; len++)
+        if (hc->req[len]!='\r' && hc->req[len]!='\n') break;
+      memmove(hc->req, hc->req+len, hc->reqlen -= len);
+      end = hc->req+hc->reqlen;
+      for (s = hc->req; (s = memchr(s, '\n', end-s)); s++) {
+        if (s+1<end && s[1]=='\n') len = 2;
+        else if (s+2<end && s[1]=='\r' && s[2]=='\n') len = 3;
+        else continue;
+        break;
+      }
+      if (s) len += s-hc->req;
+      else if (hc->reqlen>=65536) {
+        hc->keep = hc->reqlen = 0;
+        error_time(hc, 431, "Request Header Fields Too Large");
+
+        continue;
+      } else if (hc->eof && hc->reqlen) len = hc->reqlen;
+      else return !hc->eof;
+
+      s = xstrndup(hc->req, len);
+      memmove(hc->req, hc->req+len, hc->reqlen -= len);
+      handle(hc, s);
+      free(s);
     }
-  } else error_time(501, "Not Implemented");
-  free(s);
+    hc->time = millitime();
+  }
+}
+
+// Serve connections accepted from sock (or just stdin/stdout if sock<0)
+static void httpd_loop(int sock)
+{
+  struct httpd_conn *hc = 0;
+  struct pollfd *pfd = 0;
+  long long now;
+  int count = 0, i, fd, accepting;
+
+  for (fd = sock<0 ? 0 : -1;;) {
+    // Add new connection
+    if (fd != -1) {
+      hc = xrealloc(hc, (count+1)*sizeof(*hc));
+      memset(hc+count, 0, sizeof(*hc));
+      hc[count].in = fd;
+      hc[count].out = sock<0 ? 1 : fd;
+      hc[count].file = -1;
+      hc[count].keep = 1;
+      hc[count++].time = millitime();
+
+      // Header and file go out in separate writes, don't wait for ack between
+      i = 1;
+      setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &i, sizeof(i));
+    } else if (!count && sock<0) break;
+
+    // Each connection waits to either read a request or write a reply
+    pfd = xrealloc(pfd, (count+1)*sizeof(*pfd));
+    for (i = 0; i<count; i++) {
+      fd = hc[i].sent<hc[i].replen || hc[i].left;
+      pfd[i].fd = fd ? hc[i].out : hc[i].in;
+      pfd[i].events = fd ? POLLOUT : POLLIN;
+    }
+    pfd[count].fd = sock;
+    pfd[count].events = POLLIN;
+    xpoll(pfd, count+(sock>=0), count ? 5000 : -1);
+    accepting = sock>=0 && pfd[count].revents;
+
+    // Service connections, closing finished ones and ones idle for a minute
+    now = millitime();
+    for (i = count; i--;) {
+      if (pfd[i].revents ? httpd_step(hc+i, pfd[i].revents)
+        : now-hc[i].time<60000) continue;
+      if (sock>=0) close(hc[i].in);
+      if (hc[i].file != -1) close(hc[i].file);
+      free(hc[i].req);
+      free(hc[i].reply);
+      hc[i] = hc[--count];
+    }
+
+    // Accept new connection (other workers may have beaten us to it)
+    if (!accepting || -1 == (fd = accept(sock, 0, 0))) fd = -1;
+    else {
+      fcntl(fd, F_SETFL, O_NONBLOCK);
+      fcntl(fd, F_SETFD, FD_CLOEXEC);
+    }
+  }
 }
 
 void httpd_main(void)
 {
-  if (toys.optc && chdir(*toys.optargs))
-    return error_time(500, "Internal Error");
-  // inetd only at the moment
-  handle(0, 1);
+  char *host = 0, *port = TT.p, *s;
+  int sock = -1, i;
+
+  if (toys.optc && chdir(*toys.optargs)) {
+    struct httpd_conn hc;
+
+    memset(&hc, 0, sizeof(hc));
+    error_time(&hc, 500, "Internal Error");
+    xwrite(1, hc.reply, hc.replen);
+
+    return;
+  }
+
+  // Without -p we were launched from inetd with connection on stdin/stdout
+  if (FLAG(p)) {
+    if ((s = strrchr(TT.p, ':'))) {
+      *s = 0;
+      port = s+1;
+      host = TT.p;
+      if (*host=='[' && (s = strchr(++host, ']'))) *s = 0;
+    }
+    sock = xbindany(xgetaddrinfo(host, port, AF_UNSPEC, SOCK_STREAM, 0, 0));
+    if (listen(sock, SOMAXCONN)) perror_exit("listen");
+    fcntl(sock, F_SETFL, O_NONBLOCK);
+    xsignal(SIGPIPE, SIG_IGN);
+
+    // Prefork worker processes sharing the listening socket
+    for (i = 1; CFG_TOYBOX_FORK && i<TT.j; i++) if (!xfork()) break;
+  }
+  httpd_loop(sock);
 }
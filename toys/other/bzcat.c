@@ -11,20 +11,21 @@
  * No standard.
 
 
-USE_BZCAT(NEWTOY(bzcat, 0, TOYFLAG_USR|TOYFLAG_BIN))
-USE_BUNZIP2(NEWTOY(bunzip2, "cftkv", TOYFLAG_USR|TOYFLAG_BIN))
+USE_BZCAT(NEWTOY(bzcat, "j#<1", TOYFLAG_USR|TOYFLAG_BIN))
+USE_BUNZIP2(NEWTOY(bunzip2, "cftkvj#<1", TOYFLAG_USR|TOYFLAG_BIN))
 
 config BUNZIP2
   bool "bunzip2"
   default y
   help
-    usage: bunzip2 [-cftkv] [FILE...]
+    usage: bunzip2 [-cftkv] [-j N] [FILE...]
 
     Decompress listed files (file.bz becomes file) deleting archive file(s).
     Read from stdin if no files listed.
 
     -c	Force output to stdout
     -f	Force decompression (if FILE doesn't end in .bz, replace original)
+    -j	Decompress N blocks at once (default number of CPUs)
     -k	Keep input files (-c and -t imply this)
     -t	Test integrity
     -v	Verbose
@@ -33,14 +34,20 @@ config BZCAT
   bool "bzcat"
   default y
   help
-    usage: bzcat [FILE...]
+    usage: bzcat [-j N] [FILE...]
 
     Decompress listed files to stdout. Use stdin if no files listed.
+
+    -j	Decompress N blocks at once (default number of CPUs)
 */
 
 #define FOR_bunzip2
 #include "toys.h"
 
+GLOBALS(
+  long j;
+)
+
 #define THREADS 1
 
 // Constants for huffman coding
@@ -82,10 +89,11 @@ struct bwdata {
 // Structure holding all the housekeeping data, including IO buffers and
 // memory that persists between calls to bunzip
 struct bunzip_data {
-  // Input stream, input buffer, input bit buffer
+  // Input stream, input buffer, input bit buffer, where to go on EOF
   int in_fd, inbufCount, inbufPos;
   char *inbuf;
   unsigned int inbufBitCount, inbufBits;
+  jmp_buf *jmp;
 
   // Output buffer
   char outbuf[IOBUF_SIZE];
@@ -120,7 +128,7 @@ static unsigned int get_bits(struct bunzip_data *bd, char bits_wanted)
     // If we need to read more data from file into byte buffer, do so
     if (bd->inbufPos == bd->inbufCount) {
       if (0 >= (bd->inbufCount = read(bd->in_fd, bd->inbuf, IOBUF_SIZE)))
-        longjmp((void *)toybuf, RETVAL_EOF_IN);
+        longjmp(*bd->jmp, RETVAL_EOF_IN);
       bd->inbufPos = 0;
     }
 
@@ -499,7 +507,7 @@ static int read_bunzip_data(struct bunzip_data *bd)
   int rc = read_block_header(bd, bd->bwdata);
   if (!rc) rc=read_huffman_data(bd, bd->bwdata);
 
-  // First thing that can be done by a background thread.
+  // (bunzip_parallel() does all of this in worker threads instead.)
   burrows_wheeler_prep(bd, bd->bwdata);
 
   return rc;
@@ -618,6 +626,7 @@ static int start_bunzip(struct bunzip_data **bdp, int src_fd, char *inbuf,
 
   // Allocate bunzip_data. Most fields initialize to zero.
   bd = *bdp = xzalloc(i);
+  bd->jmp = (void *)toybuf;
   if (len) {
     bd->inbuf = inbuf;
     bd->inbufCount = len;
@@ -643,6 +652,270 @@ static int start_bunzip(struct bunzip_data **bdp, int src_fd, char *inbuf,
   return 0;
 }
 
+// Parallel decompression: the main thread scans input for block signatures
+// (which can start at any bit offset), worker threads decode each block into
+// memory, and the main thread writes them out in order.
+
+struct bunzip_job {
+  struct bunzip_job *next;
+  long long pos;          // bit offset of this block's signature in input
+  char *in, *out;         // in[0] is the byte containing bit pos
+  unsigned inlen, outlen, outmax, crc;
+  int state, rc;          // state 0 = queued, 1 = decoding, 2 = done
+};
+
+struct bunzip_pool {
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+  struct bunzip_job *first, *last;
+  struct bunzip_data *bd;
+  unsigned dbufSize, totalCRC;
+  int count, done;
+};
+
+static struct bunzip_data *bunzip_alloc(unsigned dbufSize)
+{
+  struct bunzip_data *bd = xzalloc(sizeof(struct bunzip_data));
+
+  bd->in_fd = -1;
+  crc_init(bd->crc32Table, 0);
+  bd->bwdata->dbuf = xmalloc((bd->dbufSize = dbufSize)*sizeof(int));
+
+  return bd;
+}
+
+// Undo burrows-wheeler transform of a whole block into job->out
+static int bunzip_unwind(struct bunzip_data *bd, struct bwdata *bw,
+  struct bunzip_job *job)
+{
+  unsigned *dbuf = bw->dbuf, crc = 0xffffffff;
+  int count = bw->writeCount, pos = bw->writePos, current = bw->writeCurrent,
+    run = bw->writeRun, previous, copies, outbyte;
+
+  while (count--) {
+    previous = current;
+    pos = dbuf[pos];
+    current = pos&0xff;
+    pos >>= 8;
+    if (run++ == 3) {
+      copies = current;
+      outbyte = previous;
+      current = -1;
+    } else {
+      copies = 1;
+      outbyte = current;
+    }
+    if (job->outlen+copies > job->outmax)
+      job->out = xrealloc(job->out, job->outmax = 2*job->outmax+copies);
+    while (copies--) {
+      job->out[job->outlen++] = outbyte;
+      crc = (crc << 8) ^ bd->crc32Table[(crc >> 24) ^ outbyte];
+    }
+    if (current != previous) run = 0;
+  }
+  if ((job->crc = ~crc) != bw->headerCRC) return RETVAL_DATA_ERROR;
+
+  return 0;
+}
+
+// Decode one block (or end of stream marker) from job->in to job->out
+static int bunzip_block(struct bunzip_data *bd, struct bunzip_job *job)
+{
+  struct bwdata *bw = bd->bwdata;
+  jmp_buf jmp;
+  int rc;
+
+  bd->inbuf = job->in;
+  bd->inbufCount = job->inlen;
+  bd->inbufPos = bd->inbufBitCount = job->outlen = 0;
+  bd->jmp = &jmp;
+  if (!(rc = setjmp(jmp))) {
+    get_bits(bd, job->pos&7);
+    if (!(rc = read_block_header(bd, bw)) && !(rc = read_huffman_data(bd, bw)))
+    {
+      burrows_wheeler_prep(bd, bw);
+      rc = bunzip_unwind(bd, bw, job);
+    } else if (rc == RETVAL_LAST_BLOCK) job->crc = bw->headerCRC;
+  }
+
+  return rc;
+}
+
+static void *bunzip_worker(void *arg)
+{
+  struct bunzip_pool *bp = arg;
+  struct bunzip_data *bd = bunzip_alloc(bp->dbufSize);
+  struct bunzip_job *job;
+
+  for (;;) {
+    pthread_mutex_lock(&bp->lock);
+    for (;;) {
+      for (job = bp->done ? 0 : bp->first; job && job->state; job = job->next);
+      if (job || bp->done) break;
+      pthread_cond_wait(&bp->cond, &bp->lock);
+    }
+    if (job) job->state = 1;
+    pthread_mutex_unlock(&bp->lock);
+    if (!job) break;
+
+    job->rc = bunzip_block(bd, job);
+
+    pthread_mutex_lock(&bp->lock);
+    job->state = 2;
+    pthread_cond_broadcast(&bp->cond);
+    pthread_mutex_unlock(&bp->lock);
+  }
+  free(bd->bwdata->dbuf);
+  free(bd);
+
+  return 0;
+}
+
+// Remove first job from the list, or the one after first if which
+static void bunzip_unqueue(struct bunzip_pool *bp, int which)
+{
+  struct bunzip_job *job, **prev = &bp->first;
+
+  pthread_mutex_lock(&bp->lock);
+  if (which) prev = &(*prev)->next;
+  if (!((*prev = (job = *prev)->next))) bp->last = which ? bp->first : 0;
+  bp->count--;
+  pthread_mutex_unlock(&bp->lock);
+  free(job->in);
+  free(job->out);
+  free(job);
+}
+
+// Write out decoded blocks in order, waiting while more than limit are
+// queued. A false signature match inside a block's data cuts it short, so
+// glue that onto the next piece and try again. Returns 1 at end of stream.
+static int bunzip_retire(struct bunzip_pool *bp, int out_fd, int limit)
+{
+  struct bunzip_job *job, *next;
+  int ready, kk;
+
+  for (;;) {
+    pthread_mutex_lock(&bp->lock);
+    while ((job = bp->first) && job->state!=2 && bp->count>limit)
+      pthread_cond_wait(&bp->cond, &bp->lock);
+    ready = job && job->state==2;
+    if (ready && job->rc==RETVAL_EOF_IN && (next = job->next))
+      while (next->state!=2) pthread_cond_wait(&bp->cond, &bp->lock);
+    pthread_mutex_unlock(&bp->lock);
+    if (!ready) return 0;
+
+    if (job->rc == RETVAL_EOF_IN) {
+      if (!(next = job->next)) return limit ? 0 : RETVAL_EOF_IN;
+      kk = next->pos/8-job->pos/8;
+      job->in = xrealloc(job->in, kk+next->inlen);
+      memcpy(job->in+kk, next->in, job->inlen = next->inlen);
+      job->inlen += kk;
+      bunzip_unqueue(bp, 1);
+      if (!bp->bd) bp->bd = bunzip_alloc(bp->dbufSize);
+      job->rc = bunzip_block(bp->bd, job);
+
+      continue;
+    }
+    if (job->rc == RETVAL_LAST_BLOCK)
+      return job->crc==bp->totalCRC ? 1 : RETVAL_DATA_ERROR;
+    if (job->rc) return job->rc;
+    if (writeall(out_fd, job->out, job->outlen) != job->outlen)
+      return RETVAL_EOF_OUT;
+    bp->totalCRC = ((bp->totalCRC << 1) | (bp->totalCRC >> 31)) ^ job->crc;
+    bunzip_unqueue(bp, 0);
+  }
+}
+
+static void bunzip_queue(struct bunzip_pool *bp, struct bunzip_job *job)
+{
+  pthread_mutex_lock(&bp->lock);
+  if (bp->last) bp->last->next = job;
+  else bp->first = job;
+  bp->last = job;
+  bp->count++;
+  pthread_cond_broadcast(&bp->cond);
+  pthread_mutex_unlock(&bp->lock);
+}
+
+static int bunzip_parallel(int src_fd, int dst_fd)
+{
+  struct bunzip_pool bp;
+  struct bunzip_job *job = 0, *next;
+  pthread_t *threads = xmalloc(TT.j*sizeof(pthread_t));
+  unsigned long long reg = 0, mm;
+  long long bits = 32, pos;
+  char *buf = xmalloc(65536);
+  int i, len, kk, rc = 0, max = 1<<18;
+
+  // File header: "BZh" then block size in units of 100k, '1'-'9'
+  memset(&bp, 0, sizeof(bp));
+  if (4 != readall(src_fd, buf, 4)) rc = RETVAL_EOF_IN;
+  else if (smemcmp(buf, "BZh", 3) || buf[3]<'1' || buf[3]>'9')
+    rc = RETVAL_NOT_BZIP_DATA;
+  if (rc) goto done;
+  bp.dbufSize = 100000*(buf[3]-'0');
+  pthread_mutex_init(&bp.lock, 0);
+  pthread_cond_init(&bp.cond, 0);
+  for (i = 0; i<TT.j; i++)
+    if ((errno = pthread_create(threads+i, 0, bunzip_worker, &bp)))
+      perror_exit("pthread_create");
+
+  // Each block (and the end of stream marker) starts with a 48 bit signature
+  // at any bit offset, so check all 8 alignments ending in each new byte.
+  job = xzalloc(sizeof(*job));
+  job->in = xmalloc(max);
+  job->pos = 32;
+  while (0<(len = read(src_fd, buf, 65536))) {
+    for (i = 0; i<len; i++) {
+      if (job->inlen == max) job->in = xrealloc(job->in, max *= 2);
+      job->in[job->inlen++] = buf[i];
+      reg = (reg<<8)|(unsigned char)buf[i];
+      bits += 8;
+      for (kk = 0; kk<8; kk++) {
+        mm = (reg>>kk)&0xffffffffffffULL;
+        if (mm != 0x314159265359ULL && mm != 0x177245385090ULL) continue;
+        if ((pos = bits-48-kk) <= job->pos) continue;
+
+        // Next block starts at pos: copy its start to a new job
+        next = xzalloc(sizeof(*next));
+        next->pos = pos;
+        pos = pos/8-job->pos/8;
+        next->in = xmalloc(max = 1<<18);
+        memcpy(next->in, job->in+pos, next->inlen = job->inlen-pos);
+        job->inlen = (next->pos+7)/8-job->pos/8;
+        bunzip_queue(&bp, job);
+        job = next;
+        if ((rc = bunzip_retire(&bp, dst_fd, 2*TT.j))) goto done;
+      }
+    }
+  }
+  bunzip_queue(&bp, job);
+  job = 0;
+  if (!(rc = bunzip_retire(&bp, dst_fd, 0))) rc = RETVAL_EOF_IN;
+
+done:
+  if (job) {
+    free(job->in);
+    free(job);
+  }
+  if (bp.dbufSize) {
+    pthread_mutex_lock(&bp.lock);
+    bp.done = 1;
+    pthread_cond_broadcast(&bp.cond);
+    pthread_mutex_unlock(&bp.lock);
+    for (i = 0; i<TT.j; i++) pthread_join(threads[i], 0);
+    while (bp.first) bunzip_unqueue(&bp, 0);
+    if (bp.bd) {
+      free(bp.bd->bwdata->dbuf);
+      free(bp.bd);
+    }
+  }
+  free(threads);
+  free(buf);
+
+  return rc==1 ? 0 : rc;
+}
+
 // Example usage: decompress src_fd to dst_fd. (Stops at end of bzip data,
 // not end of file.)
 static char *bunzipStream(int src_fd, int dst_fd)
@@ -652,6 +925,7 @@ static char *bunzipStream(int src_fd, int dst_fd)
     "out EOF"};
   int i, j;
 
+  if (TT.j>1) return bunzip_errors[-bunzip_parallel(src_fd, dst_fd)];
   if (!(i = setjmp((void *)toybuf)) && !(i = start_bunzip(&bd, src_fd, 0, 0))) {
     i = write_bunzip_data(bd, bd->bwdata, dst_fd, 0, 0);
     if (i==RETVAL_LAST_BLOCK) {
@@ -681,6 +955,7 @@ static void do_bzcat(int fd, char *name)
 
 void bzcat_main(void)
 {
+  if (!FLAG(j)) TT.j = sysconf(_SC_NPROCESSORS_ONLN);
   loopfiles(toys.optargs, do_bzcat);
 }
 
@@ -725,5 +1000,6 @@ static void do_bunzip2(int fd, char *name)
 
 void bunzip2_main(void)
 {
+  if (!FLAG(j)) TT.j = sysconf(_SC_NPROCESSORS_ONLN);
   loopfiles(toys.optargs, do_bunzip2);
 }
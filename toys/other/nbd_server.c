@@ -7,82 +7,269 @@
  * See https://github.com/NetworkBlockDevice/nbd/blob/master/doc/proto.md
 
 // Work around dash in name trying to put - in function name.
-USE_NBD_SERVER(NEWTOY(nbd_server, "<1>1r", 0))
+USE_NBD_SERVER(NEWTOY(nbd_server, "<1>1j#<1=8nr", 0))
 USE_NBD_SERVER(OLDTOY(nbd-server, nbd_server, TOYFLAG_USR|TOYFLAG_BIN))
 
 config NBD_SERVER
   bool "nbd-server"
   default y
   help
-    usage: nbd-server [-r] FILE
+    usage: nbd-server [-nr] [-j N] FILE
 
     Serve a Network Block Device from FILE on stdin/out (ala inetd).
 
+    -j	Handle up to N requests at once (default 8)
+    -n	Newstyle handshake (default oldstyle)
     -r	Read only export
 */
 
-// TODO: -r, block size, exit signal?
+// TODO: block size, exit signal?
 
 #define FOR_nbd_server
 #include "toys.h"
 
-static int copy_loop(int from, int to, unsigned len)
+GLOBALS(
+  long j;
+
+  int fd, structured, busy, done;
+  struct nbd_req *first, *last;
+  pthread_mutex_t lock, wlock;
+  pthread_cond_t cond;
+)
+
+// Request read from client. Data goes in buf after room for reply header.
+struct nbd_req {
+  struct nbd_req *next;
+  char *buf;
+  unsigned long long handle, offset;
+  unsigned length, flags, type;
+};
+
+// Has flags, can flush, fua, trim, write zeroes, maybe read only
+#define NBD_FLAGS (1+4+8+32+64+2*FLAG(r))
+
+// Read or write all of len bytes at offset, returning errno or 0
+static int nbd_io(int write, char *buf, unsigned len, off_t offset)
 {
-  int try, rc = 0;
+  ssize_t ll;
 
-  errno = 0;
-  while (len) {
-    xreadall(from, toybuf, try = len>4096 ? 4096 : len);
-    if (!rc && try != writeall(to, toybuf, try)) rc = errno;
-    len -= try;
+  for (; len; len -= ll, buf += ll, offset += ll) {
+    ll = write ? pwrite(TT.fd, buf, len, offset)
+      : pread(TT.fd, buf, len, offset);
+    if (ll<1) return ll ? errno : EINVAL;
   }
 
-  return rc;
+  return 0;
 }
 
-void nbd_server_main(void)
+// Trim (advisory, so ignore failure) or write zeroes, returning errno or 0
+static int nbd_zero(struct nbd_req *req)
 {
-  unsigned long long *ll = (void *)toybuf, offset, handle;
-  unsigned short *ss = (void *)toybuf;
-  unsigned *uu = (void *)toybuf, type, length;
-  int fd = xopen(*toys.optargs, O_RDWR*!FLAG(r));
+  unsigned long long len;
+  char *zero;
+  int rc = 0;
 
-  type = 1;
-  setsockopt(0, IPPROTO_TCP, TCP_NODELAY, &type, sizeof(int));
+#ifdef FALLOC_FL_PUNCH_HOLE
+  // NO_HOLE flag means client wants zeroes allocated, else can punch hole
+  if (!fallocate(TT.fd, FALLOC_FL_KEEP_SIZE|((req->type==6 && (req->flags&2))
+    ? FALLOC_FL_ZERO_RANGE : FALLOC_FL_PUNCH_HOLE), req->offset, req->length))
+      return 0;
+#endif
+  if (req->type==4) return 0;
+  zero = xzalloc(len = req->length<65536 ? req->length : 65536);
+  for (; !rc && req->length; req->length -= len, req->offset += len) {
+    if (len>req->length) len = req->length;
+    rc = nbd_io(1, zero, len, req->offset);
+  }
+  free(zero);
 
-  // Send original recipe negotiation, with device length and flags
-  memcpy(toybuf, "NBDMAGIC\x00\x00\x42\x02\x81\x86\x12\x53", 16);
-  ll[2] = SWAP_BE64(fdlength(fd));
-  uu[6] = SWAP_BE32(5+2*FLAG(r)); // has flags, can flush, maybe read only
-  xwrite(1, toybuf, 152);
+  return rc;
+}
+
+// Worker thread: service queued requests, replying in whatever order they
+// finish (client matches them up by handle).
+static void *nbd_thread(void *unused)
+{
+  struct nbd_req *req;
+  char *s;
+  int err, len;
 
-  // Simple loop, handles one request at a time with "simple" reply.
   for (;;) {
-    // Fetch request into toybuf
-    xreadall(0, toybuf, 28);
-    if (SWAP_BE32(*uu) != 0x25609513) break;
-    type = SWAP_BE16(ss[3]);
-    handle = SWAP_BE64(ll[1]);
-    offset = SWAP_BE64(ll[2]);
-    length = SWAP_BE32(uu[6]);
-
-    // type 0 = read, 1 = write, 2 = disconnect, 3 = flush
-    if (type==2 || type>3) break;  // disconnect
-    if (type==3) { // flush
-      if (fdatasync(fd)) uu[1] = SWAP_BE32(errno);
+    pthread_mutex_lock(&TT.lock);
+    while (!(req = TT.first) && !TT.done) pthread_cond_wait(&TT.cond, &TT.lock);
+    if (req && !(TT.first = req->next)) TT.last = 0;
+    pthread_mutex_unlock(&TT.lock);
+    if (!req) break;
+
+    // type 0 = read, 1 = write, 3 = flush, 4 = trim, 6 = write zeroes
+    err = 0;
+    if (req->type==1 || req->type==4 || req->type==6) {
+      if (FLAG(r)) err = EPERM;
+      else if (req->type==1) err = nbd_io(1, req->buf+32, req->length,
+        req->offset);
+      else err = nbd_zero(req);
+      // FUA: force unit access
+      if (!err && (req->flags&1) && fdatasync(TT.fd)) err = errno;
+    } else if (!req->type)
+      err = nbd_io(0, req->buf+32, req->length, req->offset);
+    else if (req->type==3) {
+      if (fdatasync(TT.fd)) err = errno;
+    } else err = EINVAL;
+
+    // Reply header goes in front of read data. Reads get structured replies
+    // if negotiated: one data chunk or an error chunk, either flagged done.
+    s = req->buf+32;
+    if (TT.structured && !req->type) {
+      if (err) {
+        poke_be(s -= 6, err, 4);
+        poke_be(s+4, 0, 2);
+      } else poke_be(s -= 8, req->offset, 8);
+      len = req->buf+32-s+(!err*req->length);
+      poke_be(s -= 20, 0x668e33ef, 4);
+      poke_be(s+4, 1, 2);
+      poke_be(s+6, err ? 32769 : 1, 2);
+      poke_be(s+8, req->handle, 8);
+      poke_be(s+16, len, 4);
+      len += 20;
     } else {
-      xlseek(fd, offset, SEEK_SET);
-      if (type==1) { // write
-        uu[1] = copy_loop(0, fd, length);
-        ll[1] = SWAP_BE64(handle);
-      } else uu[1] = 0; // read never reports errors because send header first
+      poke_be(s -= 16, 0x67446698, 4);
+      poke_be(s+4, err, 4);
+      poke_be(s+8, req->handle, 8);
+      len = 16+(!req->type && !err)*req->length;
     }
+    pthread_mutex_lock(&TT.wlock);
+    xwrite(1, s, len);
+    pthread_mutex_unlock(&TT.wlock);
+    free(req->buf);
+    free(req);
+
+    pthread_mutex_lock(&TT.lock);
+    TT.busy--;
+    pthread_cond_broadcast(&TT.cond);
+    pthread_mutex_unlock(&TT.lock);
+  }
+
+  return 0;
+}
 
-    // Simple reply in toybuf (handle stays put)
-    *uu = SWAP_BE32(0x67446698);
-    xwrite(1, toybuf, 16);
+// Send reply to newstyle handshake option
+static void nbd_optreply(unsigned opt, unsigned type, void *data, unsigned len)
+{
+  char buf[20];
 
-    // Append read payload
-    if (!type) if (copy_loop(fd, 1, length)) break;
+  poke_be(buf, 0x3e889045565a9LL, 8);
+  poke_be(buf+8, opt, 4);
+  poke_be(buf+12, type, 4);
+  poke_be(buf+16, len, 4);
+  xwrite(1, buf, 20);
+  if (len) xwrite(1, data, len);
+}
+
+// Fixed newstyle negotiation, returning once client picks the (only) export.
+static void nbd_newstyle(unsigned long long size)
+{
+  char *s = toybuf;
+  unsigned cflags, opt, len;
+
+  // Handshake flags: fixed newstyle, no zeroes
+  xwrite(1, "NBDMAGICIHAVEOPT\0\3", 18);
+  xreadall(0, s, 4);
+  cflags = peek_be(s, 4);
+
+  for (;;) {
+    xreadall(0, s, 16);
+    if (smemcmp(s, "IHAVEOPT", 8)) error_exit("bad option");
+    opt = peek_be(s+8, 4);
+    if ((len = peek_be(s+12, 4))>sizeof(toybuf)-256) error_exit("long option");
+    xreadall(0, s, len);
+
+    // Export info after option data: type 0, size, transmission flags
+    poke_be(s+len, 0, 2);
+    poke_be(s+len+2, size, 8);
+    poke_be(s+len+10, NBD_FLAGS+128*TT.structured, 2);
+    memset(s+len+12, 0, 124);
+
+    // 1 = export name, 2 = abort, 3 = list, 6 = info, 7 = go,
+    // 8 = structured reply. Replies: 1 = ack, 2 = server, 3 = info,
+    // 1<<31 + 1 = unsupported, + 3 = invalid
+    if (opt==1) return xwrite(1, s+len+2, (cflags&2) ? 10 : 134);
+    if (opt==2) {
+      nbd_optreply(opt, 1, 0, 0);
+      xexit();
+    }
+    if (opt==3) nbd_optreply(opt, 2, memset(s, 0, 4), 4);
+    else if (opt==6 || opt==7) nbd_optreply(opt, 3, s+len, 12);
+    else if (opt==8 && !len) TT.structured = 1;
+    else {
+      nbd_optreply(opt, (1<<31)+1+2*(opt==8), 0, 0);
+      continue;
+    }
+    nbd_optreply(opt, 1, 0, 0);
+    if (opt==7) return;
+  }
+}
+
+void nbd_server_main(void)
+{
+  unsigned long long size;
+  pthread_t *threads = xmalloc(TT.j*sizeof(pthread_t));
+  struct nbd_req *req;
+  unsigned type, length;
+  int i;
+
+  TT.fd = xopen(*toys.optargs, O_RDWR*!FLAG(r));
+  size = fdlength(TT.fd);
+  i = 1;
+  setsockopt(0, IPPROTO_TCP, TCP_NODELAY, &i, sizeof(int));
+
+  if (FLAG(n)) nbd_newstyle(size);
+  else {
+    // Send original recipe negotiation, with device length and flags
+    memcpy(toybuf, "NBDMAGIC\x00\x00\x42\x02\x81\x86\x12\x53", 16);
+    poke_be(toybuf+16, size, 8);
+    poke_be(toybuf+24, NBD_FLAGS, 4);
+    xwrite(1, toybuf, 152);
+  }
+
+  // Read requests ahead of worker threads, up to 2 per thread outstanding
+  pthread_mutex_init(&TT.lock, 0);
+  pthread_mutex_init(&TT.wlock, 0);
+  pthread_cond_init(&TT.cond, 0);
+  for (i = 0; i<TT.j; i++)
+    if ((errno = pthread_create(threads+i, 0, nbd_thread, 0)))
+      perror_exit("pthread_create");
+  for (;;) {
+    if (28 != readall(0, toybuf, 28) || peek_be(toybuf, 4) != 0x25609513)
+      break;
+    type = peek_be(toybuf+6, 2);
+    length = peek_be(toybuf+24, 4);
+
+    // type 2 = disconnect. Read/write data is max 32 megs.
+    if (type==2 || (type<2 && length>(1<<25))) break;
+    req = xzalloc(sizeof(*req));
+    req->flags = peek_be(toybuf+4, 2);
+    req->type = type;
+    req->handle = peek_be(toybuf+8, 8);
+    req->offset = peek_be(toybuf+16, 8);
+    req->length = length;
+    req->buf = xmalloc(32+(type<2)*length);
+    if (type==1) xreadall(0, req->buf+32, length);
+
+    pthread_mutex_lock(&TT.lock);
+    while (TT.busy>=2*TT.j) pthread_cond_wait(&TT.cond, &TT.lock);
+    TT.busy++;
+    if (TT.last) TT.last->next = req;
+    else TT.first = req;
+    TT.last = req;
+    pthread_cond_broadcast(&TT.cond);
+    pthread_mutex_unlock(&TT.lock);
   }
+
+  // Let outstanding requests finish and send their replies before exiting
+  pthread_mutex_lock(&TT.lock);
+  TT.done = 1;
+  pthread_cond_broadcast(&TT.cond);
+  pthread_mutex_unlock(&TT.lock);
+  for (i = 0; i<TT.j; i++) pthread_join(threads[i], 0);
+  if (CFG_TOYBOX_FREE) free(threads);
 }
@@ -43,16 +43,22 @@ struct unsocks {
   int sd;
 };
 
-// Log file entry to log into.
+// Log file entry to log into. Regular files buffer output in buf.
 struct logfile {
   struct logfile *next;
   char *filename;
   uint32_t facility[8];
   uint8_t level[LOG_NFACILITIES];
-  int logfd;
+  int logfd, used;
+  long long size;
+  char *buf;
   struct sockaddr_in saddr;
 };
 
+// Datagrams read per recvmmsg(), and per logfile output buffer size
+#define SYSLOG_BATCH 64
+#define SYSLOG_BUFSIZE 16384
+
 GLOBALS(
   char *socket;
   char *config_file;
@@ -67,6 +73,8 @@ GLOBALS(
   struct unsocks *lsocks;  // list of listen sockets
   struct logfile *lfiles;  // list of write logfiles
   int sigfd[2];
+  char *host, stamp[16];   // cached hostname, and timestamp for TT.now
+  time_t now, flushed;
 )
 
 // Lookup numerical code from name
@@ -236,6 +244,7 @@ static int parse_config_file(void)
 static void open_logfiles(void)
 {
   struct logfile *tfd;
+  struct stat st;
 
   for (tfd = TT.lfiles; tfd; tfd = tfd->next) {
     char *p, *tmpfile;
@@ -271,19 +280,42 @@ static void open_logfiles(void)
       tfd->filename = "/dev/console";
       tfd->logfd = open(tfd->filename, O_APPEND);
     }
+
+    // Buffer regular files and track their size (for rotation) ourselves.
+    // Devices (/dev/kmsg, console) and network get one write per message.
+    if (*tfd->filename != '@' && !fstat(tfd->logfd, &st) && S_ISREG(st.st_mode))
+    {
+      tfd->size = st.st_size;
+      tfd->buf = xmalloc(SYSLOG_BUFSIZE);
+    }
   }
 }
 
+// write out buffered log data
+static void flush_logfile(struct logfile *tf)
+{
+  if (tf->used && writeall(tf->logfd, tf->buf, tf->used) != tf->used)
+    perror_msg("write failed file : %s ", tf->filename);
+  tf->size += tf->used;
+  tf->used = 0;
+}
+
+static void flush_logfiles(void)
+{
+  struct logfile *tf;
+
+  for (tf = TT.lfiles; tf; tf = tf->next) if (tf->buf) flush_logfile(tf);
+  TT.flushed = time(0);
+}
+
 //write to file with rotation
 static int write_rotate(struct logfile *tf, int len)
 {
-  int size, isreg;
-  struct stat statf;
-  isreg = (!fstat(tf->logfd, &statf) && S_ISREG(statf.st_mode));
-  size = statf.st_size;
+  if (!tf->buf) return write(tf->logfd, toybuf, len);
 
   if ((toys.optflags & FLAG_s) || (toys.optflags & FLAG_b)) {
-    if (TT.rot_size && isreg && (size + len) > (TT.rot_size*1024)) {
+    if (TT.rot_size && (tf->size + tf->used + len) > (TT.rot_size*1024)) {
+      flush_logfile(tf);
       if (TT.rot_count) { /* always 0..99 */
         int i = strlen(tf->filename) + 3 + 1;
         char old_file[i];
@@ -305,9 +337,14 @@ static int write_rotate(struct logfile *tf, int len)
         }
       }
       ftruncate(tf->logfd, 0);
+      tf->size = 0;
     }
   }
-  return write(tf->logfd, toybuf, len);
+  if (tf->used+len > SYSLOG_BUFSIZE) flush_logfile(tf);
+  memcpy(tf->buf+tf->used, toybuf, len);
+  tf->used += len;
+
+  return len;
 }
 
 //Parse message and write to file.
@@ -315,7 +352,6 @@ static void logmsg(char *msg, int len)
 {
   time_t now;
   char *p, *ts, *lvlstr, *facstr;
-  struct utsname uts;
   int pri = 0;
   struct logfile *tf = TT.lfiles;
 
@@ -331,8 +367,12 @@ static void logmsg(char *msg, int len)
    */
   if (len < 16 || msg[3] != ' ' || msg[6] != ' ' || msg[9] != ':'
       || msg[12] != ':' || msg[15] != ' ') {
-    time(&now);
-    ts = ctime(&now) + 4; /* skip day of week */
+    // only redo ctime() once per second
+    if (time(&now) != TT.now) {
+      TT.now = now;
+      memcpy(TT.stamp, ctime(&now) + 4, 15); /* skip day of week */
+    }
+    ts = TT.stamp;
   } else {
     now = 0;
     ts = msg;
@@ -349,10 +389,9 @@ static void logmsg(char *msg, int len)
     facstr = dec(pri & LOG_FACMASK, facilitynames, facbuf);
     lvlstr = dec(LOG_PRI(pri), prioritynames, pribuf);
 
-    p = "local";
-    if (!uname(&uts)) p = uts.nodename;
     if (toys.optflags & FLAG_S) len = sprintf(toybuf, "%s %s", ts, msg);
-    else len = sprintf(toybuf, "%s %s %s.%s %s", ts, p, facstr, lvlstr, msg);
+    else len = sprintf(toybuf, "%s %s %s.%s %s", ts, TT.host, facstr, lvlstr,
+      msg);
   }
   if (lvl >= TT.log_prio) return;
 
@@ -386,16 +425,39 @@ static void cleanup(void)
     free(fnode);
   }
 
+  flush_logfiles();
   while (TT.lfiles) {
     struct logfile *fnode = TT.lfiles;
 
     free(fnode->filename);
+    free(fnode->buf);
     if (fnode->logfd >= 0) close(fnode->logfd);
     TT.lfiles = fnode->next;
     free(fnode);
   }
 }
 
+// Handle one received datagram (buffer has room for 2 more bytes)
+static void recvd(char *buffer, int len)
+{
+  char *last_buf = toybuf+3072;
+  static int last_len;
+
+  // The syslog function's documentation says that a trailing '\n' is
+  // optional. We trim any that are present, and then append one.
+  while (len > 0 && (buffer[len - 1] == '\n' || buffer[len - 1] == '\0'))
+    --len;
+  if (len <= 0) return;
+  buffer[len++] = '\n';
+  buffer[len] = '\0';
+  if ((toys.optflags & FLAG_D) && len == last_len
+    && !memcmp(last_buf, buffer, len)) return;
+
+  memcpy(last_buf, buffer, len);
+  last_len = len;
+  logmsg(buffer, len);
+}
+
 static void signal_handler(int sig)
 {
   unsigned char ch = sig;
@@ -405,10 +467,23 @@ static void signal_handler(int sig)
 void syslogd_main(void)
 {
   struct unsocks *tsd;
-  int nfds, retval, last_len=0;
+  struct utsname uts;
+  struct mmsghdr msgs[SYSLOG_BATCH];
+  struct iovec iov[SYSLOG_BATCH];
+  int nfds, retval, i, more;
   struct timeval tv;
   fd_set rfds;        // fds for reading
-  char *temp, *buffer = (toybuf +2048), *last_buf = (toybuf + 3072); //these two buffs are of 1K each
+  char *temp, *rbuf = xmalloc(SYSLOG_BATCH*1024);
+
+  // Receive up to SYSLOG_BATCH datagrams at once, each into 1K of rbuf,
+  // reading only 1022 bytes to reserve 1 for '\n' and 1 for '\0'
+  memset(msgs, 0, sizeof(msgs));
+  for (i = 0; i<SYSLOG_BATCH; i++) {
+    iov[i].iov_base = rbuf+1024*i;
+    iov[i].iov_len = 1022;
+    msgs[i].msg_hdr.msg_iov = iov+i;
+    msgs[i].msg_hdr.msg_iovlen = 1;
+  }
 
   if ((toys.optflags & FLAG_p) && (strlen(TT.unix_socket) > 108))
     error_exit("Socket path should not be more than 108");
@@ -416,6 +491,8 @@ void syslogd_main(void)
   TT.config_file = (toys.optflags & FLAG_f) ?
                    TT.config_file : "/etc/syslog.conf"; //DEFCONFFILE
 init_jumpin:
+  free(TT.host);
+  TT.host = xstrdup(uname(&uts) ? "local" : uts.nodename);
   tsd = xzalloc(sizeof(struct unsocks));
 
   tsd->path = (toys.optflags & FLAG_p) ? TT.unix_socket : "/dev/log"; // DEFLOGSOCK
@@ -505,6 +582,7 @@ init_jumpin:
         case SIGINT:     /* FALLTHROUGH */
         case SIGQUIT:
           logmsg("<46>syslogd exiting", 19);
+          flush_logfiles();
           if (CFG_TOYBOX_FREE ) cleanup();
           signal(sig, SIG_DFL);
           sigset_t ss;
@@ -521,36 +599,22 @@ init_jumpin:
         default: break;
       }
     } else { /* Some activity on listen sockets. */
-      for (tsd = TT.lsocks; tsd; tsd = tsd->next) {
-        int sd = tsd->sd;
-        if (FD_ISSET(sd, &rfds)) {
-          // Buffer is of 1 KiB, hence reading only 1022 bytes, reserving 1
-          // for '\n' and 1 for '\0'
-          int len = read(sd, buffer, 1022);
-
-          // The syslog function's documentation says that a trailing '\n' is
-          // optional. We trim any that are present, and then append one.
-          while (len > 0 &&
-                 (buffer[len - 1] == '\n' || buffer[len - 1] == '\0')) {
-            --len;
-          }
-
-          if (len > 0) {
-            buffer[len++] = '\n';
-            buffer[len] = '\0';
-            if((toys.optflags & FLAG_D) && (len == last_len))
-              if (!memcmp(last_buf, buffer, len)) break;
-
-            memcpy(last_buf, buffer, len);
-            last_len = len;
-            logmsg(buffer, len);
-          }
-          break;
-        }
+      for (more = 0, tsd = TT.lsocks; tsd; tsd = tsd->next) {
+        if (!FD_ISSET(tsd->sd, &rfds)) continue;
+        retval = recvmmsg(tsd->sd, msgs, SYSLOG_BATCH, MSG_DONTWAIT, 0);
+        for (i = 0; i<retval; i++)
+          recvd(msgs[i].msg_hdr.msg_iov->iov_base, msgs[i].msg_len);
+        if (retval == SYSLOG_BATCH) more++;
       }
+
+      // Write buffered output once sockets are drained (or once a second
+      // when they never are). Otherwise back to select() for more.
+      if (more && time(0) == TT.flushed) continue;
     }
+    flush_logfiles();
   }
 clean_and_exit:
   logmsg("<46>syslogd exiting", 19);
+  flush_logfiles();
   if (CFG_TOYBOX_FREE ) cleanup();
 }
@@ -37,12 +37,11 @@ config CRC32
 
 static void do_cksum(int fd, char *name)
 {
-  unsigned crc_table[256], crc = FLAG(P) ? ~0 : 0;
+  unsigned crc = FLAG(P) ? ~0 : 0;
   unsigned long long llen = 0, llen2 = 0;
-  int len, i, done = 0;
+  int len, done = 0;
 
-  // Init table, loop through data
-  crc_init(crc_table, FLAG(L));
+  // Loop through data
   for (;;) {
     len = read(fd, toybuf, sizeof(toybuf));
     if (len<0) perror_msg_raw(name);
@@ -52,9 +51,7 @@ static void do_cksum(int fd, char *name)
       for (llen2 = llen, len = 0; llen2; llen2 >>= 8) toybuf[len++] = llen2;
       done++;
     } else llen += len;
-    for (i = 0; i<len; i++)
-      crc = FLAG(L) ? crc_table[(crc^toybuf[i])&0xff] ^ (crc>>8)
-                    : (crc<<8) ^ crc_table[(crc>>24)^toybuf[i]];
+    crc = crc32_update(crc, toybuf, len, FLAG(L));
     if (done) break;
   }
 
@@ -15,7 +15,7 @@
 // options shared between mv/cp must be in same order (right to left)
 // for FLAG macros to work out right in shared infrastructure.
 
-USE_CP(NEWTOY(cp, "<1(preserve):;D(parents)RHLPprudaslv(verbose)nF(remove-destination)fit:T[-HLPd][-niu][+Rr]", TOYFLAG_BIN))
+USE_CP(NEWTOY(cp, "<1(reflink):;(sparse):(preserve):;j#<1=1D(parents)RHLPprudaslv(verbose)nF(remove-destination)fit:T[-HLPd][-niu][+Rr]", TOYFLAG_BIN))
 USE_MV(NEWTOY(mv, "<1x(swap)v(verbose)nF(remove-destination)fit:T[-ni]", TOYFLAG_BIN))
 USE_INSTALL(NEWTOY(install, "<1cdDp(preserve-timestamps)svt:m:o:g:", TOYFLAG_USR|TOYFLAG_BIN))
 
@@ -23,7 +23,7 @@ config CP
   bool "cp"
   default y
   help
-    usage: cp [-aDdFfHiLlnPpRrsTuv] [--preserve=motcxa] [-t TARGET] SOURCE... [DEST]
+    usage: cp [-aDdFfHiLlnPpRrsTuv] [-j N] [--preserve=motcxa] [--reflink[=WHEN]] [--sparse=WHEN] [-t TARGET] SOURCE... [DEST]
 
     Copy files from SOURCE to DEST.  If more than one SOURCE, DEST must
     be a directory.
@@ -35,6 +35,7 @@ config CP
     -f	Delete destination files we can't write to
     -H	Follow symlinks listed on command line
     -i	Interactive, prompt before overwriting existing DEST
+    -j	Copy N files at once
     -L	Follow all symlinks
     -l	Hard link instead of copy
     -n	No clobber (don't overwrite DEST)
@@ -57,6 +58,12 @@ config CP
            xattr - extended attributes
              all - all of the above
 
+    --reflink shares contents copy-on-write (if filesystem can): WHEN is
+    always (default), auto (else copy, as without --reflink), or never.
+
+    --sparse makes holes in DEST where SOURCE has them (auto, the default),
+    also for each block of zeroes (always), or writes all zeroes (never).
+
 config MV
   bool "mv"
   default y
@@ -103,7 +110,9 @@ GLOBALS(
     } i;
     // cp's options
     struct {
-      char *t, *preserve;
+      char *t;
+      long j;
+      char *preserve, *sparse, *reflink;
     } c;
   };
 
@@ -112,7 +121,11 @@ GLOBALS(
   int (*callback)(struct dirtree *try);
   uid_t uid;
   gid_t gid;
-  int pflags;
+  int pflags, reflink, sparse, busy, done, *pending, npending;
+  struct dirtree *first, *last;
+  pthread_t *threads;
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
 )
 
 struct cp_preserve {
@@ -146,164 +159,136 @@ void cp_xattr(int fdin, int fdout, char *file)
   free(list);
 }
 
-// Callback from dirtree_read() for each file/directory under a source dir.
+// Clone file contents copy on write (returns 0), else preallocate large
+// non-sparse files so they don't fragment (returns 1, still needs copying).
+// Returns -1 if --reflink=always couldn't clone.
+static int cp_clone(int fdin, int fdout, struct stat *st)
+{
+#ifdef __linux__
+  if (TT.reflink && st->st_size) {
+    if (!ioctl(fdout, FICLONE, fdin)) return 0;
+    if (TT.reflink>1) return -1;
+  }
+  if (TT.sparse<2 && st->st_size>=(1<<20) && st->st_blocks*512>=st->st_size)
+    fallocate(fdout, FALLOC_FL_KEEP_SIZE, 0, st->st_size);
+#endif
 
-// traverses two directories in parallel: try->dirfd is source dir,
-// try->extra is dest dir. TODO: filehandle exhaustion?
+  return 1;
+}
 
-static int cp_node(struct dirtree *try)
+// Make copy of try named catch in dest dir try->parent->extra, then set its
+// attributes. If fdout != -1 it already exists (COMEAGAIN), just do attributes.
+// Called from cp -j worker threads for regular files.
+
+static int cp_make(struct dirtree *try, char *catch, int fdout, int rr,
+  int save)
 {
-  int fdout = -1, cfd = try->parent ? try->parent->extra : AT_FDCWD,
-      save = DIRTREE_SAVE*(CFG_MV && *toys.which->name == 'm'), rc = 0, rr = 0,
+  int cfd = try->parent ? try->parent->extra : AT_FDCWD, rc = 0,
       tfd = dirtree_parentfd(try);
-  char *s = 0, *catch = try->parent ? try->name : TT.destname, *err = "%s";
-  struct stat cst;
-
-  if (!dirtree_notdotdot(try)) return 0;
+  char *s = 0, *err = fdout==-1 ? "%s" : 0;
 
-  // If returning from COMEAGAIN, jump straight to -p logic at end.
-  if (S_ISDIR(try->st.st_mode) && (try->again&DIRTREE_COMEAGAIN)) {
-    fdout = try->extra;
-    err = 0;
-
-    // If mv child had a problem, free data and don't try to delete parent dir.
-    if (try->child) {
-      save = 0;
-      llist_traverse(try->child, free);
-    }
+  // Loop for -f retry after unlink
+  if (err) do {
+    int ii, fdin = -1;
 
-    cp_xattr(try->dirfd, try->extra, catch);
-  } else {
-    // -d is only the same as -r for symlinks, not for directories
-    if (S_ISLNK(try->st.st_mode) && FLAG(d)) rr++;
+    // directory, hardlink, symlink, mknod (char, block, fifo, socket), file
 
-    // Detect recursive copies via repeated top node (cp -R .. .) or
-    // identical source/target (fun with hardlinks).
-    if ((same_file(&TT.top, &try->st) && (catch = TT.destname))
-        || (!fstatat(cfd, catch, &cst, 0) && same_file(&cst, &try->st)))
-    {
-      error_msg("'%s' is '%s'", catch, err = dirtree_path(try, 0));
-      free(err);
+    // Copy directory
 
-      return save;
-    }
+    if (S_ISDIR(try->st.st_mode)) {
+      struct stat st2;
 
-    // Handle -inuvF
-    if (!faccessat(cfd, catch, F_OK, 0) && !S_ISDIR(cst.st_mode)) {
-      if (S_ISDIR(try->st.st_mode))
-        error_msg("dir at '%s'", s = dirtree_path(try, 0));
-      else if (FLAG(F) && unlinkat(cfd, catch, 0))
-        error_msg("unlink '%s'", catch);
-      else if (FLAG(i)) {
-        fprintf(stderr, "%s: overwrite '%s'", toys.which->name, catch);
-        if (yesno(0)) rc++;
-      } else if (!(FLAG(u) && nanodiff(&try->st.st_mtim, &cst.st_mtim)>0)
-                 && !FLAG(n)) rc++;
-      free(s);
-      if (!rc) return save;
-    }
+      if (!FLAG(a) && !FLAG(r) && !rr) {
+        err = "Skipped dir '%s'";
+        catch = try->name;
+        break;
+      }
 
-    if (FLAG(v)) {
-      printf("%s '%s' -> '%s'\n", toys.which->name, s = dirtree_path(try, 0),
-             catch);
-      free(s);
-    }
+      // Always make directory writeable to us, so we can create files in it.
+      //
+      // Yes, there's a race window between mkdir() and open() so it's
+      // possible that -p can be made to chown a directory other than the one
+      // we created. The closest we can do to closing this is make sure
+      // that what we open _is_ a directory rather than something else.
 
-    // Loop for -f retry after unlink
-    do {
-      int ii, fdin = -1;
+      if (!mkdirat(cfd, catch, try->st.st_mode | 0200) || errno == EEXIST)
+        if (-1 != (try->extra = openat(cfd, catch, O_NOFOLLOW)))
+          if (!fstat(try->extra, &st2) && S_ISDIR(st2.st_mode))
+            return DIRTREE_COMEAGAIN | DIRTREE_SYMFOLLOW*FLAG(L);
 
-      // directory, hardlink, symlink, mknod (char, block, fifo, socket), file
+    // Hardlink
 
-      // Copy directory
+    } else if (FLAG(l)) {
+      if (!linkat(tfd, try->name, cfd, catch, 0)) err = 0;
 
-      if (S_ISDIR(try->st.st_mode)) {
-        struct stat st2;
+    // Copy tree as symlinks. For non-absolute paths this involves
+    // appending the right number of .. entries as you go down the tree.
 
-        if (!FLAG(a) && !FLAG(r) && !rr) {
-          err = "Skipped dir '%s'";
-          catch = try->name;
-          break;
-        }
+    } else if (FLAG(s)) {
+      char *s, *s2;
+      struct dirtree *or;
 
-        // Always make directory writeable to us, so we can create files in it.
-        //
-        // Yes, there's a race window between mkdir() and open() so it's
-        // possible that -p can be made to chown a directory other than the one
-        // we created. The closest we can do to closing this is make sure
-        // that what we open _is_ a directory rather than something else.
-
-        if (!mkdirat(cfd, catch, try->st.st_mode | 0200) || errno == EEXIST)
-          if (-1 != (try->extra = openat(cfd, catch, O_NOFOLLOW)))
-            if (!fstat(try->extra, &st2) && S_ISDIR(st2.st_mode))
-              return DIRTREE_COMEAGAIN | DIRTREE_SYMFOLLOW*FLAG(L);
-
-      // Hardlink
-
-      } else if (FLAG(l)) {
-        if (!linkat(tfd, try->name, cfd, catch, 0)) err = 0;
-
-      // Copy tree as symlinks. For non-absolute paths this involves
-      // appending the right number of .. entries as you go down the tree.
-
-      } else if (FLAG(s)) {
-        char *s, *s2;
-        struct dirtree *or;
-
-        s = dirtree_path(try, 0);
-        for (ii = 0, or = try; or->parent; or = or->parent) ii++;
-        if (*or->name == '/') ii = 0;
-        if (ii) {
-          s2 = xmprintf("%*c%s", 3*ii, ' ', s);
-          free(s);
-          s = s2;
-          while(ii--) {
-            memcpy(s2, "../", 3);
-            s2 += 3;
-          }
-        }
-        if (!symlinkat(s, cfd, catch)) {
-          err = 0;
-          fdout = AT_FDCWD;
-        }
+      s = dirtree_path(try, 0);
+      for (ii = 0, or = try; or->parent; or = or->parent) ii++;
+      if (*or->name == '/') ii = 0;
+      if (ii) {
+        s2 = xmprintf("%*c%s", 3*ii, ' ', s);
         free(s);
+        s = s2;
+        while(ii--) {
+          memcpy(s2, "../", 3);
+          s2 += 3;
+        }
+      }
+      if (!symlinkat(s, cfd, catch)) {
+        err = 0;
+        fdout = AT_FDCWD;
+      }
+      free(s);
 
-      // Do something _other_ than copy contents of a file?
-      } else if (!S_ISREG(try->st.st_mode)
-                 && (try->parent||FLAG(a)||FLAG(P)||FLAG(r)||rr))
+    // Do something _other_ than copy contents of a file?
+    } else if (!S_ISREG(try->st.st_mode)
+               && (try->parent||FLAG(a)||FLAG(P)||FLAG(r)||rr))
+    {
+      // make symlink, or make block/char/fifo/socket
+      if (S_ISLNK(try->st.st_mode)
+          ? readlinkat0(tfd, try->name, toybuf, sizeof(toybuf)) &&
+            (!unlinkat(cfd, catch, 0) || ENOENT == errno) &&
+            !symlinkat(toybuf, cfd, catch)
+          : !mknodat(cfd, catch, try->st.st_mode, try->st.st_rdev))
       {
-        // make symlink, or make block/char/fifo/socket
-        if (S_ISLNK(try->st.st_mode)
-            ? readlinkat0(tfd, try->name, toybuf, sizeof(toybuf)) &&
-              (!unlinkat(cfd, catch, 0) || ENOENT == errno) &&
-              !symlinkat(toybuf, cfd, catch)
-            : !mknodat(cfd, catch, try->st.st_mode, try->st.st_rdev))
-        {
-          err = 0;
-          fdout = AT_FDCWD;
-        }
+        err = 0;
+        fdout = AT_FDCWD;
+      }
 
-      // Copy contents of file.
-      } else {
-        fdin = openat(tfd, try->name, O_RDONLY);
-        if (fdin < 0) {
-          catch = try->name;
-          break;
-        }
+    // Copy contents of file.
+    } else {
+      fdin = openat(tfd, try->name, O_RDONLY);
+      if (fdin < 0) {
+        catch = try->name;
+        break;
+      }
 
-        // When copying contents use symlink target's attributes
-        if (S_ISLNK(try->st.st_mode)) fstat(fdin, &try->st);
-        fdout = openat(cfd, catch, O_RDWR|O_CREAT|O_TRUNC, try->st.st_mode);
-        if (fdout >= 0) {
-          xsendfile(fdin, fdout);
-          err = 0;
+      // When copying contents use symlink target's attributes
+      if (S_ISLNK(try->st.st_mode)) fstat(fdin, &try->st);
+      fdout = openat(cfd, catch, O_RDWR|O_CREAT|O_TRUNC, try->st.st_mode);
+      if (fdout >= 0) {
+        if ((ii = cp_clone(fdin, fdout, &try->st))<0) {
+          err = "reflink '%s'";
+          close(fdin);
+          close(fdout);
+          fdout = -1;
+          break;
         }
-
-        cp_xattr(fdin, fdout, catch);
+        if (ii && sendfile_holes(fdin, fdout, -1, 0, TT.sparse)<0)
+          perror_exit("short write");
+        err = 0;
       }
-      if (fdin != -1) close(fdin);
-    } while (err && (FLAG(f)||FLAG(n)) && !unlinkat(cfd, catch, 0));
-  }
+
+      cp_xattr(fdin, fdout, catch);
+    }
+    if (fdin != -1) close(fdin);
+  } while (err && (FLAG(f)||FLAG(n)) && !unlinkat(cfd, catch, 0));
 
   // Did we make a thing?
   if (fdout != -1) {
@@ -360,6 +345,134 @@ static int cp_node(struct dirtree *try)
   return 0;
 }
 
+// cp -j worker thread: copy queued files, counting them off against their
+// dest dir so its COMEAGAIN can wait to set the dir's metadata.
+static void *cp_thread(void *unused)
+{
+  struct dirtree *try;
+  int fd;
+
+  for (;;) {
+    pthread_mutex_lock(&TT.lock);
+    while (!(try = TT.first) && !TT.done) pthread_cond_wait(&TT.cond, &TT.lock);
+    if (try && !(TT.first = try->next)) TT.last = 0;
+    pthread_mutex_unlock(&TT.lock);
+    if (!try) break;
+
+    cp_make(try, try->name, -1, 0, 0);
+    fd = try->parent->extra;
+    free(try);
+
+    pthread_mutex_lock(&TT.lock);
+    TT.busy--;
+    TT.pending[fd]--;
+    pthread_cond_broadcast(&TT.cond);
+    pthread_mutex_unlock(&TT.lock);
+  }
+
+  return 0;
+}
+
+// Callback from dirtree_read() for each file/directory under a source dir.
+
+// traverses two directories in parallel: try->dirfd is source dir,
+// try->extra is dest dir. TODO: filehandle exhaustion?
+
+static int cp_node(struct dirtree *try)
+{
+  int fdout = -1, cfd = try->parent ? try->parent->extra : AT_FDCWD,
+      save = DIRTREE_SAVE*(CFG_MV && *toys.which->name == 'm'), rc = 0, rr = 0;
+  char *s = 0, *catch = try->parent ? try->name : TT.destname, *err = "%s";
+  struct stat cst;
+
+  if (!dirtree_notdotdot(try)) return 0;
+
+  // If returning from COMEAGAIN, jump straight to -p logic at end.
+  if (S_ISDIR(try->st.st_mode) && (try->again&DIRTREE_COMEAGAIN)) {
+    fdout = try->extra;
+
+    // Wait for -j threads to finish this dir's files before setting its dates
+    if (TT.threads) {
+      pthread_mutex_lock(&TT.lock);
+      while (fdout<TT.npending && TT.pending[fdout])
+        pthread_cond_wait(&TT.cond, &TT.lock);
+      pthread_mutex_unlock(&TT.lock);
+    }
+
+    // If mv child had a problem, free data and don't try to delete parent dir.
+    if (try->child) {
+      save = 0;
+      llist_traverse(try->child, free);
+    }
+
+    cp_xattr(try->dirfd, try->extra, catch);
+  } else {
+    // -d is only the same as -r for symlinks, not for directories
+    if (S_ISLNK(try->st.st_mode) && FLAG(d)) rr++;
+
+    // Detect recursive copies via repeated top node (cp -R .. .) or
+    // identical source/target (fun with hardlinks).
+    if ((same_file(&TT.top, &try->st) && (catch = TT.destname))
+        || (!fstatat(cfd, catch, &cst, 0) && same_file(&cst, &try->st)))
+    {
+      error_msg("'%s' is '%s'", catch, err = dirtree_path(try, 0));
+      free(err);
+
+      return save;
+    }
+
+    // Handle -inuvF
+    if (!faccessat(cfd, catch, F_OK, 0) && !S_ISDIR(cst.st_mode)) {
+      if (S_ISDIR(try->st.st_mode))
+        error_msg("dir at '%s'", s = dirtree_path(try, 0));
+      else if (FLAG(F) && unlinkat(cfd, catch, 0))
+        error_msg("unlink '%s'", catch);
+      else if (FLAG(i)) {
+        fprintf(stderr, "%s: overwrite '%s'", toys.which->name, catch);
+        if (yesno(0)) rc++;
+      } else if (!(FLAG(u) && nanodiff(&try->st.st_mtim, &cst.st_mtim)>0)
+                 && !FLAG(n)) rc++;
+      free(s);
+      if (!rc) return save;
+    }
+
+    if (FLAG(v)) {
+      printf("%s '%s' -> '%s'\n", toys.which->name, s = dirtree_path(try, 0),
+             catch);
+      free(s);
+    }
+
+    // Queue file copies for -j threads, which need a copy of the node
+    if (TT.threads && try->parent && S_ISREG(try->st.st_mode) && !FLAG(l)
+        && !FLAG(s))
+    {
+      int len = sizeof(*try)+strlen(try->name)+1;
+      struct dirtree *new = xmalloc(len);
+
+      memcpy(new, try, len);
+      new->next = 0;
+      pthread_mutex_lock(&TT.lock);
+      while (TT.busy>=16*TT.c.j) pthread_cond_wait(&TT.cond, &TT.lock);
+      if (cfd>=TT.npending) {
+        TT.pending = xrealloc(TT.pending, (cfd+1)*sizeof(int));
+        memset(TT.pending+TT.npending, 0, (cfd+1-TT.npending)*sizeof(int));
+        TT.npending = cfd+1;
+      }
+      TT.pending[cfd]++;
+      TT.busy++;
+      if (TT.last) TT.last->next = new;
+      else TT.first = new;
+      TT.last = new;
+      pthread_cond_broadcast(&TT.cond);
+      pthread_mutex_unlock(&TT.lock);
+
+      return 0;
+    }
+  }
+
+  return cp_make(try, catch, fdout, rr, save);
+}
+
 void cp_main(void)
 {
   char *tt = *toys.which->name == 'i' ? TT.i.t : TT.c.t,
@@ -410,6 +523,24 @@ void cp_main(void)
   if (TT.pflags & _CP_mode) umask(0);
   if (!TT.callback) TT.callback = cp_node;
 
+  // Default to cloning and sparse files when we can, like coreutils 9
+  TT.reflink = TT.sparse = 1;
+  if (FLAG(reflink) && (TT.reflink = TT.c.reflink
+      ? anystr(TT.c.reflink, (char *[]){"never", "auto", "always", 0})-1 : 2)<0)
+    error_exit("bad --reflink=%s", TT.c.reflink);
+  if (FLAG(sparse) && (TT.sparse =
+      anystr(TT.c.sparse, (char *[]){"never", "auto", "always", 0})-1)<0)
+    error_exit("bad --sparse=%s", TT.c.sparse);
+
+  if (FLAG(j) && TT.c.j>1) {
+    TT.threads = xmalloc(TT.c.j*sizeof(pthread_t));
+    pthread_mutex_init(&TT.lock, 0);
+    pthread_cond_init(&TT.cond, 0);
+    for (i = 0; i<TT.c.j; i++)
+      if ((errno = pthread_create(TT.threads+i, 0, cp_thread, 0)))
+        perror_exit("pthread_create");
+  }
+
   // Loop through sources
   for (i=0; i<toys.optc; i++) {
     char *src = toys.optargs[i], *trail;
@@ -463,6 +594,19 @@ void cp_main(void)
     }
     if (destdir) free(TT.destname);
   }
+
+  // Each dir's COMEAGAIN waited for its files, so threads are idle.
+  if (TT.threads) {
+    pthread_mutex_lock(&TT.lock);
+    TT.done = 1;
+    pthread_cond_broadcast(&TT.cond);
+    pthread_mutex_unlock(&TT.lock);
+    for (i = 0; i<TT.c.j; i++) pthread_join(TT.threads[i], 0);
+    if (CFG_TOYBOX_FREE) {
+      free(TT.threads);
+      free(TT.pending);
+    }
+  }
 }
 
 // Export cp's flags into mv and install flag context.
@@ -56,7 +56,8 @@ struct dd_flag {
 };
 
 static const struct dd_flag dd_conv[] = TAGGED_ARRAY(DD_conv,
-  {"fsync"}, {"noerror"}, {"notrunc"}, {"sync"}, {"nocreat"}, // TODO sparse excl
+  {"fsync"}, {"noerror"}, {"notrunc"}, {"sync"}, {"nocreat"}, {"sparse"},
+  // TODO excl
 );
 
 static const struct dd_flag dd_iflag[] = TAGGED_ARRAY(DD_iflag,
@@ -153,7 +154,8 @@ void dd_main()
     count = ULLONG_MAX, buflen;
   long long len;
   struct iovec iov[2];
-  int opos, olen, ifd = 0, ofd = 1, trunc = O_TRUNC, iflags, oflags, ii;
+  int opos, olen, ifd = 0, ofd = 1, trunc = O_TRUNC, iflags, oflags, ii,
+    sought = 0;
   unsigned conv = 0, iflag = 0, oflag = 0;
 
   TT.show_xfer = TT.show_records = 1;
@@ -239,8 +241,13 @@ void dd_main()
     // to realign data but is still a single atomic write.
     while (olen>=obs || (olen && (bs || !count))) {
       errno = 0;
-      len = writev(ofd, iov, iovwrap(buf, buflen, opos, minof(obs, olen), iov));
-      if (len<1) {
+      ii = iovwrap(buf, buflen, opos, len = minof(obs, olen), iov);
+
+      // conv=sparse seeks past all zero blocks (when output can seek)
+      if ((conv & _DD_conv_sparse) && allzero(iov[0].iov_base, iov[0].iov_len)
+          && (ii==1 || allzero(iov[1].iov_base, iov[1].iov_len))
+          && lseek(ofd, len, SEEK_CUR) != -1) sought = 1;
+      else if ((len = writev(ofd, iov, ii))<1) {
         if (errno==EINTR) continue;
         perror_exit("%s: write error", oname);
       }
@@ -282,6 +289,13 @@ void dd_main()
     olen += len;
     count -= minof(len, count);
   }
+  // Extend output over trailing seek (if we didn't write after it)
+  if (sought) {
+    struct stat st;
+
+    if ((len = lseek(ofd, 0, SEEK_CUR))>0 && !fstat(ofd, &st)
+        && st.st_size<len && ftruncate(ofd, len)) perror_exit("truncate");
+  }
   if ((conv & _DD_conv_fsync) && fsync(ofd)) perror_exit("%s: fsync", oname);
 
   if (CFG_TOYBOX_FREE) {
@@ -4,17 +4,16 @@
  *
  * See http://opengroup.org/onlinepubs/9699919799/utilities/du.html
  *
- * TODO: cleanup (should seen_inode be lib?)
- * 32 bit du -b maxes out at 4 gigs (instead of 2 terabytes via *512 trick)
+ * TODO: 32 bit du -b maxes out at 4 gigs (instead of 2 terabytes via *512 trick)
  * because dirtree->extra is a long.
 
-USE_DU(NEWTOY(du, "d#<0=-1hmlcaHkKLsxb[-HL][-kKmh]", TOYFLAG_USR|TOYFLAG_BIN))
+USE_DU(NEWTOY(du, "d#<0=-1j#<1=1hmlcaHkKLsxb[-HL][-kKmh]", TOYFLAG_USR|TOYFLAG_BIN))
 
 config DU
   bool "du"
   default y
   help
-    usage: du [-d N] [-abcHKkLlmsx] [FILE...]
+    usage: du [-d N] [-j N] [-abcHKkLlmsx] [FILE...]
 
     Show disk usage, space consumed by files and directories.
 
@@ -30,6 +29,7 @@ config DU
     -c	Cumulative total
     -d N	Only depth < N
     -H	Follow symlinks on cmdline
+    -j	Read N directories at once
     -L	Follow all symlinks
     -l	Disable hardlink filter
     -s	Only total size of each argument
@@ -40,11 +40,12 @@ config DU
 #include "toys.h"
 
 GLOBALS(
-  long d;
+  long j, d;
 
-  unsigned long depth, total;
+  unsigned long total;
   dev_t st_dev;
-  void *inodes;
+  struct hardlinks inodes;
+  pthread_mutex_t lock;
 )
 
 typedef struct node_size {
@@ -55,9 +56,12 @@ typedef struct node_size {
 // Print the size and name, given size in bytes
 static void print(long long size, struct dirtree *node)
 {
+  struct dirtree *dt = node;
   char *name = "total";
+  unsigned long depth = 0;
 
-  if (TT.depth > TT.d) return;
+  if (dt) while ((dt = dt->parent)) depth++;
+  if (depth > TT.d) return;
 
   if (FLAG(h)) {
     human_readable(toybuf, size, 0);
@@ -76,39 +80,11 @@ static void print(long long size, struct dirtree *node)
   if (node) free(name);
 }
 
-// Return whether or not we've seen this inode+dev, adding it to the list if
-// we haven't.
-static int seen_inode(void **list, struct stat *st)
-{
-  if (!st) llist_traverse(st, free);
-
-  // Skipping dir nodes isn't _quite_ right. They're not hardlinked, but could
-  // be bind mounted. Still, it's more efficient and the archivers can't use
-  // hardlinked directory info anyway. (Note that we don't catch bind mounted
-  // _files_ because it doesn't change st_nlink.)
-  else if (!S_ISDIR(st->st_mode) && st->st_nlink > 1) {
-    struct inode_list {
-      struct inode_list *next;
-      struct dev_ino di;
-    } *new;
-
-    for (new = *list; new; new = new->next)
-      if(same_dev_ino(st, &new->di)) return 1;
-
-    new = xzalloc(sizeof(*new));
-    new->di.ino = st->st_ino;
-    new->di.dev = st->st_dev;
-    new->next = *list;
-    *list = new;
-  }
-
-  return 0;
-}
-
 // dirtree callback, compute/display size of node
 static int do_du(struct dirtree *node)
 {
   unsigned long blocks, again = node->again&DIRTREE_COMEAGAIN;
+  int seen;
 
   if (!node->parent) TT.st_dev = node->st.st_dev;
   else if (!dirtree_notdotdot(node)) return 0;
@@ -123,21 +99,28 @@ static int do_du(struct dirtree *node)
     while ((try = try->parent)) if (same_file(&node->st, &try->st)) return 0;
   }
 
-  // Don't count hard links twice
-  if (!FLAG(l) && !again)
-    if (seen_inode(&TT.inodes, &node->st)) return 0;
+  // Don't count hard links twice (-s callbacks can come from multiple threads)
+  // Skipping dir nodes isn't _quite_ right. They're not hardlinked, but could
+  // be bind mounted. Still, it's more efficient and the archivers can't use
+  // hardlinked directory info anyway. (Note that we don't catch bind mounted
+  // _files_ because it doesn't change st_nlink.)
+  if (!FLAG(l) && !again && !S_ISDIR(node->st.st_mode)
+    && node->st.st_nlink>1)
+  {
+    pthread_mutex_lock(&TT.lock);
+    seen = !!hardlink_seen(&TT.inodes, &node->st, "", FLAG(H)|FLAG(L));
+    pthread_mutex_unlock(&TT.lock);
+    if (seen) return 0;
+  }
 
   // Collect child info before printing directory size
-  if (S_ISDIR(node->st.st_mode)) {
-    if (!again) {
-      TT.depth++;
-      return DIRTREE_COMEAGAIN|DIRTREE_SYMFOLLOW*FLAG(L);
-    } else TT.depth--;
-  }
+  if (S_ISDIR(node->st.st_mode) && !again)
+    return DIRTREE_COMEAGAIN|DIRTREE_SYMFOLLOW*FLAG(L);
 
   // Modern compilers' optimizers are insane and think signed overflow
   // behaves differently than unsigned overflow. Sigh. Big hammer.
   blocks = FLAG(b) ? node->st.st_size : node->st.st_blocks;
+  pthread_mutex_lock(&TT.lock);
   blocks += (unsigned long)node->extra;
   node->extra = blocks;
   if (node->parent)
@@ -148,6 +131,7 @@ static int do_du(struct dirtree *node)
     blocks = node->extra;
     print(FLAG(b) ? blocks : blocks*512LL, node);
   }
+  pthread_mutex_unlock(&TT.lock);
 
   return 0;
 }
@@ -156,10 +140,13 @@ void du_main(void)
 {
   char *noargs[] = {".", 0}, **args;
 
-  // Loop over command line arguments, recursing through children
+  // Loop over command line arguments, recursing through children. Order
+  // doesn't matter when only showing totals.
+  pthread_mutex_init(&TT.lock, 0);
   for (args = toys.optc ? toys.optargs : noargs; *args; args++)
-    dirtree_flagread(*args, DIRTREE_SYMFOLLOW*(FLAG(H)|FLAG(L)), do_du);
+    dirtree_parallel(*args, DIRTREE_SYMFOLLOW*(FLAG(H)|FLAG(L))
+      |DIRTREE_UNORDERED*(FLAG(s) && !FLAG(a)), do_du, TT.j);
   if (FLAG(c)) print(FLAG(b) ? TT.total : TT.total*512, 0);
 
-  if (CFG_TOYBOX_FREE) seen_inode(TT.inodes, 0);
+  if (CFG_TOYBOX_FREE) hardlink_free(&TT.inodes);
 }
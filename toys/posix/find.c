@@ -9,18 +9,19 @@
  * Not treating two {} as an error, but only using last
  * TODO: -context
 
-USE_FIND(NEWTOY(find, "?^HL[-HL]", TOYFLAG_USR|TOYFLAG_BIN))
+USE_FIND(NEWTOY(find, "?^j#<1=1HL[-HL]", TOYFLAG_USR|TOYFLAG_BIN))
 
 config FIND
   bool "find"
   default y
   help
-    usage: find [-HL] [DIR...] [<options>]
+    usage: find [-HL] [-j N] [DIR...] [<options>]
 
     Search directories for matching files.
     Default: search ".", match all, -print matches.
 
     -H  Follow command line symlinks         -L  Follow all symlinks
+    -j  Read N directories and run N "-exec +" commands at once
 
     Match filters:
     -name  PATTERN   filename with wildcards   -iname      ignore case -name
@@ -55,6 +56,7 @@ config FIND
 
     Commands substitute "{}" with matched file. End with ";" to run each file,
     or "+" (next argument after "{}") to collect and run with multiple files.
+    The toybox rm, chmod, chown, chgrp, and touch commands run without forking.
 
     -printf FORMAT characters are \ escapes and:
     %b  512 byte blocks used
@@ -69,9 +71,11 @@ config FIND
 #include "toys.h"
 
 GLOBALS(
+  long j;
+
   char **filter;
   struct double_list *argdata;
-  int topdir, xdev, depth;
+  int topdir, xdev, depth, needstat, running;
   time_t now;
   long max_bytes;
   char *start;
@@ -93,6 +97,58 @@ struct exec_range {
   struct execdir_data exec, *execdir;
 };
 
+// Wait for background "-exec +" commands until no more than n still running
+static void exec_wait(int n)
+{
+  for (; TT.running>n; TT.running--) toys.exitval |= xwaitpid(-1);
+}
+
+// Run -exec command. Toybox commands that just act on their arguments run
+// in this process (saving and restoring our state) instead of forking. Else
+// with async, run child in background without waiting, up to -j at once.
+static int run_exec(char **argv, int async)
+{
+  struct toy_list *tl = toy_find(*argv);
+  char temp[offsetof(struct toy_context, rebound)], *save;
+  sigjmp_buf rebound;
+  int rc;
+
+  if (!tl || !anystr(*argv, (char *[]){"rm", "chmod", "chown", "chgrp",
+    "touch", 0}))
+  {
+    if (!async || TT.j<2) return xrun(argv);
+    exec_wait(TT.j-1);
+    xpopen_both(argv, 0);
+    TT.running++;
+
+    return 0;
+  }
+
+  // This fakes what toybox_main() does, like sh's NOFORK builtins
+  save = xmalloc(sizeof(this)+sizeof(toybuf));
+  memcpy(save, &this, sizeof(this));
+  memcpy(save+sizeof(this), toybuf, sizeof(toybuf));
+  memcpy(temp, &toys, sizeof(temp));
+  memset(&toys, 0, sizeof(temp));
+  memset(&this, 0, sizeof(this));
+  if (!sigsetjmp(rebound, 1)) {
+    toys.rebound = &rebound;
+    toys.which = tl;
+    toys.argv = argv;
+    get_optflags();
+    tl->toy_main();
+  }
+  toys.rebound = 0;
+  rc = toys.exitval;
+  if (toys.optargs != toys.argv+1) free(toys.optargs);
+  memcpy(&toys, temp, sizeof(temp));
+  memcpy(&this, save, sizeof(this));
+  memcpy(toybuf, save+sizeof(this), sizeof(toybuf));
+  free(save);
+
+  return rc;
+}
+
 // Perform pending -exec (if any)
 static int flush_exec(struct dirtree *new, struct exec_range *aa)
 {
@@ -135,7 +191,8 @@ static int flush_exec(struct dirtree *new, struct exec_range *aa)
     newargs[pos+rest] = 0;
   }
 
-  rc = xrun(newargs);
+  rc = run_exec(newargs, aa->plus);
+  free(newargs);
 
   llist_traverse(bb->names, llist_free_double);
   bb->names = 0;
@@ -215,12 +272,16 @@ static int do_find(struct dirtree *new)
   struct double_list *argdata = TT.argdata;
   char *s, **ss, *arg;
 
-  recurse = DIRTREE_STATLESS|DIRTREE_COMEAGAIN|DIRTREE_SYMFOLLOW*FLAG(L);
+  recurse = DIRTREE_STATLESS|DIRTREE_COMEAGAIN|DIRTREE_SYMFOLLOW*FLAG(L)
+    |DIRTREE_LAZYSTAT*!TT.needstat;
 
   // skip . and .. below topdir, handle -xdev and -depth
   if (new) {
-    // Handle stat failures first.
-    if (new->again&DIRTREE_STATLESS) {
+    // Handle stat failures first. (Directories always need stat for -xdev
+    // and loop detection.)
+    if ((new->again&DIRTREE_STATLESS)
+      || ((TT.needstat || S_ISDIR(new->st.st_mode)) && !dirtree_stat(new)))
+    {
       if (!new->parent || errno != ENOENT) {
         perror_msg("'%s'", s = dirtree_path(new, 0));
         free(s);
@@ -300,6 +361,14 @@ static int do_find(struct dirtree *new)
       continue;
     } else s++;
 
+    // Tests needing more than name and type (from readdir) need stat
+    if (!new && !anystr(s, (char *[]){"xdev", "delete", "depth", "d", "o",
+      "or", "not", "true", "false", "a", "and", "noleaf", "print", "print0",
+      "prune", "executable", "readable", "quit", "name", "iname", "wholename",
+      "iwholename", "path", "ipath", "lname", "ilname", "context", "type",
+      "mindepth", "maxdepth", "exec", "execdir", "ok", "okdir", 0}))
+        TT.needstat = 1;
+
     if (!strcmp(s, "xdev")) TT.xdev = 1;
     else if (!strcmp(s, "delete")) {
       // Delete forces depth first
@@ -358,6 +427,7 @@ static int do_find(struct dirtree *new)
     } else if (!strcmp(s, "quit")) {
       if (check) {
         execdir(0, 1);
+        exec_wait(0);
         xexit();
       }
 
@@ -571,26 +641,29 @@ static int do_find(struct dirtree *new)
             }
           }
 
-          // Add next name to list (global list without -dir, local with)
-          bb = aa->execdir ? aa->execdir : &aa->exec;
-          dlist_add(&bb->names, name);
-          bb->namecount++;
-
           // -exec + collates and saves result in exitval
+          bb = aa->execdir ? aa->execdir : &aa->exec;
           if (aa->plus) {
+            int len = sizeof(char *)+strlen(name)+1;
+
             // Mark entry so COMEAGAIN can call flush_exec() in parent.
             // This is never a valid pointer value for prev to have otherwise
             // Done here vs argument parsing pass so it's after dlist_terminate
             aa->prev = (void *)1;
 
-            // Flush if the child's environment space gets too large.
-            // Linux caps individual arguments/variables at 131072 bytes,
-            // so this counter can't wrap.
-            if ((aa->plus += sizeof(char *)+strlen(name)+1) > TT.max_bytes) {
-              aa->plus = 1;
+            // Flush first if this name would make the child's environment
+            // space too large. Linux caps individual arguments/variables at
+            // 131072 bytes, so this counter can't wrap.
+            if ((aa->plus += len)+aa->argsize > TT.max_bytes) {
+              aa->plus = 1+len;
               toys.exitval |= flush_exec(new, aa);
             }
-          } else test = !flush_exec(new, aa);
+          }
+
+          // Add next name to list (global list without -dir, local with)
+          dlist_add(&bb->names, name);
+          bb->namecount++;
+          if (!aa->plus) test = !flush_exec(new, aa);
         }
 
         // Argument consumed, skip the check.
@@ -697,7 +770,7 @@ void find_main(void)
   char **ss = (char *[]){"."};
 
   TT.topdir = -1;
-  TT.max_bytes = sysconf(_SC_ARG_MAX) - environ_bytes();
+  TT.max_bytes = sysconf(_SC_ARG_MAX) - environ_bytes() - 4096;
 
   // Distinguish paths from filters
   for (len = 0; toys.optargs[len]; len++)
@@ -714,11 +787,12 @@ void find_main(void)
 
   // Loop through paths
   for (i = 0; i < len; i++)
-    dirtree_flagread(ss[i],
+    dirtree_parallel(ss[i],
       DIRTREE_STATLESS|(DIRTREE_SYMFOLLOW*!!(toys.optflags&(FLAG_H|FLAG_L))),
-      do_find);
+      do_find, TT.j);
 
   execdir(0, 1);
+  exec_wait(0);
 
   if (CFG_TOYBOX_FREE) {
     close(TT.topdir);
@@ -67,8 +67,10 @@ GLOBALS(
 
   char *purple, *cyan, *red, *green, *grey;
   struct double_list *reg;
-  int found, tried, delim;
+  int found, tried, delim, acnodes, acmax, litlen;
   struct arg_list **fixed;
+  struct ac_node *ac;
+  char *lit;
 )
 
 struct reg {
@@ -78,6 +80,23 @@ struct reg {
   regmatch_t m;
 };
 
+// Aho-Corasick automaton node for plain string patterns. Children are a
+// linked list, fail is the longest suffix that's also a prefix, out is the
+// next pattern end along the fail chain. Nodes with lots of children (and
+// root) get a row of next states for all 256 bytes, fail links included.
+struct ac_node {
+  int child, next, fail, out, depth;
+  char c, end;
+  int *row;
+};
+
+// Input buffer, unconsumed data runs from pos to len
+struct grep_in {
+  char *buf;
+  long size, pos, len;
+  int fd;
+};
+
 static void numdash(long num, char dash)
 {
   printf("%s%ld%s%c", TT.green, num, TT.cyan, dash);
@@ -110,14 +129,113 @@ static int matchw(char *line, char *start, long so, long eo)
   return 1;
 }
 
+static int ac_child(int node, int c)
+{
+  if (TT.ac[node].row) return TT.ac[node].row[c];
+  for (node = TT.ac[node].child; node; node = TT.ac[node].next)
+    if (TT.ac[node].c == c) break;
+
+  return node;
+}
+
+// Next state after byte c: child, or child of longest suffix with one
+static int ac_next(int node, int c)
+{
+  int nn;
+
+  while (!(nn = ac_child(node, c)) && !TT.ac[node].row) node = TT.ac[node].fail;
+
+  return nn;
+}
+
+// Find leftmost (then longest) plain string match passing -w. Matches are
+// found by where they end, so stop once no later one could start earlier.
+static int ac_match(char *line, char *start, long len, regmatch_t *mm)
+{
+  struct ac_node *ac = TT.ac;
+  long i, so, best = -1, bestlen = 0;
+  int node = 0, nn, c;
+
+  for (i = 0; i<len && (best<0 || i<best+TT.acmax); i++) {
+    c = FLAG(i) ? toupper(start[i]) : start[i];
+    node = ac[node].row ? ac[node].row[c] : ac_next(node, c);
+    if (!ac[node].end && !ac[node].out) continue;
+    for (nn = ac[node].end ? node : ac[node].out; nn; nn = ac[nn].out) {
+      so = i+1-ac[nn].depth;
+      if (best>=0 && (so>best || (so==best && ac[nn].depth<=bestlen))) continue;
+      if (!matchw(line, start, so, i+1)) continue;
+      best = so;
+      bestlen = ac[nn].depth;
+    }
+  }
+  if (best<0) return 0;
+  mm->rm_eo = (mm->rm_so = best)+bestlen;
+
+  return 1;
+}
+
+// Discard consumed input and read more, returns 0 at EOF
+static long grep_fill(struct grep_in *in, char *name)
+{
+  long len;
+
+  if (in->pos) memmove(in->buf, in->buf+in->pos, in->len -= in->pos);
+  in->pos = 0;
+  if (in->len == in->size) in->buf = xrealloc(in->buf, in->size *= 2);
+  if (0>(len = read(in->fd, in->buf+in->len, in->size-in->len)))
+    perror_msg_raw(name);
+  else in->len += len;
+
+  return len>0 ? len : 0;
+}
+
+// Length of next line including delimiter, 0 at EOF
+static long grep_line(struct grep_in *in, char *name)
+{
+  long len = 0;
+  char *s;
+
+  for (;;) {
+    s = in->buf+in->pos;
+    if ((s = memchr(s+len, TT.delim, in->len-in->pos-len))) break;
+    len = in->len-in->pos;
+    if (!grep_fill(in, name)) return len;
+  }
+
+  return s+1-(in->buf+in->pos);
+}
+
+// Skip whole lines that can't match because they don't contain the required
+// literal, only counting the skipped lines when -n needs them.
+// Returns 0 if no line left contains it.
+static int grep_skip(struct grep_in *in, long *lcount, long *offset, char *name)
+{
+  char *s, *ss;
+  long len;
+  int found;
+
+  for (;;) {
+    s = in->buf+in->pos;
+    len = in->len-in->pos;
+    if ((found = !!(ss = memmem(s, len, TT.lit, TT.litlen)))) len = ss-s;
+    while (len && s[len-1]!=TT.delim) len--;
+    if (FLAG(n)) for (ss = s; (ss = memchr(ss, TT.delim, s+len-ss)); ss++)
+      ++*lcount;
+    in->pos += len;
+    *offset += len;
+    if (found) return 1;
+    if (!grep_fill(in, name)) return 0;
+  }
+}
+
 // Show matches in one file
 static void do_grep(int fd, char *name)
 {
   long lcount = 0, mcount = 0, offset = 0, after = 0, before = 0, new = 1;
   struct double_list *dlb = 0;
+  struct grep_in in;
   char *bars = 0;
-  FILE *file;
-  int bin = 0;
+  int bin = 0, skip = TT.lit && !FLAG(v) && !TT.B;
 
   if (!FLAG(r)) TT.tried++;
   if (!fd) name = "(standard input)";
@@ -142,22 +260,27 @@ static void do_grep(int fd, char *name)
     if (bin && FLAG(I)) return;
   }
 
-  if (!(file = fdopen(fd, "r"))) return perror_msg_raw(name);
+  if (fd<0) return perror_msg_raw(name);
+  memset(&in, 0, sizeof(in));
+  in.buf = xmalloc(in.size = 65536);
+  in.fd = fd;
 
   // Loop through lines of input
   for (;;) {
-    char *line = 0, *start, *ss, *pp;
+    char *line, *start, *ss, *pp;
     struct reg *shoe;
     size_t ulen;
     long len;
     int matched = 0, rc = 1, move = 0, ii;
 
     // get next line, check and trim delimiter
+    if (skip && new && !after && !grep_skip(&in, &lcount, &offset, name))
+      break;
     lcount++;
-    errno = 0;
-    ulen = len = getdelim(&line, &ulen, TT.delim, file);
-    if (len == -1 && errno) perror_msg_raw(name);
-    if (len<1) break;
+    if (!(len = grep_line(&in, name))) break;
+    memcpy(line = xmalloc(len+1), in.buf+in.pos, ulen = len);
+    in.pos += len;
+    line[len] = 0;
     if (line[ulen-1] == TT.delim) line[--ulen] = 0;
 
     // Prepare for next line
@@ -172,8 +295,12 @@ static void do_grep(int fd, char *name)
       mm->rm_so = mm->rm_eo = 0;
       rc = 1;
 
-      // Handle "fixed" (literal) matches (if any)
-      if (TT.e) for (ss = start; ss-line<=ulen; ss++) {
+      // Plain strings go through the automaton, then any other "fixed"
+      // (literal-ish) patterns only need to check up to where that matched.
+      if (TT.ac) rc = !ac_match(line, start, ulen-(start-line), mm);
+      if (TT.e) for (ss = start; ss-line<=ulen && (rc || ss-start<=mm->rm_so);
+        ss++)
+      {
         ii = FLAG(i) ? toupper(*ss) : *ss;
         for (seek = TT.fixed[ii]; seek; seek = seek->next) {
           if (*(pp = seek->arg)=='^' && !FLAG(F)) {
@@ -190,9 +317,11 @@ static void do_grep(int fd, char *name)
               if (toupper(pp[ii])!=toupper(ss[ii])) break;
             } else if (pp[ii]!=ss[ii]) break;
           }
-          if (pp[ii] && (pp[ii]!='$' || pp[ii+1] || ss[ii])) continue;
-          mm->rm_eo = (mm->rm_so = ss-start)+ii;
-          if (!matchw(line, start, mm->rm_so, mm->rm_eo)) continue;
+          if (pp[ii] && (FLAG(F) || pp[ii]!='$' || pp[ii+1] || ss[ii]))
+            continue;
+          if (!matchw(line, start, ss-start, ss-start+ii)) continue;
+          if (rc || ss-start<mm->rm_so || ii>mm->rm_eo-mm->rm_so)
+            mm->rm_eo = (mm->rm_so = ss-start)+ii;
           rc = 0;
 
           goto got;
@@ -259,7 +388,7 @@ got:
       if (FLAG(L) || FLAG(l)) {
         if (FLAG(l)) xprintf("%s%c", name, '\n'*!FLAG(Z));
         free(line);
-        fclose(file);
+        free(in.buf);
         return;
       }
 
@@ -346,8 +475,7 @@ got:
   if (FLAG(L)) xprintf("%s%c", name, TT.delim);
   else if (FLAG(c)) outline(0, ':', name, mcount, 0, 1);
 
-  // loopfiles will also close the fd, but this frees an (opaque) struct.
-  fclose(file);
+  free(in.buf);
   llist_traverse(dlb, llist_free_double);
 }
 
@@ -361,6 +489,97 @@ static int lensort(struct arg_list **a, struct arg_list **b)
   return 0;
 }
 
+// Add plain string pattern to Aho-Corasick automaton (node 0 is the root)
+static void ac_add(char *s)
+{
+  int node = 0, nn, c, len = 0;
+
+  for (; *s; s++, node = nn) {
+    if (!FLAG(F) && *s=='\\') s++;
+    c = FLAG(i) ? toupper(*s) : *s;
+    len++;
+    if ((nn = ac_child(node, c))) continue;
+    if (!(TT.acnodes&(TT.acnodes-1)))
+      TT.ac = xrealloc(TT.ac, 2*TT.acnodes*sizeof(*TT.ac));
+    memset(TT.ac+(nn = TT.acnodes++), 0, sizeof(*TT.ac));
+    TT.ac[nn].c = c;
+    TT.ac[nn].depth = len;
+    TT.ac[nn].next = TT.ac[node].child;
+    TT.ac[node].child = nn;
+    if (!node) TT.ac->row[c] = nn;
+  }
+  TT.ac[node].end = 1;
+  if (len>TT.acmax) TT.acmax = len;
+}
+
+// Find longest run of bytes every match of regex s must contain, so
+// grep_skip() can search for that first. Only looks outside parentheses,
+// and gives up on alternation.
+static void grep_literal(char *s)
+{
+  char *run = xmalloc(strlen(s)+1), *ss;
+  int len = 0, depth = 0, c, sp;
+
+  for (;; s++) {
+    c = sp = 0;
+    if (*s=='\\' && *++s) {
+      if (!FLAG(E) && strchr("(){}|+?", *s)) sp = *s;
+      else if (strchr("\\.^$[]*+?{}()|", *s)) c = *s;
+    } else if (FLAG(E) && *s && strchr("(){}|", *s)) sp = *s;
+    else if (*s=='[') {
+      s += 1+(s[1]=='^');
+      s += *s==']';
+      for (; *s && *s!=']'; s++)
+        if (*s=='[' && s[1] && strchr(":.=", s[1]) && (ss = strstr(s+2, "]")))
+          s = ss;
+      if (!*s) break;
+    } else if (*s && !strchr(".^$*+?{", *s) && *s<128) c = *s;
+
+    if (sp=='|' && !depth) break;
+    if (sp=='(') depth++;
+    if (sp==')' && !depth--) break;
+    if (sp=='{') {
+      if (!(ss = strstr(s, FLAG(E) ? "}" : "\\}"))) break;
+      s = ss+!FLAG(E);
+    }
+    if (c && !depth) {
+      run[len++] = c;
+
+      // A quantifier makes the previous byte optional
+      ss = s+1+(s[1]=='\\' && !FLAG(E));
+      if (!*ss || !strchr("*?+{", *ss)) continue;
+      len--;
+    }
+    if (len>TT.litlen) {
+      free(TT.lit);
+      TT.lit = xstrndup(run, TT.litlen = len);
+    }
+    len = 0;
+    if (!*s) break;
+  }
+  free(run);
+
+  // Gave up?
+  if (*s) {
+    free(TT.lit);
+    TT.lit = 0;
+  }
+}
+
+// Is this a plain string (no wildcards or anchors)?
+static int ac_plain(char *s)
+{
+  char *ss = s;
+
+  if (FLAG(F)) return !!*s;
+  for (; *s; s++) {
+    if (*s=='\\') s++;
+    else if (*s=='.' || (*s=='$' && !s[1]) || (*s=='^' && s==ss)) return 0;
+  }
+
+  return s!=ss;
+}
+
 static void parse_regex(void)
 {
   struct arg_list *al, *new, *list = NULL, **last;
@@ -399,6 +618,12 @@ static void parse_regex(void)
   }
   TT.e = list;
 
+  // With one pattern, lines without its required literal can't match
+  if (list && !list->next && !FLAG(i)) {
+    if (!FLAG(F)) grep_literal(list->arg);
+    else if (*list->arg) TT.litlen = strlen(TT.lit = list->arg);
+  }
+
   // Convert to regex where appropriate
   for (last = &TT.e; *last;) {
     // Can we use the fast path?
@@ -424,6 +649,50 @@ static void parse_regex(void)
   }
   dlist_terminate(TT.reg);
 
+  // Lots of plain strings go in an Aho-Corasick automaton. (Its lookups are
+  // one dependent load per byte, so a few short bucket lists are faster.)
+  for (len = 0, al = TT.e; al; al = al->next) len += ac_plain(al->arg);
+  if (len>=32) for (last = &TT.e; *last;) {
+    if (!ac_plain((*last)->arg)) {
+      last = &((*last)->next);
+      continue;
+    }
+    if (!TT.ac) {
+      TT.ac = xzalloc(sizeof(*TT.ac));
+      TT.acnodes = 1;
+      TT.ac->row = xzalloc(256*sizeof(int));
+    }
+    ac_add((*last)->arg);
+    al = *last;
+    *last = (*last)->next;
+    free(al);
+  }
+
+  // Breadth first traversal, so fail links and rows of shallower nodes are
+  // done before they're needed. Cap rows at 4 megabytes.
+  if (TT.ac) {
+    struct ac_node *ac = TT.ac;
+    int *queue = xmalloc(TT.acnodes*sizeof(int)), *row, node, nn, kids,
+      rows = 0;
+
+    for (*queue = ii = 0, len = 1; ii<len; ii++) {
+      node = queue[ii];
+      kids = len;
+      for (key = ac[node].child; key; key = ac[key].next) {
+        nn = ac[key].fail = node ? ac_next(ac[node].fail, ac[key].c) : 0;
+        ac[key].out = ac[nn].end ? nn : ac[nn].out;
+        queue[len++] = key;
+      }
+      if (node && len-kids>=8 && rows++<4096) {
+        row = xmalloc(256*sizeof(int));
+        for (key = 0; key<256; key++) row[key] = ac_next(ac[node].fail, key);
+        for (key = ac[node].child; key; key = ac[key].next) row[ac[key].c] = key;
+        ac[node].row = row;
+      }
+    }
+    free(queue);
+  }
+
   // Sort fast path patterns into buckets by first character
   for (al = TT.e; al; al = new) {
     new = al->next;
@@ -460,6 +729,7 @@ static int do_grep_r(struct dirtree *new)
 {
   struct arg_list *al;
   char *name;
+  int fd;
 
   if (!new->parent) TT.tried++;
   if (!dirtree_notdotdot(new)) return 0;
@@ -484,7 +754,9 @@ static int do_grep_r(struct dirtree *new)
   if (new->parent && !FLAG(h)) toys.optflags |= FLAG_H;
 
   name = dirtree_path(new, 0);
-  do_grep(openat(dirtree_parentfd(new), new->name, O_NONBLOCK|O_NOCTTY), name);
+  fd = openat(dirtree_parentfd(new), new->name, O_NONBLOCK|O_NOCTTY);
+  do_grep(fd, name);
+  if (fd>=0) close(fd);
   free(name);
 
   return 0;
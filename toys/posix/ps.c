@@ -222,6 +222,8 @@ GLOBALS(
   int kcount, forcek, sortpos, pidlen;
   int (*match_process)(long long *slot);
   void (*show_process)(void *tb);
+  struct ps_cache **cache;
+  unsigned csize, cused, tick, fds, maxfds;
 )
 
 // Linked list of -o fields selected for display, in order, with :len and =title
@@ -292,6 +294,20 @@ struct procpid {
   char str[];                 // CMD, TTY, WCHAN, LABEL, COMM, ARGS, NAME
 };
 
+/* Top rereads the same /proc files for the same tasks every refresh, so
+ * it keeps a struct ps_cache per task (in a hash table by tid) holding open
+ * filehandles to pread() again and the procpid snapshots from the last two
+ * refreshes (alternating by TT.tick parity). The previous snapshot supplies
+ * the string fields for tasks that haven't exec()ed or run since. */
+
+struct ps_cache {
+  long long key;           // tid*2, +1 for /proc/$PID/task/$TID
+  unsigned seen, saved;    // TT.tick this task was last read, last stored
+  int fd[5];               // stat, status, io, statm, wchan (or -1)
+  struct procpid *tb[2];
+  unsigned len[2];         // allocated size of tb[]
+};
+
 /* The typos[] array lists all the types understood by "ps -o", I.E all the
  * columns ps and top know how to display. Each entry has:
  *
@@ -706,6 +722,94 @@ static void show_ps(void *p)
   putchar(TT.time ? '\r' : '\n');
 }
 
+// Close cached task's filehandles
+static void ps_closefds(struct ps_cache *pc)
+{
+  int i;
+
+  for (i = 0; i<ARRAY_LEN(pc->fd); i++) if (pc->fd[i] != -1) {
+    close(pc->fd[i]);
+    pc->fd[i] = -1;
+    TT.fds--;
+  }
+}
+
+// Free cached task, closing its filehandles
+static void ps_uncache(struct ps_cache *pc)
+{
+  ps_closefds(pc);
+  free(pc->tb[0]);
+  free(pc->tb[1]);
+  free(pc);
+}
+
+// Resize top's task hash table (to 4x entries), discarding tasks not seen
+// this tick if sweep (they exited).
+static void ps_rehash(int sweep)
+{
+  struct ps_cache **old = TT.cache, *pc;
+  unsigned i, j, size = TT.csize;
+
+  for (TT.cused = i = 0; i<size; i++) {
+    if (!(pc = old[i])) continue;
+    if (sweep && pc->seen != TT.tick) {
+      ps_uncache(pc);
+      old[i] = 0;
+    } else TT.cused++;
+  }
+  for (TT.csize = 64; TT.csize<4*TT.cused; TT.csize *= 2);
+  TT.cache = xzalloc(TT.csize*sizeof(*TT.cache));
+  for (i = 0; i<size; i++) if ((pc = old[i])) {
+    for (j = pc->key*2654435761U; TT.cache[j &= TT.csize-1]; j++);
+    TT.cache[j] = pc;
+  }
+  free(old);
+}
+
+// Find or add task in top's hash table
+static struct ps_cache *ps_cache(long long key)
+{
+  struct ps_cache *pc;
+  unsigned i;
+
+  if (TT.cused*2>=TT.csize) ps_rehash(0);
+  for (i = key*2654435761U; (pc = TT.cache[i &= TT.csize-1]); i++)
+    if (pc->key == key) return pc;
+  pc = TT.cache[i] = xzalloc(sizeof(struct ps_cache));
+  pc->key = key;
+  memset(pc->fd, -1, sizeof(pc->fd));
+  TT.cused++;
+
+  return pc;
+}
+
+// readfileat() of "$TID/file" path in buf, but if task is cached keep file
+// open (while filehandles last) and pread() it again next time. If the old
+// filehandle fails, the task exited (and a new one may have its PID), so
+// reopen all of them.
+static char *pidfile(int dirfd, struct ps_cache *pc, int which, char *buf,
+  off_t *len)
+{
+  int *fd = pc ? pc->fd+which : 0, reopen = 1;
+  ssize_t rd;
+
+  for (;;) {
+    if (!fd || (*fd == -1 && TT.fds>=TT.maxfds))
+      return readfileat(dirfd, buf, buf, len);
+    if (*fd == -1) {
+      if (-1 == (*fd = openat(dirfd, buf, O_RDONLY|O_CLOEXEC))) return 0;
+      TT.fds++;
+      reopen = 0;
+    }
+    if (0<=(rd = pread(*fd, buf, *len-1, 0))) break;
+    if (!reopen--) return 0;
+    ps_closefds(pc);
+  }
+  buf[*len = rd] = 0;
+
+  return buf;
+}
+
 // dirtree callback: read data about a process, then display or store it.
 // Fills toybuf with struct procpid and either DIRTREE_SAVEs a copy to ->extra
 // (in -k mode) or calls show_ps directly on toybuf (for low memory systems).
@@ -720,12 +824,13 @@ static int get_ps(struct dirtree *new)
     {"exe", _PS_COMMAND|_PS_COMM}, {"cmdline", _PS_CMDLINE|_PS_ARGS|_PS_NAME},
     {"", _PS_NAME}
   };
-  struct procpid *tb = (void *)toybuf;
+  struct procpid *tb = (void *)toybuf, *otb = 0;
+  struct ps_cache *pc = 0;
   long long *slot = tb->slot;
-  char *name, *s, *buf = tb->str, *end = 0;
+  char *name, *s, *ss, *buf = tb->str, *end = 0;
   FILE *fp;
   struct sysinfo si;
-  int i, j, fd;
+  int i, j, fd, same = 0;
   off_t len;
 
   // Recurse one level into /proc children, skip non-numeric entries
@@ -746,10 +851,17 @@ static int get_ps(struct dirtree *new)
   }
   fd = dirtree_parentfd(new);
 
+  // Find top's cached task, and its snapshot from the previous refresh
+  if (TT.cache) {
+    pc = ps_cache(slot[SLOT_tid]*2+(TT.threadparent && TT.threadparent!=new));
+    pc->seen = TT.tick;
+    if (pc->saved+1 == TT.tick) otb = pc->tb[~TT.tick&1];
+  }
+
   // Read /proc/$PID/stat into half of toybuf.
   len = 2048;
   sprintf(buf, "%lld/stat", slot[SLOT_tid]);
-  if (!readfileat(fd, buf, buf, &len)) return 0;
+  if (!pidfile(fd, pc, 0, buf, &len)) return 0;
 
   // parse oddball fields: the first field is same as new->name (skip it)
   // and the second and third (name and state) are the only non-numeric fields.
@@ -764,8 +876,11 @@ static int get_ps(struct dirtree *new)
   // All remaining fields should be numeric, parse them into slot[] array
   // (skipping first 3 stat fields and first slot[], both were handled above)
   // yes this means the alignment's off: stat[4] becomes slot[1]
-  for (j = SLOT_ppid; j<SLOT_upticks; j++)
-    if (1>sscanf(s += i, " %lld%n", slot+j, &i)) break;
+  // (strtoll() because sscanf() per field was most of top -H's CPU time)
+  for (s += i, j = SLOT_ppid; j<SLOT_upticks; j++, s = ss) {
+    slot[j] = strtoll(s, &ss, 10);
+    if (ss == s) break;
+  }
 
   // Now we've read the data, move status and name right after slot[] array,
   // and convert low chars to ? for non-tty display while we're at it.
@@ -795,7 +910,7 @@ static int get_ps(struct dirtree *new)
     off_t temp = len;
 
     sprintf(buf, "%lld/status", slot[SLOT_tid]);
-    if (!readfileat(fd, buf, buf, &temp)) *buf = 0;
+    if (!pidfile(fd, pc, 1, buf, &temp)) *buf = 0;
     s = strafter(buf, "\nUid:");
     slot[SLOT_ruid] = s ? atol(s) : new->st.st_uid;
     s = strafter(buf, "\nGid:");
@@ -809,7 +924,7 @@ static int get_ps(struct dirtree *new)
     off_t temp = len;
 
     sprintf(buf, "%lld/io", slot[SLOT_tid]);
-    if (!readfileat(fd, buf, buf, &temp)) *buf = 0;
+    if (!pidfile(fd, pc, 2, buf, &temp)) *buf = 0;
     if ((s = strafter(buf, "rchar:"))) slot[SLOT_rchar] = atoll(s);
     if ((s = strafter(buf, "wchar:"))) slot[SLOT_wchar] = atoll(s);
     if ((s = strafter(buf, "read_bytes:"))) slot[SLOT_rbytes] = atoll(s);
@@ -831,12 +946,19 @@ static int get_ps(struct dirtree *new)
   slot[SLOT_totalram] = si.totalram;
   slot[SLOT_upticks] = slot[SLOT_uptime]*TT.ticks - slot[SLOT_starttime];
 
-  // Do we need to read "statm"?
-  if (TT.bits&(_PS_VIRT|_PS_SHR)) {
+  // Do we need to read "statm"? (Threads share their process's memory.)
+  if ((TT.bits&(_PS_VIRT|_PS_SHR)) && TT.threadparent
+      && TT.threadparent->extra)
+  {
+    long long *pslot = ((struct procpid *)TT.threadparent->extra)->slot;
+
+    slot[SLOT_vsz] = pslot[SLOT_vsz];
+    slot[SLOT_shr] = pslot[SLOT_shr];
+  } else if (TT.bits&(_PS_VIRT|_PS_SHR)) {
     off_t temp = len;
 
     sprintf(buf, "%lld/statm", slot[SLOT_tid]);
-    if (!readfileat(fd, buf, buf, &temp)) *buf = 0;
+    if (!pidfile(fd, pc, 3, buf, &temp)) *buf = 0;
 
     // Skip redundant RSS field, we got it from stat.
     slot[SLOT_vsz] = slot[SLOT_shr] = 0;
@@ -887,6 +1009,17 @@ static int get_ps(struct dirtree *new)
   // The fetch[] array at the start of the function says what file to read
   // and what -o display field outputs it (to skip the ones we don't need).
 
+  // Top can reuse last refresh's strings if the same task (not a recycled
+  // PID) has the same name and hasn't used CPU time (to rewrite its argv[])
+  // or exec()ed (new code and stack addresses) since. TTY only depends on
+  // the tty device number.
+  if (otb && otb->slot[SLOT_starttime] != slot[SLOT_starttime]) otb = 0;
+  if (otb) same = !strcmp(otb->str, tb->str)
+    && otb->slot[SLOT_utime] == slot[SLOT_utime]
+    && otb->slot[SLOT_startcode] == slot[SLOT_startcode]
+    && otb->slot[SLOT_endcode] == slot[SLOT_endcode]
+    && otb->slot[SLOT_startstack] == slot[SLOT_startstack];
+
   slot[SLOT_argv0len] = 0;
   for (j = 0; j<ARRAY_LEN(fetch); j++) {
     tb->offset[j] = buf-(tb->str);
@@ -902,6 +1035,14 @@ static int get_ps(struct dirtree *new)
     // each use all available space, and future strings that don't use their
     // guaranteed minimum add to the pool.
     len = sizeof(toybuf)-256*(ARRAY_LEN(fetch)-j)-(buf-toybuf)-260;
+    if (otb && (j ? same && j>1 && j<5 : otb->slot[SLOT_ttynr]==slot[SLOT_ttynr])
+        && (i = strlen(s = otb->str+otb->offset[j]))<len)
+    {
+      buf = stpcpy(buf, s)+1;
+      if (j==4) slot[SLOT_argv0len] = otb->slot[SLOT_argv0len];
+
+      continue;
+    }
     sprintf(buf, "%lld/%s", slot[SLOT_tid], fetch[j].name);
 
     // For exe (j==3) readlink() instead of reading file's contents
@@ -978,7 +1119,8 @@ static int get_ps(struct dirtree *new)
       int temp = 0;
 
       // When command has no arguments, don't space over the NUL
-      if (readfileat(fd, buf, buf, &len) && len>0) {
+      if ((j==1 ? pidfile(fd, pc, 4, buf, &len)
+          : readfileat(fd, buf, buf, &len)) && len>0) {
 
         // Trim trailing whitespace and NUL bytes
         while (len)
@@ -1015,8 +1157,14 @@ static int get_ps(struct dirtree *new)
     return 0;
   }
 
-  // We're retaining data (probably to sort it), save copy in list.
-  s = xmalloc(buf-toybuf);
+  // We're retaining data (probably to sort it), save copy in list (or in
+  // top's cache, reusing this task's buffer from two refreshes ago).
+  if (pc) {
+    if (pc->len[i = TT.tick&1]<buf-toybuf)
+      pc->tb[i] = xrealloc(pc->tb[i], pc->len[i] = buf-toybuf);
+    s = (void *)pc->tb[i];
+    pc->saved = TT.tick;
+  } else s = xmalloc(buf-toybuf);
   new->extra = (long)s;
   memcpy(s, toybuf, buf-toybuf);
 
@@ -1531,6 +1679,7 @@ static void top_common(
   int (*filter)(long long *oslot, long long *nslot, int milis))
 {
   long long timeout = 0, now, stats[16];
+  struct rlimit rl;
   struct proclist {
     struct procpid **tb;
     int count;
@@ -1538,7 +1687,6 @@ static void top_common(
   } plist[2], *plold, *plnew, old, new, mix;
   char scratch[16], *pos, *cpufields[] = {"user", "nice", "sys", "idle",
     "iow", "irq", "sirq", "host"};
-  unsigned tock = 0;
   int i, lines, topoff = 0, done = 0;
 
   if (!TT.fields) perror_exit("no -o");
@@ -1549,6 +1697,14 @@ static void top_common(
     xputsn("\e[?25l");
   }
 
+  // Keep /proc files open between refreshes, with as many fds as we can get
+  getrlimit(RLIMIT_NOFILE, &rl);
+  rl.rlim_cur = rl.rlim_max;
+  setrlimit(RLIMIT_NOFILE, &rl);
+  getrlimit(RLIMIT_NOFILE, &rl);
+  if (rl.rlim_cur>64) TT.maxfds = rl.rlim_cur>(1<<24) ? 1<<24 : rl.rlim_cur-64;
+  ps_rehash(0);
+
   toys.signal = SIGWINCH;
   TT.bits = get_headers(TT.fields, toybuf, sizeof(toybuf));
   *scratch = 0;
@@ -1558,8 +1714,8 @@ static void top_common(
     struct dirtree *dt;
     int recalc = 1;
 
-    plold = plist+(tock++&1);
-    plnew = plist+(tock&1);
+    plold = plist+(TT.tick++&1);
+    plnew = plist+(TT.tick&1);
     plnew->whence = millitime();
     dt = dirtree_flagread("/proc", DIRTREE_SHUTUP|DIRTREE_PROC,
       (FLAG(H) || (TT.bits&(_PS_TID|_PS_TCNT))) ? get_threads : get_ps);
@@ -1568,7 +1724,7 @@ static void top_common(
     TT.kcount = 0;
 
     if (readfile("/proc/stat", pos = toybuf, sizeof(toybuf))) {
-      long long *st = stats+8*(tock&1);
+      long long *st = stats+8*(TT.tick&1);
 
       // user nice system idle iowait irq softirq host
       sscanf(pos, "cpu %lld %lld %lld %lld %lld %lld %lld %lld",
@@ -1797,8 +1953,9 @@ static void top_common(
       }
     }
 
+    // Cache frees snapshots of tasks that exited, the rest get reused
     free(mix.tb);
-    for (i=0; i<plold->count; i++) free(plold->tb[i]);
+    ps_rehash(1);
     free(plold->tb);
   } while (!done);
 
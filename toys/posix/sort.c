@@ -7,13 +7,14 @@
  * Deviations from POSIX: Lots.
  * We invented -x
 
-USE_SORT(NEWTOY(sort, USE_TOYBOX_FLOAT("g")"S:T:m" "o:k*t:" "xVbMCcszdfirun", TOYFLAG_USR|TOYFLAG_BIN|TOYFLAG_ARGFAIL(2)|TOYFLAG_MOREHELP(CFG_TOYBOX_FLOAT)))
+USE_SORT(NEWTOY(sort, "(parallel)#<1"USE_TOYBOX_FLOAT("g")"S:T:m" "o:k*t:" "xVbMCcszdfirun", TOYFLAG_USR|TOYFLAG_BIN|TOYFLAG_ARGFAIL(2)|TOYFLAG_MOREHELP(CFG_TOYBOX_FLOAT)))
 
 config SORT
   bool "sort"
   default y
   help
-    usage: sort [-bCcdf!giMnrsuxVz] [FILE...] [-k#[,#[x]] [-t X]] [-o FILE]
+    usage: sort [-bCcdf!giMmnrsuxVz] [FILE...] [-k#[,#[x]] [-t X]] [-o FILE]
+    [-S SIZE] [-T DIR] [--parallel=N]
 
     Sort all lines of text from input files (or stdin) to stdout.
 
@@ -26,15 +27,20 @@ config SORT
     -i	Ignore nonprinting characters
     -k	Sort by KEY (see below)
     -M	Month sort (jan, feb, etc)
+    -m	Merge already sorted files (without reading them into memory)
     -n	Numeric order (instead of alphabetical)
     -o	Output to FILE instead of stdout
     -r	Reverse
-    -s	Skip fallback sort (only sort with keys)
+    -S	Memory to use before sorting via temp files (default kilobytes, b=bytes,
+    	% of RAM, or k/m/g suffix; default 25%)
+    -s	Skip fallback sort (only sort with keys, equal lines stay in input order)
+    -T	Directory for temp files (default $TMPDIR or /tmp)
     -t	Use a key separator other than whitespace
     -u	Unique lines only
     -x	Hexadecimal numerical sort
     -V	Version numbers (name-1.234-rc6.5b.tgz)
     -z	Zero (null) terminated lines
+    --parallel	Sort with N threads (default number of CPUs for large input)
 
     Sorting by KEY looks at a subset of the words on each line. -k2 uses the
     second word to the end of the line, -k2,2 looks at only the second word,
@@ -51,11 +57,16 @@ config SORT
 GLOBALS(
   char *t;
   struct arg_list *k;
-  char *o, *T, S;
+  char *o, *T, *S;
+  long parallel;
 
   void *key_list;
   unsigned linecount;
-  char **lines, *name;
+  union sort_val **lines;
+  char *name;
+  long long size, used;
+  struct sort_run *runs;
+  int nruns, nkeys;
 )
 
 // The sort types are n, g, and M.
@@ -69,8 +80,26 @@ struct sort_key {
   struct sort_key *next_key;  // linked list
   long range[4];              // start word, start char, end word, end char
   int flags;
+  char string;                // compares as string, not parsed number
 };
 
+// Each line is stored as a record: [0] is the line, then one entry per key
+// extracted from it when read, so comparisons don't have to re-parse.
+union sort_val {
+  char *str;
+  long long ll;
+};
+
+// Sorted lines waiting to be merged: a temp file or an -m input
+struct sort_run {
+  FILE *fp;
+  union sort_val *rec;
+  int level;
+};
+
+// How many runs to merge at once
+#define NMERGE 16
+
 static int skip_key(char *str)
 {
   int end = 0;
@@ -167,47 +196,93 @@ static struct sort_key *add_key(void)
   return *pkey = xzalloc(sizeof(struct sort_key));
 }
 
-// Perform actual comparison
-static int compare_values(int flags, char *x, char *y)
+// Does this key compare as a string, or as a number we can parse up front?
+static int key_string(int flags)
+{
+  return !((CFG_TOYBOX_FLOAT && (flags & FLAG_g)) || (flags & (FLAG_M|FLAG_x))
+    || (flags & (FLAG_V|FLAG_n)) == FLAG_n);
+}
+
+// Extract key from line, converting numeric sorts to a long long that
+// compares the same way and -f to lower case, so compare_values() is cheap.
+static void get_key_val(union sort_val *val, char *line, struct sort_key *key,
+  int flags)
 {
+  char *x = get_key_data(line, key, flags), *xx;
+
   if (CFG_TOYBOX_FLOAT && (flags & FLAG_g)) {
-    char *xx,*yy;
-    double dx = strtod(x,&xx), dy = strtod(y,&yy);
-    int xinf, yinf;
+    double dx = strtod(x, &xx);
+    unsigned long long bits;
+
+    // not numbers < NaN < -infinity < numbers < +infinity: flipping the
+    // magnitude bits of negative doubles makes them sort as integers, which
+    // leaves the two lowest values free for not numbers and NaN.
+    if (x==xx) val->ll = LLONG_MIN;
+    else if (dx!=dx) val->ll = LLONG_MIN+1;
+    else {
+      if (!dx) dx = 0;
+      memcpy(&bits, &dx, sizeof(dx));
+      val->ll = (bits>>63) ? bits^LLONG_MAX : bits;
+    }
+  } else if (flags & FLAG_M) {
+    struct tm thyme;
 
-    // not numbers < NaN < -infinity < numbers < +infinity
+    // Months sort after things that aren't
+    val->ll = strptime(x, "%b", &thyme) ? thyme.tm_mon : -1;
+  } else if (flags & FLAG_x) val->ll = strtol(x, NULL, 16);
+  // This is actually an integer sort with decimals sorted by string fallback.
+  else if ((flags & (FLAG_V|FLAG_n)) == FLAG_n) val->ll = atoll(x);
+  else {
+    if ((flags & (FLAG_V|FLAG_f)) == FLAG_f) {
+      if (x == line) x = xstrdup(x);
+      for (xx = x; *xx; xx++) *xx = tolower(*xx);
+    }
+    val->str = x;
 
-    if (x==xx) return y==yy ? 0 : -1;
-    if (y==yy) return 1;
+    return;
+  }
+  if (x != line) free(x);
+}
 
-    // Check for isnan
-    if (dx!=dx) return (dy!=dy) ? 0 : -1;
-    if (dy!=dy) return 1;
+// Copy line into a new record, with its extracted keys in front of it.
+// Add memory used to *used (if not NULL) to enforce -S.
+static union sort_val *new_rec(char *line, long len, long long *used)
+{
+  union sort_val *rec = xmalloc((TT.nkeys+1)*sizeof(*rec)+len+1);
+  struct sort_key *key;
+  int i;
 
-    // Check for infinity.  (Could underflow, but avoids needing libm.)
-    xinf = (1.0/dx == 0.0);
-    yinf = (1.0/dy == 0.0);
-    if (xinf) {
-      if(dx<0) return (yinf && dy<0) ? 0 : -1;
-      return (yinf && dy>0) ? 0 : 1;
-    }
-    if (yinf) return dy<0 ? 1 : -1;
+  rec->str = memcpy(rec+TT.nkeys+1, line, len+1);
+  for (i = 1, key = TT.key_list; key; key = key->next_key, i++) {
+    get_key_val(rec+i, rec->str, key, key->flags ? : toys.optflags);
+    if (used && key->string && rec[i].str != rec->str)
+      *used += strlen(rec[i].str)+1+16;
+  }
+  if (used) *used += (TT.nkeys+1)*sizeof(*rec)+len+1+16+sizeof(rec);
 
-    return dx<dy ? -1 : dx>dy;
-  } else if (flags & FLAG_M) {
-    struct tm thyme;
-    int dx;
-    char *xx,*yy;
-
-    xx = strptime(x,"%b",&thyme);
-    dx = thyme.tm_mon;
-    yy = strptime(y,"%b",&thyme);
-    if (!xx) return !yy ? 0 : -1;
-    else if (!yy) return 1;
-    else return dx==thyme.tm_mon ? 0 : dx-thyme.tm_mon;
-
-  } else if (flags & FLAG_x) return strtol(x, NULL, 16)-strtol(y, NULL, 16);
-  else if (flags & FLAG_V) {
+  return rec;
+}
+
+static void free_rec(union sort_val *rec)
+{
+  struct sort_key *key;
+  int i;
+
+  if (rec) for (i = 1, key = TT.key_list; key; key = key->next_key, i++)
+    if (key->string && rec[i].str != rec->str) free(rec[i].str);
+  free(rec);
+}
+
+// Perform actual comparison
+static int compare_values(int flags, union sort_val *vx, union sort_val *vy)
+{
+  char *x, *y;
+
+  if (!key_string(flags)) return vx->ll<vy->ll ? -1 : vx->ll>vy->ll;
+
+  x = vx->str;
+  y = vy->str;
+  if (flags & FLAG_V) {
     while (*x && *y) {
       while (*x && *x == *y) x++, y++;
       if (isdigit(*x) && isdigit(*y)) {
@@ -225,77 +300,288 @@ static int compare_values(int flags, char *x, char *y)
         }
       }
     }
-    return *x ? !!*y : -1;
-  // This is actually an integer sort with decimals sorted by string fallback.
-  } else if (flags & FLAG_n) {
-    long long dx = atoll(x), dy = atoll(y);
-
-    return dx<dy ? -1 : dx>dy;
+    return *x ? 1 : -!!*y;
 
-  // Ascii sort
-  } else return ((flags&FLAG_f) ? strcasecmp : strcmp)(x, y);
+  // Ascii sort (-f already lowercased the key)
+  } else return strcmp(x, y);
 }
 
 // Callback from qsort(): Iterate through key_list and perform comparisons.
 static int compare_keys(const void *xarg, const void *yarg)
 {
-  int flags = toys.optflags, retval = 0;
-  char *x, *y, *xx = *(char **)xarg, *yy = *(char **)yarg;
+  int flags = toys.optflags, retval = 0, i;
+  union sort_val *x = *(union sort_val **)xarg, *y = *(union sort_val **)yarg;
   struct sort_key *key;
 
-  for (key=(void *)TT.key_list; !retval && key; key = key->next_key) {
+  for (i = 1, key = TT.key_list; key; key = key->next_key, i++) {
     flags = key->flags ? : toys.optflags;
+    if ((retval = compare_values(flags, x+i, y+i))) break;
+  }
 
-    // Chop out and modify key chunks, handling -dfib
+  // Perform fallback sort if necessary (always case insensitive, no -f,
+  // the point is to get a stable order even for -f sorts)
+  if (!retval && !FLAG(s)) {
+    flags = toys.optflags;
+    retval = strcmp(x->str, y->str);
+  }
 
-    x = get_key_data(xx, key, flags);
-    y = get_key_data(yy, key, flags);
+  return retval * ((flags&FLAG_r) ? -1 : 1);
+}
 
-    retval = compare_values(flags, x, y);
+// Write line to output, discarding it if -u and it matches the last one.
+static void sort_write(FILE *fp, union sort_val **last, union sort_val *rec)
+{
+  if (FLAG(u) && *last && !compare_keys(last, &rec)) free_rec(rec);
+  else {
+    fputs(rec->str, fp);
+    fputc('\n'*!FLAG(z), fp);
+    xferror(fp);
+    free_rec(*last);
+    *last = rec;
+  }
+}
+
+// Merge sorted a[0..mid) and a[mid..n) in place, ties from the left half
+// first, using tmp[mid] scratch space.
+static void merge_lines(union sort_val **a, union sort_val **tmp, long mid,
+  long n)
+{
+  long i, j, k;
 
-    // Free the copies get_key_data() made.
+  if (compare_keys(a+mid-1, a+mid)<=0) return;
+  memcpy(tmp, a, mid*sizeof(*a));
+  for (i = k = 0, j = mid; i<mid;)
+    a[k++] = (j==n || compare_keys(a+j, tmp+i)>=0) ? tmp[i++] : a[j++];
+}
 
-    if (x != xx) free(x);
-    if (y != yy) free(y);
+// Stable merge sort (qsort() isn't), so -s keeps input order and splitting
+// the work between threads doesn't change the output.
+static void sort_array(union sort_val **a, union sort_val **tmp, long n)
+{
+  union sort_val *swap;
+  long i, j;
 
-    if (retval) break;
+  if (n<8) {
+    for (i = 1; i<n; i++) for (j = i; j && compare_keys(a+j-1, a+j)>0; j--)
+      swap = a[j], a[j] = a[j-1], a[j-1] = swap;
+  } else {
+    sort_array(a, tmp, n/2);
+    sort_array(a+n/2, tmp, n-n/2);
+    merge_lines(a, tmp, n/2, n);
   }
+}
 
-  // Perform fallback sort if necessary (always case insensitive, no -f,
-  // the point is to get a stable order even for -f sorts)
-  if (!retval && !FLAG(s)) {
-    flags = toys.optflags;
-    retval = strcmp(xx, yy);
+struct sort_job {
+  union sort_val **a, **tmp;
+  long mid, n;
+  pthread_t thread;
+};
+
+static void *sort_job(void *arg)
+{
+  struct sort_job *job = arg;
+
+  if (!job->mid) sort_array(job->a, job->tmp, job->n);
+  else if (job->mid<job->n) merge_lines(job->a, job->tmp, job->mid, job->n);
+
+  return 0;
+}
+
+// Sort chunks of the array in threads, then merge pairs of neighboring
+// chunks in threads until there's one left.
+static void sort_threads(union sort_val **a, long n, int threads)
+{
+  struct sort_job *job = xzalloc(threads*sizeof(*job));
+  union sort_val **tmp = xmalloc(n*sizeof(*a));
+  long i, j;
+
+  for (i = 0; i<threads; i++) {
+    job[i].a = a+(j = n*i/threads);
+    job[i].tmp = tmp+j;
+    job[i].n = n*(i+1)/threads-j;
   }
+  for (;;) {
+    for (i = 0; i<threads; i++)
+      if (i == threads-1 || pthread_create(&job[i].thread, 0, sort_job, job+i))
+        sort_job(job+i), job[i].thread = 0;
+    for (i = 0; i<threads; i++)
+      if (job[i].thread) pthread_join(job[i].thread, 0);
+    if (threads == 1) break;
+
+    // Pair up results for next pass, an odd one out has nothing to merge
+    for (i = j = 0; i<threads; i += 2, j++) {
+      job[j] = job[i];
+      job[j].mid = job[i].n;
+      if (i+1<threads) job[j].n += job[i+1].n;
+    }
+    threads = j;
+  }
+  free(tmp);
+  free(job);
+}
 
-  return retval * ((flags&FLAG_r) ? -1 : 1);
+// Sort the lines in memory and write them out, emptying the array.
+static void sort_flush(FILE *fp)
+{
+  union sort_val *last = 0, **tmp;
+  long threads = FLAG(parallel) ? TT.parallel : sysconf(_SC_NPROCESSORS_ONLN);
+  unsigned i;
+
+  // Threads only pay off with enough lines for each to chew on
+  if (threads>TT.linecount/16384) threads = TT.linecount/16384;
+  if (threads>1) sort_threads(TT.lines, TT.linecount, threads);
+  else {
+    sort_array(TT.lines, tmp = xmalloc((TT.linecount/2+1)*sizeof(*tmp)),
+      TT.linecount);
+    free(tmp);
+  }
+  for (i = 0; i<TT.linecount; i++) sort_write(fp, &last, TT.lines[i]);
+  free_rec(last);
+  free(TT.lines);
+  TT.lines = 0;
+  TT.linecount = TT.used = 0;
+}
+
+// Anonymous temp file in -T or $TMPDIR
+static FILE *sort_tmp(void)
+{
+  char *s = xmprintf("%s/sort", TT.T ? : getenv("TMPDIR") ? : "/tmp"), *name;
+  int fd = xtempfile(s, &name);
+
+  unlink(name);
+  free(name);
+  free(s);
+
+  return xfdopen(fd, "w+");
+}
+
+// Finish writing a temp file and rewind it to read back
+static void sort_done(FILE *fp)
+{
+  fflush(fp);
+  xferror(fp);
+  rewind(fp);
+}
+
+static struct sort_run *add_run(FILE *fp)
+{
+  struct sort_run *run;
+
+  if (!(TT.nruns&15))
+    TT.runs = xrealloc(TT.runs, (TT.nruns+16)*sizeof(struct sort_run));
+  run = TT.runs+TT.nruns++;
+  run->fp = fp;
+  run->rec = 0;
+  run->level = 0;
+
+  return run;
+}
+
+// Read next line of a run into run->rec, closing it at EOF
+static int next_run(struct sort_run *run)
+{
+  char *s = xgetdelim(run->fp, '\n'*!FLAG(z));
+  long len;
+
+  run->rec = 0;
+  if (!s) fclose(run->fp);
+  else {
+    if (!FLAG(z) && (len = strlen(s)) && s[len-1]=='\n') s[--len] = 0;
+    run->rec = new_rec(s, strlen(s), 0);
+    free(s);
+  }
+
+  return !!s;
+}
+
+// Heap order, ties go to the earlier run so equal lines stay in input order
+static int run_less(struct sort_run *runs, int a, int b)
+{
+  int rc = compare_keys(&runs[a].rec, &runs[b].rec);
+
+  return rc ? rc<0 : a<b;
+}
+
+static void sift_runs(struct sort_run *runs, int *heap, int len, int i)
+{
+  int j, k;
+
+  while ((j = 2*i+1)<len) {
+    if (j+1<len && run_less(runs, heap[j+1], heap[j])) j++;
+    if (!run_less(runs, heap[j], heap[i])) break;
+    k = heap[i], heap[i] = heap[j], heap[j] = k;
+    i = j;
+  }
+}
+
+// Merge sorted runs to output, using a heap to find the next line.
+static void merge_runs(struct sort_run *runs, int count, FILE *fp)
+{
+  int *heap = xmalloc(count*sizeof(int)), i, len = 0;
+  union sort_val *last = 0;
+
+  for (i = 0; i<count; i++) if (next_run(runs+i)) heap[len++] = i;
+  for (i = len/2; i--;) sift_runs(runs, heap, len, i);
+  while (len) {
+    i = *heap;
+    sort_write(fp, &last, runs[i].rec);
+    if (!next_run(runs+i)) *heap = heap[--len];
+    sift_runs(runs, heap, len, 0);
+  }
+  free_rec(last);
+  free(heap);
+}
+
+// Out of memory budget: write sorted lines to a temp file. When there are
+// NMERGE runs of the same size merge them into one bigger run, so open
+// files and merge passes stay logarithmic in input size.
+static void sort_spill(void)
+{
+  struct sort_run *run = add_run(sort_tmp());
+  FILE *fp;
+
+  sort_flush(run->fp);
+  sort_done(run->fp);
+  while (TT.nruns>=NMERGE) {
+    run = TT.runs+TT.nruns-NMERGE;
+    if (run->level != run[NMERGE-1].level) break;
+    merge_runs(run, NMERGE, fp = sort_tmp());
+    sort_done(fp);
+    run->fp = fp;
+    run->level++;
+    TT.nruns -= NMERGE-1;
+  }
 }
 
 // Read each line from file, appending to a big array.
 static void sort_lines(char **pline, long len)
 {
+  union sort_val *rec;
   char *line;
 
   if (!pline) return;
   line = *pline;
   if (!FLAG(z) && len && line[len-1]=='\n') line[--len] = 0;
-  *pline = 0;
+
+  // Copy into a record with its keys (getdelim()'s slack gets reused).
+  rec = new_rec(line, len, &TT.used);
 
   // handle -c here so we don't allocate more memory than necessary.
   if (FLAG(C)||FLAG(c)) {
-    if (TT.lines && compare_keys((void *)&TT.lines, &line)>-FLAG(u)) {
+    if (TT.lines && compare_keys((void *)&TT.lines, &rec)>-FLAG(u)) {
       toys.exitval = 1;
       if (FLAG(C)) xexit();
       error_exit("%s: Check line %u", TT.name, TT.linecount+1);
     }
-    free(TT.lines);
-    TT.lines = (void *)line;
+    free_rec((void *)TT.lines);
+    TT.lines = (void *)rec;
   } else {
     if (!(TT.linecount&63))
-      TT.lines = xrealloc(TT.lines, sizeof(char *)*(TT.linecount+64));
-    TT.lines[TT.linecount] = line;
+      TT.lines = xrealloc(TT.lines, sizeof(*TT.lines)*(TT.linecount+64));
+    TT.lines[TT.linecount] = rec;
   }
   TT.linecount++;
+  if (!FLAG(C) && !FLAG(c) && TT.used>TT.size) sort_spill();
 }
 
 // Callback from loopfiles to handle input files.
@@ -305,9 +591,44 @@ static void sort_read(int fd, char *name)
   do_lines(fd, '\n'*!FLAG(z), sort_lines);
 }
 
+// Open -m inputs as runs to merge without reading them into memory. An input
+// that's also the -o output gets copied aside before it's truncated.
+static void sort_open(char **args)
+{
+  struct stat st1, st2;
+  int fd, same = TT.o && !stat(TT.o, &st1);
+  FILE *fp;
+
+  for (args = *args ? args : (char *[]){"-", 0}; *args; args++) {
+    if (-1 == (fd = openro(*args, O_RDONLY))) continue;
+    if (same && !fstat(fd, &st2) && same_file(&st1, &st2)) {
+      xsendfile(fd, fileno(fp = sort_tmp()));
+      close(fd);
+      rewind(fp);
+    } else fp = xfdopen(fd, "r");
+    add_run(fp);
+  }
+}
+
+// -S size defaults to kilobytes, with b for bytes and % of physical memory
+static long long sort_size(char *str)
+{
+  char *end;
+  long long val = xstrtol(str, &end, 10);
+
+  if (!*end) return val*1024;
+  if (*end=='%' && !end[1])
+    return val*sysconf(_SC_PHYS_PAGES)/100*sysconf(_SC_PAGESIZE);
+  if (tolower(*end)=='b' && !end[1]) return val;
+
+  return atolx(str);
+}
+
 void sort_main(void)
 {
-  int idx, jdx, fd = 1;
+  struct sort_key *key;
+  FILE *fp = stdout;
+  int idx;
 
   if (FLAG(u)) toys.optflags |= FLAG_s;
 
@@ -316,10 +637,10 @@ void sort_main(void)
     struct arg_list *arg;
 
     for (arg = TT.k; arg; arg = arg->next) {
-      struct sort_key *key = add_key();
       char *temp, *temp2, *optlist;
       int flag;
 
+      key = add_key();
       idx = 0;
       temp = arg->arg;
       while (*temp) {
@@ -336,8 +657,8 @@ void sort_main(void)
             break;
           }
 
-          // Which flag is this?
-          optlist = toys.which->options;
+          // Which flag is this? (Key flags are all after the last argument.)
+          optlist = strrchr(toys.which->options, ':')+1;
           temp2 = strchr(optlist, *temp);
           flag = 1<<(optlist-temp2+strlen(optlist)-1);
 
@@ -358,43 +679,38 @@ void sort_main(void)
 
   // If no keys, perform alphabetic sort over the whole line.
   if (!TT.key_list) add_key()->range[0] = 1;
+  for (key = TT.key_list; key; key = key->next_key, TT.nkeys++)
+    key->string = key_string(key->flags ? : toys.optflags);
+
+  TT.size = TT.S ? sort_size(TT.S)
+    : (long long)sysconf(_SC_PHYS_PAGES)/4*sysconf(_SC_PAGESIZE);
 
   // Open input files and read data, populating TT.lines[TT.linecount]
-  loopfiles(toys.optargs, sort_read);
+  // (spilling sorted runs to temp files when it doesn't fit), or for -m
+  // set up each input as a run.
+  if (FLAG(m) && !FLAG(C) && !FLAG(c)) sort_open(toys.optargs);
+  else loopfiles(toys.optargs, sort_read);
 
   // The compare (-c) logic was handled in sort_read(),
   // so if we got here, we're done.
   if (FLAG(C)||FLAG(c)) goto exit_now;
 
-  // Perform the actual sort
-  qsort(TT.lines, TT.linecount, sizeof(char *), compare_keys);
-
-  // handle unique (-u)
-  if (FLAG(u)) {
-    for (jdx=0, idx=1; idx<TT.linecount; idx++) {
-      if (!compare_keys(&TT.lines[jdx], &TT.lines[idx])) free(TT.lines[idx]);
-      else TT.lines[++jdx] = TT.lines[idx];
-    }
-    if (TT.linecount) TT.linecount = jdx+1;
-  }
-
   // Open output file if necessary. We can't do this until we've finished
   // reading in case the output file is one of the input files.
-  if (TT.o) fd = xcreate(TT.o, O_CREAT|O_TRUNC|O_WRONLY, 0666);
-
-  // Output result
-  for (idx = 0; idx<TT.linecount; idx++) {
-    char *s = TT.lines[idx];
-    unsigned i = strlen(s);
+  if (TT.o) fp = xfdopen(xcreate(TT.o, O_CREAT|O_TRUNC|O_WRONLY, 0666), "w");
 
-    if (!FLAG(z)) s[i] = '\n';
-    xwrite(fd, s, i+1);
-    if (CFG_TOYBOX_FREE) free(s);
+  // Sort what's in memory, or merge it with the runs it didn't fit in.
+  if (!TT.nruns) sort_flush(fp);
+  else {
+    if (TT.linecount) sort_spill();
+    merge_runs(TT.runs, TT.nruns, fp);
   }
+  if (fflush(fp) || ferror(fp)) perror_exit("%s", TT.o ? : "stdout");
 
 exit_now:
   if (CFG_TOYBOX_FREE) {
-    if (fd != 1) close(fd);
-    free(TT.lines);
+    if (fp != stdout) fclose(fp);
+    free_rec((void *)TT.lines);
+    free(TT.runs);
   }
 }
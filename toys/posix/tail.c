@@ -21,7 +21,7 @@ config TAIL
     -c	Output the last NUMBER bytes, +NUMBER counts from start
     -f	Follow FILE(s) by descriptor, waiting for more data to be appended
     -F	Follow FILE(s) by filename, waiting for more data, and retrying
-    -s	Used with -F, sleep SECONDS between retries (default 1)
+    -s	Used with -F, check unwatchable files every SECONDS (default 1)
 */
 
 #define FOR_tail
@@ -31,11 +31,11 @@ GLOBALS(
   long n, c;
   char *s;
 
-  int file_no, last_fd, ss;
+  int file_no, last_fd, ss, polls;
   struct xnotify *not;
   struct {
     char *path;
-    int fd;
+    int fd, poll;
     struct dev_ino di;
   } *F;
 )
@@ -131,53 +131,98 @@ static int try_lseek(int fd, long bytes, long lines)
   return 1;
 }
 
-// For -f and -F
-static void tail_continue()
+// Copy newly appended data to stdout
+static void tail_read(int fd, char *path)
+{
+  int len;
+
+  while ((len = read(fd, toybuf, sizeof(toybuf)))>0) {
+    if (TT.file_no>1 && TT.last_fd != fd) {
+      TT.last_fd = fd;
+      xprintf("\n==> %s <==\n", path);
+    }
+    xwrite(1, toybuf, len);
+  }
+}
+
+// For -F: poll file i (when its watches can't see changes, or may be gone)
+static void tail_poll(int i, int poll)
+{
+  TT.polls += poll-TT.F[i].poll;
+  TT.F[i].poll = poll;
+}
+
+// For -F: (re)watch file i, polling it if notification can't see changes
+static void tail_watch(int i)
+{
+  tail_poll(i, !xnotify_file(TT.not, i, TT.F[i].fd, TT.F[i].path));
+}
+
+// For -F: reopen file i if replaced, rewind if truncated, then copy new data
+static void tail_check(int i)
 {
   long long pos;
   char *path;
   struct stat sb;
-  int i = 0, fd, len;
-
-  for (i = 0; ; i++) {
-    if (FLAG(f)) fd = xnotify_wait(TT.not, &path);
-    else {
-      if (i == TT.file_no) {
-        i = 0;
-        msleep(TT.ss);
-      }
-      fd = TT.F[i].fd;
-      path = TT.F[i].path;
-
-      if (stat(TT.F[i].path, &sb)) {
-        if (fd >= 0) {
-          close(fd);
-          TT.F[i].fd = -1;
-          error_msg("file inaccessible: %s\n", TT.F[i].path);
-        }
-        continue;
-      }
+  int fd;
 
-      if (fd<0 || !same_dev_ino(&sb, &TT.F[i].di)) {
-        if (fd>=0) close(fd);
-        if (-1 == (TT.F[i].fd = fd = open(path, O_RDONLY))) continue;
-        error_msg("following new file: %s\n", path);
-        TT.F[i].di.dev = sb.st_dev;
-        TT.F[i].di.ino = sb.st_ino;
-      } else if (sb.st_size <= (pos = lseek(fd, 0, SEEK_CUR))) {
-        if (pos == sb.st_size) continue;
-        error_msg("file truncated: %s\n", path);
-        lseek(fd, 0, SEEK_SET);
-      }
+  // Notification lost events, check everything
+  if (i<0) {
+    for (i = 0; i<TT.file_no; i++) tail_check(i);
+
+    return;
+  }
+  fd = TT.F[i].fd;
+  path = TT.F[i].path;
+
+  if (stat(path, &sb)) {
+    if (fd >= 0) {
+      close(fd);
+      TT.F[i].fd = -1;
+      error_msg("file inaccessible: %s\n", path);
     }
+    tail_poll(i, 1);
 
-    while ((len = read(fd, toybuf, sizeof(toybuf)))>0) {
-      if (TT.file_no>1 && TT.last_fd != fd) {
-        TT.last_fd = fd;
-        xprintf("\n==> %s <==\n", path);
-      }
-      xwrite(1, toybuf, len);
+    return;
+  }
+
+  if (fd<0 || !same_dev_ino(&sb, &TT.F[i].di)) {
+    if (fd>=0) close(fd);
+    if (-1 == (TT.F[i].fd = fd = open(path, O_RDONLY)))
+      return tail_poll(i, 1);
+    error_msg("following new file: %s\n", path);
+    TT.F[i].di.dev = sb.st_dev;
+    TT.F[i].di.ino = sb.st_ino;
+    tail_watch(i);
+  } else if (sb.st_size <= (pos = lseek(fd, 0, SEEK_CUR))) {
+    if (pos == sb.st_size) return;
+    error_msg("file truncated: %s\n", path);
+    lseek(fd, 0, SEEK_SET);
+  }
+  tail_read(fd, path);
+}
+
+// For -f and -F
+static void tail_continue()
+{
+  long long next = 0, now;
+  char *path;
+  int i, fd;
+
+  if (FLAG(f)) for (;;) {
+    fd = xnotify_wait(TT.not, &path);
+    tail_read(fd, path);
+  }
+
+  // For -F, check files when notified, and poll the ones we can't watch
+  for (;;) {
+    if (TT.polls && (now = millitime())>=next) {
+      for (i = 0; i<TT.file_no; i++) if (TT.F[i].poll) tail_check(i);
+      next = now+TT.ss;
     }
+    if (!TT.polls) now = -1;
+    else if ((now = next-millitime())<0) now = 0;
+    xnotify_poll(TT.not, now, tail_check);
   }
 }
 
@@ -205,6 +250,7 @@ static void do_tail(int fd, char *name)
       }
       TT.F[TT.file_no].fd = fd;
       TT.F[TT.file_no].path = s;
+      tail_watch(TT.file_no);
     }
   }
 
@@ -297,7 +343,7 @@ void tail_main(void)
   }
 
   if (FLAG(F)) TT.F = xzalloc(toys.optc*sizeof(*TT.F));
-  else if (FLAG(f)) TT.not = xnotify_init(toys.optc);
+  if (FLAG(f) || FLAG(F)) TT.not = xnotify_init(toys.optc);
   TT.ss = TT.s ? xparsemillitime(TT.s) : 1000;
 
   loopfiles_rw(args,
@@ -70,16 +70,14 @@ GLOBALS(
   struct double_list *incl, *excl, *seen;
   struct string_list *dirs;
   char *cwd, **xfsed;
-  int fd, ouid, ggid, hlc, warn, sparselen, pid, xfpipe[2];
+  int fd, ouid, ggid, warn, sparselen, pid, xfpipe[2], zfd[4], zlen;
+  pthread_t zthread[2];
   struct dev_ino archive_di;
   long long *sparse;
   time_t mtt;
 
-  // hardlinks seen so far (hlc many)
-  struct {
-    char *arg;
-    struct dev_ino di;
-  } *hlx;
+  // hardlinks seen so far
+  struct hardlinks hlx;
 
   // Parsed information about a tar header.
   struct tar_header {
@@ -342,22 +340,11 @@ static int add_to_tar(struct dirtree *node)
   ITOO(hdr.mtime, st->st_mtime);
   strcpy(hdr.magic, "ustar  ");
 
-  // Are there hardlinks to a non-directory entry?
+  // Are there hardlinks to a non-directory entry? If we've seen this dev&ino
+  // before, store a link to the first name, else store as normal file.
   lnk = 0;
-  if ((st->st_nlink>1 || FLAG(h)) && !S_ISDIR(st->st_mode)) {
-    // Have we seen this dev&ino before?
-    for (i = 0; i<TT.hlc; i++) if (same_dev_ino(st, &TT.hlx[i].di)) break;
-    if (i != TT.hlc) lnk = TT.hlx[i].arg;
-    else {
-      // first time we've seen it. Store as normal file, but remember it.
-      if (!(TT.hlc&255))
-        TT.hlx = xrealloc(TT.hlx, sizeof(*TT.hlx)*(TT.hlc+256));
-      TT.hlx[TT.hlc].arg = xstrdup(hname);
-      TT.hlx[TT.hlc].di.ino = st->st_ino;
-      TT.hlx[TT.hlc].di.dev = st->st_dev;
-      TT.hlc++;
-    }
-  }
+  if ((st->st_nlink>1 || FLAG(h)) && !S_ISDIR(st->st_mode))
+    lnk = hardlink_seen(&TT.hlx, st, hname, FLAG(h));
 
   xfname = xform(&hname, 'r');
   strncpy(hdr.name, hname, sizeof(hdr.name));
@@ -1006,6 +993,51 @@ static char *get_archiver()
   return TT.I ? : FLAG(z)?"gzip" : FLAG(j)?"bzip2" : FLAG(Z)?"zstd" : "xz";
 }
 
+// Built-in gzip (lib/deflate.c) runs in a thread from zfd[0] to zfd[1]
+static void *tar_gzip(void *unused)
+{
+  if (FLAG(c)) gzip_fd(TT.zfd[0], TT.zfd[1], 6);
+  else gunzip_fd(TT.zfd[0], TT.zfd[1]);
+  close(TT.zfd[0]);
+  close(TT.zfd[1]);
+
+  return 0;
+}
+
+// Start gzip thread between fd and a pipe, returning our end of the pipe
+static int tar_thread(int fd)
+{
+  int pp[2];
+
+  xpipe(pp);
+  TT.zfd[0] = FLAG(c) ? pp[0] : fd;
+  TT.zfd[1] = FLAG(c) ? fd : pp[1];
+  if ((errno = pthread_create(TT.zthread, 0, tar_gzip, 0)))
+    perror_exit("pthread_create");
+
+  return pp[FLAG(c)];
+}
+
+// Autodetect couldn't seek back, so feed the decompressor (zfd[2]) the data
+// we already read (hdr) and then the rest of the input (zfd[3]).
+static void *tar_feed(void *hdr)
+{
+  xwrite(TT.zfd[2], hdr, TT.zlen);
+  free(hdr);
+  xsendfile(TT.zfd[3], TT.zfd[2]);
+  close(TT.zfd[2]);
+  close(TT.zfd[3]);
+
+  return 0;
+}
+
+// Wait for in-process filter(s) to finish
+static void tar_join(void)
+{
+  if (TT.zthread[1]) pthread_join(TT.zthread[1], 0);
+  if (TT.zthread[0]) pthread_join(TT.zthread[0], 0);
+}
+
 void tar_main(void)
 {
   char *s, **xfsed, **args = toys.optargs;
@@ -1066,14 +1098,10 @@ void tar_main(void)
     free(xfsed);
   }
 
-  // nommu reentry for nonseekable input skips this, parent did it for us
-  if (toys.stacktop) {
-    if (TT.f && strcmp(TT.f, "-"))
-      TT.fd = xcreate(TT.f, TT.fd*(O_WRONLY|O_CREAT|O_TRUNC),
-                      0666&~toys.old_umask);
-    // Get destination directory
-    if (TT.C) xchdir(TT.C);
-  }
+  if (TT.f && strcmp(TT.f, "-"))
+    TT.fd = xcreate(TT.f, TT.fd*(O_WRONLY|O_CREAT|O_TRUNC),
+                    0666&~toys.old_umask);
+  if (TT.C) xchdir(TT.C);
 
   // Get destination directory
   TT.cwd = xabspath(s = xgetcwd(), ABS_PATH);
@@ -1110,48 +1138,40 @@ void tar_main(void)
     }
 
     if (FLAG(j)||FLAG(z)||FLAG(I)||FLAG(J)||FLAG(Z)) {
-      int pipefd[2] = {hdr ? -1 : TT.fd, -1}, i, pid;
-      struct string_list *zcat = FLAG(I) ? 0 : find_in_path(getenv("PATH"),
-        FLAG(z)?"zcat" : FLAG(j)?"bzcat" : FLAG(Z)?"zstdcat" : "xzcat");
-
-      // Toybox provides more decompressors than compressors, so try them first
-      TT.pid = xpopen_both(zcat ? (char *[]){zcat->str, 0} :
-        (char *[]){get_archiver(), "-d", 0}, pipefd);
-      if (CFG_TOYBOX_FREE) llist_traverse(zcat, free);
-
-      if (!hdr) {
-        // If we could seek, child gzip inherited fd and we read its output
-        close(TT.fd);
-        TT.fd = pipefd[1];
+      int pipefd[2] = {hdr ? -1 : TT.fd, -1};
 
+      // gzip is built in, so decompress it in a thread without fork/exec
+      if (FLAG(z) && !FLAG(I)) {
+        if (hdr) {
+          xpipe(pipefd);
+          TT.zfd[2] = pipefd[1];
+        }
+        pipefd[1] = tar_thread(*pipefd);
       } else {
+        char *zcat = FLAG(I) ? 0 : FLAG(j)?"bzcat" : FLAG(Z)?"zstdcat":"xzcat";
+        struct string_list *sl = 0;
+
+        // Toybox provides more decompressors than compressors, so try them
+        // first. A builtin one runs in the forked child without exec.
+        if (zcat && !(CFG_TOYBOX && !CFG_TOYBOX_NORECURSE && toy_find(zcat)))
+          zcat = (sl = find_in_path(getenv("PATH"), zcat)) ? sl->str : 0;
+        TT.pid = xpopen_both(zcat ? (char *[]){zcat, 0} :
+          (char *[]){get_archiver(), "-d", 0}, pipefd);
+        if (CFG_TOYBOX_FREE) llist_traverse(sl, free);
+        if (hdr) TT.zfd[2] = *pipefd;
+        else close(TT.fd);
+      }
 
-        // If we autodetected type but then couldn't lseek to put the data back
-        // we have to loop reading data from TT.fd and pass it to gzip ourselves
-        // (starting with the block of data we read to autodetect).
-
-        // dirty trick: move gzip input pipe to stdin so child closes spare copy
-        dup2(pipefd[0], 0);
-        if (pipefd[0]) close(pipefd[0]);
-
-        // Fork a copy of ourselves to handle extraction (reads from zip output
-        // pipe, writes to stdout).
-        pipefd[0] = pipefd[1];
-        pipefd[1] = 1;
-        pid = xpopen_both(0, pipefd);
-        close(pipefd[1]);
-
-        // loop writing collated data to zip proc
-        xwrite(0, hdr, len);
-        for (;;) {
-          if ((i = read(TT.fd, toybuf, sizeof(toybuf)))<1) {
-            close(0);
-            xwaitpid(pid);
-            return;
-          }
-          xwrite(0, toybuf, i);
-        }
+      // If we autodetected type but then couldn't lseek to put the data back,
+      // a thread passes the decompressor the block we read plus the rest.
+      if (hdr) {
+        TT.zfd[3] = TT.fd;
+        TT.zlen = len;
+        if ((errno = pthread_create(TT.zthread+1, 0, tar_feed,
+          xmemdup(hdr, len)))) perror_exit("pthread_create");
+        hdr = 0;
       }
+      TT.fd = pipefd[1];
     }
 
     unpack_tar(hdr);
@@ -1187,7 +1207,8 @@ void tar_main(void)
         if (strend(TT.f, tbz[len])) toys.optflags |= FLAG_j;
     }
 
-    if (FLAG(j)||FLAG(z)||FLAG(I)||FLAG(J)||FLAG(Z)) {
+    if (FLAG(z) && !FLAG(I)) TT.fd = tar_thread(TT.fd);
+    else if (FLAG(j)||FLAG(I)||FLAG(J)||FLAG(Z)) {
       int pipefd[2] = {-1, TT.fd};
 
       TT.pid = xpopen_both((char *[]){get_archiver(), 0}, pipefd);
@@ -1204,6 +1225,7 @@ void tar_main(void)
     writeall(TT.fd, toybuf, 1024);
     close(TT.fd);
   }
+  tar_join();
   if (TT.pid) {
     TT.pid = xpclose_both(TT.pid, 0);
     if (TT.pid) toys.exitval = TT.pid;
@@ -1213,8 +1235,7 @@ void tar_main(void)
   if (CFG_TOYBOX_FREE) {
     llist_traverse(TT.excl, llist_free_double);
     llist_traverse(TT.incl, llist_free_double);
-    while(TT.hlc) free(TT.hlx[--TT.hlc].arg);
-    free(TT.hlx);
+    hardlink_free(&TT.hlx);
     free(TT.cwd);
     close(TT.fd);
   }
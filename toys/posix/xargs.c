@@ -9,7 +9,7 @@
  * TODO: -L	Max number of lines of input per command
  * TODO: -x	Exit if can't fit everything in one command
 
-USE_XARGS(NEWTOY(xargs, "^(process-slot-var):a:E:P#<0(null)=1optr(no-run-if-empty)n#<1(max-args)s#0[!0E]", TOYFLAG_USR|TOYFLAG_BIN))
+USE_XARGS(NEWTOY(xargs, "^(group)(jobserver)(load)#<1(memfree):(process-slot-var):a:E:P#<0(null)=1optr(no-run-if-empty)n#<1(max-args)s#0[!0E]", TOYFLAG_USR|TOYFLAG_BIN))
 
 config XARGS
   bool "xargs"
@@ -32,6 +32,11 @@ config XARGS
     -s	Size in bytes per command line
     -t	Trace, print command line to stderr
 
+    --group	Buffer each command's output, print it all when command exits
+    --jobserver	Share CPUs with make: take tokens from the MAKEFLAGS jobserver,
+    		or (with -P) provide one to child make/xargs
+    --load=N	Don't start more commands while N processes are runnable
+    --memfree=SIZE	Don't start more commands while less memory available
     --process-slot-var NAME	Set environment variable NAME in children
 */
 
@@ -40,14 +45,22 @@ config XARGS
 
 GLOBALS(
   long s, n, P;
-  char *E, *a, *process_slot_var;
+  char *E, *a, *process_slot_var, *memfree;
+  long load;
 
-  long entries, bytes, np;
+  long entries, bytes, np, slots, mem;
   char delim;
   FILE *tty;
-  pid_t *pids;
+  struct xargs_job *jobs;
+  int jr, jw, tokens;
 )
 
+// Running command and its --group output files
+struct xargs_job {
+  pid_t pid;
+  int out, err;
+};
+
 // If !entry count TT.bytes and TT.entries, stopping at max.
 // Otherwise, fill out entry[].
 
@@ -104,16 +117,30 @@ static void signal_P(int sig)
 
 static void waitchild(int options)
 {
+  struct xargs_job *job;
   int pid, i, status;
 
   if ((pid = waitpid(-1, &status, options)) <= 0) return;
 
   TT.np--;
-  for (i = 0; i < TT.P; ++i) {
-    if (TT.pids[i] == pid) {
-      TT.pids[i] = 0;
-      break;
+  for (i = 0; i<TT.slots; i++) {
+    if ((job = TT.jobs+i)->pid != pid) continue;
+    job->pid = 0;
+    if (FLAG(group)) {
+      lseek(job->out, 0, SEEK_SET);
+      lseek(job->err, 0, SEEK_SET);
+      xsendfile(job->out, 1);
+      xsendfile(job->err, 2);
+      close(job->out);
+      close(job->err);
     }
+    break;
+  }
+
+  // Return jobserver token (the first command runs without one)
+  if (TT.tokens && TT.tokens>=TT.np) {
+    TT.tokens--;
+    if (write(TT.jw, "+", 1) != 1) perror_msg("jobserver");
   }
 
   i = WIFEXITED(status) ? WEXITSTATUS(status) : WTERMSIG(status)+128;
@@ -125,16 +152,114 @@ static void waitchild(int options)
   else if (i) toys.exitval = 123;
 }
 
+// Unlinked temp file for --group output
+static int xargs_tmp(void)
+{
+  char *s = xmprintf("%s/xargs", getenv("TMPDIR") ? : "/tmp"), *name;
+  int fd = xtempfile(s, &name);
+
+  unlink(name);
+  free(name);
+  free(s);
+  fcntl(fd, F_SETFD, FD_CLOEXEC);
+
+  return fd;
+}
+
+// Use make's jobserver from MAKEFLAGS (fifo:PATH or inherited R,W pipe fds)
+// or else start one with -P tokens our children's make/xargs can share.
+// Read tokens from our own nonblocking open() of the pipe so we can keep
+// reaping children while waiting, without changing flags make sees.
+static void jobserver(void)
+{
+  char *mf = getenv("MAKEFLAGS"), *s;
+  int fds[2], i;
+
+  if (mf && (s = strafter(mf, "--jobserver-auth=") ? :
+                 strafter(mf, "--jobserver-fds="))) {
+    if (strstart(&s, "fifo:")) {
+      s = xstrndup(s, strcspn(s, " "));
+      TT.jw = TT.jr = open(s, O_RDWR|O_NONBLOCK|O_CLOEXEC);
+      free(s);
+    } else if (2==sscanf(s, "%d,%d", fds, fds+1) && fcntl(fds[1], F_GETFD)>=0) {
+      sprintf(toybuf, "/proc/self/fd/%d", *fds);
+      TT.jr = open(toybuf, O_RDONLY|O_NONBLOCK|O_CLOEXEC);
+      TT.jw = fds[1];
+    }
+    // make only passes the fds to recipes marked with + (or using $(MAKE)),
+    // so warn and fall back to -P like make -j1 does
+    if (TT.jr == -1) {
+      error_msg("jobserver unavailable (add '+' to make rule)");
+      toys.exitval = 0;
+    // -P caps us below the jobserver limit, but default is jobserver's limit
+    } else if (!FLAG(P)) TT.P = 0;
+  } else if (TT.P>1) {
+    xpipe(fds);
+    for (i = 1; i<TT.P; i++) xwrite(fds[1], "+", 1);
+    xsetenv(xmprintf("MAKEFLAGS=%s -j%ld --jobserver-auth=%d,%d", mf ? : "",
+      TT.P, *fds, fds[1]), 0);
+    sprintf(toybuf, "/proc/self/fd/%d", *fds);
+    if (-1 == (TT.jr = open(toybuf, O_RDONLY|O_NONBLOCK|O_CLOEXEC)))
+      perror_exit("jobserver");
+    TT.jw = fds[1];
+  }
+}
+
+// Is the system too busy to start another command? (--load, --memfree)
+static int overloaded(void)
+{
+  char *s;
+
+  // 4th field of loadavg is runnable/total processes (including us)
+  if (TT.load && readfile("/proc/loadavg", toybuf, sizeof(toybuf))
+      && (s = strchr(toybuf, '/')))
+  {
+    while (s>toybuf && s[-1] != ' ') s--;
+    if (atol(s)-1 >= TT.load) return 1;
+  }
+  if (TT.mem && readfile("/proc/meminfo", toybuf, sizeof(toybuf))
+      && (s = strafter(toybuf, "MemAvailable:")) && atol(s)*1024LL<TT.mem)
+    return 1;
+
+  return 0;
+}
+
+// Wait until we can start another command: holding a jobserver token for
+// each running command past the first and not overloaded. Always allows one.
+static void throttle(void)
+{
+  struct pollfd pfd = {.fd = TT.jr, .events = POLLIN};
+  char c;
+
+  while (TT.np) {
+    if (TT.jr == -1 || TT.tokens>=TT.np) {
+      if (!overloaded()) break;
+    } else if (read(TT.jr, &c, 1) == 1) {
+      TT.tokens++;
+
+      continue;
+    }
+
+    // Check for exited children at least 4 times a second
+    poll(&pfd, TT.jr != -1 && TT.tokens<TT.np, 250);
+    waitchild(WNOHANG);
+  }
+}
+
 void xargs_main(void)
 {
   struct double_list *dlist = 0, *dtemp;
   int entries, bytes, slot, done = 0;
+  struct xargs_job *job;
   char *data = 0, **out = 0;
   pid_t pid = 0;
   FILE *args_fp = TT.a ? xfopen(TT.a, "re") : stdin;
 
   xsignal_flags(SIGUSR1, signal_P, SA_RESTART);
   xsignal_flags(SIGUSR2, signal_P, SA_RESTART);
+  TT.jr = TT.jw = -1;
+  if (TT.memfree) TT.mem = atolx(TT.memfree);
+  if (FLAG(jobserver)) jobserver();
 
   // POSIX requires that we never hit the ARG_MAX limit, even if we try to
   // with -s. POSIX also says we have to reserve 2048 bytes "to guarantee
@@ -157,13 +282,12 @@ void xargs_main(void)
     bytes += strlen(toys.optargs[entries])+1+sizeof(char *)*!FLAG(s);
   if (bytes >= TT.s) error_exit("command too long");
 
-  if (TT.P) TT.pids = xzalloc(sizeof(pid_t) * TT.P);
-
   // Loop through exec chunks.
   while (data || !done) {
     TT.entries = 0;
     TT.bytes = bytes;
-    if (TT.np) waitchild(WNOHANG*!(TT.np==TT.P||(!data && done)));
+    if (TT.np) waitchild(WNOHANG);
+    while (TT.P && TT.np>=TT.P) waitchild(0);
     if (toys.exitval==124) break;
 
     // Arbitrary number of execs, can't just leak memory each time...
@@ -219,17 +343,32 @@ void xargs_main(void)
       } else fprintf(stderr, "\n");
     }
 
+    throttle();
+    if (toys.exitval==124) break;
+
+    // Slots grow as needed (SIGUSR1 can raise -P, and -P 0 is unlimited)
     TT.np++;
-    for (slot = 0; slot < TT.P && TT.pids[slot]; ++slot);
+    for (slot = 0; slot<TT.slots && TT.jobs[slot].pid; slot++);
+    if (slot == TT.slots)
+      TT.jobs = xrealloc(TT.jobs, ++TT.slots*sizeof(struct xargs_job));
+    job = TT.jobs+slot;
+    if (FLAG(group)) {
+      job->out = xargs_tmp();
+      job->err = xargs_tmp();
+    }
 
     if (!(pid = XVFORK())) {
       if (!TT.a) close(0);
       if (TT.process_slot_var)
         xsetenv(xmprintf("%s=%d", TT.process_slot_var, slot), 0);
       xopen_stdio(FLAG(o) ? "/dev/tty" : "/dev/null", O_RDONLY|O_CLOEXEC);
+      if (FLAG(group)) {
+        dup2(job->out, 1);
+        dup2(job->err, 2);
+      }
       xexec(out);
     }
-    if (TT.pids) TT.pids[slot] = pid;
+    job->pid = pid;
   }
   while (TT.np) waitchild(0);
   if (TT.tty) fclose(TT.tty);